@@ -78,15 +78,12 @@ int main() {
 
   // Main adaptivity loop
   int adapt_iterations = 1;
-  double elem_errors[MAX_ELEM_NUM];      // This array decides what 
-                                         // elements will be refined.
-  ElemPtr2 ref_elem_pairs[MAX_ELEM_NUM]; // To store element pairs from the 
-                                         // FTR solution. Decides how 
-                                         // elements will be hp-refined. 
-  for (int i=0; i < MAX_ELEM_NUM; i++) {
-    ref_elem_pairs[i][0] = new Element();
-    ref_elem_pairs[i][1] = new Element();
-  }
+  double *elem_errors = NULL;      // This array decides what
+                                   // elements will be refined.
+  ElemPtr2 *ref_elem_pairs = NULL; // To store element pairs from the
+                                   // FTR solution. Decides how
+                                   // elements will be hp-refined.
+  int n_pairs = 0;                 // Length of both arrays.
   while(1) {
     printf("============ Adaptivity step %d ============\n", adapt_iterations); 
 
@@ -100,6 +97,21 @@ int main() {
     // solution and the coarse mesh solution, and store the
     // error in the elem_errors[] array.
     int n_elem = mesh->get_n_active_elem();
+    if (n_elem > n_pairs) {
+      // the number of elements only grows during adaptivity
+      ElemPtr2 *pairs_new = new ElemPtr2[n_elem];
+      for (int i=0; i < n_elem; i++) {
+        for (int j=0; j < 2; j++) {
+          if (i < n_pairs) pairs_new[i][j] = ref_elem_pairs[i][j];
+          else pairs_new[i][j] = new Element();
+        }
+      }
+      delete [] ref_elem_pairs;
+      ref_elem_pairs = pairs_new;
+      delete [] elem_errors;
+      elem_errors = new double[n_elem];
+      n_pairs = n_elem;
+    }
     for (int i=0; i < n_elem; i++) {
 
       printf("=== Starting FTR of Elem [%d]\n", i);
@@ -126,9 +138,9 @@ int main() {
       // and FTR solutions.
       // NOTE: later we want to look at the difference in some quantity 
       // of interest rather than error in global norm.
-      double err_est_array[MAX_ELEM_NUM];
+      std::vector<double> err_est_array(n_elem);
       elem_errors[i] = calc_error_estimate(NORM, mesh, mesh_ref_local, 
-                       err_est_array);
+                       &err_est_array[0]);
       printf("Elem [%d]: absolute error (est) = %g\n", i, elem_errors[i]);
 
       // Copy the reference element pair for element 'i'
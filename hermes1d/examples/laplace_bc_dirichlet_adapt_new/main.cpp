@@ -85,15 +85,12 @@ int main() {
 
   // Main adaptivity loop
   int adapt_iterations = 1;
-  double ftr_errors[MAX_ELEM_NUM];      // This array decides what 
-                                         // elements will be refined.
-  ElemPtr2 ref_ftr_pairs[MAX_ELEM_NUM]; // To store element pairs from the 
-                                         // FTR solution. Decides how 
-                                         // elements will be hp-refined. 
-  for (int i=0; i < MAX_ELEM_NUM; i++) {
-    ref_ftr_pairs[i][0] = new Element();
-    ref_ftr_pairs[i][1] = new Element();
-  }
+  double *ftr_errors = NULL;      // This array decides what
+                                  // elements will be refined.
+  ElemPtr2 *ref_ftr_pairs = NULL; // To store element pairs from the
+                                  // FTR solution. Decides how
+                                  // elements will be hp-refined.
+  int n_pairs = 0;                // Length of both arrays.
   while(1) {
     printf("============ Adaptivity step %d ============\n", adapt_iterations); 
 
@@ -107,6 +104,21 @@ int main() {
     // solution and the coarse mesh solution, and store the
     // error in the ftr_errors[] array.
     int n_elem = mesh->get_n_active_elem();
+    if (n_elem > n_pairs) {
+      // the number of elements only grows during adaptivity
+      ElemPtr2 *pairs_new = new ElemPtr2[n_elem];
+      for (int i=0; i < n_elem; i++) {
+        for (int j=0; j < 2; j++) {
+          if (i < n_pairs) pairs_new[i][j] = ref_ftr_pairs[i][j];
+          else pairs_new[i][j] = new Element();
+        }
+      }
+      delete [] ref_ftr_pairs;
+      ref_ftr_pairs = pairs_new;
+      delete [] ftr_errors;
+      ftr_errors = new double[n_elem];
+      n_pairs = n_elem;
+    }
     for (int i=0; i < n_elem; i++) {
 
       printf("=== Starting FTR of Elem [%d]\n", i);
@@ -133,9 +145,9 @@ int main() {
       // and FTR solutions.
       // NOTE: later we want to look at the difference in some quantity 
       // of interest rather than error in global norm.
-      double err_est_array[MAX_ELEM_NUM];
+      std::vector<double> err_est_array(n_elem);
       ftr_errors[i] = calc_error_estimate(NORM, mesh, mesh_ref_local, 
-                      err_est_array);
+                      &err_est_array[0]);
       //printf("Elem [%d]: absolute error (est) = %g\n", i, ftr_errors[i]);
 
       // Copy the reference element pair for element 'i'
@@ -105,9 +105,9 @@ int main() {
 
     // In the next step, estimate element errors based on 
     // the difference between the fine mesh and coarse mesh solutions. 
-    double err_est_array[MAX_ELEM_NUM]; 
+    std::vector<double> err_est_array(mesh->get_n_active_elem());
     double err_est_total = calc_error_estimate(NORM, 
-              mesh, mesh_ref, err_est_array);
+              mesh, mesh_ref, &err_est_array[0]);
 
     // Calculate the norm of the fine mesh solution
     double ref_sol_norm = calc_solution_norm(NORM, mesh_ref);
@@ -147,7 +147,7 @@ int main() {
     // coarse and fine mesh solutions on them, respectively. 
     // The coefficient vectors and numbers of degrees of freedom 
     // on both meshes are also updated. 
-    adapt(NORM, ADAPT_TYPE, THRESHOLD, err_est_array,
+    adapt(NORM, ADAPT_TYPE, THRESHOLD, &err_est_array[0],
           mesh, mesh_ref);
 
     adapt_iterations++;
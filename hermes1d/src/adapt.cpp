@@ -9,6 +9,9 @@
 #include "linearizer.h"
 #include "adapt.h"
 
+#include <map>
+#include <vector>
+
 // This is great help to debug automatic adaptivity. Generated are 
 // Gnuplot files for all refinement candidates, showing both the 
 // reference solution and the projection. Thus one can visually 
@@ -160,10 +163,14 @@ double calc_elem_est_error_squared_hp(int norm, Element *e,
   return err_squared;
 }
 
+// The element pairs are collected by a simultaneous traversal of 
+// 'mesh' and 'mesh_ref' first, then the element errors are 
+// calculated in parallel.
 double calc_error_estimate(int norm, Mesh* mesh, Mesh* mesh_ref,
 			   double *err_array, int sln)
 {
-  double err_total_squared = 0;
+  int n_elem = mesh->get_n_active_elem();
+  std::vector<Element*> elems(n_elem), refs_left(n_elem), refs_right(n_elem);
   Iterator *I = new Iterator(mesh);
   Iterator *I_ref = new Iterator(mesh_ref);
 
@@ -172,38 +179,52 @@ double calc_error_estimate(int norm, Mesh* mesh, Mesh* mesh_ref,
   int counter = 0;
   while ((e = I->next_active_element()) != NULL) {
     Element *e_ref = I_ref->next_active_element();
+    elems[counter] = e;
+    refs_left[counter] = e_ref;
+    // element 'e' was refined in space for reference solution
+    if (e->level != e_ref->level) refs_right[counter] = I_ref->next_active_element();
+    else refs_right[counter] = NULL;
+    counter++;
+  }
+  delete I;
+  delete I_ref;
+
+  double err_total_squared = 0;
+#pragma omp parallel for schedule(dynamic, 64) reduction(+:err_total_squared)
+  for (int i=0; i < counter; i++) {
     double err_squared;
-    if (e->level == e_ref->level) { // element 'e' was not refined in space
-                                    // for reference solution
-      err_squared = calc_elem_est_error_squared_p(norm, e, e_ref, sln);
+    if (refs_right[i] == NULL) { // element 'e' was not refined in space
+                                 // for reference solution
+      err_squared = calc_elem_est_error_squared_p(norm, elems[i], 
+                                                  refs_left[i], sln);
     }
     else { // element 'e' was refined in space for reference solution
-      Element* e_ref_left = e_ref;
-      Element* e_ref_right = I_ref->next_active_element();
-      err_squared = calc_elem_est_error_squared_hp(norm, e, 
-                    e_ref_left, e_ref_right, sln);
+      err_squared = calc_elem_est_error_squared_hp(norm, elems[i], 
+                    refs_left[i], refs_right[i], sln);
     }
-    err_array[e->id] = err_squared;
+    err_array[elems[i]->id] = sqrt(err_squared);
     err_total_squared += err_squared;
-    counter++;
   }
 
-  for (int i=0; i < counter; i++) {
-    err_array[i] = sqrt(err_array[i]);
-  }
   return sqrt(err_total_squared);
 }
 
 double calc_error_estimate(int norm, Mesh* mesh, 
                            ElemPtr2* ref_element_pairs)
 {
-  double err_total_squared = 0;
+  int n_elem = mesh->get_n_active_elem();
+  std::vector<Element*> elems(n_elem);
   Iterator *I = new Iterator(mesh);
-
-  // simultaneous traversal of 'mesh' and 'ref_element_pairs' 
-  Element *e;
+  Element *e_next;
   int counter = 0;
-  while ((e = I->next_active_element()) != NULL) {
+  while ((e_next = I->next_active_element()) != NULL) elems[counter++] = e_next;
+  delete I;
+
+  // traversal of 'mesh' and 'ref_element_pairs' 
+  double err_total_squared = 0;
+#pragma omp parallel for schedule(dynamic, 64) reduction(+:err_total_squared)
+  for (int i=0; i < counter; i++) {
+    Element *e = elems[i];
     double err_squared;
     // element 'e' was not refined in space for reference solution
     if (e->level == ref_element_pairs[e->id][0]->level) {
@@ -218,7 +239,6 @@ double calc_error_estimate(int norm, Mesh* mesh,
                     e_ref_left, e_ref_right);
     }
     err_total_squared += err_squared;
-    counter++;
   }
 
   return sqrt(err_total_squared);
@@ -276,7 +296,7 @@ int int_cmp(const void *a, const void *b)
 // err_squared_array[] will be sorted. 
 void sort_element_errors(int n, double *err_squared_array, int *id_array) 
 {
-    double array[MAX_ELEM_NUM][2];
+    double (*array)[2] = new double[n][2];
     for (int i=0; i<n; i++) {
       array[i][0] = err_squared_array[i];
       array[i][1] = id_array[i];
@@ -288,6 +308,7 @@ void sort_element_errors(int n, double *err_squared_array, int *id_array)
       err_squared_array[i] = array[i][0];
       id_array[i] = (int) array[i][1];
     }
+    delete [] array;
 }
 
 // Calculate the projection coefficients for every 
@@ -319,7 +340,7 @@ double** get_proj_matrix_H1(int n_eq, int fns_num, int pts_num,
                             double phys_weights[MAX_QUAD_PTS_NUM]) 
 { 
   // allocate
-  double** matrix = _new_matrix<double>(MAX_P+1, MAX_P+1);
+  double** matrix = _new_matrix<double>(fns_num, fns_num);
 
   // fill
   for (int i=0; i<fns_num; i++) {
@@ -356,33 +377,106 @@ void fill_proj_rhs_H1(int fns_num, int pts_num,
   }
 }
 
+// LU factorizations of H1 projection matrices. A projection matrix
+// only depends on the number of Legendre polynomials, the quadrature
+// order(s) and the interval length(s), so it is shared by all elements 
+// and candidates of the same size. The cache is shared by all threads.
+struct ProjMatrixKey {
+  int fns_num, order_left, order_right;
+  double h[3];
+  bool operator<(const ProjMatrixKey &k) const {
+    if (fns_num != k.fns_num) return fns_num < k.fns_num;
+    if (order_left != k.order_left) return order_left < k.order_left;
+    if (order_right != k.order_right) return order_right < k.order_right;
+    for (int i=0; i < 3; i++) 
+      if (h[i] != k.h[i]) return h[i] < k.h[i];
+    return false;
+  }
+};
+
+class ProjMatrixCache {
+public:
+  ~ProjMatrixCache() {
+    std::map<ProjMatrixKey, ProjMatrixLU>::iterator it;
+    for (it = this->lu.begin(); it != this->lu.end(); it++) {
+      delete [] it->second.matrix;
+      delete [] it->second.indx;
+    }
+  }
+  // Looks up the factorization for 'key'.
+  bool find(const ProjMatrixKey &key, double** &matrix, int* &indx) {
+    bool found = false;
+#pragma omp critical (proj_matrix_cache)
+    {
+      std::map<ProjMatrixKey, ProjMatrixLU>::iterator it = this->lu.find(key);
+      if (it != this->lu.end()) {
+        matrix = it->second.matrix;
+        indx = it->second.indx;
+        found = true;
+      }
+    }
+    return found;
+  }
+  // Stores a factorization. Returns false (and the caller keeps the 
+  // ownership of the arrays) if the key is already present or if
+  // the cache is full.
+  bool insert(const ProjMatrixKey &key, double** matrix, int* indx) {
+    bool inserted = false;
+#pragma omp critical (proj_matrix_cache)
+    {
+      if (this->lu.size() < MAX_SIZE && this->lu.find(key) == this->lu.end()) {
+        ProjMatrixLU entry = {matrix, indx};
+        this->lu[key] = entry;
+        inserted = true;
+      }
+    }
+    return inserted;
+  }
+
+private:
+  static const unsigned MAX_SIZE = 4096;
+  struct ProjMatrixLU {
+    double **matrix;
+    int *indx;
+  };
+  std::map<ProjMatrixKey, ProjMatrixLU> lu;
+};
+
+static ProjMatrixCache proj_matrix_cache;
+
 // Calculate the projection coefficients for every 
 // transformed Legendre polynomial and every solution 
 // component. The basis are the transformed Legendre 
-// which are NOT orthonormal in H1 (norm == 1)
+// which are NOT orthonormal in H1 (norm == 1). 'order' 
+// and 'h' are the quadrature order and the length of 
+// the interval that 'pol_val', 'pol_der' and 'phys_weights'
+// belong to.
 void calc_proj_coeffs_H1(int n_eq, int fns_num, int pts_num,
                          double phys_u_ref[MAX_EQN_NUM][MAX_QUAD_PTS_NUM], 
                          double phys_dudx_ref[MAX_EQN_NUM][MAX_QUAD_PTS_NUM],
                          double pol_val[MAX_QUAD_PTS_NUM][MAX_P+1],
                          double pol_der[MAX_QUAD_PTS_NUM][MAX_P+1],
                          double phys_weights[MAX_QUAD_PTS_NUM], 
+                         int order, double h,
                          double proj_coeffs[MAX_EQN_NUM][MAX_P+1])
 { 
-  // allocate and fill projection matrix
-  double** matrix = get_proj_matrix_H1(n_eq, fns_num, pts_num,
-                                       pol_val, pol_der, 
-                                       phys_weights); 
-
-  // replace matrix with its LU decomposition
-  // permutations caused by partial pivoting are 
-  // recorded in the vector indx
-  int *indx = new int[MAX_P+1];
-  double d;
-  ludcmp(matrix, fns_num, indx, &d);
-
-  // allocate projection rhs vector
-  double *rhs = new double[MAX_P+1];
+  // LU decomposition of the projection matrix, permutations caused 
+  // by partial pivoting are recorded in the vector indx
+  ProjMatrixKey key = {fns_num, order, -1, {h, 0, 0}};
+  double** matrix;
+  int *indx;
+  bool cached = proj_matrix_cache.find(key, matrix, indx);
+  if (!cached) {
+    matrix = get_proj_matrix_H1(n_eq, fns_num, pts_num,
+                                pol_val, pol_der, 
+                                phys_weights); 
+    indx = new int[fns_num];
+    double d;
+    ludcmp(matrix, fns_num, indx, &d);
+    cached = proj_matrix_cache.insert(key, matrix, indx);
+  }
 
+  double rhs[MAX_P+1];
   for(int c=0; c<n_eq; c++) {          // loop over solution components 
     // fill projection rhs
     fill_proj_rhs_H1(fns_num, pts_num,
@@ -397,11 +491,10 @@ void calc_proj_coeffs_H1(int n_eq, int fns_num, int pts_num,
     for(int m=0; m < fns_num; m++) proj_coeffs[c][m] = rhs[m];
   }
 
-  // FIXME: can this frequent creation and deletion 
-  // of this matrix be avoided?
-  delete [] matrix;
-  delete [] indx;
-  delete [] rhs;
+  if (!cached) {
+    delete [] matrix;
+    delete [] indx;
+  }
 }
 
 // Assumes that reference solution is defined on two half-elements 'e_ref_left'
@@ -461,6 +554,7 @@ double check_cand_coarse_hp_fine_hp(int norm, Element *e, Element *e_ref_left,
                            leg_pol_val_left, 
                            leg_pol_der_left, 
                            phys_weights_left, 
+                           order_left, e_ref_left->x2 - e_ref_left->x1,
                            proj_coeffs_left);
 
   // evaluate the projection in 'e_ref_left' for every solution component
@@ -543,6 +637,7 @@ double check_cand_coarse_hp_fine_hp(int norm, Element *e, Element *e_ref_left,
                            leg_pol_val_right, 
                            leg_pol_der_right, 
                            phys_weights_right, 
+                           order_right, e_ref_right->x2 - e_ref_right->x1,
                            proj_coeffs_right);
 
   // evaluate the projection in 'e_ref_right' for every solution component
@@ -739,6 +834,7 @@ double check_cand_coarse_hp_fine_p(int norm, Element *e, Element *e_ref,
                            leg_pol_val_left, 
                            leg_pol_der_left, 
                            phys_weights_left, 
+                           order_left, (e->x1 + e->x2)/2. - e->x1,
                            proj_coeffs_left);
 
   // evaluate the projection on the left half for every solution component
@@ -819,6 +915,7 @@ double check_cand_coarse_hp_fine_p(int norm, Element *e, Element *e_ref,
                            leg_pol_val_right, 
                            leg_pol_der_right, 
                            phys_weights_right, 
+                           order_right, e->x2 - (e->x1 + e->x2)/2.,
                            proj_coeffs_right);
 
   // evaluate the projection on the right half for every solution component
@@ -1048,32 +1145,43 @@ double check_cand_coarse_p_fine_hp(int norm, Element *e, Element *e_ref_left,
     }
   }
   else { 
-    // calculate first part of the projection matrix
-    double** matrix_left;  
-    matrix_left = get_proj_matrix_H1(n_eq, fns_num, pts_num_left,
-                                     leg_pol_val_left, leg_pol_der_left, 
-                                     phys_weights_left); 
-    // calculate second part of the projection matrix
-    double** matrix_right;  
-    matrix_right = get_proj_matrix_H1(n_eq, fns_num, pts_num_right,
-                                      leg_pol_val_right, leg_pol_der_right, 
-                                      phys_weights_right); 
-    // add the two matrices 
-    double ** matrix = _new_matrix<double>(MAX_P+1, MAX_P+1);
-    for(int i=0; i < fns_num; i++) { 
-      for(int j=0; j < fns_num; j++) { 
-        matrix[i][j] = matrix_left[i][j] + matrix_right[i][j];
+    ProjMatrixKey key = {fns_num, order_left, order_right, 
+                         {e_ref_left->x2 - e_ref_left->x1, 
+                          e_ref_right->x2 - e_ref_right->x1, e->x2 - e->x1}};
+    double** matrix;
+    int *indx;
+    bool cached = proj_matrix_cache.find(key, matrix, indx);
+    if (!cached) {
+      // calculate first part of the projection matrix
+      double** matrix_left;  
+      matrix_left = get_proj_matrix_H1(n_eq, fns_num, pts_num_left,
+                                       leg_pol_val_left, leg_pol_der_left, 
+                                       phys_weights_left); 
+      // calculate second part of the projection matrix
+      double** matrix_right;  
+      matrix_right = get_proj_matrix_H1(n_eq, fns_num, pts_num_right,
+                                        leg_pol_val_right, leg_pol_der_right, 
+                                        phys_weights_right); 
+      // add the two matrices 
+      matrix = _new_matrix<double>(fns_num, fns_num);
+      for(int i=0; i < fns_num; i++) { 
+        for(int j=0; j < fns_num; j++) { 
+          matrix[i][j] = matrix_left[i][j] + matrix_right[i][j];
+        }
       }
+      delete [] matrix_left;
+      delete [] matrix_right;
+      // perform LU factorization (result stored in matrix and indx)
+      indx = new int[fns_num];
+      double d;
+      ludcmp(matrix, fns_num, indx, &d);
+      cached = proj_matrix_cache.insert(key, matrix, indx);
     }
-    // perform LU factorization (result stored in matrix and indx)
-    int *indx = new int[MAX_P+1];
-    double d;
-    ludcmp(matrix, fns_num, indx, &d);
 
     // for every equation, construct the rhs and solve the system
-    double *rhs_left = new double[MAX_P+1];
-    double *rhs_right = new double[MAX_P+1];    
-    double *rhs = new double[MAX_P+1];
+    double rhs_left[MAX_P+1];
+    double rhs_right[MAX_P+1];    
+    double rhs[MAX_P+1];
     for (int c=0; c<n_eq; c++) {
       fill_proj_rhs_H1(fns_num, pts_num_left,
                        phys_u_ref_left[c], phys_dudx_ref_left[c],
@@ -1087,12 +1195,10 @@ double check_cand_coarse_p_fine_hp(int norm, Element *e, Element *e_ref_left,
       lubksb(matrix, fns_num, indx, rhs);
       for(int m=0; m < fns_num; m++) proj_coeffs[c][m] = rhs[m];
     }
-    delete [] matrix_left;
-    delete [] matrix_right;
-    delete [] matrix;
-    delete [] rhs_left;
-    delete [] rhs_right;
-    delete [] rhs;
+    if (!cached) {
+      delete [] matrix;
+      delete [] indx;
+    }
   }
 
   // evaluate the projection in 'e_ref_left' for every solution component
@@ -1324,6 +1430,7 @@ double check_cand_coarse_p_fine_p(int norm, Element *e, Element *e_ref,
                            leg_pol_val, 
                            leg_pol_der, 
                            phys_weights, 
+                           order, e->x2 - e->x1,
                            proj_coeffs);
 
   // evaluate the projection in 'e' for every solution component
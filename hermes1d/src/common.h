@@ -35,8 +35,6 @@ const int MAX_QUAD_PTS_NUM = 101;      // max number of quadrature points
 const int MAX_CAND_NUM = 100;          // maximum allowed number of hp-refinement
                                        // candidates of an element
 
-const int MAX_ELEM_NUM = 10000;        // maximum number of elements
-const int MAX_N_DOF = 10000;           // maximum number of degrees of freedom
 const int MAX_EQN_NUM = 10;            // maximum number of equations in the system
 const int MAX_SLN_NUM = 5;             // maximum number of solutions (not to be confused 
                                        // components - every solution can have multiple 
@@ -9,28 +9,10 @@
 
 #include "solvers.h"
 
-static int _precalculated = 0;
-
 DiscreteProblem::DiscreteProblem() {
-    if (_precalculated == 0) {
-        // precalculating values and derivatives 
-        // of all polynomials at all possible 
-        // integration points
-        fprintf(stderr, "Precalculating Legendre polynomials...");
-        fflush(stderr);
-        precalculate_legendre_1d();
-        precalculate_legendre_1d_left();
-        precalculate_legendre_1d_right();
-        fprintf(stderr, "done.\n");
-
-        fprintf(stderr, "Precalculating Lobatto shape functions...");
-        fflush(stderr);
-        precalculate_lobatto_1d();
-        precalculate_lobatto_1d_left();
-        precalculate_lobatto_1d_right();
-        fprintf(stderr, "done.\n");
-        _precalculated = 1;
-    }
+    // the tables of Legendre and Lobatto polynomials at the 
+    // quadrature points are filled on demand, one quadrature 
+    // order at a time (see lobatto_tab_init())
 }
 
 void DiscreteProblem::add_matrix_form(int i, int j, matrix_form fn, int marker)
@@ -61,14 +43,17 @@ void DiscreteProblem::add_vector_form_surf(int i, vector_form_surf fn, int bdy_i
 
 // process volumetric weak forms
 void DiscreteProblem::process_vol_forms(Mesh *mesh, Matrix *mat, double *res, 
-					int matrix_flag) {
+					int matrix_flag, Element **elems, int n_elems,
+					int n_samples, void **user_data) {
   int n_eq = mesh->get_n_eq();
-  Element *elems = mesh->get_base_elems();
-  int n_elem = mesh->get_n_base_elem();
   Iterator *I = new Iterator(mesh);
 
-  Element *e;
-  while ((e = I->next_active_element()) != NULL) {
+  int count = 0;
+  while (1) {
+    Element *e;
+    if (elems == NULL) e = I->next_active_element();
+    else e = (count < n_elems) ? elems[count++] : NULL;
+    if (e == NULL) break;
     //printf("Processing elem %d\n", m);
     int    pts_num;                                     // num of quad points
     double phys_pts[MAX_QUAD_PTS_NUM];                  // quad points
@@ -112,7 +97,7 @@ void DiscreteProblem::process_vol_forms(Mesh *mesh, Matrix *mat, double *res,
 	  // loop over test functions (rows)
 	  for(int i=0; i<e->p + 1; i++) {
 	    // if i-th test function is active
-	    int pos_i = e->dof[c_i][i]; // row in matrix
+	    int pos_i = e->dof(c_i, i); // row in matrix
             //printf("elem (%g, %g): pos_i = %d\n", e->x1, e->x2, pos_i);
 	    if(pos_i != -1) {
 	      // transform i-th test function to element 'm'
@@ -123,7 +108,7 @@ void DiscreteProblem::process_vol_forms(Mesh *mesh, Matrix *mat, double *res,
 	      if(matrix_flag == 0 || matrix_flag == 1) {
 	        // loop over basis functions (columns)
 	        for(int j=0; j < e->p + 1; j++) {
-		  int pos_j = e->dof[c_j][j]; // matrix column
+		  int pos_j = e->dof(c_j, j); // matrix column
                   //printf("elem (%g, %g): pos_j = %d\n", e->x1, e->x2, pos_j);
 		  // if j-th basis function is active
 		  if(pos_j != -1) {
@@ -133,7 +118,8 @@ void DiscreteProblem::process_vol_forms(Mesh *mesh, Matrix *mat, double *res,
 		    // evaluate the bilinear form
 		    double val_ij = mfv->fn(pts_num, phys_pts,
 			      phys_weights, phys_u, phys_dudx, phys_v, phys_dvdx,
-			      phys_u_prev, phys_du_prevdx, NULL); 
+			      phys_u_prev, phys_du_prevdx, 
+			      user_data ? user_data[0] : NULL); 
 		    //truncating
 		    if (fabs(val_ij) < 1e-12) val_ij = 0.0; 
 		    // add the result to the matrix
@@ -162,24 +148,26 @@ void DiscreteProblem::process_vol_forms(Mesh *mesh, Matrix *mat, double *res,
           // loop over test functions (rows)
           for(int i=0; i<e->p + 1; i++) {
 	    // if i-th test function is active
-	    int pos_i = e->dof[c_i][i]; // row in residual vector
+	    int pos_i = e->dof(c_i, i); // row in residual vector
 	    if(pos_i != -1) {
 	      // transform i-th test function to element 'm'
 	      element_shapefn(e->x1, e->x2,  
 			      i, order, phys_v, phys_dvdx); 
 	      // contribute to residual vector
 	      if(matrix_flag == 0 || matrix_flag == 2) {
-	        double val_i = vfv->fn(pts_num, phys_pts, phys_weights, 
-				       phys_u_prev, phys_du_prevdx, phys_v,
-				       phys_dvdx, NULL);
-	        // truncating
-	        if(fabs(val_i) < 1e-12) val_i = 0.0; 
-	        // add the contribution to the residual vector
- 	        if (val_i != 0) res[pos_i] += val_i;
-	        if (DEBUG) {
-		  if (val_i != 0) {
-	            printf("Adding to residual pos %d value %g (comp %d)\n", 
-                    pos_i, val_i, c_i);
+	        for (int k=0; k < n_samples; k++) {
+	          double val_i = vfv->fn(pts_num, phys_pts, phys_weights, 
+				         phys_u_prev, phys_du_prevdx, phys_v,
+				         phys_dvdx, user_data ? user_data[k] : NULL);
+	          // truncating
+	          if(fabs(val_i) < 1e-12) val_i = 0.0; 
+	          // add the contribution to the residual vector
+ 	          if (val_i != 0) res[pos_i*n_samples + k] += val_i;
+	          if (DEBUG) {
+		    if (val_i != 0) {
+	              printf("Adding to residual pos %d value %g (comp %d)\n", 
+                      pos_i, val_i, c_i);
+                    }
                   }
                 }
               }
@@ -195,7 +183,8 @@ void DiscreteProblem::process_vol_forms(Mesh *mesh, Matrix *mat, double *res,
 
 // process boundary weak forms
 void DiscreteProblem::process_surf_forms(Mesh *mesh, Matrix *mat, double *res, 
-					 int matrix_flag, int bdy_index) {
+					 int matrix_flag, int bdy_index,
+					 int n_samples, void **user_data) {
   Iterator *I = new Iterator(mesh);
   Element *e; 
 
@@ -222,6 +211,11 @@ void DiscreteProblem::process_surf_forms(Mesh *mesh, Matrix *mat, double *res,
     e->get_solution_point(x_phys, phys_u_prev[sln], phys_du_prevdx[sln], sln); 
   }
 
+  // values and derivatives of all shape functions at the boundary point
+  double shape_val[MAX_P+1], shape_der[MAX_P+1];
+  double jac = (e->x2 - e->x1)/2.;
+  fill_lobatto_array_ref(x_ref, shape_val, shape_der, e->p > 1 ? e->p : 1);
+
   // surface bilinear forms
   if(matrix_flag == 0 || matrix_flag == 1) {
     for (int ww = 0; ww < this->matrix_forms_surf.size(); ww++)
@@ -234,25 +228,25 @@ void DiscreteProblem::process_surf_forms(Mesh *mesh, Matrix *mat, double *res,
       // loop over test functions on the boundary element
       for(int i=0; i<e->p + 1; i++) {
         double phys_v, phys_dvdx; 
-        int pos_i = e->dof[c_i][i]; // matrix row
+        int pos_i = e->dof(c_i, i); // matrix row
         if(pos_i != -1) {
           // transform j-th basis function to the boundary element
-          element_shapefn_point(x_ref, e->x1, e->x2, i, phys_v, 
-                                phys_dvdx); 
+          phys_v = shape_val[i];
+          phys_dvdx = shape_der[i]/jac;
           // loop over basis functions on the boundary element
           for(int j=0; j < e->p + 1; j++) {
             double phys_u, phys_dudx;
-            int pos_j = e->dof[c_j][j]; // matrix column
+            int pos_j = e->dof(c_j, j); // matrix column
             // if j-th basis function is active
             if(pos_j != -1) {
               // transform j-th basis function to the boundary element
-              element_shapefn_point(x_ref, e->x1, e->x2, j, phys_u, 
-                                    phys_dudx); 
+              phys_u = shape_val[j];
+              phys_dudx = shape_der[j]/jac;
               // evaluate the surface bilinear form
               double val_ij_surf = mfs->fn(x_phys,
                                phys_u, phys_dudx, phys_v, 
                                phys_dvdx, phys_u_prev, phys_du_prevdx, 
-                               NULL); 
+                               user_data ? user_data[0] : NULL); 
   	      // truncating
 	      if(fabs(val_ij_surf) < 1e-12) val_ij_surf = 0.0; 
               // add the result to the matrix
@@ -275,19 +269,21 @@ void DiscreteProblem::process_surf_forms(Mesh *mesh, Matrix *mat, double *res,
       // loop over test functions on the boundary element
       for(int i=0; i<e->p + 1; i++) {
         double phys_v, phys_dvdx; 
-        int pos_i = e->dof[c_i][i]; // matrix row
+        int pos_i = e->dof(c_i, i); // matrix row
         if(pos_i != -1) {
           // transform j-th basis function to the boundary element
-          element_shapefn_point(x_ref, e->x1, e->x2, i, phys_v, 
-                                phys_dvdx); 
+          phys_v = shape_val[i];
+          phys_dvdx = shape_der[i]/jac;
           // evaluate the surface bilinear form
-          double val_i_surf = vfs->fn(x_phys,
-                          phys_u_prev, phys_du_prevdx, phys_v, phys_dvdx, 
-                          NULL);
-          // truncating
-          if(fabs(val_i_surf) < 1e-12) val_i_surf = 0.0; 
-          // add the result to the matrix
-          if (val_i_surf != 0) res[pos_i] += val_i_surf;
+          for (int k=0; k < n_samples; k++) {
+            double val_i_surf = vfs->fn(x_phys,
+                            phys_u_prev, phys_du_prevdx, phys_v, phys_dvdx, 
+                            user_data ? user_data[k] : NULL);
+            // truncating
+            if(fabs(val_i_surf) < 1e-12) val_i_surf = 0.0; 
+            // add the result to the matrix
+            if (val_i_surf != 0) res[pos_i*n_samples + k] += val_i_surf;
+          }
         }
       }
     }
@@ -360,8 +356,80 @@ void DiscreteProblem::assemble_vector(Mesh *mesh, double *res) {
   assemble(mesh, void_mat, res, 2);
 } 
 
+// add residual contributions of the elements elems[] only, 
+// including the boundary terms if a boundary element is among them
+void DiscreteProblem::assemble_vector_elems(Mesh *mesh, double *res, 
+                                            Element **elems, int n_elems) {
+  Matrix *void_mat = NULL;
+  process_vol_forms(mesh, void_mat, res, 2, elems, n_elems);
+
+  Element *first = mesh->first_active_element();
+  Element *last = mesh->last_active_element();
+  for (int i=0; i < n_elems; i++) {
+    if (elems[i] == first) 
+      process_surf_forms(mesh, void_mat, res, 2, BOUNDARY_LEFT);
+    if (elems[i] == last) 
+      process_surf_forms(mesh, void_mat, res, 2, BOUNDARY_RIGHT);
+  }
+}
+
+void DiscreteProblem::assemble_ensemble(Mesh *mesh, Matrix *mat, double *res, 
+                                        int n_samples, void **user_data) {
+  int n_dof = mesh->get_n_dof();
+  int matrix_flag = (mat != NULL) ? 0 : 2;
+  for(int i=0; i<n_dof*n_samples; i++) res[i] = 0;
+  process_vol_forms(mesh, mat, res, matrix_flag, NULL, 0, 
+                    n_samples, user_data);
+  process_surf_forms(mesh, mat, res, matrix_flag, BOUNDARY_LEFT, 
+                     n_samples, user_data);
+  process_surf_forms(mesh, mat, res, matrix_flag, BOUNDARY_RIGHT, 
+                     n_samples, user_data);
+}
+
 // Newton's iteration
-void newton(DiscreteProblem *dp, Mesh *mesh,
+// Numbers the dofs element by element (all unknowns of an element 
+// get consecutive numbers, neighbors share the vertex dof), which 
+// makes the Jacobi matrix banded. perm[dof] is the new number of 
+// 'dof'. Returns the half-bandwidth.
+static int band_ordering(Mesh *mesh, int *perm)
+{
+  int n_dof = mesh->get_n_dof();
+  int n_eq = mesh->get_n_eq();
+  for (int i=0; i<n_dof; i++) perm[i] = -1;
+  int count = 0, bw = 0;
+  Iterator *I = new Iterator(mesh);
+  Element *e;
+  while ((e = I->next_active_element()) != NULL) {
+    for (int c=0; c<n_eq; c++) {
+      int d = e->dof(c, 0);
+      if (d >= 0 && perm[d] < 0) perm[d] = count++;
+    }
+    for (int c=0; c<n_eq; c++) {
+      for (int j=2; j <= e->p; j++) perm[e->dof(c, j)] = count++;
+    }
+    for (int c=0; c<n_eq; c++) {
+      int d = e->dof(c, 1);
+      if (d >= 0 && perm[d] < 0) perm[d] = count++;
+    }
+    int lo = n_dof, hi = -1;
+    for (int c=0; c<n_eq; c++) {
+      for (int j=0; j <= e->p; j++) {
+        int d = e->dof(c, j);
+        if (d < 0) continue;
+        if (perm[d] < lo) lo = perm[d];
+        if (perm[d] > hi) hi = perm[d];
+      }
+    }
+    if (hi - lo > bw) bw = hi - lo;
+  }
+  delete I;
+  if (count != n_dof) error("Band ordering of dofs failed.");
+  return bw;
+}
+
+// If 'solver' is NULL, the Jacobi matrix is assembled directly 
+// into a banded matrix (allocated once) and factorized by banded LU
+void newton(DiscreteProblem *dp, Mesh *mesh, 
             CommonSolver *solver,
             double newton_tol, int newton_maxiter,
             bool verbose)
@@ -370,20 +438,35 @@ void newton(DiscreteProblem *dp, Mesh *mesh,
   int n_dof = mesh->get_n_dof();
   double *y = new double[n_dof];
   if (y == NULL) error("vector y could not be allocated in newton().");
-  double *res = new double[n_dof];
-  if (res == NULL)
-    error("vector res could not be allocated in newton().");
 
   // fill vector y using dof and coeffs arrays
   // in elements
   copy_mesh_to_vector(mesh, y);
 
+  // matrix and residual vector, reused in all iterations; with an 
+  // external solver the residual is assembled directly into the 
+  // right-hand side vector
+  Matrix *mat;
+  BandMatrix *band = NULL;
+  AVector *v = NULL;
+  double *res;
+  if (solver) {
+    mat = new CooMatrix();
+    v = new AVector(n_dof);
+    res = v->get_c_array();
+  }
+  else {
+    int *perm = new int[n_dof];
+    int bw = band_ordering(mesh, perm);
+    mat = band = new BandMatrix(n_dof, bw, bw, perm);
+    delete [] perm;
+    res = new double[n_dof];
+  }
+
   // Newton iteration
-  CooMatrix *mat = NULL;
   while (1) {
     // Reset the matrix:
-    if (mat != NULL) delete mat;
-    mat = new CooMatrix();
+    mat->set_zero();
 
     // construct matrix and residual vector
     dp->assemble_matrix_and_vector(mesh, mat, res);
@@ -409,14 +492,11 @@ void newton(DiscreteProblem *dp, Mesh *mesh,
 
     // solving the matrix system
     if (solver) {
-        AVector *v = new AVector(n_dof);
-        memcpy(v->get_c_array(), res, sizeof(double)*n_dof);
         solver->solve(mat, v);
-        memcpy(res, v->get_c_array(), sizeof(double)*n_dof);
-        delete v;
+        res = v->get_c_array();
     }
     else
-        solve_linear_system_sparselib_cgs(mat, res);
+        band->solve(res);
 
     // updating vector y by new solution which is in res
     for(int i=0; i<n_dof; i++) y[i] += res[i];
@@ -430,27 +510,97 @@ void newton(DiscreteProblem *dp, Mesh *mesh,
     }
   }
 
-  if (mat != NULL) delete mat;
+  delete mat;
+  if (v != NULL) delete v;
+  else delete [] res;
   if (y != NULL) delete [] y;
-  if (res != NULL) delete [] res;
 }
 
+void solve_linear_ensemble(DiscreteProblem *dp, Mesh *mesh, 
+                           int n_samples, void **user_data, double *y)
+{
+  int n_dof = mesh->get_n_dof();
+  double *y_orig = new double[n_dof];
+  copy_mesh_to_vector(mesh, y_orig);
+
+  int *perm = new int[n_dof];
+  int bw = band_ordering(mesh, perm);
+  BandMatrix *mat = new BandMatrix(n_dof, bw, bw, perm);
+  delete [] perm;
+
+  // one Jacobi matrix and all residual vectors (in y)
+  dp->assemble_ensemble(mesh, mat, y, n_samples, user_data);
+
+  // one factorization, all right-hand sides eliminated together
+  mat->solve(y, n_samples);
+
+  for(int i=0; i<n_dof; i++) {
+    double *y_i = y + i*n_samples;
+    for(int k=0; k<n_samples; k++) y_i[k] = y_orig[i] - y_i[k];
+  }
+
+  delete mat;
+  delete [] y_orig;
+}
+
+// Approximates J(y_orig)*vec by finite differences. Assumes that the
+// coefficients of y_orig are in the mesh. If the perturbation 'vec' 
+// is nonzero on a few elements only, just their residual contributions 
+// are evaluated again. 
 void J_dot_vec_jfnk(DiscreteProblem *dp, Mesh *mesh, double* vec,
                     double* y_orig, double* f_orig, 
                     double* J_dot_vec,
                     double jfnk_epsilon, int n_dof) 
 {
-  double y_perturbed[MAX_N_DOF];
-  double f_perturbed[MAX_N_DOF];
+  double *y_perturbed = new double[n_dof];
+  double *f_perturbed = new double[n_dof];
   for (int i=0; i<n_dof; i++) {
     y_perturbed[i] = y_orig[i] + jfnk_epsilon*vec[i];
   }
-  copy_vector_to_mesh(y_perturbed, mesh);
-  dp->assemble_vector(mesh, f_perturbed); 
-  copy_vector_to_mesh(y_orig, mesh);
-  for (int i=0; i<n_dof; i++) {
-    J_dot_vec[i] = (f_perturbed[i] - f_orig[i])/jfnk_epsilon;
+
+  // find elements touched by the perturbation
+  std::vector<Element*> touched;
+  int n_elem = 0;
+  Iterator *I = new Iterator(mesh);
+  Element *e;
+  while ((e = I->next_active_element()) != NULL) {
+    n_elem++;
+    bool t = false;
+    for (int c=0; c < e->n_eq && !t; c++) {
+      for (int j=0; j < e->p + 1; j++) {
+        int d = e->dof(c, j);
+        if (d >= 0 && vec[d] != 0) { t = true; break; }
+      }
+    }
+    if (t) touched.push_back(e);
   }
+  delete I;
+
+  if (4*(int)touched.size() > n_elem) {
+    copy_vector_to_mesh(y_perturbed, mesh);
+    dp->assemble_vector(mesh, f_perturbed); 
+    copy_vector_to_mesh(y_orig, mesh);
+    for (int i=0; i<n_dof; i++) {
+      J_dot_vec[i] = (f_perturbed[i] - f_orig[i])/jfnk_epsilon;
+    }
+  }
+  else {
+    // difference of the contributions of the touched elements
+    // before and after the perturbation
+    for (int i=0; i<n_dof; i++) f_perturbed[i] = J_dot_vec[i] = 0;
+    int n_touched = touched.size();
+    if (n_touched > 0) {
+      dp->assemble_vector_elems(mesh, J_dot_vec, &touched[0], n_touched);
+      for (int k=0; k < n_touched; k++) touched[k]->get_coeffs_from_vector(y_perturbed);
+      dp->assemble_vector_elems(mesh, f_perturbed, &touched[0], n_touched);
+      for (int k=0; k < n_touched; k++) touched[k]->get_coeffs_from_vector(y_orig);
+    }
+    for (int i=0; i<n_dof; i++) {
+      J_dot_vec[i] = (f_perturbed[i] - J_dot_vec[i])/jfnk_epsilon;
+    }
+  }
+  delete [] y_perturbed;
+  delete [] f_perturbed;
 }
 
 // CG method adjusted for JFNK
@@ -461,15 +611,15 @@ void jfnk_cg(DiscreteProblem *dp, Mesh *mesh,
 {
   int n_dof = mesh->get_n_dof();
   // vectors for JFNK
-  double f_orig[MAX_N_DOF];
-  double y_orig[MAX_N_DOF];
-  double vec[MAX_N_DOF];
-  double rhs[MAX_N_DOF];
+  double *f_orig = new double[n_dof];
+  double *y_orig = new double[n_dof];
+  double *vec = new double[n_dof];
+  double *rhs = new double[n_dof];
 
   // vectors for the CG method
-  double r[MAX_N_DOF];
-  double p[MAX_N_DOF];
-  double J_dot_vec[MAX_N_DOF];
+  double *r = new double[n_dof];
+  double *p = new double[n_dof];
+  double *J_dot_vec = new double[n_dof];
 
   /*
   // debug
@@ -570,5 +720,320 @@ void jfnk_cg(DiscreteProblem *dp, Mesh *mesh,
 
   // copy updated vector y_orig to mesh
   copy_vector_to_mesh(y_orig, mesh);
+
+  delete [] f_orig;
+  delete [] y_orig;
+  delete [] vec;
+  delete [] rhs;
+  delete [] r;
+  delete [] p;
+  delete [] J_dot_vec;
+}
+
+
+// Preconditioner for jfnk_gmres(), built from the Jacobi matrix 
+// assembled at the current Newton iterate
+class JFNKPreconditioner {
+public:
+  JFNKPreconditioner(int type) { this->type = type; this->n_dof = 0; }
+  void build(DiscreteProblem *dp, Mesh *mesh);
+  // z = M^{-1} r
+  void apply(double *r, double *z);
+
+private:
+  int type;
+  int n_dof;
+  // JFNK_PRECOND_JACOBIAN: ILU(0) factors in CSR, unit lower triangle
+  std::vector<int> Ap, Ai, diag;
+  std::vector<double> Ax;
+  // JFNK_PRECOND_BLOCK_DIAG: dense LU of one block per element
+  std::vector<int> blk_start, blk_dofs, blk_piv;
+  std::vector<int> lu_start;
+  std::vector<double> lu;
+};
+
+void JFNKPreconditioner::build(DiscreteProblem *dp, Mesh *mesh)
+{
+  this->n_dof = mesh->get_n_dof();
+  if (this->type == JFNK_PRECOND_NONE) return;
+
+  CooMatrix *coo = new CooMatrix(n_dof);
+  dp->assemble_matrix(mesh, coo);
+  CSRMatrix *csr = new CSRMatrix(coo);
+  delete coo;
+  int *csr_Ap = csr->get_Ap();
+  int *csr_Ai = csr->get_Ai();
+  double *csr_Ax = csr->get_Ax();
+
+  if (this->type == JFNK_PRECOND_JACOBIAN) {
+    int nnz = csr_Ap[n_dof];
+    Ap.assign(csr_Ap, csr_Ap + n_dof + 1);
+    Ai.assign(csr_Ai, csr_Ai + nnz);
+    Ax.assign(csr_Ax, csr_Ax + nnz);
+    diag.assign(n_dof, -1);
+    std::vector<int> pos(n_dof, -1);
+    for (int i=0; i < n_dof; i++) {
+      for (int k=Ap[i]; k < Ap[i+1]; k++) pos[Ai[k]] = k;
+      for (int k=Ap[i]; k < Ap[i+1] && Ai[k] < i; k++) {
+        int r = Ai[k];
+        if (diag[r] < 0) continue;
+        Ax[k] /= Ax[diag[r]];
+        for (int q=diag[r]+1; q < Ap[r+1]; q++)
+          if (pos[Ai[q]] >= 0) Ax[pos[Ai[q]]] -= Ax[k]*Ax[q];
+      }
+      for (int k=Ap[i]; k < Ap[i+1]; k++) {
+        if (Ai[k] == i) diag[i] = k;
+        pos[Ai[k]] = -1;
+      }
+      if (diag[i] < 0 || Ax[diag[i]] == 0) 
+        error("Zero pivot in the JFNK preconditioner.");
+    }
+  }
+  else {
+    // every dof goes to the block of the first element it belongs to
+    std::vector<int> blk_of(n_dof, -1), idx_in_blk(n_dof, -1);
+    blk_start.assign(1, 0);
+    blk_dofs.clear();
+    Iterator *I = new Iterator(mesh);
+    Element *e;
+    while ((e = I->next_active_element()) != NULL) {
+      int b = blk_start.size() - 1;
+      for (int c=0; c < e->n_eq; c++) {
+        for (int j=0; j < e->p + 1; j++) {
+          int d = e->dof(c, j);
+          if (d < 0 || blk_of[d] >= 0) continue;
+          blk_of[d] = b;
+          idx_in_blk[d] = blk_dofs.size() - blk_start[b];
+          blk_dofs.push_back(d);
+        }
+      }
+      if ((int) blk_dofs.size() > blk_start[b]) blk_start.push_back(blk_dofs.size());
+    }
+    delete I;
+
+    // extract the blocks and factorize them (LU with partial pivoting)
+    int n_blk = blk_start.size() - 1;
+    lu_start.assign(1, 0);
+    for (int b=0; b < n_blk; b++) {
+      int m = blk_start[b+1] - blk_start[b];
+      lu_start.push_back(lu_start[b] + m*m);
+    }
+    lu.assign(lu_start[n_blk], 0.0);
+    blk_piv.assign(blk_dofs.size(), 0);
+    for (int b=0; b < n_blk; b++) {
+      int m = blk_start[b+1] - blk_start[b];
+      double *a = &lu[lu_start[b]];
+      for (int r=0; r < m; r++) {
+        int d = blk_dofs[blk_start[b] + r];
+        for (int k=csr_Ap[d]; k < csr_Ap[d+1]; k++)
+          if (blk_of[csr_Ai[k]] == b) a[r*m + idx_in_blk[csr_Ai[k]]] += csr_Ax[k];
+      }
+      int *piv = &blk_piv[blk_start[b]];
+      for (int k=0; k < m; k++) {
+        int pr = k;
+        for (int r=k+1; r < m; r++) 
+          if (fabs(a[r*m + k]) > fabs(a[pr*m + k])) pr = r;
+        if (a[pr*m + k] == 0) error("Singular block in the JFNK preconditioner.");
+        piv[k] = pr;
+        if (pr != k) 
+          for (int j=0; j < m; j++) std::swap(a[k*m + j], a[pr*m + j]);
+        for (int r=k+1; r < m; r++) {
+          a[r*m + k] /= a[k*m + k];
+          for (int j=k+1; j < m; j++) a[r*m + j] -= a[r*m + k]*a[k*m + j];
+        }
+      }
+    }
+  }
+  delete csr;
+}
+
+void JFNKPreconditioner::apply(double *r, double *z)
+{
+  if (this->type == JFNK_PRECOND_NONE) {
+    for (int i=0; i < n_dof; i++) z[i] = r[i];
+  }
+  else if (this->type == JFNK_PRECOND_JACOBIAN) {
+    for (int i=0; i < n_dof; i++) {
+      double sum = r[i];
+      for (int k=Ap[i]; k < diag[i]; k++) sum -= Ax[k]*z[Ai[k]];
+      z[i] = sum;
+    }
+    for (int i=n_dof-1; i >= 0; i--) {
+      double sum = z[i];
+      for (int k=diag[i]+1; k < Ap[i+1]; k++) sum -= Ax[k]*z[Ai[k]];
+      z[i] = sum/Ax[diag[i]];
+    }
+  }
+  else {
+    int n_blk = blk_start.size() - 1;
+    std::vector<double> x;
+    for (int b=0; b < n_blk; b++) {
+      int m = blk_start[b+1] - blk_start[b];
+      double *a = &lu[lu_start[b]];
+      int *piv = &blk_piv[blk_start[b]];
+      int *dofs = &blk_dofs[blk_start[b]];
+      x.resize(m);
+      for (int k=0; k < m; k++) x[k] = r[dofs[k]];
+      for (int k=0; k < m; k++) {
+        std::swap(x[k], x[piv[k]]);
+        for (int j=k+1; j < m; j++) x[j] -= a[j*m + k]*x[k];
+      }
+      for (int k=m-1; k >= 0; k--) {
+        for (int j=k+1; j < m; j++) x[k] -= a[k*m + j]*x[j];
+        x[k] /= a[k*m + k];
+      }
+      for (int k=0; k < m; k++) z[dofs[k]] = x[k];
+    }
+  }
 }
 
+// JFNK with restarted GMRES, preconditioned from the right so that 
+// the GMRES residual is the residual of the Newton system
+void jfnk_gmres(DiscreteProblem *dp, Mesh *mesh, 
+                double matrix_solver_tol, int matrix_solver_maxiter, 
+                double jfnk_epsilon, double tol_jfnk, int jfnk_maxiter, 
+                int precond, int precond_update, int restart, bool verbose)
+{
+  int n_dof = mesh->get_n_dof();
+  int m = restart;
+  if (m < 1) error("GMRES restart must be positive.");
+  if (precond_update < 1) precond_update = 1;
+
+  // vectors for JFNK
+  double *f_orig = new double[n_dof];
+  double *y_orig = new double[n_dof];
+  double *vec = new double[n_dof];
+  double *rhs = new double[n_dof];
+  double *J_dot_vec = new double[n_dof];
+  double *z = new double[n_dof];
+  // Krylov basis and Hessenberg matrix for GMRES
+  double *V = new double[(m+1)*n_dof];
+  double *H = new double[(m+1)*m];
+  double *cs = new double[m];
+  double *sn = new double[m];
+  double *g = new double[m+1];
+  double *w = new double[n_dof];
+
+  JFNKPreconditioner M(precond);
+
+  // JFNK loop
+  int jfnk_iter_num = 1;
+  while (1) {
+    // fill vector y_orig using dof and coeffs arrays in elements
+    copy_mesh_to_vector(mesh, y_orig);
+
+    // construct residual vector f_orig corresponding to y_orig
+    // (f_orig stays unchanged through the entire GMRES loop)
+    dp->assemble_vector(mesh, f_orig); 
+
+    // calculate L2 norm of f_orig
+    double res_norm_squared = 0;
+    for(int i=0; i<n_dof; i++) res_norm_squared += f_orig[i]*f_orig[i];
+
+    // If residual norm less than 'tol_jfnk', break
+    if (verbose) printf("Residual norm: %.15f\n", sqrt(res_norm_squared));
+    if(res_norm_squared < tol_jfnk*tol_jfnk) break;
+
+    if (verbose) printf("JFNK iteration: %d\n", jfnk_iter_num);
+
+    // the preconditioner is only updated occasionally
+    if ((jfnk_iter_num - 1) % precond_update == 0) M.build(dp, mesh);
+
+    // right-hand side is negative residual
+    for(int i=0; i<n_dof; i++) rhs[i] = -f_orig[i];
+
+    // GMRES(m) with the initial vector vec = 0
+    for(int i=0; i<n_dof; i++) vec[i] = 0;
+    double *r = V;
+    for(int i=0; i<n_dof; i++) r[i] = rhs[i];
+    double beta = sqrt(vec_dot(r, r, n_dof));
+    int iter_current = 0;
+    while (beta >= matrix_solver_tol && iter_current < matrix_solver_maxiter) {
+      for(int i=0; i<n_dof; i++) V[i] /= beta;
+      g[0] = beta;
+      int k = 0;
+      for (; k < m && iter_current < matrix_solver_maxiter; k++) {
+        double *v_k = V + k*n_dof, *v_next = V + (k+1)*n_dof;
+        M.apply(v_k, z);
+        J_dot_vec_jfnk(dp, mesh, z, y_orig, f_orig, 
+                       v_next, jfnk_epsilon, n_dof);
+        iter_current++;
+        // modified Gram-Schmidt
+        for (int j=0; j <= k; j++) {
+          double h = vec_dot(v_next, V + j*n_dof, n_dof);
+          H[j*m + k] = h;
+          for(int i=0; i<n_dof; i++) v_next[i] -= h*V[j*n_dof + i];
+        }
+        double h_next = sqrt(vec_dot(v_next, v_next, n_dof));
+        // Givens rotations
+        for (int j=0; j < k; j++) {
+          double t = cs[j]*H[j*m + k] + sn[j]*H[(j+1)*m + k];
+          H[(j+1)*m + k] = -sn[j]*H[j*m + k] + cs[j]*H[(j+1)*m + k];
+          H[j*m + k] = t;
+        }
+        double d = sqrt(H[k*m + k]*H[k*m + k] + h_next*h_next);
+        cs[k] = H[k*m + k]/d;
+        sn[k] = h_next/d;
+        H[k*m + k] = d;
+        g[k+1] = -sn[k]*g[k];
+        g[k] *= cs[k];
+        beta = fabs(g[k+1]);
+        if (beta < matrix_solver_tol || h_next == 0) { k++; break; }
+        for(int i=0; i<n_dof; i++) v_next[i] /= h_next;
+      }
+
+      // vec += M^{-1} V y, where H y = g
+      for (int j=k-1; j >= 0; j--) {
+        for (int l=j+1; l < k; l++) g[j] -= H[j*m + l]*g[l];
+        g[j] /= H[j*m + j];
+      }
+      for(int i=0; i<n_dof; i++) w[i] = 0;
+      for (int j=0; j < k; j++)
+        for(int i=0; i<n_dof; i++) w[i] += g[j]*V[j*n_dof + i];
+      M.apply(w, z);
+      for(int i=0; i<n_dof; i++) vec[i] += z[i];
+
+      // true residual for the restart (the perturbation is scaled
+      // to unit length to keep the finite difference accurate)
+      double vec_norm = sqrt(vec_dot(vec, vec, n_dof));
+      for(int i=0; i<n_dof; i++) z[i] = vec[i]/vec_norm;
+      J_dot_vec_jfnk(dp, mesh, z, y_orig, f_orig, 
+                     J_dot_vec, jfnk_epsilon, n_dof);
+      for(int i=0; i<n_dof; i++) r[i] = rhs[i] - vec_norm*J_dot_vec[i];
+      beta = sqrt(vec_dot(r, r, n_dof));
+    }
+    // check whether GMRES converged
+    if (verbose) printf("GMRES (JFNK) made %d iteration(s) (tol = %g)\n", 
+           iter_current, beta);
+    if(beta > matrix_solver_tol) {
+      error("GMRES (JFNK) did not converge.");
+    }
+
+    // updating vector y_orig by new solution which is in vec
+    for(int i=0; i<n_dof; i++) y_orig[i] += vec[i];
+
+    // copying vector y_orig to mesh elements
+    copy_vector_to_mesh(y_orig, mesh);
+
+    jfnk_iter_num++;
+    if (jfnk_iter_num >= jfnk_maxiter) {
+      error("JFNK did not converge.");
+    }
+  }
+
+  // copy updated vector y_orig to mesh
+  copy_vector_to_mesh(y_orig, mesh);
+
+  delete [] f_orig;
+  delete [] y_orig;
+  delete [] vec;
+  delete [] rhs;
+  delete [] J_dot_vec;
+  delete [] z;
+  delete [] V;
+  delete [] H;
+  delete [] cs;
+  delete [] sn;
+  delete [] g;
+  delete [] w;
+}
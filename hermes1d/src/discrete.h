@@ -43,15 +43,32 @@ public:
     void add_matrix_form_surf(int i, int j, matrix_form_surf fn, int bdy_index);
     void add_vector_form_surf(int i, vector_form_surf fn, int bdy_index);
     // c is solution component
+    // If elems != NULL, only the n_elems elements in elems[] are processed.
+    // With n_samples > 1, res holds n_samples interleaved residual 
+    // vectors, the k-th one is assembled with user_data[k].
     void process_vol_forms(Mesh *mesh, Matrix *mat, double *res, 
-                           int matrix_flag);
+                           int matrix_flag, Element **elems=NULL, int n_elems=0,
+                           int n_samples=1, void **user_data=NULL);
     // c is solution component
     void process_surf_forms(Mesh *mesh, Matrix *mat, double *res, 
-                            int matrix_flag, int bdy_index);
+                            int matrix_flag, int bdy_index,
+                            int n_samples=1, void **user_data=NULL);
     void assemble(Mesh *mesh, Matrix *mat, double *res, int matrix_flag);
     void assemble_matrix_and_vector(Mesh *mesh, Matrix *mat, double *res); 
     void assemble_matrix(Mesh *mesh, Matrix *mat);
     void assemble_vector(Mesh *mesh, double *res);
+    // adds the residual contributions of the given elements only 
+    // (res is not erased)
+    void assemble_vector_elems(Mesh *mesh, double *res, 
+                               Element **elems, int n_elems);
+    // Assembles the residual vectors of n_samples parameter values in 
+    // one pass (the vector forms get user_data[k] for the k-th one), 
+    // interleaved: res[i*n_samples + k]. Quadrature, shape functions 
+    // and the previous solution are evaluated once for all of them. 
+    // If mat != NULL, the Jacobi matrix is assembled too, with 
+    // user_data[0]; it must not depend on the parameter.
+    void assemble_ensemble(Mesh *mesh, Matrix *mat, double *res, 
+                           int n_samples, void **user_data);
 
 private:
 	struct MatrixFormVol {
@@ -100,6 +117,29 @@ void jfnk_cg(DiscreteProblem *dp, Mesh *mesh,
              double matrix_solver_tol, int matrix_solver_maxiter,  
 	     double jfnk_epsilon, double jfnk_tol, int jfnk_maxiter, bool verbose=true);
 
+// Solves the problem for n_samples parameter values (user_data[k] is
+// passed to the vector forms) by one Newton step from the solution in 
+// the mesh, which is exact for linear problems. The Jacobi matrix must 
+// not depend on the parameter; it is factorized once. The solutions 
+// are returned interleaved in y (y[i*n_samples + k]), the mesh is 
+// not changed.
+void solve_linear_ensemble(DiscreteProblem *dp, Mesh *mesh, 
+                           int n_samples, void **user_data, double *y);
+
+// preconditioners for jfnk_gmres()
+const int JFNK_PRECOND_NONE = 0;
+const int JFNK_PRECOND_BLOCK_DIAG = 1;  // element blocks of the Jacobi matrix
+const int JFNK_PRECOND_JACOBIAN = 2;    // ILU(0) of the Jacobi matrix
+
+// Jacobian-free Newton-Krylov method with restarted GMRES. The Jacobi
+// matrix is only assembled for the preconditioner, every 
+// 'precond_update' JFNK iterations.
+void jfnk_gmres(DiscreteProblem *dp, Mesh *mesh,
+                double matrix_solver_tol, int matrix_solver_maxiter,  
+                double jfnk_epsilon, double jfnk_tol, int jfnk_maxiter, 
+                int precond=JFNK_PRECOND_NONE, int precond_update=1,
+                int restart=30, bool verbose=true);
+
 
 
 #endif
@@ -35,51 +35,49 @@ double leg_norm_const_ref(int n)
 
 // Fills an array of length MAX_P + 1 with Legendre polynomials 
 // and their derivatives at point 'x'. The polynomials are 
-// normalized in the inner product L^2(-1,1)
+// normalized in the inner product L^2(-1,1). Only the entries 
+// 0, 1, ..., max_p are filled.
 extern void fill_legendre_array_ref(double x, 
                                 double val_array[MAX_P+1],
-                                double der_array[MAX_P+1]) {
+                                double der_array[MAX_P+1],
+                                int max_p) {
     // first fill the array with unnormed Legendre 
     // polynomials using the recursive formula
     val_array[0] = 1.;
     der_array[0] = 0;
     val_array[1] = x;
     der_array[1] = 1.;
-    for (int i=1; i < MAX_P; i++) {
-      val_array[i+1]  = (2*i+1)*x*val_array[i] - i*val_array[i-1]; // last index is MAX_P
+    for (int i=1; i < max_p; i++) {
+      val_array[i+1]  = (2*i+1)*x*val_array[i] - i*val_array[i-1]; // last index is max_p
       val_array[i+1] /= i+1; 
       der_array[i+1]  = (2*i+1)*(val_array[i] + x*der_array[i]) 
                         - i*der_array[i-1]; 
       der_array[i+1] /= i+1; 
     }
     // normalization
-    for (int i=0; i < MAX_P + 1; i++) {   
-      val_array[i] /= leg_norm_const_ref(i);   // last index is MAX_P
+    for (int i=0; i < max_p + 1; i++) {   
+      val_array[i] /= leg_norm_const_ref(i);   // last index is max_p
       der_array[i] /= leg_norm_const_ref(i);
     }
 }
 
-// FIXME - this function is inefficient, 
-// it fills the whole array
 extern double legendre_val_ref(double x, int n) 
 {
     // first fill the array with unnormed Legendre 
     // polynomials using the recursive formula
     double val_array[MAX_P + 1];
     double der_array[MAX_P + 1];
-    fill_legendre_array_ref(x, val_array, der_array);
+    fill_legendre_array_ref(x, val_array, der_array, n > 1 ? n : 1);
     return val_array[n];
 }
 
-// FIXME - this function is inefficient,
-// it fills the whole array
 extern double legendre_der_ref(double x, int n) 
 {
     // first fill the array with unnormed Legendre 
     // polynomials using the recursive formula
     double val_array[MAX_P + 1];
     double der_array[MAX_P + 1];
-    fill_legendre_array_ref(x, val_array, der_array);
+    fill_legendre_array_ref(x, val_array, der_array, n > 1 ? n : 1);
     return der_array[n];
 }
 
@@ -107,7 +105,8 @@ double legendre_val_phys_plot(int i, double a, double b, double x) {  // x \in (
 void legendre_val_phys_quad(int flag, int quad_order, int fns_num, 
                        double a, double b,  
                        double leg_pol_val[MAX_QUAD_PTS_NUM][MAX_P+1]) 
-{ 
+{
+  legendre_tab_init(quad_order);
   double norm_const = sqrt(2/(b-a));
   int pts_num = g_quad_1d_std.get_num_points(quad_order);
   if (flag == 0) {
@@ -153,6 +152,7 @@ void legendre_der_phys_quad(int flag, int quad_order, int fns_num,
                        double a, double b,  
                        double leg_pol_der[MAX_QUAD_PTS_NUM][MAX_P+1]) 
 {
+  legendre_tab_init(quad_order);
   double norm_const = sqrt(2/(b-a));
   norm_const *= 2./(b-a); // to account for interval stretching/shortening
   int pts_num = g_quad_1d_std.get_num_points(quad_order);
@@ -183,76 +183,71 @@ void legendre_der_phys_quad(int flag, int quad_order, int fns_num,
   }
 }
 
-// Legendre polynomials in (-1, 1)
-void precalculate_legendre_1d() 
+// legendre_tab_ready[quad_order] is set once the tables are filled 
+// for the quadrature rule of order 'quad_order'
+static int legendre_tab_ready[MAX_QUAD_ORDER];
+
+// fills the tables for one quadrature order: Legendre polynomials 
+// in (-1, 1), and their halves in (-1, 0) and (0, 1)
+static void fill_legendre_tab(int quad_order)
 {
-  // erasing
-  for (int quad_order=0; quad_order < MAX_QUAD_ORDER; quad_order++) {
-    for (int point_id=0; point_id < MAX_QUAD_PTS_NUM; point_id++) {
-      for (int poly_deg=0; poly_deg < MAX_P + 1; poly_deg++) {
-        legendre_val_ref_tab[quad_order][point_id][poly_deg] = 0;
-        legendre_der_ref_tab[quad_order][point_id][poly_deg] = 0;
-      }
-    }
+  int pts_num = g_quad_1d_std.get_num_points(quad_order);
+  double2 *ref_tab = g_quad_1d_std.get_points(quad_order);
+  for (int point_id=0; point_id < pts_num; point_id++) {
+    double x_ref = ref_tab[point_id][0];
+    fill_legendre_array_ref(x_ref, legendre_val_ref_tab[quad_order][point_id],
+                        legendre_der_ref_tab[quad_order][point_id]);
+    x_ref = (ref_tab[point_id][0] - 1.) / 2.; // transf to (-1, 0)
+    fill_legendre_array_ref(x_ref, 
+              legendre_val_ref_tab_left[quad_order][point_id],
+              legendre_der_ref_tab_left[quad_order][point_id]);
+    x_ref = (ref_tab[point_id][0] + 1.) / 2.; // transf to (0, 1)
+    fill_legendre_array_ref(x_ref, 
+          legendre_val_ref_tab_right[quad_order][point_id],
+          legendre_der_ref_tab_right[quad_order][point_id]);
   }
+}
 
-  for (int quad_order=0; quad_order < MAX_QUAD_ORDER; quad_order++) {
-    int pts_num = g_quad_1d_std.get_num_points(quad_order);
-    double2 *ref_tab = g_quad_1d_std.get_points(quad_order);
-    for (int point_id=0; point_id < pts_num; point_id++) {
-      double x_ref = ref_tab[point_id][0];
-      fill_legendre_array_ref(x_ref, legendre_val_ref_tab[quad_order][point_id],
-                          legendre_der_ref_tab[quad_order][point_id]);
+void legendre_tab_init(int quad_order)
+{
+  if (quad_order < 0 || quad_order >= MAX_QUAD_ORDER) 
+    error("Quadrature order out of range in legendre_tab_init().");
+  // the tables are shared by all threads (see calc_error_estimate());
+  // the flag is read atomically and the flush makes the filled tables 
+  // visible to this thread
+  int ready;
+#pragma omp atomic read
+  ready = legendre_tab_ready[quad_order];
+  if (ready) {
+#pragma omp flush
+    return;
+  }
+#pragma omp critical (legendre_tab)
+  {
+    if (!legendre_tab_ready[quad_order]) {
+      fill_legendre_tab(quad_order);
+#pragma omp flush
+#pragma omp atomic write
+      legendre_tab_ready[quad_order] = 1;
     }
   }
 }
 
+// Legendre polynomials in (-1, 1)
+void precalculate_legendre_1d() 
+{
+  for (int quad_order=0; quad_order < MAX_QUAD_ORDER; quad_order++) 
+    legendre_tab_init(quad_order);
+}
+
 // half polynomials in (-1, 0)
 void precalculate_legendre_1d_left() 
 {
-  // erasing
-  for (int quad_order=0; quad_order < MAX_QUAD_ORDER; quad_order++) {
-    for (int point_id=0; point_id < MAX_QUAD_PTS_NUM; point_id++) {
-      for (int poly_deg=0; poly_deg < MAX_P + 1; poly_deg++) {
-        legendre_val_ref_tab_left[quad_order][point_id][poly_deg] = 0;
-        legendre_der_ref_tab_left[quad_order][point_id][poly_deg] = 0;
-      }
-    }
-  }
-
-  for (int quad_order=0; quad_order < MAX_QUAD_ORDER; quad_order++) {
-    int pts_num = g_quad_1d_std.get_num_points(quad_order);
-    double2 *ref_tab = g_quad_1d_std.get_points(quad_order);
-    for (int point_id=0; point_id < pts_num; point_id++) {
-      double x_ref = (ref_tab[point_id][0] - 1.) / 2.; // transf to (-1, 0)
-      fill_legendre_array_ref(x_ref, 
-                legendre_val_ref_tab_left[quad_order][point_id],
-                legendre_der_ref_tab_left[quad_order][point_id]);
-    }
-  }
+  precalculate_legendre_1d();
 }
 
 // half polynomials in (0, 1)
 void precalculate_legendre_1d_right() 
 {
-  // erasing
-  for (int quad_order=0; quad_order < MAX_QUAD_ORDER; quad_order++) {
-    for (int point_id=0; point_id < MAX_QUAD_PTS_NUM; point_id++) {
-      for (int poly_deg=0; poly_deg < MAX_P + 1; poly_deg++) {
-        legendre_val_ref_tab_right[quad_order][point_id][poly_deg] = 0;
-        legendre_der_ref_tab_right[quad_order][point_id][poly_deg] = 0;
-      }
-    }
-  }
-
-  for (int quad_order=0; quad_order < MAX_QUAD_ORDER; quad_order++) {
-    int pts_num = g_quad_1d_std.get_num_points(quad_order);
-    double2 *ref_tab = g_quad_1d_std.get_points(quad_order);
-    for (int point_id=0; point_id < pts_num; point_id++) {
-      double x_ref = (ref_tab[point_id][0] + 1.) / 2.; // transf to (0, 1)
-      fill_legendre_array_ref(x_ref, 
-            legendre_val_ref_tab_right[quad_order][point_id],
-            legendre_der_ref_tab_right[quad_order][point_id]);
-    }
-  }
+  precalculate_legendre_1d();
 }
@@ -14,13 +14,20 @@
 extern double leg_norm_const_ref(int n);
 extern void fill_legendre_array_ref(double x, 
                                 double val_array[MAX_P+1],
-                                double der_array[MAX_P+1]);
+                                double der_array[MAX_P+1], 
+                                int max_p=MAX_P);
 extern double legendre_val_ref(double x, int n);
 extern double legendre_der_ref(double x, int n);
 
 // Poly orders of Legendre polynomials
 extern int legendre_order_1d[];
 
+// Fills the tables below for the Gauss quadrature rule of order 
+// 'quad_order' unless this was done before. The tables are built 
+// lazily, order by order, and must not be read for an order before 
+// this was called. Safe to call from several threads.
+extern void legendre_tab_init(int quad_order);
+
 // Precalculated values of Legendre polynomials and their derivatives 
 // at all Gauss quadrature rules on the reference
 // interval (-1, 1). The first index runs through Gauss quadrature 
@@ -29,6 +36,7 @@ extern int legendre_order_1d[];
 // Lobatto polynomials at that point. 
 extern double legendre_val_ref_tab[MAX_QUAD_ORDER][MAX_QUAD_PTS_NUM][MAX_P + 1];
 extern double legendre_der_ref_tab[MAX_QUAD_ORDER][MAX_QUAD_PTS_NUM][MAX_P + 1];
+// fills the tables for all quadrature orders
 extern void precalculate_legendre_1d();
 
 // Precalculated values of Legendre polynomials and their derivatives 
@@ -14,11 +14,13 @@ void Linearizer::eval_approx(int sln, Element *e, double x_ref,
                              double *x_phys, double *val) 
 {
   int n_eq = this->mesh->get_n_eq();
+  double shape_val[MAX_P+1], shape_der[MAX_P+1];
+  fill_lobatto_array_ref(x_ref, shape_val, shape_der, e->p > 1 ? e->p : 1);
   for(int c=0; c<n_eq; c++) { // loop over solution components
     val[c] = 0;
     for(int i=0; i <= e->p; i++) { // loop over shape functions
-      if(e->dof[c][i] >= 0) val[c] += 
-                  e->coeffs[sln][c][i]*lobatto_val_ref(x_ref, i);
+      if(e->dof(c, i) >= 0) val[c] += 
+                  e->coeffs(sln, c, i)*shape_val[i];
     }
   }
   double a = e->x1;
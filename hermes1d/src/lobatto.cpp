@@ -45,16 +45,17 @@ static double lobatto_der_1(double x) {
 
 // Fills an array of length MAX_P + 1 with Lobatto shape 
 // functions (integrated normalized Legendre polynomials) 
-// at point 'x'. 
+// at point 'x'. Only the entries 0, 1, ..., max_p are filled.
 extern void fill_lobatto_array_ref(double x, 
                                    double lobatto_array_val[MAX_P+1],
-                                   double lobatto_array_der[MAX_P+1]) {
+                                   double lobatto_array_der[MAX_P+1],
+                                   int max_p) {
     double legendre_array[MAX_P + 1];
     // calculating (non-normalized) Legendre polynomials
     legendre_array[0] = 1.;
     legendre_array[1] = x;
-    for (int i=1; i < MAX_P; i++) {
-      legendre_array[i+1]  = (2*i+1)*x*legendre_array[i] // last index is MAX_P
+    for (int i=1; i < max_p; i++) {
+      legendre_array[i+1]  = (2*i+1)*x*legendre_array[i] // last index is max_p
                              - i*legendre_array[i-1]; 
       legendre_array[i+1] /= i+1; 
     }
@@ -65,8 +66,8 @@ extern void fill_lobatto_array_ref(double x,
     lobatto_array_der[1] = lobatto_der_1(x);
     // then fill the quadratic and higher which actually are 
     // the integrated Legendre polynomials
-    for (int i=1; i < MAX_P; i++) {
-      lobatto_array_val[i+1] =                           // last index is MAX_P
+    for (int i=1; i < max_p; i++) {
+      lobatto_array_val[i+1] =                           // last index is max_p
         (legendre_array[i+1] - legendre_array[i-1]) / (2.*i + 1.);
       lobatto_array_val[i+1] /= leg_norm_const_ref(i);
       lobatto_array_der[i+1] = legendre_array[i]; 
@@ -74,97 +75,87 @@ extern void fill_lobatto_array_ref(double x,
     }
 }
 
-// FIXME - this function is inefficient, it fills the
-// whole array
 extern double lobatto_val_ref(double x, int n) 
 {
     double val_array[MAX_P + 1];
     double der_array[MAX_P + 1];
-    fill_lobatto_array_ref(x, val_array, der_array);
-    //printf("val_array[%d] = %g\n", n, val_array[n]);
+    fill_lobatto_array_ref(x, val_array, der_array, n > 1 ? n : 1);
     return val_array[n];
 }
 
-// FIXME - this function is inefficient, it fills the
-// whole array
 extern double lobatto_der_ref(double x, int n) 
 {
     double val_array[MAX_P + 1];
     double der_array[MAX_P + 1];
-    fill_lobatto_array_ref(x, val_array, der_array);
+    fill_lobatto_array_ref(x, val_array, der_array, n > 1 ? n : 1);
     return der_array[n];
 }
 
-// integrated Legendre polynomials in (-1, 1)
-void precalculate_lobatto_1d() 
+// lobatto_tab_ready[quad_order] is set once the tables are filled 
+// for the quadrature rule of order 'quad_order'
+static int lobatto_tab_ready[MAX_QUAD_ORDER];
+
+// fills the tables for one quadrature order: integrated Legendre 
+// polynomials in (-1, 1), and their halves in (-1, 0) and (0, 1)
+static void fill_lobatto_tab(int quad_order)
 {
-  // erasing
-  for (int quad_order=0; quad_order < MAX_QUAD_ORDER; quad_order++) {
-    for (int point_id=0; point_id < MAX_QUAD_PTS_NUM; point_id++) {
-      for (int poly_deg=0; poly_deg < MAX_P + 1; poly_deg++) {
-        lobatto_val_ref_tab[quad_order][point_id][poly_deg] = 0;
-      }
-    }
+  int pts_num = g_quad_1d_std.get_num_points(quad_order);
+  double2 *ref_tab = g_quad_1d_std.get_points(quad_order);
+  for (int point_id=0; point_id < pts_num; point_id++) {
+    double x_ref = ref_tab[point_id][0];
+    fill_lobatto_array_ref(x_ref, lobatto_val_ref_tab[quad_order][point_id],
+                           lobatto_der_ref_tab[quad_order][point_id]);
+    x_ref = (ref_tab[point_id][0] - 1.) / 2.;  // transf to (-1, 0)
+    fill_lobatto_array_ref(x_ref, 
+          lobatto_val_ref_tab_left[quad_order][point_id],
+          lobatto_der_ref_tab_left[quad_order][point_id]);
+    x_ref = (ref_tab[point_id][0] + 1.) / 2.;  // transf to (0, 1)
+    fill_lobatto_array_ref(x_ref, 
+          lobatto_val_ref_tab_right[quad_order][point_id],
+          lobatto_der_ref_tab_right[quad_order][point_id]);
   }
+}
 
-  for (int quad_order=0; quad_order < MAX_QUAD_ORDER; quad_order++) {
-    int pts_num = g_quad_1d_std.get_num_points(quad_order);
-    double2 *ref_tab = g_quad_1d_std.get_points(quad_order);
-    for (int point_id=0; point_id < pts_num; point_id++) {
-      double x_ref = ref_tab[point_id][0];
-      fill_lobatto_array_ref(x_ref, lobatto_val_ref_tab[quad_order][point_id],
-                             lobatto_der_ref_tab[quad_order][point_id]);
+void lobatto_tab_init(int quad_order)
+{
+  if (quad_order < 0 || quad_order >= MAX_QUAD_ORDER) 
+    error("Quadrature order out of range in lobatto_tab_init().");
+  // the tables are shared by all threads (see calc_error_estimate());
+  // the flag is read atomically and the flush makes the filled tables 
+  // visible to this thread
+  int ready;
+#pragma omp atomic read
+  ready = lobatto_tab_ready[quad_order];
+  if (ready) {
+#pragma omp flush
+    return;
+  }
+#pragma omp critical (lobatto_tab)
+  {
+    if (!lobatto_tab_ready[quad_order]) {
+      fill_lobatto_tab(quad_order);
+#pragma omp flush
+#pragma omp atomic write
+      lobatto_tab_ready[quad_order] = 1;
     }
   }
 }
 
+// integrated Legendre polynomials in (-1, 1)
+void precalculate_lobatto_1d() 
+{
+  for (int quad_order=0; quad_order < MAX_QUAD_ORDER; quad_order++) 
+    lobatto_tab_init(quad_order);
+}
+
 // half-polynomials in (-1, 0)
 void precalculate_lobatto_1d_left() 
 {
-  // erasing
-  for (int quad_order=0; quad_order < MAX_QUAD_ORDER; quad_order++) {
-    for (int point_id=0; point_id < MAX_QUAD_PTS_NUM; point_id++) {
-      for (int poly_deg=0; poly_deg < MAX_P + 1; poly_deg++) {
-        lobatto_val_ref_tab_left[quad_order][point_id][poly_deg] = 0;
-        lobatto_der_ref_tab_left[quad_order][point_id][poly_deg] = 0;
-      }
-    }
-  }
-
-  for (int quad_order=0; quad_order < MAX_QUAD_ORDER; quad_order++) {
-    int pts_num = g_quad_1d_std.get_num_points(quad_order);
-    double2 *ref_tab = g_quad_1d_std.get_points(quad_order);
-    for (int point_id=0; point_id < pts_num; point_id++) {
-      double x_ref = (ref_tab[point_id][0] - 1.) / 2.;  // transf to (-1, 0)
-      fill_lobatto_array_ref(x_ref, 
-            lobatto_val_ref_tab_left[quad_order][point_id],
-            lobatto_der_ref_tab_left[quad_order][point_id]);
-    }
-  }
+  precalculate_lobatto_1d();
 }
 
 // half-polynomials in (0, 1)
 void precalculate_lobatto_1d_right() 
 {
-  // erasing
-  for (int quad_order=0; quad_order < MAX_QUAD_ORDER; quad_order++) {
-    for (int point_id=0; point_id < MAX_QUAD_PTS_NUM; point_id++) {
-      for (int poly_deg=0; poly_deg < MAX_P + 1; poly_deg++) {
-        lobatto_val_ref_tab_right[quad_order][point_id][poly_deg] = 0;
-        lobatto_der_ref_tab_right[quad_order][point_id][poly_deg] = 0;
-      }
-    }
-  }
-
-  for (int quad_order=0; quad_order < MAX_QUAD_ORDER; quad_order++) {
-    int pts_num = g_quad_1d_std.get_num_points(quad_order);
-    double2 *ref_tab = g_quad_1d_std.get_points(quad_order);
-    for (int point_id=0; point_id < pts_num; point_id++) {
-      double x_ref = (ref_tab[point_id][0] + 1.) / 2.;  // transf to (0, 1)
-      fill_lobatto_array_ref(x_ref, 
-              lobatto_val_ref_tab_right[quad_order][point_id],
-              lobatto_der_ref_tab_right[quad_order][point_id]);
-    }
-  }
+  precalculate_lobatto_1d();
 }
-
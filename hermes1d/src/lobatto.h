@@ -12,13 +12,19 @@
 
 void fill_lobatto_array_ref(double x, 
 			double lobatto_array_val[MAX_P+1],
-			double lobatto_array_der[MAX_P+1]);
+			double lobatto_array_der[MAX_P+1], int max_p=MAX_P);
 double lobatto_val_ref(double x, int n);
 double lobatto_der_ref(double x, int n);
 
 // Poly orders of Lobatto functions
 extern int lobatto_order_1d[];
 
+// Fills the tables below for the Gauss quadrature rule of order 
+// 'quad_order' unless this was done before. The tables are built 
+// lazily, order by order, and must not be read for an order before 
+// this was called. Safe to call from several threads.
+extern void lobatto_tab_init(int quad_order);
+
 // Precalculated values of Lobatto polynomials and their derivatives 
 // at all Gauss quadrature rules on the reference interval (-1, 1). 
 // The first index runs through Gauss quadrature 
@@ -27,6 +33,7 @@ extern int lobatto_order_1d[];
 // Legendre polynomials at that point. 
 extern double lobatto_val_ref_tab[MAX_QUAD_ORDER][MAX_QUAD_PTS_NUM][MAX_P + 1];
 extern double lobatto_der_ref_tab[MAX_QUAD_ORDER][MAX_QUAD_PTS_NUM][MAX_P + 1];
+// fills the tables for all quadrature orders
 extern void precalculate_lobatto_1d();
 
 // The first index runs through Gauss quadrature 
@@ -9,6 +9,8 @@
 #include "transforms.h"
 #include "linearizer.h"
 
+#include <vector>
+
 // debug - prints element dof arrays in assign_dofs()
 int DEBUG_ELEM_DOF = 0;
 
@@ -16,14 +18,6 @@ Element::Element()
 {
   x1 = x2 = 0;
   p = 0; 
-  for (int j=0; j < MAX_EQN_NUM; j++) {
-    for (int k=0; k < MAX_P + 1; k++) {
-      dof[j][k] = 0;
-      for (int sln=0; sln < MAX_SLN_NUM; sln++) {
-        coeffs[sln][j][k] = 0;
-      }
-    }
-  }
   sons[0] = sons[1] = NULL; 
   active = 1;
   level = 0;
@@ -31,16 +25,25 @@ Element::Element()
   id = -1;
   n_eq = 0;
   n_sln = 0;
+  storage = NULL;
+  dof_arr = NULL;
+  coeffs_arr = NULL;
+  n_fns = 0;
 }
 
-Element::Element(double x_left, double x_right, int level, int deg, int n_eq, int n_sln, int marker) 
+Element::Element(double x_left, double x_right, int level, int deg, int n_eq, int n_sln, int marker,
+                 ElemStorage *storage) 
 {
   x1 = x_left;
   x2 = x_right;
   p = deg; 
-  this->n_eq = n_eq;
-  this->n_sln = n_sln;
-  if (dof == NULL) error("Not enough memory in Element().");
+  this->storage = storage;
+  dof_arr = NULL;
+  coeffs_arr = NULL;
+  n_fns = 0;
+  this->n_eq = 0;
+  this->n_sln = 0;
+  this->alloc_arrays(n_eq, n_sln, deg + 1);
   sons[0] = sons[1] = NULL; 
   active = 1;
   this->level = level;
@@ -48,6 +51,64 @@ Element::Element(double x_left, double x_right, int level, int deg, int n_eq, in
   id = -1;
 }
 
+// (Re)allocates the dof and coeffs arrays for the given number of 
+// equations, solutions and shape functions, from the mesh storage 
+// if the element has one. Entries present in both the old and new 
+// arrays are kept, new entries are zero.
+void Element::alloc_arrays(int n_eq, int n_sln, int n_fns)
+{
+  if (n_fns < 0) n_fns = 0;
+  if (n_eq == this->n_eq && n_sln == this->n_sln && n_fns == this->n_fns) return;
+
+  int n_dof_new = n_eq*n_fns;
+  int n_coeffs_new = n_sln*n_eq*n_fns;
+  int *dof_new = NULL;
+  double *coeffs_new = NULL;
+  if (n_dof_new > 0) {
+    if (this->storage != NULL) {
+      dof_new = this->storage->dofs.alloc(n_dof_new);
+      coeffs_new = this->storage->coeffs.alloc(n_coeffs_new);
+    }
+    else {
+      dof_new = new int[n_dof_new];
+      coeffs_new = new double[n_coeffs_new];
+    }
+    if (dof_new == NULL || coeffs_new == NULL) error("Not enough memory in Element::alloc_arrays().");
+    for (int i=0; i < n_dof_new; i++) dof_new[i] = 0;
+    for (int i=0; i < n_coeffs_new; i++) coeffs_new[i] = 0;
+  }
+
+  // keep the common part
+  int c_num = n_eq < this->n_eq ? n_eq : this->n_eq;
+  int sln_num = n_sln < this->n_sln ? n_sln : this->n_sln;
+  int j_num = n_fns < this->n_fns ? n_fns : this->n_fns;
+  for (int c=0; c < c_num; c++) {
+    for (int j=0; j < j_num; j++) {
+      dof_new[c*n_fns + j] = this->dof_arr[c*this->n_fns + j];
+      for (int sln=0; sln < sln_num; sln++) {
+        coeffs_new[(sln*n_eq + c)*n_fns + j] = 
+          this->coeffs_arr[(sln*this->n_eq + c)*this->n_fns + j];
+      }
+    }
+  }
+
+  int n_dof_old = this->n_eq*this->n_fns;
+  if (this->storage != NULL) {
+    this->storage->dofs.release(this->dof_arr, n_dof_old);
+    this->storage->coeffs.release(this->coeffs_arr, this->n_sln*n_dof_old);
+  }
+  else {
+    delete [] this->dof_arr;
+    delete [] this->coeffs_arr;
+  }
+
+  this->dof_arr = dof_new;
+  this->coeffs_arr = coeffs_new;
+  this->n_eq = n_eq;
+  this->n_sln = n_sln;
+  this->n_fns = n_fns;
+}
+
 unsigned Element::is_active() 
 {
   return this->active;
@@ -62,27 +123,30 @@ unsigned Element::is_active()
 void Element::refine(int type, int p_left, int p_right) 
 {
   if(type == 0) {         // p-refinement
+    this->alloc_arrays(this->n_eq, this->n_sln, p_left + 1);
     this->p = p_left;
   }
   else {
     double x1 = this->x1;
     double x2 = this->x2;
     double midpoint = (x1 + x2)/2.; 
-    this->sons[0] = new Element(x1, midpoint, this->level + 1, p_left, this->n_eq, this->n_sln, this->marker);
+    this->sons[0] = new Element(x1, midpoint, this->level + 1, p_left, this->n_eq, 
+                                this->n_sln, this->marker, this->storage);
     this->sons[1] = new Element(midpoint, x2, this->level + 1, 
-                                p_right, this->n_eq, this->n_sln, this->marker);
+                                p_right, this->n_eq, this->n_sln, this->marker, 
+                                this->storage);
     // Copy Dirichtel boundary conditions to sons
     for(int c=0; c<this->n_eq; c++) {
-      if (this->dof[c][0] < 0) {
-        this->sons[0]->dof[c][0] = this->dof[c][0];
+      if (this->dof(c, 0) < 0) {
+        this->sons[0]->dof(c, 0) = this->dof(c, 0);
         for(int sln=0; sln<this->n_sln; sln++) {
-          this->sons[0]->coeffs[sln][c][0] = this->coeffs[sln][c][0];
+          this->sons[0]->coeffs(sln, c, 0) = this->coeffs(sln, c, 0);
         }
       }
-      if (this->dof[c][1] < 0) {
-        this->sons[1]->dof[c][1] = this->dof[c][1];
+      if (this->dof(c, 1) < 0) {
+        this->sons[1]->dof(c, 1) = this->dof(c, 1);
         for(int sln=0; sln<this->n_sln; sln++) {
-          this->sons[1]->coeffs[sln][c][1] = this->coeffs[sln][c][1];
+          this->sons[1]->coeffs(sln, c, 1) = this->coeffs(sln, c, 1);
         }
       }
     }
@@ -104,6 +168,7 @@ void Element::refine(int3 cand)
 void Element::init(double x1, double x2, int p_init, 
                    int id, int active, int level, int n_eq, int n_sln, int marker)
 {
+  this->alloc_arrays(n_eq, n_sln, p_init + 1);
   this->x1 = x1;
   this->x2 = x2;
   this->p = p_init;
@@ -111,8 +176,6 @@ void Element::init(double x1, double x2, int p_init,
   this->active = active;
   this->level = level;
   this->marker = marker;
-  this->n_eq = n_eq;
-  this->n_sln = n_sln;
 }
 
 // Copies coefficients from the solution vector into element.
@@ -122,7 +185,7 @@ void Element::get_coeffs_from_vector(double *y, int sln)
   if (!this->is_active()) error("Internal in get_coeffs_from_vector().");
   for(int c=0; c<this->n_eq; c++) {
     for (int j=0; j < this->p + 1; j++) {
-      if (this->dof[c][j] != -1) this->coeffs[sln][c][j] = y[this->dof[c][j]];
+      if (this->dof(c, j) != -1) this->coeffs(sln, c, j) = y[this->dof(c, j)];
     }
   }
 }
@@ -131,7 +194,7 @@ void Element::get_coeffs(int sln, int comp, double coeffs[])
 {
   if (!this->is_active()) error("Internal in get_coeffs().");
     for (int j=0; j < this->p + 1; j++) {
-      coeffs[j] = this->coeffs[sln][comp][j];
+      coeffs[j] = this->coeffs(sln, comp, j);
     }
 }
 
@@ -142,7 +205,7 @@ void Element::copy_coeffs_to_vector(double *y, int sln)
   if (!this->is_active()) error("Internal in copy_coeffs_to_vector().");
   for(int c=0; c<this->n_eq; c++) {
     for (int j=0; j < this->p + 1; j++) {
-      if (this->dof[c][j] != -1) y[this->dof[c][j]] = this->coeffs[sln][c][j];
+      if (this->dof(c, j) != -1) y[this->dof(c, j)] = this->coeffs(sln, c, j);
     }
   }
 }
@@ -151,8 +214,8 @@ void Element::copy_dofs(int sln_src, int sln_trg)
 {
   for (int c = 0; c < this -> n_eq; c++) {    // loop over solution components
     for (int i = 0; i < this -> p + 1; i++) {     // loop over coefficients
-      if (this->dof[c][i] >= 0) {
-        coeffs[sln_trg][c][i] = coeffs[sln_src][c][i];
+      if (this->dof(c, i) >= 0) {
+        this->coeffs(sln_trg, c, i) = this->coeffs(sln_src, c, i);
       }
     }
   }
@@ -173,15 +236,15 @@ void Element::get_solution_quad(int flag, int quad_order,
 
   double jac = (this->x2 - this->x1)/2.; // Jacobian of reference map
   int p = this->p;
-  double x_ref[MAX_QUAD_PTS_NUM];
+  lobatto_tab_init(quad_order);
   // filling the values and derivatives
   if (flag == 0) { // integration points in the whole element
     for(int c=0; c<this->n_eq; c++) { 
       for (int i=0 ; i < pts_num; i++) {
         der_phys[c][i] = val_phys[c][i] = 0;
         for(int j=0; j<=p; j++) {
-          val_phys[c][i] += this->coeffs[sln][c][j]*lobatto_val_ref_tab[quad_order][i][j];
-          der_phys[c][i] += this->coeffs[sln][c][j]*lobatto_der_ref_tab[quad_order][i][j];
+          val_phys[c][i] += this->coeffs(sln, c, j)*lobatto_val_ref_tab[quad_order][i][j];
+          der_phys[c][i] += this->coeffs(sln, c, j)*lobatto_der_ref_tab[quad_order][i][j];
         }
         der_phys[c][i] /= jac;
       }
@@ -192,8 +255,8 @@ void Element::get_solution_quad(int flag, int quad_order,
       for (int i=0 ; i < pts_num; i++) {
         der_phys[c][i] = val_phys[c][i] = 0;
         for(int j=0; j<=p; j++) {
-          val_phys[c][i] += this->coeffs[sln][c][j]*lobatto_val_ref_tab_left[quad_order][i][j];
-          der_phys[c][i] += this->coeffs[sln][c][j]*lobatto_der_ref_tab_left[quad_order][i][j];
+          val_phys[c][i] += this->coeffs(sln, c, j)*lobatto_val_ref_tab_left[quad_order][i][j];
+          der_phys[c][i] += this->coeffs(sln, c, j)*lobatto_der_ref_tab_left[quad_order][i][j];
         }
         der_phys[c][i] /= jac;
       }
@@ -204,8 +267,8 @@ void Element::get_solution_quad(int flag, int quad_order,
       for (int i=0 ; i < pts_num; i++) {
         der_phys[c][i] = val_phys[c][i] = 0;
         for(int j=0; j<=p; j++) {
-          val_phys[c][i] += this->coeffs[sln][c][j]*lobatto_val_ref_tab_right[quad_order][i][j];
-          der_phys[c][i] += this->coeffs[sln][c][j]*lobatto_der_ref_tab_right[quad_order][i][j];
+          val_phys[c][i] += this->coeffs(sln, c, j)*lobatto_val_ref_tab_right[quad_order][i][j];
+          der_phys[c][i] += this->coeffs(sln, c, j)*lobatto_der_ref_tab_right[quad_order][i][j];
         }
         der_phys[c][i] /= jac;
       }
@@ -226,13 +289,16 @@ void Element::get_solution_plot(double x_phys[MAX_PLOT_PTS_NUM], int pts_num,
   double x_ref[MAX_PLOT_PTS_NUM];
   // transforming points to (-1, 1)
   for (int i=0 ; i < pts_num; i++) x_ref[i] = inverse_map(x1, x2, x_phys[i]);
-  // filling the values and derivatives
-  for(int c=0; c<this->n_eq; c++) { 
-    for (int i=0 ; i < pts_num; i++) {
+  // filling the values and derivatives, all shape functions 
+  // are evaluated at once in every point
+  double shape_val[MAX_P+1], shape_der[MAX_P+1];
+  for (int i=0 ; i < pts_num; i++) {
+    fill_lobatto_array_ref(x_ref[i], shape_val, shape_der, p > 1 ? p : 1);
+    for(int c=0; c<this->n_eq; c++) { 
       der_phys[c][i] = val_phys[c][i] = 0;
       for(int j=0; j<=p; j++) {
-        val_phys[c][i] += this->coeffs[sln][c][j]*lobatto_val_ref(x_ref[i], j);
-        der_phys[c][i] += this->coeffs[sln][c][j]*lobatto_der_ref(x_ref[i], j);
+        val_phys[c][i] += this->coeffs(sln, c, j)*shape_val[j];
+        der_phys[c][i] += this->coeffs(sln, c, j)*shape_der[j];
       }
       der_phys[c][i] /= jac;
     }
@@ -309,11 +375,13 @@ void Element::get_solution_point(double x_phys,
   int p = this->p;
   // transforming point x_phys to (-1, 1)
   double x_ref = inverse_map(x1, x2, x_phys);
+  double shape_val[MAX_P+1], shape_der[MAX_P+1];
+  fill_lobatto_array_ref(x_ref, shape_val, shape_der, p > 1 ? p : 1);
   for(int c=0; c < this->n_eq; c++) {
     der[c] = val[c] = 0;
     for(int j=0; j<=p; j++) {
-      val[c] += this->coeffs[sln][c][j]*lobatto_val_ref(x_ref, j);
-      der[c] += this->coeffs[sln][c][j]*lobatto_der_ref(x_ref, j);
+      val[c] += this->coeffs(sln, c, j)*shape_val[j];
+      der[c] += this->coeffs(sln, c, j)*shape_der[j];
     }
     der[c] /= jac;
   }
@@ -329,10 +397,10 @@ void Element::copy_into(Element *e_trg)
 
   // copy dof arrays for all solution components
   for(int c=0; c < this->n_eq; c++) {
-    for(int i=0; i < MAX_P + 1; i++) {
-      e_trg->dof[c][i] = this->dof[c][i];
+    for(int i=0; i < this->p + 1; i++) {
+      e_trg->dof(c, i) = this->dof(c, i);
       for(int sln=0; sln < this->n_sln; sln++) {
-        e_trg->coeffs[sln][c][i] = this->coeffs[sln][c][i];
+        e_trg->coeffs(sln, c, i) = this->coeffs(sln, c, i);
       }
     }
   }
@@ -349,6 +417,8 @@ void Element::copy_recursively_into(Element *e_trg)
   if(this->sons[0] != NULL) {          // element was split in space (sons will be replicated)
     e_trg->sons[0] = new Element();
     e_trg->sons[1] = new Element();
+    e_trg->sons[0]->storage = e_trg->storage;
+    e_trg->sons[1]->storage = e_trg->storage;
     // left son
     this->sons[0]->copy_recursively_into(e_trg->sons[0]);
     // right son
@@ -390,6 +460,8 @@ Mesh::Mesh(double a, double b, int n_base_elem, int p_init, int n_eq, int
   // check maximum number of equations
   if(n_eq > MAX_EQN_NUM) 
   error("Maximum number of equations exceeded (set in common.h)");
+  if(n_sln > MAX_SLN_NUM) 
+  error("Maximum number of solutions exceeded (set in common.h)");
 
   // all Mesh class variables
   this->left_endpoint = a;
@@ -412,6 +484,7 @@ Mesh::Mesh(double a, double b, int n_base_elem, int p_init, int n_eq, int
     int id = i;         
     int active = 1;
     int level = 0; 
+    this->base_elems[i].storage = &this->storage;
     this->base_elems[i].init(a + i*h, a + i*h + h, p_init, 
                              id, active, level, n_eq, n_sln, marker_default);
   }
@@ -434,6 +507,8 @@ Mesh::Mesh(int n_macro_elem, double *pts_array, int *p_array, int *m_array, int
   // check maximum number of equations
   if(n_eq > MAX_EQN_NUM) 
   error("Maximum number of equations exceeded (set in common.h)");
+  if(n_sln > MAX_SLN_NUM) 
+  error("Maximum number of solutions exceeded (set in common.h)");
 
   // calculate n_base_elem
   int n_base_elem = 0;
@@ -469,6 +544,7 @@ Mesh::Mesh(int n_macro_elem, double *pts_array, int *p_array, int *m_array, int
       int level = 0;
       double x_left = pts_array[i] + length * j;
       double x_right = x_left + length;
+      this->base_elems[count].storage = &this->storage;
       this->base_elems[count].init(x_left, x_right, p_array[i], id, active, level, n_eq, n_sln, m_array[i]);
       count++;
     }
@@ -539,9 +615,9 @@ void Mesh::set_bc_left_dirichlet(int eqn, double val)
   // left boundary, and fill the coeffs array entry
   Element *e = this->base_elems + 0;
   do {
-    e->dof[eqn][0] = -1;
+    e->dof(eqn, 0) = -1;
     for (int sln=0; sln < this->n_sln; sln++) {
-      e->coeffs[sln][eqn][0] = val;
+      e->coeffs(sln, eqn, 0) = val;
     }
     e = e->sons[0];
   } while (e != NULL);
@@ -554,9 +630,9 @@ void Mesh::set_bc_right_dirichlet(int eqn, double val)
   // right boundary, and fill the coeffs array entry
   Element *e = this->base_elems + this->n_base_elem - 1;
   do {
-    e->dof[eqn][1] = -1;
+    e->dof(eqn, 1) = -1;
     for (int sln=0; sln < this->n_sln; sln++) {
-      e->coeffs[sln][eqn][1] = val;
+      e->coeffs(sln, eqn, 1) = val;
     }
     e = e->sons[1];
   } while (e != NULL);
@@ -573,8 +649,8 @@ int Mesh::assign_dofs()
     Element *e;
     I->reset();
     while ((e = I->next_active_element()) != NULL) {
-      if (e->dof[c][0] != -1) e->dof[c][0] = count_dof++; 
-      if (e->dof[c][1] != -1) e->dof[c][1] = count_dof; 
+      if (e->dof(c, 0) != -1) e->dof(c, 0) = count_dof++; 
+      if (e->dof(c, 1) != -1) e->dof(c, 1) = count_dof; 
       else count_dof--;
     }
     count_dof++;
@@ -582,7 +658,7 @@ int Mesh::assign_dofs()
     I->reset();
     while ((e = I->next_active_element()) != NULL) {
       for(int j=2; j <= e->p; j++) {
-        e->dof[c][j] = count_dof;
+        e->dof(c, j) = count_dof;
         count_dof++;
       }
     }
@@ -604,7 +680,7 @@ int Mesh::assign_dofs()
         printf("\nElement (%g, %g), id = %d, p = %d\n ", 
                e->x1, e->x2, e->id, e->p); 
         for(int j = 0; j<e->p + 1; j++) {
-          printf("dof[%d][%d] = %d\n ", c, j, e->dof[c][j]);
+          printf("dof[%d][%d] = %d\n ", c, j, e->dof(c, j));
         }
       }
     }
@@ -742,6 +818,7 @@ void element_shapefn(double a, double b,
   //double2 *ref_tab = g_quad_1d_std.get_points(order);
   int pts_num = g_quad_1d_std.get_num_points(order);
   double jac = (b-a)/2.; 
+  lobatto_tab_init(order);
   for (int i=0 ; i < pts_num; i++) {
     // change function values and derivatives to interval (a, b)
     //val[i] = lobatto_val_ref(ref_tab[i][0], k);
@@ -1094,7 +1171,7 @@ void create_ref_index_array(double threshold, double *err_array,
   }
 
   // Create auxiliary array of element indices
-  int id_array[MAX_ELEM_NUM];
+  int *id_array = new int[n_elem];
   for(int i=0; i < n_elem; i++) {
     if(err_array[i] < threshold*max_elem_error) id_array[i] = -1; 
     else id_array[i] = i;
@@ -1118,6 +1195,7 @@ void create_ref_index_array(double threshold, double *err_array,
       num_to_adapt++;
     }
   }
+  delete [] id_array;
  
   /*
   // Debug: Printing list of elements to be refined
@@ -1127,6 +1205,33 @@ void create_ref_index_array(double threshold, double *err_array,
   */
 }
 
+// An element to be refined by adapt(), with its reference 
+// element(s), refinement candidates and the selected candidate
+struct RefinementItem {
+  Element *e, *e_new;
+  Element *e_ref_left, *e_ref_right;
+  Element *e_ref_new_left, *e_ref_new_right;
+  int ref_sol_type;
+  int num_cand;
+  int3 cand_list[MAX_CAND_NUM];
+  int choice;
+};
+
+// Selects the best refinement candidate for all items. Candidates 
+// of different elements are independent, so this is done in parallel.
+static void select_refinements(std::vector<RefinementItem> &items, int norm)
+{
+  int n = items.size();
+#pragma omp parallel for schedule(dynamic)
+  for (int i=0; i < n; i++) {
+    RefinementItem &item = items[i];
+    item.choice = select_hp_refinement(item.e, item.e_ref_left, 
+                                       item.e_ref_right, item.num_cand, 
+                                       item.cand_list, item.ref_sol_type, 
+                                       norm);
+  }
+}
+
 // Returns updated coarse and reference meshes, with the last 
 // coarse and reference mesh solutions on them, respectively. 
 // The coefficient vectors and numbers of degrees of freedom 
@@ -1139,7 +1244,7 @@ void adapt(int norm, int adapt_type, double threshold,
   
   // Use the err_array[] and threshold to create a list of 
   // elements to be refined.
-  int adapt_list[MAX_ELEM_NUM];
+  int *adapt_list = new int[n_elem];
   int num_to_adapt;
   create_ref_index_array(threshold, err_array, n_elem, adapt_list, num_to_adapt);
 
@@ -1150,9 +1255,10 @@ void adapt(int norm, int adapt_type, double threshold,
 
   // Simultaneous traversal of all meshes.
   // For each element in 'mesh_new', create a list of refinement 
-  // candidates and select the one that best resembles the reference 
-  // solution on 'mesh_ref_new'. While elements in 'mesh_new' are refined, 
-  // corresponding refinements are also done in 'mesh_ref_new'.
+  // candidates. Then select the ones that best resemble the reference 
+  // solution on 'mesh_ref_new' (in parallel) and refine the elements 
+  // in 'mesh_new'. Corresponding refinements are also done in 
+  // 'mesh_ref_new'.
   Iterator *I = new Iterator(mesh);
   Iterator *I_new = new Iterator(mesh_new);
   Iterator *I_ref = new Iterator(mesh_ref);
@@ -1161,100 +1267,44 @@ void adapt(int norm, int adapt_type, double threshold,
   Element *e_new = I_new->next_active_element();
   Element *e_ref = I_ref->next_active_element();
   Element *e_ref_new = I_ref_new->next_active_element();
+  std::vector<RefinementItem> items(num_to_adapt);
   int counter = 0;
   while (counter != num_to_adapt) {
     if (e->id == adapt_list[counter]) {
+      RefinementItem &item = items[counter];
       counter++;
-      int choice = 0;
-      // Every refinement candidate consists of three
-      // and then either one or two polynomial degrees
-      int3 cand_list[MAX_CAND_NUM];   
-      Element* e_ref_left;
-      Element* e_ref_right;
-      Element* e_ref_new_left;
-      Element* e_ref_new_right;
+      item.e = e;
+      item.e_new = e_new;
       // Element 'e' was not refined in space
       // for reference solution.
       if (e->level == e_ref->level) {
-        e_ref_left = e_ref;
-        e_ref_new_left = e_ref_new;
-        e_ref_right = NULL;
-        e_ref_new_right = NULL;
-        int num_cand = e->create_cand_list(adapt_type, e_ref->p, -1, cand_list);
+        item.e_ref_left = e_ref;
+        item.e_ref_new_left = e_ref_new;
+        item.e_ref_right = NULL;
+        item.e_ref_new_right = NULL;
+        item.ref_sol_type = 0;   // reference element was p-refined
+        item.num_cand = e->create_cand_list(adapt_type, e_ref->p, -1, 
+                                            item.cand_list);
         // debug:
-        //e->print_cand_list(num_cand, cand_list);
-        // reference element was p-refined
-        choice = select_hp_refinement(e, e_ref, NULL, num_cand, cand_list, 
-                                      0, norm);
+        //e->print_cand_list(item.num_cand, item.cand_list);
       }
       // Element 'e' was refined in space for reference solution.
       else {
-        e_ref_left = e_ref;
-        e_ref_new_left = e_ref_new;
-        e_ref_right = I_ref->next_active_element();
-        e_ref_new_right = I_ref_new->next_active_element();
-        int num_cand = e->create_cand_list(adapt_type, e_ref_left->p, 
-                                           e_ref_right->p, cand_list);
-        choice = select_hp_refinement(e, e_ref_left, e_ref_right, 
-                                      num_cand, cand_list, 1, norm);
+        item.e_ref_left = e_ref;
+        item.e_ref_new_left = e_ref_new;
+        item.e_ref_right = I_ref->next_active_element();
+        item.e_ref_new_right = I_ref_new->next_active_element();
+        item.ref_sol_type = 1;
+        item.num_cand = e->create_cand_list(adapt_type, item.e_ref_left->p, 
+                                            item.e_ref_right->p, item.cand_list);
       }
 
-      // Next we perform the refinement defined by cand_list[choice]
-      // e_new_last... element in mesh_new that will be refined,
-      // e_ref_left... corresponding element in fine mesh (if reference 
-      //               refinement was p-refinement). In this case 
-      //               e_ref_right == NULL
-      // e_ref_left, e_ref_right... corresponding pair of elements 
-      //               in the fine mesh if reference refinement was hp-refinement
-      Element *e_new_last = e_new;
       // moving pointers 'e' and 'e_new' to the next position in coarse meshes
       // and 'e_ref' and 'e_ref_new' to the next position in fine meshes 
       e = I->next_active_element();
       e_new = I_new->next_active_element();
       e_ref = I_ref->next_active_element();
       e_ref_new = I_ref_new->next_active_element();
-      // perform the refinement of element e_new_last
-      e_new_last->refine(cand_list[choice]);
-      //printf("  Refined element (%g, %g), cand = (%d %d %d)\n", 
-      //       e_new_last->x1, e_new_last->x2, cand_list[choice][0], 
-      //       cand_list[choice][1], cand_list[choice][2]);
-      if(cand_list[choice][0] == 1) mesh_new->n_active_elem++; 
-      // perform corresponding refinement(s) in the new fine mesh
-      if (e_new_last->level == e_ref_left->level) { // ref. refinement of 'e_last' was 
-                                                    // p-refinement so also future ref. 
-                                                    // refinements will be p-refinements
-        if (cand_list[choice][0] == 0) { // e_last is being p-refined, thus also
-                                         // e_ref_new_left needs to be p-refined
-          int new_p = cand_list[choice][1];
-	  e_ref_new_left->refine(0, new_p + 1, -1);
-        }
-        else { // e_new_last is being split, thus e_ref_new_left needs to be 
-               // split as well
-          int new_p_left = cand_list[choice][1];
-          int new_p_right = cand_list[choice][2];
-	  e_ref_new_left->refine(1, new_p_left + 1, new_p_right + 1);
-          mesh_ref_new->n_active_elem++;
-        }
-      }
-      else { // ref. refinement was hp-refinement, so also future
-             // ref. refinements will be hp-refinements
-        if (cand_list[choice][0] == 0) { // e_new_last is being p-refined, thus also 
-                                         // e_ref_new_left and e_ref_new_right  
-                                         // will just be p-refined
-          int new_p = cand_list[choice][1];
-	  e_ref_new_left->refine(0, new_p + 1, -1);
-	  e_ref_new_right->refine(0, new_p + 1, -1);
-        }
-        else { // e_new_last is being hp-refined, so we need to 
-               // split both e_ref_new_left and e_ref_new_right
-          int new_p_left = cand_list[choice][1];
-          int new_p_right = cand_list[choice][2];
-	  e_ref_new_left->refine(1, new_p_left + 1, new_p_left + 1);
-          mesh_ref_new->n_active_elem++;
-	  e_ref_new_right->refine(1, new_p_right + 1, new_p_right + 1);
-          mesh_ref_new->n_active_elem++;
-        }
-      }
     }
     else {
       e = I->next_active_element();
@@ -1267,6 +1317,73 @@ void adapt(int norm, int adapt_type, double threshold,
       }    
     }
   }
+  delete I;
+  delete I_new;
+  delete I_ref;
+  delete I_ref_new;
+
+  // select the best candidate for every element
+  select_refinements(items, norm);
+
+  for (int i=0; i < num_to_adapt; i++) {
+    RefinementItem &item = items[i];
+    int3 *cand_list = item.cand_list;
+    int choice = item.choice;
+    Element* e_ref_left = item.e_ref_left;
+    Element* e_ref_new_left = item.e_ref_new_left;
+    Element* e_ref_new_right = item.e_ref_new_right;
+
+    // Next we perform the refinement defined by cand_list[choice]
+    // e_new_last... element in mesh_new that will be refined,
+    // e_ref_left... corresponding element in fine mesh (if reference 
+    //               refinement was p-refinement). In this case 
+    //               e_ref_right == NULL
+    // e_ref_left, e_ref_right... corresponding pair of elements 
+    //               in the fine mesh if reference refinement was hp-refinement
+    Element *e_new_last = item.e_new;
+    // perform the refinement of element e_new_last
+    e_new_last->refine(cand_list[choice]);
+    //printf("  Refined element (%g, %g), cand = (%d %d %d)\n", 
+    //       e_new_last->x1, e_new_last->x2, cand_list[choice][0], 
+    //       cand_list[choice][1], cand_list[choice][2]);
+    if(cand_list[choice][0] == 1) mesh_new->n_active_elem++; 
+    // perform corresponding refinement(s) in the new fine mesh
+    if (e_new_last->level == e_ref_left->level) { // ref. refinement of 'e_last' was 
+                                                  // p-refinement so also future ref. 
+                                                  // refinements will be p-refinements
+      if (cand_list[choice][0] == 0) { // e_last is being p-refined, thus also
+                                       // e_ref_new_left needs to be p-refined
+        int new_p = cand_list[choice][1];
+        e_ref_new_left->refine(0, new_p + 1, -1);
+      }
+      else { // e_new_last is being split, thus e_ref_new_left needs to be 
+             // split as well
+        int new_p_left = cand_list[choice][1];
+        int new_p_right = cand_list[choice][2];
+        e_ref_new_left->refine(1, new_p_left + 1, new_p_right + 1);
+        mesh_ref_new->n_active_elem++;
+      }
+    }
+    else { // ref. refinement was hp-refinement, so also future
+           // ref. refinements will be hp-refinements
+      if (cand_list[choice][0] == 0) { // e_new_last is being p-refined, thus also 
+                                       // e_ref_new_left and e_ref_new_right  
+                                       // will just be p-refined
+        int new_p = cand_list[choice][1];
+        e_ref_new_left->refine(0, new_p + 1, -1);
+        e_ref_new_right->refine(0, new_p + 1, -1);
+      }
+      else { // e_new_last is being hp-refined, so we need to 
+             // split both e_ref_new_left and e_ref_new_right
+        int new_p_left = cand_list[choice][1];
+        int new_p_right = cand_list[choice][2];
+        e_ref_new_left->refine(1, new_p_left + 1, new_p_left + 1);
+        mesh_ref_new->n_active_elem++;
+        e_ref_new_right->refine(1, new_p_right + 1, new_p_right + 1);
+        mesh_ref_new->n_active_elem++;
+      }
+    }
+  }
   // enumerate dofs in both new meshes
   int n_dof_new = mesh_new->assign_dofs();
   int n_dof_ref_new = mesh_ref_new->assign_dofs();
@@ -1284,6 +1401,8 @@ void adapt(int norm, int adapt_type, double threshold,
   // Last adjust the number of dofs in each mesh
   mesh->set_n_dof(n_dof_new);
   mesh_ref->set_n_dof(n_dof_ref_new);
+
+  delete [] adapt_list;
 }
 
 // Returns updated coarse mesh, with the last 
@@ -1298,7 +1417,7 @@ void adapt(int norm, int adapt_type, double threshold,
   
   // Use the err_array[] and threshold to create a list of 
   // elements to be refined.
-  int adapt_list[MAX_ELEM_NUM];
+  int *adapt_list = new int[n_elem];
   int num_to_adapt;
   create_ref_index_array(threshold, err_array, n_elem, adapt_list, num_to_adapt);
 
@@ -1308,68 +1427,68 @@ void adapt(int norm, int adapt_type, double threshold,
 
   // Simultaneous traversal of mesh_new and the ref_elem_pairs[] array.
   // For each element in mesh_new create a list of refinement 
-  // candidates and select the one that best resembles the reference 
-  // solution in ref_elem_pairs[]. 
+  // candidates, then select the ones that best resemble the reference 
+  // solution in ref_elem_pairs[] (in parallel) and refine. 
   Iterator *I = new Iterator(mesh);
   Iterator *I_new = new Iterator(mesh_new);
   Element *e = I->next_active_element();
   Element *e_new = I_new->next_active_element();
+  std::vector<RefinementItem> items(num_to_adapt);
   int counter_adapt = 0;
   while (counter_adapt != num_to_adapt) {
     if (e->id == adapt_list[counter_adapt]) {
+      RefinementItem &item = items[counter_adapt];
       counter_adapt++;
-      int choice = 0;
-      // Every refinement candidate consists of three
-      // and then either one or two polynomial degrees
-      int3 cand_list[MAX_CAND_NUM];   
+      item.e = e;
+      item.e_new = e_new;
       Element* e_ref = ref_elem_pairs[e->id][0];
-      Element* e_ref_left;
-      Element* e_ref_right;
       // Element 'e' was not refined in space
       // for reference solution.
       if (e->level == e_ref->level) {
-        e_ref_left = e_ref;
-        e_ref_right = NULL;
-        int num_cand = e->create_cand_list(adapt_type, e_ref->p, -1, cand_list);
+        item.e_ref_left = e_ref;
+        item.e_ref_right = NULL;
+        item.ref_sol_type = 0;   // reference element was p-refined
+        item.num_cand = e->create_cand_list(adapt_type, e_ref->p, -1, 
+                                            item.cand_list);
         // debug:
-        //e->print_cand_list(num_cand, cand_list);
-        // reference element was p-refined
-        choice = select_hp_refinement(e, e_ref, NULL, num_cand, cand_list, 
-                                      0, norm);
+        //e->print_cand_list(item.num_cand, item.cand_list);
       }
       // Element 'e' was refined in space for reference solution.
       else {
-        e_ref_left = e_ref;
-        e_ref_right = ref_elem_pairs[e->id][1];
-        int num_cand = e->create_cand_list(adapt_type, e_ref_left->p, 
-                                           e_ref_right->p, cand_list);
-        choice = select_hp_refinement(e, e_ref_left, e_ref_right, 
-                                      num_cand, cand_list, 1, norm);
+        item.e_ref_left = e_ref;
+        item.e_ref_right = ref_elem_pairs[e->id][1];
+        item.ref_sol_type = 1;
+        item.num_cand = e->create_cand_list(adapt_type, item.e_ref_left->p, 
+                                            item.e_ref_right->p, item.cand_list);
       }
-
-      // Next we perform the refinement defined by cand_list[choice]
-      // e_new_last... element in mesh_new that will be refined,
-      // e_ref_left... corresponding element in ref_elem_pairs[] (if reference 
-      //               refinement was p-refinement). In this case 
-      //               e_ref_right == NULL
-      // e_ref_left, e_ref_right... corresponding pair of elements 
-      //               in ref_elem_pairs[] (if reference refinement was hp-refinement)
-      Element *e_new_last = e_new;
       // moving pointers 'e' and 'e_new' to the next position in coarse meshes
       e = I->next_active_element();
       e_new = I_new->next_active_element();
-      // perform the refinement of element e_new_last
-      e_new_last->refine(cand_list[choice]);
-      printf("  Refined element (%g, %g), cand = (%d %d %d)\n", 
-             e_new_last->x1, e_new_last->x2, cand_list[choice][0], 
-             cand_list[choice][1], cand_list[choice][2]);
-      if(cand_list[choice][0] == 1) mesh_new->n_active_elem++;
     }
     else {
       e = I->next_active_element();
       e_new = I_new->next_active_element();
     }
   }
+  delete I;
+  delete I_new;
+
+  // select the best candidate for every element
+  select_refinements(items, norm);
+
+  for (int i=0; i < num_to_adapt; i++) {
+    int3 *cand_list = items[i].cand_list;
+    int choice = items[i].choice;
+    // Next we perform the refinement defined by cand_list[choice]
+    // e_new_last... element in mesh_new that will be refined
+    Element *e_new_last = items[i].e_new;
+    // perform the refinement of element e_new_last
+    e_new_last->refine(cand_list[choice]);
+    printf("  Refined element (%g, %g), cand = (%d %d %d)\n", 
+           e_new_last->x1, e_new_last->x2, cand_list[choice][0], 
+           cand_list[choice][1], cand_list[choice][2]);
+    if(cand_list[choice][0] == 1) mesh_new->n_active_elem++;
+  }
   // enumerate dofs in both new meshes
   int n_dof_new = mesh_new->assign_dofs();
   printf("New mesh has %d elements.\n",
@@ -1379,11 +1498,10 @@ void adapt(int norm, int adapt_type, double threshold,
   delete mesh;
   mesh = mesh_new;
 
-  // check on DOF overflow
-  if (n_dof_new > MAX_N_DOF) error("MAX_N_DOF exceeded in adapt().");
-
   // Adjust the number of dofs
   mesh->set_n_dof(n_dof_new);
+
+  delete [] adapt_list;
 }
 
 void adapt_plotting(Mesh *mesh, Mesh *mesh_ref, 
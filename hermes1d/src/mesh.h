@@ -9,18 +9,27 @@
 #include "common.h"
 #include "legendre.h"
 #include "lobatto.h"
+#include "pool.h"
+
+// Storage for the dof and coeffs arrays of all elements of a mesh.
+struct ElemStorage {
+    Pool<int> dofs;
+    Pool<double> coeffs;
+};
 
 class Element {
 public:
     Element();
     Element(double x_left, double x_right, int level, int deg, 
-            int n_eq, int n_sln, int marker);
+            int n_eq, int n_sln, int marker, ElemStorage *storage=NULL);
     void free_element() {
         if (this->sons[0] != NULL) delete this->sons[0];
         if (this->sons[1] != NULL) delete this->sons[1];
+        this->sons[0] = this->sons[1] = NULL;
     }
     ~Element() {
         this->free_element();
+        this->alloc_arrays(0, 0, 0);
     }
     void init(double x1, double x2, int p_init, 
 	      int id, int active, int level, int n_eq, int n_sln, int marker);
@@ -53,13 +62,29 @@ public:
     int marker;        // can be used to distinguish between material parameters
     int n_eq;          // number of equations (= number of solution components)
     int n_sln;         // number of solution copies
-    int dof[MAX_EQN_NUM][MAX_P + 1];   // connectivity array of length p+1 
-                                       // for every solution component
-    double coeffs[MAX_SLN_NUM][MAX_EQN_NUM][MAX_P + 1];   // solution coefficient array of length p+1 
-                                                          // for every component and every solution 
+    // connectivity array of length p+1 for every solution component
+    int &dof(int c, int j) {
+        return this->dof_arr[c*this->n_fns + j];
+    }
+    // solution coefficient array of length p+1 for every component 
+    // and every solution 
+    double &coeffs(int sln, int c, int j) {
+        return this->coeffs_arr[(sln*this->n_eq + c)*this->n_fns + j];
+    }
     int id;
     unsigned level;    // refinement level (zero for initial mesh elements) 
     Element *sons[2];  // for refinement
+    ElemStorage *storage; // where the dof and coeffs arrays come from 
+                          // (NULL... heap)
+
+private:
+    int *dof_arr;
+    double *coeffs_arr;
+    int n_fns;         // p+1 at the time the arrays were allocated
+    void alloc_arrays(int n_eq, int n_sln, int n_fns);
+
+    Element(const Element &);
+    Element &operator=(const Element &);
 };
 
 typedef Element* ElemPtr2[2];
@@ -85,13 +110,12 @@ class Mesh {
         Mesh(int n_macro_elem, double *pts_array, int *p_array, int *m_array, 
              int *div_array, int n_eq=1, int n_sln=1, bool print_banner=true);
         ~Mesh() {
-            if (this->base_elems != NULL) {
-                delete[] this->base_elems;
-            }
+            this->free_elements();
         }
         void free_elements() {
             if (this->base_elems != NULL) {
                 delete[] this->base_elems;
+                this->base_elems = NULL;
             }
         }
         int assign_dofs();
@@ -181,6 +205,7 @@ class Mesh {
         int n_base_elem;     // number of elements in the base mesh
         int n_dof;           // number of DOF (in each solution copy)
         Element *base_elems; // base mesh
+        ElemStorage storage; // dof and coeffs arrays of all elements
 
 };
 
@@ -0,0 +1,56 @@
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Distributed under the terms of the BSD license (see the LICENSE
+// file for the exact terms).
+// Email: hermes1d@googlegroups.com, home page: http://hpfem.org/
+
+#ifndef _POOL_H_
+#define _POOL_H_
+
+#include <vector>
+
+// Hands out arrays of type T carved from large contiguous chunks.
+// Released arrays are kept in free lists (one per array length) and
+// reused, so the data of elements created together stay together
+// in memory. All chunks are freed when the pool is destroyed.
+template<typename T>
+class Pool {
+public:
+    Pool(int chunk_size = 65536) {
+        this->chunk_size = chunk_size;
+        this->pos = this->end = NULL;
+    }
+    ~Pool() {
+        for (unsigned i = 0; i < this->chunks.size(); i++)
+            delete [] this->chunks[i];
+    }
+    T *alloc(int n) {
+        if (n <= 0) return NULL;
+        if (n < (int) this->free_lists.size() && !this->free_lists[n].empty()) {
+            T *a = this->free_lists[n].back();
+            this->free_lists[n].pop_back();
+            return a;
+        }
+        if (this->end - this->pos < n) {
+            int size = n > this->chunk_size ? n : this->chunk_size;
+            this->pos = new T[size];
+            this->end = this->pos + size;
+            this->chunks.push_back(this->pos);
+        }
+        T *a = this->pos;
+        this->pos += n;
+        return a;
+    }
+    void release(T *a, int n) {
+        if (a == NULL) return;
+        if (n >= (int) this->free_lists.size()) this->free_lists.resize(n + 1);
+        this->free_lists[n].push_back(a);
+    }
+
+private:
+    int chunk_size;
+    T *pos, *end;                           // unused part of the last chunk
+    std::vector<T*> chunks;
+    std::vector<std::vector<T*> > free_lists;
+};
+
+#endif
@@ -13,8 +13,8 @@ void set_vertex_dofs_constant(Mesh* mesh, double val, int comp, int sln)
   Iterator *I = new Iterator(mesh);
   Element *e;
   while ((e = I->next_active_element()) != NULL) {
-    e->coeffs[sln][comp][0] = val;
-    e->coeffs[sln][comp][1] = val;
+    e->coeffs(sln, comp, 0) = val;
+    e->coeffs(sln, comp, 1) = val;
   }
   delete I;
 }
@@ -41,8 +41,8 @@ void multiply_dofs_with_constant(Mesh* mesh, double val, int sln)
 // solution "sln_src" to target solution "sln_trg"
 void copy_dofs(int sln_src, int sln_trg, Mesh* mesh, int comp=0) 
 {
-  if(sln_src < 0 || sln_src > MAX_SLN_NUM) error("wrong solution index in copy_dofs().");
-  if(sln_trg < 0 || sln_trg > MAX_SLN_NUM) error("wrong solution index in copy_dofs().");
+  if(sln_src < 0 || sln_src >= mesh->get_n_sln()) error("wrong solution index in copy_dofs().");
+  if(sln_trg < 0 || sln_trg >= mesh->get_n_sln()) error("wrong solution index in copy_dofs().");
   Iterator *I = new Iterator(mesh);
   Element *e;
   while ((e = I->next_active_element()) != NULL) {
@@ -164,7 +164,7 @@ void transform_element_refined_forward(int sln, int comp, Element *e, Element *e
   double y_prev_loc_trans_right[MAX_P+1];
   int fns_num_coarse = e->p + 1;
   for (int i=0; i < fns_num_coarse; i++)
-      y_prev_loc[i] = e->coeffs[sln][comp][i];  
+      y_prev_loc[i] = e->coeffs(sln, comp, i);  
   //debug
   if (DEBUG_SOLUTION_TRANSFER) {
     for (int i=0; i < fns_num_coarse; i++) {
@@ -209,22 +209,22 @@ void transform_element_refined_forward(int sln, int comp, Element *e, Element *e
 
   // Copying computed coefficients into the elements e_ref_left and e_ref_right.
   // low-order part left:
-  if (e->dof[comp][0] != -1)
-    e_ref_left->coeffs[sln][comp][0] = y_prev_loc_trans_left[0];
-  else e_ref_left->coeffs[sln][comp][0] = e->coeffs[sln][comp][0];
-  e_ref_left->coeffs[sln][comp][1] = y_prev_loc_trans_left[1];
+  if (e->dof(comp, 0) != -1)
+    e_ref_left->coeffs(sln, comp, 0) = y_prev_loc_trans_left[0];
+  else e_ref_left->coeffs(sln, comp, 0) = e->coeffs(sln, comp, 0);
+  e_ref_left->coeffs(sln, comp, 1) = y_prev_loc_trans_left[1];
   // low-order part right:
-  e_ref_right->coeffs[sln][comp][0] = y_prev_loc_trans_right[0];
-  if (e->dof[comp][1] != -1)
-    e_ref_right->coeffs[sln][comp][1] = y_prev_loc_trans_right[1];
-  else e_ref_right->coeffs[sln][comp][1] = e->coeffs[sln][comp][1];
+  e_ref_right->coeffs(sln, comp, 0) = y_prev_loc_trans_right[0];
+  if (e->dof(comp, 1) != -1)
+    e_ref_right->coeffs(sln, comp, 1) = y_prev_loc_trans_right[1];
+  else e_ref_right->coeffs(sln, comp, 1) = e->coeffs(sln, comp, 1);
   // higher-order part left:
   for (int p=2; p < fns_num_ref_left; p++) {
-    e_ref_left->coeffs[sln][comp][p] = y_prev_loc_trans_left[p];
+    e_ref_left->coeffs(sln, comp, p) = y_prev_loc_trans_left[p];
   }
   // higher-order part right:
   for (int p=2; p < fns_num_ref_right; p++) {
-    e_ref_right->coeffs[sln][comp][p] = y_prev_loc_trans_right[p];
+    e_ref_right->coeffs(sln, comp, p) = y_prev_loc_trans_right[p];
   }
 }
 // default for sln=0
@@ -254,11 +254,11 @@ void transform_element_unrefined_forward(int sln, int comp, Element *e, Element
   }
   int fns_num = e->p + 1; 
   for (int p=0; p < fns_num; p++) {
-    e_ref->coeffs[sln][comp][p] = e->coeffs[sln][comp][p];
+    e_ref->coeffs(sln, comp, p) = e->coeffs(sln, comp, p);
   }
   int fns_num_ref = e_ref->p + 1;
   for (int p = fns_num; p < fns_num_ref; p++) {
-    e_ref->coeffs[sln][comp][p] = 0.;
+    e_ref->coeffs(sln, comp, p) = 0.;
   }
 }
 // default for sln=0
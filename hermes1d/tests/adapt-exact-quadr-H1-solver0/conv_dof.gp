@@ -0,0 +1,16 @@
+set terminal postscript eps enhanced
+set output 'conv_dof.eps'
+set size 0.8, 0.8
+set logscale y
+set grid
+set title 'Convergence History'
+set xlabel 'Degrees of Freedom'
+set ylabel 'Error [%]'
+plot '-' w lp linetype 1 pointtype 6 title 'exact error' ,  '-' w lp linetype 2 pointtype 0 title 'error estimate' 
+1  44.320263021396
+3  6.0198329474788e-13
+e
+1  44.320263021383
+3  4.5795310897852e-11
+e
+set terminal x11
@@ -0,0 +1,2008 @@
+-1 5.36016e-13
+
+-0.998 5.36017e-13
+
+-0.996 5.35798e-13
+
+-0.994 5.35803e-13
+
+-0.992 5.35811e-13
+
+-0.99 5.35598e-13
+
+-0.988 5.35832e-13
+
+-0.986 5.35846e-13
+
+-0.984 5.35862e-13
+
+-0.982 5.36102e-13
+
+-0.98 5.35901e-13
+
+-0.978 5.35923e-13
+
+-0.976 5.35947e-13
+
+-0.974 5.35753e-13
+
+-0.972 5.36004e-13
+
+-0.97 5.36035e-13
+
+-0.968 5.36067e-13
+
+-0.966 5.36326e-13
+
+-0.964 5.3614e-13
+
+-0.962 5.3618e-13
+
+-0.96 5.36222e-13
+
+-0.958 5.36044e-13
+
+-0.956 5.36312e-13
+
+-0.954 5.36361e-13
+
+-0.952 5.3641e-13
+
+-0.95 5.36686e-13
+
+-0.948 5.36518e-13
+
+-0.946 5.36574e-13
+
+-0.944 5.36632e-13
+
+-0.942 5.36471e-13
+
+-0.94 5.36535e-13
+
+-0.938 5.36821e-13
+
+-0.936 5.36891e-13
+
+-0.934 5.37181e-13
+
+-0.932 5.3703e-13
+
+-0.93 5.37104e-13
+
+-0.928 5.37181e-13
+
+-0.926 5.37479e-13
+
+-0.924 5.37341e-13
+
+-0.922 5.3742e-13
+
+-0.92 5.37507e-13
+
+-0.918 5.37371e-13
+
+-0.916 5.37686e-13
+
+-0.914 5.37771e-13
+
+-0.912 5.37646e-13
+
+-0.91 5.38179e-13
+
+-0.908 5.3828e-13
+
+-0.906 5.38151e-13
+
+-0.904 5.38256e-13
+
+-0.902 5.38137e-13
+
+-0.9 5.38244e-13
+
+-0.898 5.38571e-13
+
+-0.896 5.38687e-13
+
+-0.894 5.38795e-13
+
+-0.892 5.39134e-13
+
+-0.89 5.39024e-13
+
+-0.888 5.39144e-13
+
+-0.886 5.39262e-13
+
+-0.884 5.39168e-13
+
+-0.882 5.39511e-13
+
+-0.88 5.39416e-13
+
+-0.878 5.39766e-13
+
+-0.876 5.40118e-13
+
+-0.874 5.40029e-13
+
+-0.872 5.40169e-13
+
+-0.87 5.40304e-13
+
+-0.868 5.40224e-13
+
+-0.866 5.4058e-13
+
+-0.864 5.40501e-13
+
+-0.862 5.40872e-13
+
+-0.86 5.41237e-13
+
+-0.858 5.41164e-13
+
+-0.856 5.41321e-13
+
+-0.854 5.41472e-13
+
+-0.852 5.41414e-13
+
+-0.85 5.4157e-13
+
+-0.848 5.41719e-13
+
+-0.846 5.42106e-13
+
+-0.844 5.42496e-13
+
+-0.842 5.4244e-13
+
+-0.84 5.42614e-13
+
+-0.838 5.42773e-13
+
+-0.836 5.42724e-13
+
+-0.834 5.42904e-13
+
+-0.832 5.43087e-13
+
+-0.83 5.43482e-13
+
+-0.828 5.43669e-13
+
+-0.826 5.4384e-13
+
+-0.824 5.43803e-13
+
+-0.822 5.44205e-13
+
+-0.82 5.44401e-13
+
+-0.818 5.44598e-13
+
+-0.816 5.44788e-13
+
+-0.814 5.4499e-13
+
+-0.812 5.45174e-13
+
+-0.81 5.45162e-13
+
+-0.808 5.4536e-13
+
+-0.806 5.45788e-13
+
+-0.804 5.4599e-13
+
+-0.802 5.46194e-13
+
+-0.8 5.464e-13
+
+-0.798 5.46619e-13
+
+-0.796 5.46818e-13
+
+-0.794 5.46834e-13
+
+-0.792 5.47048e-13
+
+-0.79 5.47481e-13
+
+-0.788 5.47711e-13
+
+-0.786 5.47702e-13
+
+-0.784 5.48152e-13
+
+-0.782 5.48364e-13
+
+-0.78 5.48601e-13
+
+-0.778 5.48612e-13
+
+-0.776 5.48854e-13
+
+-0.774 5.49302e-13
+
+-0.772 5.49548e-13
+
+-0.77 5.49567e-13
+
+-0.768 5.50008e-13
+
+-0.766 5.50273e-13
+
+-0.764 5.50514e-13
+
+-0.762 5.50554e-13
+
+-0.76 5.50786e-13
+
+-0.758 5.51249e-13
+
+-0.756 5.51511e-13
+
+-0.754 5.5156e-13
+
+-0.752 5.52015e-13
+
+-0.75 5.5227e-13
+
+-0.748 5.5254e-13
+
+-0.746 5.52812e-13
+
+-0.744 5.52858e-13
+
+-0.742 5.53107e-13
+
+-0.74 5.53614e-13
+
+-0.738 5.5388e-13
+
+-0.736 5.54163e-13
+
+-0.734 5.54419e-13
+
+-0.732 5.54691e-13
+
+-0.73 5.5495e-13
+
+-0.728 5.55055e-13
+
+-0.726 5.55348e-13
+
+-0.724 5.55827e-13
+
+-0.722 5.56124e-13
+
+-0.72 5.56178e-13
+
+-0.718 5.56677e-13
+
+-0.716 5.5698e-13
+
+-0.714 5.57284e-13
+
+-0.712 5.57346e-13
+
+-0.71 5.5767e-13
+
+-0.708 5.58162e-13
+
+-0.706 5.58475e-13
+
+-0.704 5.58576e-13
+
+-0.702 5.59073e-13
+
+-0.7 5.59391e-13
+
+-0.698 5.59679e-13
+
+-0.696 5.59789e-13
+
+-0.694 5.6008e-13
+
+-0.692 5.60618e-13
+
+-0.69 5.60946e-13
+
+-0.688 5.61031e-13
+
+-0.686 5.61574e-13
+
+-0.684 5.61874e-13
+
+-0.682 5.6221e-13
+
+-0.68 5.62369e-13
+
+-0.678 5.62675e-13
+
+-0.676 5.63193e-13
+
+-0.674 5.63536e-13
+
+-0.672 5.63847e-13
+
+-0.67 5.64228e-13
+
+-0.668 5.64507e-13
+
+-0.666 5.64893e-13
+
+-0.664 5.65e-13
+
+-0.662 5.65319e-13
+
+-0.66 5.65886e-13
+
+-0.658 5.6628e-13
+
+-0.656 5.66604e-13
+
+-0.654 5.66756e-13
+
+-0.652 5.67294e-13
+
+-0.65 5.67623e-13
+
+-0.648 5.6799e-13
+
+-0.646 5.6815e-13
+
+-0.644 5.68731e-13
+
+-0.642 5.69067e-13
+
+-0.64 5.69196e-13
+
+-0.638 5.69572e-13
+
+-0.636 5.69951e-13
+
+-0.634 5.7054e-13
+
+-0.632 5.70923e-13
+
+-0.63 5.71099e-13
+
+-0.628 5.71655e-13
+
+-0.626 5.72004e-13
+
+-0.624 5.72225e-13
+
+-0.622 5.72578e-13
+
+-0.62 5.72932e-13
+
+-0.618 5.73534e-13
+
+-0.616 5.73931e-13
+
+-0.614 5.74083e-13
+
+-0.612 5.74484e-13
+
+-0.61 5.75093e-13
+
+-0.608 5.75291e-13
+
+-0.606 5.75697e-13
+
+-0.604 5.76024e-13
+
+-0.602 5.7664e-13
+
+-0.6 5.77092e-13
+
+-0.598 5.77464e-13
+
+-0.596 5.77632e-13
+
+-0.594 5.78254e-13
+
+-0.592 5.78467e-13
+
+-0.59 5.78888e-13
+
+-0.588 5.7931e-13
+
+-0.586 5.79897e-13
+
+-0.584 5.8028e-13
+
+-0.582 5.80545e-13
+
+-0.58 5.80888e-13
+
+-0.578 5.81362e-13
+
+-0.576 5.81956e-13
+
+-0.574 5.82347e-13
+
+-0.572 5.82578e-13
+
+-0.57 5.8322e-13
+
+-0.568 5.83616e-13
+
+-0.566 5.83897e-13
+
+-0.564 5.84296e-13
+
+-0.562 5.84696e-13
+
+-0.56 5.8539e-13
+
+-0.558 5.85794e-13
+
+-0.556 5.85995e-13
+
+-0.554 5.86401e-13
+
+-0.552 5.87102e-13
+
+-0.55 5.87355e-13
+
+-0.548 5.8772e-13
+
+-0.546 5.88224e-13
+
+-0.544 5.8884e-13
+
+-0.542 5.89301e-13
+
+-0.54 5.89609e-13
+
+-0.538 5.89981e-13
+
+-0.536 5.90649e-13
+
+-0.534 5.90869e-13
+
+-0.532 5.91339e-13
+
+-0.53 5.9181e-13
+
+-0.528 5.92437e-13
+
+-0.526 5.92959e-13
+
+-0.524 5.93187e-13
+
+-0.522 5.93665e-13
+
+-0.52 5.94297e-13
+
+-0.518 5.94579e-13
+
+-0.516 5.95062e-13
+
+-0.514 5.95546e-13
+
+-0.512 5.96135e-13
+
+-0.51 5.96671e-13
+
+-0.508 5.96912e-13
+
+-0.506 5.97403e-13
+
+-0.504 5.98046e-13
+
+-0.502 5.98292e-13
+
+-0.5 5.98837e-13
+
+-0.5 6.1118e-13
+
+-0.498 6.11619e-13
+
+-0.496 6.12108e-13
+
+-0.494 6.12548e-13
+
+-0.492 6.13091e-13
+
+-0.49 6.13634e-13
+
+-0.488 6.1403e-13
+
+-0.486 6.14527e-13
+
+-0.484 6.15075e-13
+
+-0.482 6.15575e-13
+
+-0.48 6.16027e-13
+
+-0.478 6.16482e-13
+
+-0.476 6.17035e-13
+
+-0.474 6.17592e-13
+
+-0.472 6.17951e-13
+
+-0.47 6.18559e-13
+
+-0.468 6.1907e-13
+
+-0.466 6.19531e-13
+
+-0.464 6.19999e-13
+
+-0.462 6.20561e-13
+
+-0.46 6.21078e-13
+
+-0.458 6.21499e-13
+
+-0.456 6.22117e-13
+
+-0.454 6.22587e-13
+
+-0.452 6.2311e-13
+
+-0.45 6.2359e-13
+
+-0.448 6.24214e-13
+
+-0.446 6.24689e-13
+
+-0.444 6.25218e-13
+
+-0.442 6.25652e-13
+
+-0.44 6.26282e-13
+
+-0.438 6.26816e-13
+
+-0.436 6.27254e-13
+
+-0.434 6.27737e-13
+
+-0.432 6.28426e-13
+
+-0.43 6.28966e-13
+
+-0.428 6.29357e-13
+
+-0.426 6.299e-13
+
+-0.424 6.30541e-13
+
+-0.422 6.31141e-13
+
+-0.42 6.31482e-13
+
+-0.418 6.32086e-13
+
+-0.416 6.32733e-13
+
+-0.414 6.33284e-13
+
+-0.412 6.33796e-13
+
+-0.41 6.34447e-13
+
+-0.408 6.34948e-13
+
+-0.406 6.35354e-13
+
+-0.404 6.35912e-13
+
+-0.402 6.36625e-13
+
+-0.4 6.37091e-13
+
+-0.398 6.37598e-13
+
+-0.396 6.38106e-13
+
+-0.394 6.38881e-13
+
+-0.392 6.39296e-13
+
+-0.39 6.39865e-13
+
+-0.388 6.40435e-13
+
+-0.386 6.41045e-13
+
+-0.384 6.4158e-13
+
+-0.382 6.42097e-13
+
+-0.38 6.42673e-13
+
+-0.378 6.43345e-13
+
+-0.376 6.43887e-13
+
+-0.374 6.44409e-13
+
+-0.372 6.4499e-13
+
+-0.37 6.45667e-13
+
+-0.368 6.46157e-13
+
+-0.366 6.46684e-13
+
+-0.364 6.47271e-13
+
+-0.362 6.47953e-13
+
+-0.36 6.48484e-13
+
+-0.358 6.49039e-13
+
+-0.356 6.49632e-13
+
+-0.354 6.5026e-13
+
+-0.352 6.5082e-13
+
+-0.35 6.51476e-13
+
+-0.348 6.52074e-13
+
+-0.346 6.52707e-13
+
+-0.344 6.53093e-13
+
+-0.342 6.53815e-13
+
+-0.34 6.54358e-13
+
+-0.338 6.55116e-13
+
+-0.336 6.55568e-13
+
+-0.334 6.56174e-13
+
+-0.332 6.56783e-13
+
+-0.33 6.57392e-13
+
+-0.328 6.58003e-13
+
+-0.326 6.58615e-13
+
+-0.324 6.59167e-13
+
+-0.322 6.59843e-13
+
+-0.32 6.60367e-13
+
+-0.318 6.61107e-13
+
+-0.316 6.61725e-13
+
+-0.314 6.62252e-13
+
+-0.312 6.62781e-13
+
+-0.31 6.6365e-13
+
+-0.308 6.64119e-13
+
+-0.306 6.64807e-13
+
+-0.304 6.65278e-13
+
+-0.302 6.65997e-13
+
+-0.3 6.66626e-13
+
+-0.298 6.67193e-13
+
+-0.296 6.67732e-13
+
+-0.294 6.6861e-13
+
+-0.292 6.68935e-13
+
+-0.29 6.69724e-13
+
+-0.288 6.7036e-13
+
+-0.286 6.70934e-13
+
+-0.284 6.71545e-13
+
+-0.282 6.72211e-13
+
+-0.28 6.72916e-13
+
+-0.278 6.73558e-13
+
+-0.276 6.74047e-13
+
+-0.274 6.74846e-13
+
+-0.272 6.75337e-13
+
+-0.27 6.75944e-13
+
+-0.268 6.76632e-13
+
+-0.266 6.77306e-13
+
+-0.264 6.77932e-13
+
+-0.262 6.78673e-13
+
+-0.26 6.79236e-13
+
+-0.258 6.79914e-13
+
+-0.256 6.80414e-13
+
+-0.254 6.81226e-13
+
+-0.252 6.81794e-13
+
+-0.25 6.82386e-13
+
+-0.248 6.83223e-13
+
+-0.246 6.83862e-13
+
+-0.244 6.8448e-13
+
+-0.242 6.85032e-13
+
+-0.24 6.85741e-13
+
+-0.238 6.86451e-13
+
+-0.236 6.87006e-13
+
+-0.234 6.8763e-13
+
+-0.232 6.8841e-13
+
+-0.23 6.89057e-13
+
+-0.228 6.89684e-13
+
+-0.226 6.90379e-13
+
+-0.224 6.91029e-13
+
+-0.222 6.91815e-13
+
+-0.22 6.92379e-13
+
+-0.218 6.93012e-13
+
+-0.216 6.93734e-13
+
+-0.214 6.94389e-13
+
+-0.212 6.95025e-13
+
+-0.21 6.95662e-13
+
+-0.208 6.9632e-13
+
+-0.206 6.97027e-13
+
+-0.204 6.97755e-13
+
+-0.202 6.98329e-13
+
+-0.2 6.99127e-13
+
+-0.198 6.99703e-13
+
+-0.196 7.00504e-13
+
+-0.194 7.01081e-13
+
+-0.192 7.01728e-13
+
+-0.19 7.02464e-13
+
+-0.188 7.03131e-13
+
+-0.186 7.03712e-13
+
+-0.184 7.04433e-13
+
+-0.182 7.05172e-13
+
+-0.18 7.05955e-13
+
+-0.178 7.06567e-13
+
+-0.176 7.07196e-13
+
+-0.174 7.07967e-13
+
+-0.172 7.08754e-13
+
+-0.17 7.09441e-13
+
+-0.168 7.10003e-13
+
+-0.166 7.10708e-13
+
+-0.164 7.11428e-13
+
+-0.162 7.12119e-13
+
+-0.16 7.12756e-13
+
+-0.158 7.13606e-13
+
+-0.156 7.1433e-13
+
+-0.154 7.14955e-13
+
+-0.152 7.15667e-13
+
+-0.15 7.16379e-13
+
+-0.148 7.17164e-13
+
+-0.146 7.17807e-13
+
+-0.144 7.18565e-13
+
+-0.142 7.19168e-13
+
+-0.14 7.19843e-13
+
+-0.138 7.20603e-13
+
+-0.136 7.21407e-13
+
+-0.134 7.21959e-13
+
+-0.132 7.22765e-13
+
+-0.13 7.23559e-13
+
+-0.128 7.24295e-13
+
+-0.126 7.24851e-13
+
+-0.124 7.25587e-13
+
+-0.122 7.26386e-13
+
+-0.12 7.27197e-13
+
+-0.118 7.27758e-13
+
+-0.116 7.28425e-13
+
+-0.114 7.29228e-13
+
+-0.112 7.30032e-13
+
+-0.11 7.30649e-13
+
+-0.108 7.31424e-13
+
+-0.106 7.322e-13
+
+-0.104 7.32893e-13
+
+-0.102 7.33513e-13
+
+-0.1 7.34365e-13
+
+-0.098 7.3507e-13
+
+-0.096 7.35767e-13
+
+-0.094 7.36466e-13
+
+-0.092 7.37206e-13
+
+-0.09 7.37947e-13
+
+-0.088 7.38772e-13
+
+-0.086 7.39507e-13
+
+-0.084 7.40061e-13
+
+-0.082 7.40996e-13
+
+-0.08 7.41552e-13
+
+-0.078 7.42497e-13
+
+-0.076 7.43121e-13
+
+-0.074 7.43993e-13
+
+-0.072 7.44626e-13
+
+-0.07 7.45411e-13
+
+-0.068 7.46128e-13
+
+-0.066 7.46914e-13
+
+-0.064 7.47551e-13
+
+-0.062 7.48428e-13
+
+-0.06 7.48985e-13
+
+-0.058 7.49775e-13
+
+-0.056 7.50654e-13
+
+-0.054 7.51295e-13
+
+-0.052 7.52094e-13
+
+-0.05 7.52736e-13
+
+-0.048 7.53532e-13
+
+-0.046 7.54338e-13
+
+-0.044 7.55095e-13
+
+-0.042 7.55817e-13
+
+-0.04 7.56585e-13
+
+-0.038 7.57385e-13
+
+-0.036 7.58074e-13
+
+-0.034 7.5888e-13
+
+-0.032 7.59643e-13
+
+-0.03 7.60531e-13
+
+-0.028 7.61146e-13
+
+-0.026 7.61755e-13
+
+-0.024 7.62568e-13
+
+-0.022 7.63453e-13
+
+-0.02 7.64265e-13
+
+-0.018 7.6492e-13
+
+-0.016 7.65733e-13
+
+-0.014 7.66508e-13
+
+-0.012 7.67203e-13
+
+-0.01 7.68019e-13
+
+-0.008 7.68678e-13
+
+-0.006 7.69456e-13
+
+-0.004 7.70391e-13
+
+-0.002 7.71052e-13
+
+0 7.71793e-13
+
+0 7.71951e-13
+
+0.002 7.7125e-13
+
+0.004 7.70628e-13
+
+0.006 7.69733e-13
+
+0.008 7.68956e-13
+
+0.01 7.68297e-13
+
+0.012 7.67441e-13
+
+0.014 7.66706e-13
+
+0.016 7.65932e-13
+
+0.018 7.65119e-13
+
+0.02 7.64347e-13
+
+0.022 7.63536e-13
+
+0.024 7.62768e-13
+
+0.026 7.62075e-13
+
+0.028 7.61186e-13
+
+0.03 7.60458e-13
+
+0.032 7.5977e-13
+
+0.034 7.59e-13
+
+0.036 7.58275e-13
+
+0.038 7.5755e-13
+
+0.04 7.56867e-13
+
+0.042 7.56099e-13
+
+0.044 7.55297e-13
+
+0.046 7.5454e-13
+
+0.048 7.53734e-13
+
+0.05 7.52939e-13
+
+0.052 7.52377e-13
+
+0.054 7.51498e-13
+
+0.056 7.50857e-13
+
+0.058 7.49984e-13
+
+0.06 7.4927e-13
+
+0.062 7.48631e-13
+
+0.064 7.47755e-13
+
+0.066 7.47043e-13
+
+0.068 7.46332e-13
+
+0.07 7.4554e-13
+
+0.072 7.44831e-13
+
+0.074 7.44198e-13
+
+0.076 7.43408e-13
+
+0.078 7.42627e-13
+
+0.08 7.41757e-13
+
+0.082 7.41127e-13
+
+0.084 7.40424e-13
+
+0.086 7.39672e-13
+
+0.088 7.39061e-13
+
+0.09 7.38154e-13
+
+0.092 7.37569e-13
+
+0.094 7.36714e-13
+
+0.096 7.36016e-13
+
+0.098 7.35393e-13
+
+0.1 7.34573e-13
+
+0.102 7.33763e-13
+
+0.104 7.33101e-13
+
+0.106 7.32408e-13
+
+0.108 7.31591e-13
+
+0.11 7.30858e-13
+
+0.112 7.30199e-13
+
+0.114 7.29364e-13
+
+0.116 7.28592e-13
+
+0.118 7.27895e-13
+
+0.12 7.27209e-13
+
+0.122 7.26596e-13
+
+0.124 7.25756e-13
+
+0.126 7.24988e-13
+
+0.128 7.24379e-13
+
+0.13 7.23698e-13
+
+0.132 7.22933e-13
+
+0.134 7.2217e-13
+
+0.136 7.21492e-13
+
+0.138 7.20815e-13
+
+0.14 7.20054e-13
+
+0.142 7.19308e-13
+
+0.144 7.18692e-13
+
+0.146 7.17977e-13
+
+0.148 7.17149e-13
+
+0.15 7.16407e-13
+
+0.152 7.15794e-13
+
+0.154 7.15055e-13
+
+0.156 7.14373e-13
+
+0.158 7.13706e-13
+
+0.16 7.12955e-13
+
+0.162 7.12205e-13
+
+0.164 7.11471e-13
+
+0.166 7.10879e-13
+
+0.168 7.10019e-13
+
+0.17 7.09386e-13
+
+0.172 7.0884e-13
+
+0.174 7.08139e-13
+
+0.176 7.07299e-13
+
+0.178 7.06783e-13
+
+0.18 7.05972e-13
+
+0.182 7.05345e-13
+
+0.184 7.04649e-13
+
+0.186 7.03885e-13
+
+0.188 7.03261e-13
+
+0.19 7.02568e-13
+
+0.192 7.01945e-13
+
+0.194 7.01255e-13
+
+0.196 7.00634e-13
+
+0.198 6.99877e-13
+
+0.2 6.99345e-13
+
+0.202 6.98435e-13
+
+0.204 6.97818e-13
+
+0.206 6.97115e-13
+
+0.208 6.9647e-13
+
+0.21 6.95925e-13
+
+0.212 6.95088e-13
+
+0.214 6.94632e-13
+
+0.216 6.93866e-13
+
+0.218 6.933e-13
+
+0.22 6.92511e-13
+
+0.222 6.91948e-13
+
+0.224 6.91162e-13
+
+0.226 6.90533e-13
+
+0.228 6.89972e-13
+
+0.23 6.89123e-13
+
+0.232 6.88543e-13
+
+0.234 6.87851e-13
+
+0.236 6.87228e-13
+
+0.238 6.86518e-13
+
+0.24 6.85763e-13
+
+0.242 6.85144e-13
+
+0.244 6.84592e-13
+
+0.246 6.83885e-13
+
+0.248 6.83246e-13
+
+0.25 6.82476e-13
+
+0.252 6.81973e-13
+
+0.254 6.81315e-13
+
+0.256 6.80504e-13
+
+0.258 6.80004e-13
+
+0.26 6.7935e-13
+
+0.262 6.78698e-13
+
+0.264 6.77891e-13
+
+0.266 6.77396e-13
+
+0.268 6.76812e-13
+
+0.27 6.76035e-13
+
+0.272 6.75363e-13
+
+0.274 6.74872e-13
+
+0.276 6.74163e-13
+
+0.278 6.73494e-13
+
+0.28 6.72943e-13
+
+0.282 6.72302e-13
+
+0.284 6.71663e-13
+
+0.286 6.7087e-13
+
+0.288 6.70387e-13
+
+0.29 6.69815e-13
+
+0.292 6.69026e-13
+
+0.294 6.68547e-13
+
+0.296 6.67915e-13
+
+0.298 6.67284e-13
+
+0.3 6.66626e-13
+
+0.302 6.66089e-13
+
+0.304 6.65462e-13
+
+0.306 6.64898e-13
+
+0.308 6.64057e-13
+
+0.31 6.6365e-13
+
+0.312 6.62903e-13
+
+0.314 6.62345e-13
+
+0.316 6.61571e-13
+
+0.318 6.61107e-13
+
+0.32 6.6049e-13
+
+0.322 6.59843e-13
+
+0.324 6.59167e-13
+
+0.326 6.58707e-13
+
+0.328 6.58095e-13
+
+0.33 6.57453e-13
+
+0.332 6.56722e-13
+
+0.334 6.56207e-13
+
+0.336 6.55661e-13
+
+0.338 6.54962e-13
+
+0.34 6.54418e-13
+
+0.342 6.53848e-13
+
+0.344 6.53247e-13
+
+0.346 6.52613e-13
+
+0.348 6.52074e-13
+
+0.35 6.5145e-13
+
+0.352 6.5082e-13
+
+0.354 6.5026e-13
+
+0.356 6.49666e-13
+
+0.358 6.49039e-13
+
+0.36 6.48389e-13
+
+0.362 6.47953e-13
+
+0.364 6.47365e-13
+
+0.366 6.46684e-13
+
+0.368 6.46193e-13
+
+0.37 6.45609e-13
+
+0.372 6.45026e-13
+
+0.374 6.44409e-13
+
+0.376 6.43923e-13
+
+0.378 6.43287e-13
+
+0.38 6.42768e-13
+
+0.382 6.42097e-13
+
+0.384 6.41675e-13
+
+0.386 6.41045e-13
+
+0.388 6.40473e-13
+
+0.39 6.3996e-13
+
+0.392 6.39334e-13
+
+0.394 6.38728e-13
+
+0.396 6.38201e-13
+
+0.398 6.37598e-13
+
+0.4 6.3713e-13
+
+0.402 6.36529e-13
+
+0.404 6.35952e-13
+
+0.406 6.35298e-13
+
+0.408 6.34892e-13
+
+0.41 6.34296e-13
+
+0.412 6.33837e-13
+
+0.414 6.33133e-13
+
+0.416 6.32581e-13
+
+0.418 6.32031e-13
+
+0.42 6.31482e-13
+
+0.422 6.3099e-13
+
+0.424 6.30541e-13
+
+0.426 6.299e-13
+
+0.428 6.29303e-13
+
+0.43 6.28815e-13
+
+0.432 6.28426e-13
+
+0.434 6.27781e-13
+
+0.436 6.272e-13
+
+0.438 6.26718e-13
+
+0.44 6.26228e-13
+
+0.442 6.25599e-13
+
+0.444 6.25068e-13
+
+0.446 6.24591e-13
+
+0.448 6.24161e-13
+
+0.45 6.23537e-13
+
+0.452 6.23012e-13
+
+0.454 6.22489e-13
+
+0.456 6.22117e-13
+
+0.458 6.21447e-13
+
+0.46 6.20928e-13
+
+0.462 6.20411e-13
+
+0.464 6.20045e-13
+
+0.466 6.19531e-13
+
+0.468 6.1892e-13
+
+0.47 6.18409e-13
+
+0.472 6.179e-13
+
+0.474 6.17392e-13
+
+0.476 6.16886e-13
+
+0.478 6.16381e-13
+
+0.48 6.15878e-13
+
+0.482 6.15426e-13
+
+0.484 6.15025e-13
+
+0.486 6.14477e-13
+
+0.488 6.13931e-13
+
+0.49 6.13485e-13
+
+0.492 6.13041e-13
+
+0.494 6.12548e-13
+
+0.496 6.11959e-13
+
+0.498 6.11519e-13
+
+0.5 6.1118e-13
+
+0.5 5.98837e-13
+
+0.502 5.98292e-13
+
+0.504 5.97798e-13
+
+0.506 5.97403e-13
+
+0.508 5.96664e-13
+
+0.51 5.96423e-13
+
+0.512 5.95935e-13
+
+0.514 5.95498e-13
+
+0.516 5.95013e-13
+
+0.518 5.9453e-13
+
+0.52 5.94049e-13
+
+0.522 5.93665e-13
+
+0.524 5.93187e-13
+
+0.526 5.92711e-13
+
+0.528 5.92236e-13
+
+0.53 5.91562e-13
+
+0.532 5.91339e-13
+
+0.534 5.90869e-13
+
+0.536 5.90448e-13
+
+0.538 5.89733e-13
+
+0.54 5.89563e-13
+
+0.542 5.89053e-13
+
+0.544 5.8884e-13
+
+0.546 5.88224e-13
+
+0.548 5.8772e-13
+
+0.55 5.87309e-13
+
+0.552 5.86854e-13
+
+0.554 5.86199e-13
+
+0.556 5.8595e-13
+
+0.558 5.85546e-13
+
+0.56 5.85142e-13
+
+0.562 5.84696e-13
+
+0.564 5.84251e-13
+
+0.566 5.83897e-13
+
+0.568 5.83412e-13
+
+0.57 5.82768e-13
+
+0.572 5.82535e-13
+
+0.574 5.82142e-13
+
+0.576 5.81751e-13
+
+0.578 5.81071e-13
+
+0.58 5.80888e-13
+
+0.582 5.80459e-13
+
+0.584 5.80075e-13
+
+0.586 5.79649e-13
+
+0.588 5.79268e-13
+
+0.59 5.78845e-13
+
+0.592 5.78467e-13
+
+0.594 5.77801e-13
+
+0.596 5.7759e-13
+
+0.598 5.77258e-13
+
+0.6 5.76845e-13
+
+0.602 5.76433e-13
+
+0.604 5.76024e-13
+
+0.606 5.75657e-13
+
+0.608 5.7525e-13
+
+0.61 5.7468e-13
+
+0.612 5.74444e-13
+
+0.614 5.74083e-13
+
+0.616 5.73724e-13
+
+0.618 5.73367e-13
+
+0.62 5.72932e-13
+
+0.622 5.72538e-13
+
+0.624 5.72186e-13
+
+0.626 5.71796e-13
+
+0.628 5.71408e-13
+
+0.63 5.71061e-13
+
+0.632 5.70468e-13
+
+0.634 5.70332e-13
+
+0.636 5.69951e-13
+
+0.638 5.69572e-13
+
+0.64 5.69196e-13
+
+0.642 5.68858e-13
+
+0.644 5.68522e-13
+
+0.646 5.6815e-13
+
+0.648 5.67781e-13
+
+0.65 5.6745e-13
+
+0.652 5.67084e-13
+
+0.654 5.6672e-13
+
+0.656 5.66358e-13
+
+0.658 5.65824e-13
+
+0.66 5.65676e-13
+
+0.662 5.65355e-13
+
+0.664 5.65035e-13
+
+0.666 5.64647e-13
+
+0.668 5.64332e-13
+
+0.67 5.63983e-13
+
+0.672 5.63636e-13
+
+0.674 5.63325e-13
+
+0.676 5.62982e-13
+
+0.678 5.62641e-13
+
+0.68 5.62335e-13
+
+0.682 5.61998e-13
+
+0.684 5.61663e-13
+
+0.686 5.61362e-13
+
+0.688 5.61031e-13
+
+0.69 5.60701e-13
+
+0.692 5.60439e-13
+
+0.694 5.60113e-13
+
+0.696 5.59789e-13
+
+0.698 5.59467e-13
+
+0.7 5.59147e-13
+
+0.702 5.58861e-13
+
+0.704 5.58544e-13
+
+0.706 5.58475e-13
+
+0.708 5.57918e-13
+
+0.71 5.57639e-13
+
+0.712 5.57346e-13
+
+0.714 5.57055e-13
+
+0.716 5.56751e-13
+
+0.718 5.56464e-13
+
+0.72 5.55964e-13
+
+0.722 5.56094e-13
+
+0.724 5.55584e-13
+
+0.726 5.55319e-13
+
+0.728 5.55026e-13
+
+0.73 5.5475e-13
+
+0.732 5.54476e-13
+
+0.734 5.5419e-13
+
+0.736 5.5392e-13
+
+0.738 5.53652e-13
+
+0.74 5.53371e-13
+
+0.742 5.53107e-13
+
+0.744 5.52844e-13
+
+0.746 5.52597e-13
+
+0.748 5.52338e-13
+
+0.75 5.5227e-13
+
+0.752 5.518e-13
+
+0.754 5.51547e-13
+
+0.756 5.51283e-13
+
+0.758 5.51033e-13
+
+0.76 5.50773e-13
+
+0.762 5.50528e-13
+
+0.764 5.50285e-13
+
+0.766 5.50044e-13
+
+0.768 5.49792e-13
+
+0.77 5.49567e-13
+
+0.772 5.49319e-13
+
+0.774 5.49073e-13
+
+0.776 5.48842e-13
+
+0.778 5.486e-13
+
+0.78 5.48613e-13
+
+0.782 5.48159e-13
+
+0.784 5.47935e-13
+
+0.786 5.47702e-13
+
+0.788 5.47482e-13
+
+0.79 5.47253e-13
+
+0.792 5.47048e-13
+
+0.794 5.46823e-13
+
+0.796 5.46818e-13
+
+0.798 5.46379e-13
+
+0.8 5.46182e-13
+
+0.802 5.46194e-13
+
+0.804 5.45751e-13
+
+0.806 5.4556e-13
+
+0.808 5.4535e-13
+
+0.81 5.45162e-13
+
+0.812 5.45174e-13
+
+0.814 5.44762e-13
+
+0.816 5.44342e-13
+
+0.818 5.44598e-13
+
+0.82 5.44192e-13
+
+0.822 5.43987e-13
+
+0.824 5.43812e-13
+
+0.826 5.43611e-13
+
+0.828 5.4366e-13
+
+0.83 5.43254e-13
+
+0.832 5.43078e-13
+
+0.834 5.43124e-13
+
+0.836 5.42733e-13
+
+0.838 5.42554e-13
+
+0.84 5.42386e-13
+
+0.842 5.42212e-13
+
+0.844 5.42268e-13
+
+0.846 5.41887e-13
+
+0.848 5.41727e-13
+
+0.85 5.41562e-13
+
+0.852 5.41626e-13
+
+0.854 5.41253e-13
+
+0.856 5.41093e-13
+
+0.858 5.40936e-13
+
+0.86 5.40797e-13
+
+0.862 5.40652e-13
+
+0.864 5.40501e-13
+
+0.866 5.4036e-13
+
+0.868 5.40441e-13
+
+0.87 5.40076e-13
+
+0.872 5.39945e-13
+
+0.874 5.40029e-13
+
+0.876 5.39674e-13
+
+0.878 5.39539e-13
+
+0.88 5.39416e-13
+
+0.882 5.39284e-13
+
+0.884 5.39386e-13
+
+0.886 5.39041e-13
+
+0.888 5.38923e-13
+
+0.89 5.39024e-13
+
+0.892 5.38686e-13
+
+0.894 5.38574e-13
+
+0.896 5.38461e-13
+
+0.898 5.3835e-13
+
+0.9 5.38465e-13
+
+0.902 5.38137e-13
+
+0.904 5.38035e-13
+
+0.906 5.38151e-13
+
+0.908 5.37835e-13
+
+0.91 5.37737e-13
+
+0.912 5.37646e-13
+
+0.914 5.3755e-13
+
+0.916 5.37682e-13
+
+0.918 5.37371e-13
+
+0.92 5.37281e-13
+
+0.922 5.372e-13
+
+0.924 5.37115e-13
+
+0.926 5.37256e-13
+
+0.928 5.37179e-13
+
+0.93 5.36883e-13
+
+0.932 5.36808e-13
+
+0.934 5.36736e-13
+
+0.936 5.3667e-13
+
+0.938 5.36599e-13
+
+0.94 5.36535e-13
+
+0.942 5.36471e-13
+
+0.944 5.36632e-13
+
+0.946 5.36352e-13
+
+0.948 5.36296e-13
+
+0.95 5.36241e-13
+
+0.952 5.36188e-13
+
+0.954 5.36138e-13
+
+0.956 5.3609e-13
+
+0.958 5.36043e-13
+
+0.96 5.36001e-13
+
+0.962 5.35958e-13
+
+0.964 5.35918e-13
+
+0.966 5.35881e-13
+
+0.968 5.35845e-13
+
+0.97 5.36035e-13
+
+0.972 5.36004e-13
+
+0.974 5.35753e-13
+
+0.976 5.35725e-13
+
+0.978 5.35701e-13
+
+0.98 5.35678e-13
+
+0.982 5.35658e-13
+
+0.984 5.3564e-13
+
+0.986 5.35624e-13
+
+0.988 5.35832e-13
+
+0.99 5.35598e-13
+
+0.992 5.35811e-13
+
+0.994 5.35581e-13
+
+0.996 5.35576e-13
+
+0.998 5.35573e-13
+
+1 5.36016e-13
+
@@ -0,0 +1,205 @@
+-1 0
+-0.99 0.0199
+-0.98 0.0396
+-0.97 0.0591
+-0.96 0.0784
+-0.95 0.0975
+-0.94 0.1164
+-0.93 0.1351
+-0.92 0.1536
+-0.91 0.1719
+-0.9 0.19
+-0.89 0.2079
+-0.88 0.2256
+-0.87 0.2431
+-0.86 0.2604
+-0.85 0.2775
+-0.84 0.2944
+-0.83 0.3111
+-0.82 0.3276
+-0.81 0.3439
+-0.8 0.36
+-0.79 0.3759
+-0.78 0.3916
+-0.77 0.4071
+-0.76 0.4224
+-0.75 0.4375
+-0.74 0.4524
+-0.73 0.4671
+-0.72 0.4816
+-0.71 0.4959
+-0.7 0.51
+-0.69 0.5239
+-0.68 0.5376
+-0.67 0.5511
+-0.66 0.5644
+-0.65 0.5775
+-0.64 0.5904
+-0.63 0.6031
+-0.62 0.6156
+-0.61 0.6279
+-0.6 0.64
+-0.59 0.6519
+-0.58 0.6636
+-0.57 0.6751
+-0.56 0.6864
+-0.55 0.6975
+-0.54 0.7084
+-0.53 0.7191
+-0.52 0.7296
+-0.51 0.7399
+-0.5 0.75
+-0.5 0.75
+-0.49 0.7599
+-0.48 0.7696
+-0.47 0.7791
+-0.46 0.7884
+-0.45 0.7975
+-0.44 0.8064
+-0.43 0.8151
+-0.42 0.8236
+-0.41 0.8319
+-0.4 0.84
+-0.39 0.8479
+-0.38 0.8556
+-0.37 0.8631
+-0.36 0.8704
+-0.35 0.8775
+-0.34 0.8844
+-0.33 0.8911
+-0.32 0.8976
+-0.31 0.9039
+-0.3 0.91
+-0.29 0.9159
+-0.28 0.9216
+-0.27 0.9271
+-0.26 0.9324
+-0.25 0.9375
+-0.24 0.9424
+-0.23 0.9471
+-0.22 0.9516
+-0.21 0.9559
+-0.2 0.96
+-0.19 0.9639
+-0.18 0.9676
+-0.17 0.9711
+-0.16 0.9744
+-0.15 0.9775
+-0.14 0.9804
+-0.13 0.9831
+-0.12 0.9856
+-0.11 0.9879
+-0.1 0.99
+-0.09 0.9919
+-0.08 0.9936
+-0.07 0.9951
+-0.06 0.9964
+-0.05 0.9975
+-0.04 0.9984
+-0.03 0.9991
+-0.02 0.9996
+-0.01 0.9999
+0 1
+0 1
+0.01 0.9999
+0.02 0.9996
+0.03 0.9991
+0.04 0.9984
+0.05 0.9975
+0.06 0.9964
+0.07 0.9951
+0.08 0.9936
+0.09 0.9919
+0.1 0.99
+0.11 0.9879
+0.12 0.9856
+0.13 0.9831
+0.14 0.9804
+0.15 0.9775
+0.16 0.9744
+0.17 0.9711
+0.18 0.9676
+0.19 0.9639
+0.2 0.96
+0.21 0.9559
+0.22 0.9516
+0.23 0.9471
+0.24 0.9424
+0.25 0.9375
+0.26 0.9324
+0.27 0.9271
+0.28 0.9216
+0.29 0.9159
+0.3 0.91
+0.31 0.9039
+0.32 0.8976
+0.33 0.8911
+0.34 0.8844
+0.35 0.8775
+0.36 0.8704
+0.37 0.8631
+0.38 0.8556
+0.39 0.8479
+0.4 0.84
+0.41 0.8319
+0.42 0.8236
+0.43 0.8151
+0.44 0.8064
+0.45 0.7975
+0.46 0.7884
+0.47 0.7791
+0.48 0.7696
+0.49 0.7599
+0.5 0.75
+0.5 0.75
+0.51 0.7399
+0.52 0.7296
+0.53 0.7191
+0.54 0.7084
+0.55 0.6975
+0.56 0.6864
+0.57 0.6751
+0.58 0.6636
+0.59 0.6519
+0.6 0.64
+0.61 0.6279
+0.62 0.6156
+0.63 0.6031
+0.64 0.5904
+0.65 0.5775
+0.66 0.5644
+0.67 0.5511
+0.68 0.5376
+0.69 0.5239
+0.7 0.51
+0.71 0.4959
+0.72 0.4816
+0.73 0.4671
+0.74 0.4524
+0.75 0.4375
+0.76 0.4224
+0.77 0.4071
+0.78 0.3916
+0.79 0.3759
+0.8 0.36
+0.81 0.3439
+0.82 0.3276
+0.83 0.3111
+0.84 0.2944
+0.85 0.2775
+0.86 0.2604
+0.87 0.2431
+0.88 0.2256
+0.89 0.2079
+0.9 0.19
+0.91 0.1719
+0.92 0.1536
+0.93 0.1351
+0.94 0.1164
+0.95 0.0975
+0.96 0.0784
+0.97 0.0591
+0.98 0.0396
+0.99 0.0199
+1 0
+
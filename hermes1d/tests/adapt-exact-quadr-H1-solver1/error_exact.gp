@@ -0,0 +1,1004 @@
+-1 1.33227e-14
+-0.998 1.33227e-14
+-0.996 1.33228e-14
+-0.994 1.33232e-14
+-0.992 1.33229e-14
+-0.99 1.33233e-14
+-0.988 1.31021e-14
+-0.986 1.31015e-14
+-0.984 1.3103e-14
+-0.982 1.28807e-14
+-0.98 1.28805e-14
+-0.978 1.28827e-14
+-0.976 1.28834e-14
+-0.974 1.28831e-14
+-0.972 1.26617e-14
+-0.97 1.26625e-14
+-0.968 1.26648e-14
+-0.966 1.24434e-14
+-0.964 1.24419e-14
+-0.962 1.24445e-14
+-0.96 1.24469e-14
+-0.958 1.24463e-14
+-0.956 1.22277e-14
+-0.954 1.22264e-14
+-0.952 1.22264e-14
+-0.95 1.20089e-14
+-0.948 1.20105e-14
+-0.946 1.20121e-14
+-0.944 1.20138e-14
+-0.942 1.20156e-14
+-0.94 1.20174e-14
+-0.938 1.17922e-14
+-0.936 1.1794e-14
+-0.934 1.15783e-14
+-0.932 1.15763e-14
+-0.93 1.15804e-14
+-0.928 1.15783e-14
+-0.926 1.13683e-14
+-0.924 1.13635e-14
+-0.922 1.13659e-14
+-0.92 1.13635e-14
+-0.918 1.13659e-14
+-0.916 1.11423e-14
+-0.914 1.11496e-14
+-0.912 1.13707e-14
+-0.91 1.09367e-14
+-0.908 1.09395e-14
+-0.906 1.09395e-14
+-0.904 1.09425e-14
+-0.902 1.09395e-14
+-0.9 1.09485e-14
+-0.898 1.07279e-14
+-0.896 1.07343e-14
+-0.894 1.07411e-14
+-0.892 1.05139e-14
+-0.89 1.05208e-14
+-0.888 1.05208e-14
+-0.886 1.0528e-14
+-0.884 1.0528e-14
+-0.882 1.03155e-14
+-0.88 1.0528e-14
+-0.878 1.03155e-14
+-0.876 1.00879e-14
+-0.874 1.01038e-14
+-0.872 1.00957e-14
+-0.87 1.01122e-14
+-0.868 1.01079e-14
+-0.866 9.89283e-15
+-0.864 1.01122e-14
+-0.862 9.89283e-15
+-0.86 9.6736e-15
+-0.858 9.68268e-15
+-0.856 9.68268e-15
+-0.854 9.69206e-15
+-0.852 9.70175e-15
+-0.85 9.69206e-15
+-0.848 9.71175e-15
+-0.846 9.48331e-15
+-0.844 9.27551e-15
+-0.842 9.27551e-15
+-0.84 9.26504e-15
+-0.838 9.29741e-15
+-0.836 9.29741e-15
+-0.834 9.29741e-15
+-0.832 9.29741e-15
+-0.83 9.0801e-15
+-0.828 9.0918e-15
+-0.826 8.86303e-15
+-0.824 9.10383e-15
+-0.822 8.87502e-15
+-0.82 8.88733e-15
+-0.818 8.65849e-15
+-0.816 8.68408e-15
+-0.814 8.67112e-15
+-0.812 8.67112e-15
+-0.81 8.69738e-15
+-0.808 8.69738e-15
+-0.806 8.48213e-15
+-0.804 8.48213e-15
+-0.802 8.28159e-15
+-0.8 8.29627e-15
+-0.798 8.26725e-15
+-0.796 8.29627e-15
+-0.794 8.29627e-15
+-0.792 8.29627e-15
+-0.79 8.09797e-15
+-0.788 8.08255e-15
+-0.786 8.08255e-15
+-0.784 7.90133e-15
+-0.782 7.90133e-15
+-0.78 7.90133e-15
+-0.778 7.90133e-15
+-0.776 7.90133e-15
+-0.774 7.70646e-15
+-0.772 7.70646e-15
+-0.77 7.68945e-15
+-0.768 7.51351e-15
+-0.766 7.51351e-15
+-0.764 7.49565e-15
+-0.762 7.51351e-15
+-0.76 7.51351e-15
+-0.758 7.30388e-15
+-0.756 7.32263e-15
+-0.754 7.32263e-15
+-0.752 7.11431e-15
+-0.75 7.13399e-15
+-0.748 7.13399e-15
+-0.746 7.13399e-15
+-0.744 7.15405e-15
+-0.742 7.13399e-15
+-0.74 6.92712e-15
+-0.738 6.94777e-15
+-0.736 6.72121e-15
+-0.734 6.76417e-15
+-0.732 6.76417e-15
+-0.73 6.76417e-15
+-0.728 6.76417e-15
+-0.726 6.76417e-15
+-0.724 6.56066e-15
+-0.722 6.56066e-15
+-0.72 6.5834e-15
+-0.718 6.40571e-15
+-0.716 6.40571e-15
+-0.714 6.35839e-15
+-0.712 6.40571e-15
+-0.71 6.40571e-15
+-0.708 6.20634e-15
+-0.706 6.15749e-15
+-0.704 6.20634e-15
+-0.702 6.06064e-15
+-0.7 6.06064e-15
+-0.698 6.06064e-15
+-0.696 6.06064e-15
+-0.694 6.06064e-15
+-0.692 5.86635e-15
+-0.69 5.86635e-15
+-0.688 5.92177e-15
+-0.686 5.6741e-15
+-0.684 5.73138e-15
+-0.682 5.6741e-15
+-0.68 5.6741e-15
+-0.678 5.73138e-15
+-0.676 5.54334e-15
+-0.674 5.54334e-15
+-0.672 5.60415e-15
+-0.67 5.29659e-15
+-0.668 5.4208e-15
+-0.666 5.29659e-15
+-0.664 5.4208e-15
+-0.662 5.3579e-15
+-0.66 5.17535e-15
+-0.658 5.17535e-15
+-0.656 5.17535e-15
+-0.654 5.17535e-15
+-0.652 5.0634e-15
+-0.65 5.0634e-15
+-0.648 5.0634e-15
+-0.646 5.0634e-15
+-0.644 4.89003e-15
+-0.642 4.89003e-15
+-0.64 4.89003e-15
+-0.638 4.89003e-15
+-0.636 4.89003e-15
+-0.634 4.72073e-15
+-0.632 4.72073e-15
+-0.63 4.72073e-15
+-0.628 4.63244e-15
+-0.626 4.63244e-15
+-0.624 4.55597e-15
+-0.622 4.55597e-15
+-0.62 4.71028e-15
+-0.618 4.39626e-15
+-0.616 4.47545e-15
+-0.614 4.47545e-15
+-0.612 4.47545e-15
+-0.61 4.32417e-15
+-0.608 4.32417e-15
+-0.606 4.32417e-15
+-0.604 4.40746e-15
+-0.602 4.17922e-15
+-0.6 4.17922e-15
+-0.598 4.26534e-15
+-0.596 4.17922e-15
+-0.594 4.04127e-15
+-0.592 3.95339e-15
+-0.59 4.04127e-15
+-0.588 4.04127e-15
+-0.586 4.00297e-15
+-0.584 4.00297e-15
+-0.582 3.8202e-15
+-0.58 4.00297e-15
+-0.578 3.91107e-15
+-0.576 3.88419e-15
+-0.574 3.88419e-15
+-0.572 3.88419e-15
+-0.57 3.77476e-15
+-0.568 3.77476e-15
+-0.566 3.77476e-15
+-0.564 3.67717e-15
+-0.562 3.77476e-15
+-0.56 3.67549e-15
+-0.558 3.67549e-15
+-0.556 3.67549e-15
+-0.554 3.77639e-15
+-0.552 3.58724e-15
+-0.55 3.4844e-15
+-0.548 3.69055e-15
+-0.546 3.58724e-15
+-0.544 3.51083e-15
+-0.542 3.51083e-15
+-0.54 3.51083e-15
+-0.538 3.51083e-15
+-0.536 3.44706e-15
+-0.534 3.44706e-15
+-0.532 3.55445e-15
+-0.53 3.44706e-15
+-0.528 3.50556e-15
+-0.526 3.39663e-15
+-0.524 3.50556e-15
+-0.522 3.39663e-15
+-0.52 3.36014e-15
+-0.518 3.36014e-15
+-0.516 3.36014e-15
+-0.514 3.36014e-15
+-0.512 3.33806e-15
+-0.51 3.33806e-15
+-0.508 3.44885e-15
+-0.506 3.33806e-15
+-0.504 3.33067e-15
+-0.502 3.44169e-15
+-0.5 3.33067e-15
+-0.498 3.44169e-15
+-0.496 3.33252e-15
+-0.494 3.44348e-15
+-0.492 3.44885e-15
+-0.49 3.33806e-15
+-0.488 3.45777e-15
+-0.486 3.34728e-15
+-0.484 3.36014e-15
+-0.482 3.36014e-15
+-0.48 3.37661e-15
+-0.478 3.48617e-15
+-0.476 3.50556e-15
+-0.474 3.39663e-15
+-0.472 3.52834e-15
+-0.47 3.42014e-15
+-0.468 3.55445e-15
+-0.466 3.44706e-15
+-0.464 3.47732e-15
+-0.462 3.47732e-15
+-0.46 3.51083e-15
+-0.458 3.51083e-15
+-0.456 3.54751e-15
+-0.454 3.54751e-15
+-0.452 3.58724e-15
+-0.45 3.4844e-15
+-0.448 3.62994e-15
+-0.446 3.73207e-15
+-0.444 3.67549e-15
+-0.442 3.67549e-15
+-0.44 3.7238e-15
+-0.438 3.7238e-15
+-0.436 3.67717e-15
+-0.434 3.77476e-15
+-0.432 3.77476e-15
+-0.43 3.82826e-15
+-0.428 3.88419e-15
+-0.426 3.88419e-15
+-0.424 3.88419e-15
+-0.422 3.94246e-15
+-0.42 3.84913e-15
+-0.418 3.91107e-15
+-0.416 4.00297e-15
+-0.414 3.97516e-15
+-0.412 3.97516e-15
+-0.41 4.04127e-15
+-0.408 4.04127e-15
+-0.406 4.10933e-15
+-0.404 4.10933e-15
+-0.402 4.26534e-15
+-0.4 4.17922e-15
+-0.398 4.25086e-15
+-0.396 4.33556e-15
+-0.394 4.32417e-15
+-0.392 4.32417e-15
+-0.39 4.39906e-15
+-0.388 4.39906e-15
+-0.386 4.47545e-15
+-0.384 4.47545e-15
+-0.382 4.39626e-15
+-0.38 4.55327e-15
+-0.378 4.55597e-15
+-0.376 4.55597e-15
+-0.374 4.63244e-15
+-0.372 4.71289e-15
+-0.37 4.72073e-15
+-0.368 4.72073e-15
+-0.366 4.72073e-15
+-0.364 4.80484e-15
+-0.362 4.89003e-15
+-0.36 4.89003e-15
+-0.358 4.89003e-15
+-0.356 4.97623e-15
+-0.354 5.0634e-15
+-0.352 5.0634e-15
+-0.35 4.996e-15
+-0.348 5.08526e-15
+-0.346 5.17535e-15
+-0.344 5.24044e-15
+-0.342 5.17535e-15
+-0.34 5.26625e-15
+-0.338 5.3579e-15
+-0.336 5.3579e-15
+-0.334 5.3579e-15
+-0.332 5.45028e-15
+-0.33 5.45028e-15
+-0.328 5.54334e-15
+-0.326 5.4841e-15
+-0.324 5.5788e-15
+-0.322 5.63705e-15
+-0.32 5.6741e-15
+-0.318 5.6741e-15
+-0.316 5.76996e-15
+-0.314 5.76996e-15
+-0.312 5.86635e-15
+-0.31 5.86635e-15
+-0.308 5.86635e-15
+-0.306 5.96325e-15
+-0.304 6.00855e-15
+-0.302 6.00855e-15
+-0.3 6.00855e-15
+-0.298 6.10724e-15
+-0.296 6.20634e-15
+-0.294 6.20634e-15
+-0.292 6.20634e-15
+-0.29 6.30583e-15
+-0.288 6.40571e-15
+-0.286 6.35839e-15
+-0.284 6.40571e-15
+-0.282 6.50594e-15
+-0.28 6.56066e-15
+-0.278 6.56066e-15
+-0.276 6.56066e-15
+-0.274 6.66226e-15
+-0.272 6.66226e-15
+-0.27 6.76417e-15
+-0.268 6.76417e-15
+-0.266 6.86635e-15
+-0.264 6.82403e-15
+-0.262 6.92712e-15
+-0.26 6.92712e-15
+-0.258 7.03044e-15
+-0.256 7.07152e-15
+-0.254 7.13399e-15
+-0.252 7.13399e-15
+-0.25 7.13399e-15
+-0.248 7.19935e-15
+-0.246 7.30388e-15
+-0.244 7.30388e-15
+-0.242 7.30388e-15
+-0.24 7.40861e-15
+-0.238 7.51351e-15
+-0.236 7.51351e-15
+-0.234 7.51351e-15
+-0.232 7.61859e-15
+-0.23 7.68945e-15
+-0.228 7.72383e-15
+-0.226 7.68945e-15
+-0.224 7.79532e-15
+-0.222 7.90133e-15
+-0.22 7.90133e-15
+-0.218 7.90133e-15
+-0.216 8.00747e-15
+-0.214 8.08255e-15
+-0.212 8.08255e-15
+-0.21 8.08255e-15
+-0.208 8.18935e-15
+-0.206 8.29627e-15
+-0.204 8.29627e-15
+-0.202 8.26725e-15
+-0.2 8.4033e-15
+-0.198 8.4033e-15
+-0.196 8.48213e-15
+-0.194 8.48213e-15
+-0.192 8.58971e-15
+-0.19 8.58971e-15
+-0.188 8.67112e-15
+-0.186 8.67112e-15
+-0.184 8.80513e-15
+-0.182 8.77919e-15
+-0.18 8.88733e-15
+-0.178 8.86303e-15
+-0.176 8.99555e-15
+-0.174 8.99555e-15
+-0.172 9.0801e-15
+-0.17 9.0801e-15
+-0.168 9.10383e-15
+-0.166 9.18873e-15
+-0.164 9.18873e-15
+-0.162 9.29741e-15
+-0.16 9.3845e-15
+-0.158 9.3845e-15
+-0.156 9.3845e-15
+-0.154 9.4734e-15
+-0.152 9.60263e-15
+-0.15 9.58271e-15
+-0.148 9.58271e-15
+-0.146 9.69206e-15
+-0.144 9.80145e-15
+-0.142 9.7832e-15
+-0.14 9.7832e-15
+-0.138 9.89283e-15
+-0.136 1.00025e-14
+-0.134 9.89283e-15
+-0.132 1.00025e-14
+-0.13 1.01122e-14
+-0.128 1.02056e-14
+-0.126 1.00957e-14
+-0.124 1.02056e-14
+-0.122 1.03155e-14
+-0.12 1.04107e-14
+-0.118 1.03155e-14
+-0.116 1.04255e-14
+-0.114 1.05208e-14
+-0.112 1.05208e-14
+-0.11 1.05208e-14
+-0.108 1.06309e-14
+-0.106 1.07411e-14
+-0.104 1.07411e-14
+-0.102 1.07279e-14
+-0.1 1.08382e-14
+-0.098 1.09367e-14
+-0.096 1.09485e-14
+-0.094 1.09367e-14
+-0.092 1.10471e-14
+-0.09 1.10471e-14
+-0.088 1.12577e-14
+-0.086 1.11471e-14
+-0.084 1.11471e-14
+-0.082 1.13683e-14
+-0.08 1.13683e-14
+-0.078 1.13683e-14
+-0.076 1.14697e-14
+-0.074 1.14789e-14
+-0.072 1.16911e-14
+-0.07 1.15804e-14
+-0.068 1.15724e-14
+-0.066 1.18018e-14
+-0.064 1.1794e-14
+-0.062 1.1794e-14
+-0.06 1.19048e-14
+-0.058 1.19048e-14
+-0.056 1.1898e-14
+-0.054 1.20156e-14
+-0.052 1.20089e-14
+-0.05 1.22251e-14
+-0.048 1.22251e-14
+-0.046 1.22306e-14
+-0.044 1.2336e-14
+-0.042 1.2336e-14
+-0.04 1.2336e-14
+-0.038 1.25534e-14
+-0.036 1.25534e-14
+-0.034 1.25534e-14
+-0.032 1.26643e-14
+-0.03 1.26643e-14
+-0.028 1.26609e-14
+-0.026 1.27719e-14
+-0.024 1.27719e-14
+-0.022 1.27719e-14
+-0.02 1.29915e-14
+-0.018 1.29915e-14
+-0.016 1.31025e-14
+-0.014 1.31011e-14
+-0.012 1.31025e-14
+-0.01 1.32121e-14
+-0.008 1.32121e-14
+-0.006 1.32121e-14
+-0.004 1.34337e-14
+-0.002 1.34337e-14
+0 1.33227e-14
+
+0 1.35447e-14
+0.002 1.36523e-14
+0.004 1.36488e-14
+0.006 1.35348e-14
+0.008 1.35313e-14
+0.01 1.35278e-14
+0.012 1.33037e-14
+0.014 1.32989e-14
+0.016 1.32968e-14
+0.018 1.31858e-14
+0.02 1.31788e-14
+0.022 1.30632e-14
+0.024 1.30632e-14
+0.026 1.30632e-14
+0.028 1.28343e-14
+0.03 1.28308e-14
+0.032 1.28308e-14
+0.034 1.27198e-14
+0.036 1.27198e-14
+0.038 1.27059e-14
+0.04 1.27103e-14
+0.042 1.2595e-14
+0.044 1.25855e-14
+0.046 1.25855e-14
+0.048 1.23637e-14
+0.05 1.23637e-14
+0.052 1.248e-14
+0.054 1.22445e-14
+0.056 1.22445e-14
+0.058 1.21402e-14
+0.06 1.21264e-14
+0.062 1.21198e-14
+0.064 1.19048e-14
+0.066 1.19048e-14
+0.068 1.19048e-14
+0.07 1.18018e-14
+0.072 1.1794e-14
+0.074 1.17742e-14
+0.076 1.16635e-14
+0.078 1.16635e-14
+0.08 1.14421e-14
+0.082 1.14421e-14
+0.084 1.14512e-14
+0.086 1.13406e-14
+0.088 1.15443e-14
+0.09 1.13233e-14
+0.092 1.13233e-14
+0.094 1.12128e-14
+0.096 1.12244e-14
+0.098 1.12128e-14
+0.1 1.1114e-14
+0.102 1.10037e-14
+0.104 1.10166e-14
+0.106 1.0989e-14
+0.108 1.08788e-14
+0.11 1.07686e-14
+0.112 1.07686e-14
+0.114 1.07829e-14
+0.116 1.06729e-14
+0.118 1.05629e-14
+0.12 1.05354e-14
+0.122 1.05354e-14
+0.124 1.04255e-14
+0.126 1.03316e-14
+0.128 1.03155e-14
+0.13 1.03489e-14
+0.132 1.02219e-14
+0.134 1.01122e-14
+0.136 1.01122e-14
+0.138 1.01122e-14
+0.14 1.00025e-14
+0.142 1.00203e-14
+0.144 9.91088e-15
+0.146 9.85616e-15
+0.148 9.76633e-15
+0.15 9.76633e-15
+0.152 9.65719e-15
+0.154 9.65719e-15
+0.156 9.54808e-15
+0.158 9.54808e-15
+0.16 9.43902e-15
+0.162 9.35178e-15
+0.164 9.35178e-15
+0.166 9.35178e-15
+0.168 9.26637e-15
+0.17 9.15799e-15
+0.172 9.26637e-15
+0.174 9.15799e-15
+0.176 9.12884e-15
+0.178 9.12884e-15
+0.18 9.02086e-15
+0.182 9.02086e-15
+0.184 8.91295e-15
+0.186 8.91295e-15
+0.188 8.83238e-15
+0.19 8.83238e-15
+0.192 8.72497e-15
+0.194 8.72497e-15
+0.196 8.61765e-15
+0.198 8.61765e-15
+0.2 8.61765e-15
+0.202 8.54006e-15
+0.204 8.4033e-15
+0.206 8.32667e-15
+0.208 8.43331e-15
+0.21 8.37998e-15
+0.212 8.2734e-15
+0.214 8.2428e-15
+0.216 8.16693e-15
+0.218 8.16693e-15
+0.22 8.06059e-15
+0.222 8.06059e-15
+0.224 7.98763e-15
+0.226 7.98763e-15
+0.228 7.98763e-15
+0.23 7.882e-15
+0.232 7.77652e-15
+0.234 7.77652e-15
+0.236 7.77652e-15
+0.238 7.70726e-15
+0.24 7.55033e-15
+0.242 7.55033e-15
+0.244 7.55033e-15
+0.246 7.44595e-15
+0.248 7.34176e-15
+0.25 7.23777e-15
+0.252 7.34176e-15
+0.254 7.23777e-15
+0.256 7.17448e-15
+0.258 7.13399e-15
+0.26 7.17448e-15
+0.262 7.07152e-15
+0.264 6.96881e-15
+0.266 6.96881e-15
+0.268 6.96881e-15
+0.27 6.86635e-15
+0.272 6.80866e-15
+0.274 6.80866e-15
+0.276 6.80866e-15
+0.278 6.60653e-15
+0.28 6.70744e-15
+0.282 6.60653e-15
+0.284 6.65393e-15
+0.286 6.40571e-15
+0.288 6.50594e-15
+0.29 6.35839e-15
+0.292 6.30583e-15
+0.294 6.30583e-15
+0.296 6.30583e-15
+0.298 6.20634e-15
+0.3 6.10724e-15
+0.302 6.10724e-15
+0.304 6.15849e-15
+0.306 6.06064e-15
+0.308 5.96325e-15
+0.31 5.91031e-15
+0.312 5.96325e-15
+0.314 5.86635e-15
+0.316 5.76996e-15
+0.318 5.76996e-15
+0.32 5.82629e-15
+0.322 5.6741e-15
+0.324 5.5788e-15
+0.326 5.63705e-15
+0.328 5.63705e-15
+0.33 5.4841e-15
+0.332 5.45028e-15
+0.334 5.45028e-15
+0.336 5.45028e-15
+0.338 5.3579e-15
+0.34 5.26625e-15
+0.342 5.33023e-15
+0.344 5.26625e-15
+0.346 5.24044e-15
+0.348 5.08526e-15
+0.35 5.15148e-15
+0.352 5.0634e-15
+0.354 5.0634e-15
+0.356 5.0634e-15
+0.358 4.97623e-15
+0.36 4.89003e-15
+0.362 4.89003e-15
+0.364 4.89003e-15
+0.366 4.80484e-15
+0.368 4.87741e-15
+0.37 4.79457e-15
+0.372 4.86982e-15
+0.374 4.71289e-15
+0.376 4.71289e-15
+0.378 4.63244e-15
+0.38 4.63244e-15
+0.382 4.47545e-15
+0.384 4.55327e-15
+0.386 4.47545e-15
+0.388 4.55597e-15
+0.39 4.47545e-15
+0.392 4.48096e-15
+0.394 4.40746e-15
+0.396 4.40746e-15
+0.398 4.25086e-15
+0.4 4.33556e-15
+0.402 4.26534e-15
+0.404 4.26534e-15
+0.406 4.19688e-15
+0.408 4.19688e-15
+0.41 4.13027e-15
+0.412 4.13027e-15
+0.414 4.0656e-15
+0.416 4.15704e-15
+0.418 4.00297e-15
+0.42 4.09581e-15
+0.422 4.0367e-15
+0.424 3.94246e-15
+0.426 3.88419e-15
+0.428 3.97981e-15
+0.43 3.92523e-15
+0.432 3.92523e-15
+0.434 3.92523e-15
+0.436 3.97205e-15
+0.438 3.82342e-15
+0.44 3.82342e-15
+0.442 3.77639e-15
+0.444 3.77639e-15
+0.446 3.73207e-15
+0.448 3.73207e-15
+0.45 3.69055e-15
+0.452 3.69055e-15
+0.454 3.54751e-15
+0.456 3.65194e-15
+0.458 3.72215e-15
+0.46 3.61633e-15
+0.462 3.5838e-15
+0.464 3.5838e-15
+0.466 3.5838e-15
+0.468 3.55445e-15
+0.47 3.63672e-15
+0.472 3.63672e-15
+0.474 3.61462e-15
+0.476 3.50556e-15
+0.478 3.48617e-15
+0.48 3.48617e-15
+0.482 3.47022e-15
+0.484 3.47022e-15
+0.486 3.45777e-15
+0.488 3.45777e-15
+0.49 3.44885e-15
+0.492 3.55965e-15
+0.494 3.44348e-15
+0.496 3.44348e-15
+0.498 3.44169e-15
+0.5 3.33067e-15
+0.502 3.44169e-15
+0.504 3.44169e-15
+0.506 3.33806e-15
+0.508 3.55965e-15
+0.51 3.44885e-15
+0.512 3.33806e-15
+0.514 3.47022e-15
+0.516 3.47022e-15
+0.518 3.47022e-15
+0.52 3.47022e-15
+0.522 3.39663e-15
+0.524 3.50556e-15
+0.526 3.50556e-15
+0.528 3.50556e-15
+0.53 3.55445e-15
+0.532 3.55445e-15
+0.534 3.44706e-15
+0.536 3.44706e-15
+0.538 3.61633e-15
+0.54 3.61633e-15
+0.542 3.61633e-15
+0.544 3.51083e-15
+0.546 3.58724e-15
+0.548 3.69055e-15
+0.55 3.58724e-15
+0.552 3.69055e-15
+0.554 3.77639e-15
+0.556 3.77639e-15
+0.558 3.77639e-15
+0.56 3.77639e-15
+0.562 3.77476e-15
+0.564 3.77476e-15
+0.566 3.77476e-15
+0.568 3.77476e-15
+0.57 3.97981e-15
+0.572 3.97981e-15
+0.574 3.88419e-15
+0.576 3.88419e-15
+0.578 4.00297e-15
+0.58 4.09581e-15
+0.582 4.09581e-15
+0.584 4.09581e-15
+0.586 4.22031e-15
+0.588 4.13027e-15
+0.59 4.13027e-15
+0.592 4.04127e-15
+0.594 4.26534e-15
+0.596 4.26534e-15
+0.598 4.26534e-15
+0.6 4.26534e-15
+0.602 4.32417e-15
+0.604 4.40746e-15
+0.606 4.40746e-15
+0.608 4.40746e-15
+0.61 4.47545e-15
+0.612 4.55597e-15
+0.614 4.47545e-15
+0.616 4.47545e-15
+0.618 4.55597e-15
+0.62 4.71028e-15
+0.622 4.63244e-15
+0.624 4.63244e-15
+0.626 4.63244e-15
+0.628 4.86982e-15
+0.63 4.79457e-15
+0.632 4.96134e-15
+0.634 4.89003e-15
+0.636 4.89003e-15
+0.638 4.89003e-15
+0.64 4.89003e-15
+0.642 4.89003e-15
+0.644 5.0634e-15
+0.646 5.0634e-15
+0.648 5.0634e-15
+0.65 5.30705e-15
+0.652 5.24044e-15
+0.654 5.24044e-15
+0.656 5.24044e-15
+0.658 5.4208e-15
+0.66 5.4208e-15
+0.662 5.4208e-15
+0.664 5.3579e-15
+0.666 5.60415e-15
+0.668 5.54334e-15
+0.67 5.60415e-15
+0.672 5.54334e-15
+0.674 5.60415e-15
+0.676 5.73138e-15
+0.678 5.6741e-15
+0.68 5.79021e-15
+0.682 5.92177e-15
+0.684 5.86635e-15
+0.686 5.86635e-15
+0.688 5.92177e-15
+0.69 5.86635e-15
+0.692 6.1143e-15
+0.694 6.06064e-15
+0.696 6.06064e-15
+0.698 6.25677e-15
+0.7 6.25677e-15
+0.702 6.20634e-15
+0.704 6.25677e-15
+0.706 6.20634e-15
+0.708 6.45459e-15
+0.71 6.45459e-15
+0.712 6.40571e-15
+0.714 6.40571e-15
+0.716 6.63004e-15
+0.718 6.63004e-15
+0.72 6.80866e-15
+0.722 6.60653e-15
+0.724 6.80866e-15
+0.726 6.80866e-15
+0.728 6.80866e-15
+0.73 6.76417e-15
+0.732 6.96881e-15
+0.734 6.99022e-15
+0.736 6.96881e-15
+0.738 7.17448e-15
+0.74 7.17448e-15
+0.742 7.15405e-15
+0.744 7.17448e-15
+0.746 7.13399e-15
+0.748 7.34176e-15
+0.75 7.13399e-15
+0.752 7.34176e-15
+0.754 7.55033e-15
+0.756 7.55033e-15
+0.758 7.53174e-15
+0.76 7.53174e-15
+0.762 7.55033e-15
+0.764 7.72383e-15
+0.766 7.74157e-15
+0.768 7.72383e-15
+0.77 7.91788e-15
+0.772 7.93479e-15
+0.774 7.93479e-15
+0.776 7.91788e-15
+0.778 7.91788e-15
+0.78 7.90133e-15
+0.782 8.11375e-15
+0.784 8.11375e-15
+0.786 8.3113e-15
+0.788 8.3113e-15
+0.79 8.32667e-15
+0.792 8.29627e-15
+0.794 8.3113e-15
+0.796 8.29627e-15
+0.798 8.51042e-15
+0.8 8.51042e-15
+0.802 8.51042e-15
+0.804 8.72497e-15
+0.806 8.71101e-15
+0.808 8.71101e-15
+0.81 8.69738e-15
+0.812 8.68408e-15
+0.814 8.89998e-15
+0.816 9.12884e-15
+0.818 8.88733e-15
+0.82 9.10383e-15
+0.822 9.10383e-15
+0.824 9.10383e-15
+0.826 9.10383e-15
+0.828 9.0801e-15
+0.83 9.29741e-15
+0.832 9.32059e-15
+0.834 9.29741e-15
+0.836 9.29741e-15
+0.838 9.29741e-15
+0.84 9.49354e-15
+0.842 9.71175e-15
+0.844 9.71175e-15
+0.846 9.71175e-15
+0.848 9.71175e-15
+0.85 9.70175e-15
+0.852 9.71175e-15
+0.854 9.92036e-15
+0.856 9.91088e-15
+0.858 1.01298e-14
+0.86 1.01209e-14
+0.862 1.01122e-14
+0.864 1.01122e-14
+0.866 1.01122e-14
+0.868 1.01122e-14
+0.87 1.03401e-14
+0.872 1.03194e-14
+0.874 1.03234e-14
+0.876 1.05317e-14
+0.878 1.05432e-14
+0.88 1.05317e-14
+0.882 1.05432e-14
+0.884 1.05317e-14
+0.886 1.07481e-14
+0.888 1.07446e-14
+0.89 1.07446e-14
+0.892 1.09614e-14
+0.894 1.09614e-14
+0.896 1.09614e-14
+0.898 1.09485e-14
+0.9 1.09485e-14
+0.902 1.11633e-14
+0.904 1.11662e-14
+0.906 1.11633e-14
+0.908 1.13841e-14
+0.91 1.13786e-14
+0.912 1.13733e-14
+0.914 1.13733e-14
+0.916 1.13683e-14
+0.918 1.15895e-14
+0.92 1.15871e-14
+0.922 1.15895e-14
+0.924 1.18061e-14
+0.926 1.18107e-14
+0.928 1.18018e-14
+0.93 1.18061e-14
+0.932 1.17978e-14
+0.934 1.20233e-14
+0.936 1.20156e-14
+0.938 1.20174e-14
+0.94 1.2239e-14
+0.942 1.22408e-14
+0.944 1.22338e-14
+0.946 1.22346e-14
+0.948 1.22338e-14
+0.95 1.24495e-14
+0.952 1.24482e-14
+0.954 1.24509e-14
+0.956 1.26713e-14
+0.958 1.26687e-14
+0.96 1.26687e-14
+0.962 1.28883e-14
+0.964 1.28862e-14
+0.966 1.28877e-14
+0.968 1.28867e-14
+0.97 1.28849e-14
+0.972 1.2884e-14
+0.974 1.31052e-14
+0.976 1.31056e-14
+0.978 1.31049e-14
+0.98 1.33248e-14
+0.982 1.33249e-14
+0.984 1.3325e-14
+0.986 1.33236e-14
+0.988 1.33241e-14
+0.99 1.35454e-14
+0.992 1.35449e-14
+0.994 1.35452e-14
+0.996 1.37669e-14
+0.998 1.37668e-14
+1 1.33227e-14
+
@@ -0,0 +1,20 @@
+-1 0
+-1 3
+-0.5 3
+-0.5 0
+
+-0.5 0
+-0.5 3
+0 3
+0 0
+
+0 0
+0 3
+0.5 3
+0.5 0
+
+0.5 0
+0.5 3
+1 3
+1 0
+
@@ -0,0 +1,16 @@
+set terminal postscript eps enhanced
+set output 'conv_dof.eps'
+set size 0.8, 0.8
+set logscale y
+set grid
+set title 'Convergence History'
+set xlabel 'Degrees of Freedom'
+set ylabel 'Error [%]'
+plot '-' w lp linetype 1 pointtype 6 title 'exact error' ,  '-' w lp linetype 2 pointtype 0 title 'error estimate' 
+1  25
+3  3.3281486382968e-13
+e
+1  25.000000000023
+3  4.2688204984631e-11
+e
+set terminal x11
@@ -0,0 +1,2008 @@
+-1 0
+
+-0.998 1.07119e-15
+
+-0.996 2.16147e-15
+
+-0.994 3.21271e-15
+
+-0.992 4.27783e-15
+
+-0.99 5.34989e-15
+
+-0.988 6.43235e-15
+
+-0.986 7.51135e-15
+
+-0.984 8.57647e-15
+
+-0.982 9.63812e-15
+
+-0.98 1.07137e-14
+
+-0.978 1.17892e-14
+
+-0.976 1.2837e-14
+
+-0.974 1.39402e-14
+
+-0.972 1.50158e-14
+
+-0.97 1.60844e-14
+
+-0.968 1.71252e-14
+
+-0.966 1.82354e-14
+
+-0.964 1.92762e-14
+
+-0.962 2.03587e-14
+
+-0.96 2.14412e-14
+
+-0.958 2.24959e-14
+
+-0.956 2.35784e-14
+
+-0.954 2.46608e-14
+
+-0.952 2.57155e-14
+
+-0.95 2.68119e-14
+
+-0.948 2.78666e-14
+
+-0.946 2.89213e-14
+
+-0.944 2.99899e-14
+
+-0.942 3.10585e-14
+
+-0.94 3.2141e-14
+
+-0.938 3.31957e-14
+
+-0.936 3.43059e-14
+
+-0.934 3.53606e-14
+
+-0.932 3.64153e-14
+
+-0.93 3.74978e-14
+
+-0.928 3.85803e-14
+
+-0.926 3.9635e-14
+
+-0.924 4.07452e-14
+
+-0.922 4.17721e-14
+
+-0.92 4.28824e-14
+
+-0.918 4.39371e-14
+
+-0.916 4.50751e-14
+
+-0.914 4.60743e-14
+
+-0.912 4.71845e-14
+
+-0.91 4.82114e-14
+
+-0.908 4.93217e-14
+
+-0.906 5.03209e-14
+
+-0.904 5.14311e-14
+
+-0.902 5.24858e-14
+
+-0.9 5.35683e-14
+
+-0.898 5.4623e-14
+
+-0.896 5.5761e-14
+
+-0.894 5.67879e-14
+
+-0.892 5.78981e-14
+
+-0.89 5.89251e-14
+
+-0.888 6.00076e-14
+
+-0.886 6.10623e-14
+
+-0.884 6.21725e-14
+
+-0.882 6.32272e-14
+
+-0.88 6.42819e-14
+
+-0.878 6.53644e-14
+
+-0.876 6.64468e-14
+
+-0.874 6.75016e-14
+
+-0.872 6.86118e-14
+
+-0.87 6.96665e-14
+
+-0.868 7.0749e-14
+
+-0.866 7.17759e-14
+
+-0.864 7.28306e-14
+
+-0.862 7.39409e-14
+
+-0.86 7.49956e-14
+
+-0.858 7.60503e-14
+
+-0.856 7.71605e-14
+
+-0.854 7.82152e-14
+
+-0.852 7.93254e-14
+
+-0.85 8.03801e-14
+
+-0.848 8.13793e-14
+
+-0.846 8.24896e-14
+
+-0.844 8.35998e-14
+
+-0.842 8.46545e-14
+
+-0.84 8.57647e-14
+
+-0.838 8.67639e-14
+
+-0.836 8.78186e-14
+
+-0.834 8.89289e-14
+
+-0.832 9.00391e-14
+
+-0.83 9.10938e-14
+
+-0.828 9.2204e-14
+
+-0.826 9.32032e-14
+
+-0.824 9.42579e-14
+
+-0.822 9.53126e-14
+
+-0.82 9.64229e-14
+
+-0.818 9.75331e-14
+
+-0.816 9.85878e-14
+
+-0.814 9.9698e-14
+
+-0.812 1.00697e-13
+
+-0.81 1.01807e-13
+
+-0.808 1.02862e-13
+
+-0.806 1.03972e-13
+
+-0.804 1.05027e-13
+
+-0.802 1.06082e-13
+
+-0.8 1.07137e-13
+
+-0.798 1.08247e-13
+
+-0.796 1.09246e-13
+
+-0.794 1.10412e-13
+
+-0.792 1.11466e-13
+
+-0.79 1.12521e-13
+
+-0.788 1.13631e-13
+
+-0.786 1.14631e-13
+
+-0.784 1.15741e-13
+
+-0.782 1.1674e-13
+
+-0.78 1.1785e-13
+
+-0.778 1.18905e-13
+
+-0.776 1.20015e-13
+
+-0.774 1.2107e-13
+
+-0.772 1.2218e-13
+
+-0.77 1.23235e-13
+
+-0.768 1.24234e-13
+
+-0.766 1.254e-13
+
+-0.764 1.26454e-13
+
+-0.762 1.27565e-13
+
+-0.76 1.28564e-13
+
+-0.758 1.29619e-13
+
+-0.756 1.30729e-13
+
+-0.754 1.31839e-13
+
+-0.752 1.32838e-13
+
+-0.75 1.33893e-13
+
+-0.748 1.35003e-13
+
+-0.746 1.36113e-13
+
+-0.744 1.37168e-13
+
+-0.742 1.38167e-13
+
+-0.74 1.39333e-13
+
+-0.738 1.40388e-13
+
+-0.736 1.41498e-13
+
+-0.734 1.42497e-13
+
+-0.732 1.43552e-13
+
+-0.73 1.44551e-13
+
+-0.728 1.45772e-13
+
+-0.726 1.46883e-13
+
+-0.724 1.47882e-13
+
+-0.722 1.48992e-13
+
+-0.72 1.49991e-13
+
+-0.718 1.51046e-13
+
+-0.716 1.52156e-13
+
+-0.714 1.53266e-13
+
+-0.712 1.54265e-13
+
+-0.71 1.55431e-13
+
+-0.708 1.5643e-13
+
+-0.706 1.57541e-13
+
+-0.704 1.58651e-13
+
+-0.702 1.5965e-13
+
+-0.7 1.6076e-13
+
+-0.698 1.61759e-13
+
+-0.696 1.6287e-13
+
+-0.694 1.63869e-13
+
+-0.692 1.64979e-13
+
+-0.69 1.66089e-13
+
+-0.688 1.67089e-13
+
+-0.686 1.68199e-13
+
+-0.684 1.69198e-13
+
+-0.682 1.70308e-13
+
+-0.68 1.71529e-13
+
+-0.678 1.72529e-13
+
+-0.676 1.73528e-13
+
+-0.674 1.74638e-13
+
+-0.672 1.75637e-13
+
+-0.67 1.76859e-13
+
+-0.668 1.77747e-13
+
+-0.666 1.78968e-13
+
+-0.664 1.79967e-13
+
+-0.662 1.80966e-13
+
+-0.66 1.82077e-13
+
+-0.658 1.83298e-13
+
+-0.656 1.84297e-13
+
+-0.654 1.85407e-13
+
+-0.652 1.86406e-13
+
+-0.65 1.87406e-13
+
+-0.648 1.88516e-13
+
+-0.646 1.89626e-13
+
+-0.644 1.90736e-13
+
+-0.642 1.91736e-13
+
+-0.64 1.92735e-13
+
+-0.638 1.93845e-13
+
+-0.636 1.94955e-13
+
+-0.634 1.96065e-13
+
+-0.632 1.97176e-13
+
+-0.63 1.98286e-13
+
+-0.628 1.99285e-13
+
+-0.626 2.00284e-13
+
+-0.624 2.01505e-13
+
+-0.622 2.02505e-13
+
+-0.62 2.03504e-13
+
+-0.618 2.04614e-13
+
+-0.616 2.05724e-13
+
+-0.614 2.06724e-13
+
+-0.612 2.07834e-13
+
+-0.61 2.08944e-13
+
+-0.608 2.10054e-13
+
+-0.606 2.11164e-13
+
+-0.604 2.12053e-13
+
+-0.602 2.13163e-13
+
+-0.6 2.14384e-13
+
+-0.598 2.15383e-13
+
+-0.596 2.16382e-13
+
+-0.594 2.17493e-13
+
+-0.592 2.18603e-13
+
+-0.59 2.19713e-13
+
+-0.588 2.20823e-13
+
+-0.586 2.21823e-13
+
+-0.584 2.22822e-13
+
+-0.582 2.24043e-13
+
+-0.58 2.24931e-13
+
+-0.578 2.26152e-13
+
+-0.576 2.27152e-13
+
+-0.574 2.28151e-13
+
+-0.572 2.29261e-13
+
+-0.57 2.30371e-13
+
+-0.568 2.3137e-13
+
+-0.566 2.32592e-13
+
+-0.564 2.33591e-13
+
+-0.562 2.3459e-13
+
+-0.56 2.35811e-13
+
+-0.558 2.36811e-13
+
+-0.556 2.3781e-13
+
+-0.554 2.38809e-13
+
+-0.552 2.4003e-13
+
+-0.55 2.4114e-13
+
+-0.548 2.42029e-13
+
+-0.546 2.4325e-13
+
+-0.544 2.44249e-13
+
+-0.542 2.45359e-13
+
+-0.54 2.46581e-13
+
+-0.538 2.47469e-13
+
+-0.536 2.48579e-13
+
+-0.534 2.49578e-13
+
+-0.532 2.50688e-13
+
+-0.53 2.51799e-13
+
+-0.528 2.52798e-13
+
+-0.526 2.54019e-13
+
+-0.524 2.55018e-13
+
+-0.522 2.56128e-13
+
+-0.52 2.57128e-13
+
+-0.518 2.58238e-13
+
+-0.516 2.59348e-13
+
+-0.514 2.60458e-13
+
+-0.512 2.61346e-13
+
+-0.51 2.62568e-13
+
+-0.508 2.63567e-13
+
+-0.506 2.64677e-13
+
+-0.504 2.65676e-13
+
+-0.502 2.66676e-13
+
+-0.5 2.67897e-13
+
+-0.5 2.67897e-13
+
+-0.498 2.68896e-13
+
+-0.496 2.70006e-13
+
+-0.494 2.71227e-13
+
+-0.492 2.72227e-13
+
+-0.49 2.73448e-13
+
+-0.488 2.74336e-13
+
+-0.486 2.75668e-13
+
+-0.484 2.76668e-13
+
+-0.482 2.77778e-13
+
+-0.48 2.78777e-13
+
+-0.478 2.79998e-13
+
+-0.476 2.80997e-13
+
+-0.474 2.82219e-13
+
+-0.472 2.83218e-13
+
+-0.47 2.84328e-13
+
+-0.468 2.85438e-13
+
+-0.466 2.86438e-13
+
+-0.464 2.87659e-13
+
+-0.462 2.88658e-13
+
+-0.46 2.89768e-13
+
+-0.458 2.90878e-13
+
+-0.456 2.91989e-13
+
+-0.454 2.92988e-13
+
+-0.452 2.94098e-13
+
+-0.45 2.95319e-13
+
+-0.448 2.9643e-13
+
+-0.446 2.97429e-13
+
+-0.444 2.98539e-13
+
+-0.442 2.99649e-13
+
+-0.44 3.00759e-13
+
+-0.438 3.0187e-13
+
+-0.436 3.0298e-13
+
+-0.434 3.03979e-13
+
+-0.432 3.052e-13
+
+-0.43 3.06311e-13
+
+-0.428 3.0731e-13
+
+-0.426 3.0842e-13
+
+-0.424 3.0953e-13
+
+-0.422 3.10751e-13
+
+-0.42 3.1164e-13
+
+-0.418 3.12861e-13
+
+-0.416 3.13971e-13
+
+-0.414 3.15081e-13
+
+-0.412 3.16303e-13
+
+-0.41 3.17413e-13
+
+-0.408 3.18412e-13
+
+-0.406 3.19411e-13
+
+-0.404 3.20521e-13
+
+-0.402 3.21743e-13
+
+-0.4 3.22853e-13
+
+-0.398 3.23852e-13
+
+-0.396 3.24851e-13
+
+-0.394 3.26184e-13
+
+-0.392 3.27183e-13
+
+-0.39 3.28293e-13
+
+-0.388 3.29403e-13
+
+-0.386 3.30402e-13
+
+-0.384 3.31624e-13
+
+-0.382 3.32623e-13
+
+-0.38 3.33733e-13
+
+-0.378 3.34843e-13
+
+-0.376 3.36065e-13
+
+-0.374 3.37064e-13
+
+-0.372 3.38174e-13
+
+-0.37 3.39284e-13
+
+-0.368 3.40394e-13
+
+-0.366 3.41394e-13
+
+-0.364 3.42504e-13
+
+-0.362 3.43614e-13
+
+-0.36 3.44613e-13
+
+-0.358 3.45834e-13
+
+-0.356 3.46945e-13
+
+-0.354 3.47944e-13
+
+-0.352 3.49165e-13
+
+-0.35 3.50386e-13
+
+-0.348 3.51497e-13
+
+-0.346 3.52496e-13
+
+-0.344 3.53384e-13
+
+-0.342 3.54716e-13
+
+-0.34 3.55715e-13
+
+-0.338 3.56937e-13
+
+-0.336 3.57936e-13
+
+-0.334 3.59046e-13
+
+-0.332 3.60156e-13
+
+-0.33 3.61267e-13
+
+-0.328 3.62377e-13
+
+-0.326 3.63487e-13
+
+-0.324 3.64486e-13
+
+-0.322 3.65707e-13
+
+-0.32 3.66818e-13
+
+-0.318 3.67817e-13
+
+-0.316 3.68927e-13
+
+-0.314 3.70037e-13
+
+-0.312 3.71148e-13
+
+-0.31 3.72369e-13
+
+-0.308 3.73368e-13
+
+-0.306 3.74589e-13
+
+-0.304 3.75588e-13
+
+-0.302 3.76699e-13
+
+-0.3 3.77809e-13
+
+-0.298 3.78808e-13
+
+-0.296 3.79918e-13
+
+-0.294 3.8114e-13
+
+-0.292 3.82028e-13
+
+-0.29 3.83249e-13
+
+-0.288 3.84359e-13
+
+-0.286 3.85358e-13
+
+-0.284 3.8658e-13
+
+-0.282 3.87579e-13
+
+-0.28 3.888e-13
+
+-0.278 3.8991e-13
+
+-0.276 3.9091e-13
+
+-0.274 3.92131e-13
+
+-0.272 3.9313e-13
+
+-0.27 3.94018e-13
+
+-0.268 3.9535e-13
+
+-0.266 3.9635e-13
+
+-0.264 3.97571e-13
+
+-0.262 3.98681e-13
+
+-0.26 3.99791e-13
+
+-0.258 4.00791e-13
+
+-0.256 4.0179e-13
+
+-0.254 4.03011e-13
+
+-0.252 4.04121e-13
+
+-0.25 4.0512e-13
+
+-0.248 4.06453e-13
+
+-0.246 4.07452e-13
+
+-0.244 4.08562e-13
+
+-0.242 4.09561e-13
+
+-0.24 4.10671e-13
+
+-0.238 4.11782e-13
+
+-0.236 4.12781e-13
+
+-0.234 4.13891e-13
+
+-0.232 4.15112e-13
+
+-0.23 4.16112e-13
+
+-0.228 4.17222e-13
+
+-0.226 4.18443e-13
+
+-0.224 4.19442e-13
+
+-0.222 4.20664e-13
+
+-0.22 4.21663e-13
+
+-0.218 4.22773e-13
+
+-0.216 4.23883e-13
+
+-0.214 4.24882e-13
+
+-0.212 4.25993e-13
+
+-0.21 4.27103e-13
+
+-0.208 4.28102e-13
+
+-0.206 4.29323e-13
+
+-0.204 4.30433e-13
+
+-0.202 4.31433e-13
+
+-0.2 4.32654e-13
+
+-0.198 4.33653e-13
+
+-0.196 4.34874e-13
+
+-0.194 4.35874e-13
+
+-0.192 4.36984e-13
+
+-0.19 4.38094e-13
+
+-0.188 4.39093e-13
+
+-0.186 4.40092e-13
+
+-0.184 4.41314e-13
+
+-0.182 4.42424e-13
+
+-0.18 4.43534e-13
+
+-0.178 4.44644e-13
+
+-0.176 4.45644e-13
+
+-0.174 4.46865e-13
+
+-0.172 4.47975e-13
+
+-0.17 4.49196e-13
+
+-0.168 4.50084e-13
+
+-0.166 4.51195e-13
+
+-0.164 4.52194e-13
+
+-0.162 4.53415e-13
+
+-0.16 4.54414e-13
+
+-0.158 4.55747e-13
+
+-0.156 4.56746e-13
+
+-0.154 4.57856e-13
+
+-0.152 4.58966e-13
+
+-0.15 4.60076e-13
+
+-0.148 4.61298e-13
+
+-0.146 4.62297e-13
+
+-0.144 4.63407e-13
+
+-0.142 4.64406e-13
+
+-0.14 4.65517e-13
+
+-0.138 4.66627e-13
+
+-0.136 4.67737e-13
+
+-0.134 4.68847e-13
+
+-0.132 4.69957e-13
+
+-0.13 4.71179e-13
+
+-0.128 4.72178e-13
+
+-0.126 4.73288e-13
+
+-0.124 4.74287e-13
+
+-0.122 4.75509e-13
+
+-0.12 4.76619e-13
+
+-0.118 4.77729e-13
+
+-0.116 4.78617e-13
+
+-0.114 4.79838e-13
+
+-0.112 4.8106e-13
+
+-0.11 4.82059e-13
+
+-0.108 4.83169e-13
+
+-0.106 4.84279e-13
+
+-0.104 4.8539e-13
+
+-0.102 4.86389e-13
+
+-0.1 4.8761e-13
+
+-0.098 4.88609e-13
+
+-0.096 4.89719e-13
+
+-0.094 4.9083e-13
+
+-0.092 4.9194e-13
+
+-0.09 4.9305e-13
+
+-0.088 4.9416e-13
+
+-0.086 4.95382e-13
+
+-0.084 4.9627e-13
+
+-0.082 4.97602e-13
+
+-0.08 4.9849e-13
+
+-0.078 4.99711e-13
+
+-0.076 5.00822e-13
+
+-0.074 5.01932e-13
+
+-0.072 5.02931e-13
+
+-0.07 5.04152e-13
+
+-0.068 5.05151e-13
+
+-0.066 5.06373e-13
+
+-0.064 5.07372e-13
+
+-0.062 5.08482e-13
+
+-0.06 5.09481e-13
+
+-0.058 5.10703e-13
+
+-0.056 5.11813e-13
+
+-0.054 5.12812e-13
+
+-0.052 5.13922e-13
+
+-0.05 5.14921e-13
+
+-0.048 5.16143e-13
+
+-0.046 5.17142e-13
+
+-0.044 5.18363e-13
+
+-0.042 5.19473e-13
+
+-0.04 5.20473e-13
+
+-0.038 5.21694e-13
+
+-0.036 5.22693e-13
+
+-0.034 5.23803e-13
+
+-0.032 5.25024e-13
+
+-0.03 5.26135e-13
+
+-0.028 5.27023e-13
+
+-0.026 5.28133e-13
+
+-0.024 5.29132e-13
+
+-0.022 5.30465e-13
+
+-0.02 5.31575e-13
+
+-0.018 5.32574e-13
+
+-0.016 5.33684e-13
+
+-0.014 5.34794e-13
+
+-0.012 5.35905e-13
+
+-0.01 5.37015e-13
+
+-0.008 5.38014e-13
+
+-0.006 5.39124e-13
+
+-0.004 5.40346e-13
+
+-0.002 5.41345e-13
+
+0 5.42455e-13
+
+0 5.42455e-13
+
+0.002 5.41345e-13
+
+0.004 5.40346e-13
+
+0.006 5.39124e-13
+
+0.008 5.38014e-13
+
+0.01 5.37015e-13
+
+0.012 5.35905e-13
+
+0.014 5.34794e-13
+
+0.016 5.33684e-13
+
+0.018 5.32574e-13
+
+0.02 5.31464e-13
+
+0.022 5.30354e-13
+
+0.024 5.29132e-13
+
+0.026 5.28133e-13
+
+0.028 5.27023e-13
+
+0.03 5.25913e-13
+
+0.032 5.24802e-13
+
+0.034 5.23803e-13
+
+0.036 5.22693e-13
+
+0.038 5.21583e-13
+
+0.04 5.20473e-13
+
+0.042 5.19473e-13
+
+0.044 5.18363e-13
+
+0.046 5.17142e-13
+
+0.048 5.16143e-13
+
+0.05 5.14921e-13
+
+0.052 5.13922e-13
+
+0.054 5.12812e-13
+
+0.056 5.11813e-13
+
+0.058 5.10592e-13
+
+0.06 5.09481e-13
+
+0.062 5.08482e-13
+
+0.064 5.07372e-13
+
+0.066 5.06262e-13
+
+0.068 5.05151e-13
+
+0.07 5.04041e-13
+
+0.072 5.02931e-13
+
+0.074 5.01932e-13
+
+0.076 5.00822e-13
+
+0.078 4.996e-13
+
+0.08 4.9849e-13
+
+0.082 4.97491e-13
+
+0.084 4.96381e-13
+
+0.086 4.95382e-13
+
+0.088 4.9416e-13
+
+0.09 4.9305e-13
+
+0.092 4.92051e-13
+
+0.094 4.9083e-13
+
+0.096 4.89719e-13
+
+0.098 4.8872e-13
+
+0.1 4.8761e-13
+
+0.102 4.86389e-13
+
+0.104 4.8539e-13
+
+0.106 4.84279e-13
+
+0.108 4.83169e-13
+
+0.11 4.82059e-13
+
+0.112 4.8106e-13
+
+0.114 4.79727e-13
+
+0.116 4.78617e-13
+
+0.118 4.77618e-13
+
+0.12 4.76508e-13
+
+0.122 4.75509e-13
+
+0.124 4.74287e-13
+
+0.126 4.73177e-13
+
+0.128 4.72178e-13
+
+0.13 4.71068e-13
+
+0.132 4.69957e-13
+
+0.134 4.68847e-13
+
+0.136 4.67737e-13
+
+0.138 4.66627e-13
+
+0.14 4.65517e-13
+
+0.142 4.64295e-13
+
+0.144 4.63407e-13
+
+0.146 4.62297e-13
+
+0.148 4.61076e-13
+
+0.15 4.59854e-13
+
+0.152 4.58966e-13
+
+0.154 4.57745e-13
+
+0.156 4.56746e-13
+
+0.158 4.55636e-13
+
+0.16 4.54525e-13
+
+0.162 4.53415e-13
+
+0.164 4.52194e-13
+
+0.166 4.51195e-13
+
+0.168 4.49973e-13
+
+0.17 4.48974e-13
+
+0.172 4.47975e-13
+
+0.174 4.46865e-13
+
+0.176 4.45532e-13
+
+0.178 4.44644e-13
+
+0.18 4.43423e-13
+
+0.182 4.42424e-13
+
+0.184 4.41314e-13
+
+0.186 4.40092e-13
+
+0.188 4.39093e-13
+
+0.19 4.37983e-13
+
+0.192 4.36984e-13
+
+0.194 4.35874e-13
+
+0.196 4.34874e-13
+
+0.198 4.33653e-13
+
+0.2 4.32654e-13
+
+0.202 4.31322e-13
+
+0.204 4.30322e-13
+
+0.206 4.29323e-13
+
+0.208 4.27991e-13
+
+0.21 4.27103e-13
+
+0.212 4.25882e-13
+
+0.214 4.24993e-13
+
+0.216 4.23883e-13
+
+0.218 4.22884e-13
+
+0.22 4.21663e-13
+
+0.222 4.20664e-13
+
+0.224 4.19442e-13
+
+0.226 4.18332e-13
+
+0.228 4.17333e-13
+
+0.23 4.16001e-13
+
+0.232 4.15112e-13
+
+0.234 4.13891e-13
+
+0.236 4.12781e-13
+
+0.238 4.11671e-13
+
+0.24 4.1056e-13
+
+0.242 4.0945e-13
+
+0.244 4.08451e-13
+
+0.246 4.07341e-13
+
+0.248 4.06342e-13
+
+0.25 4.0512e-13
+
+0.252 4.04121e-13
+
+0.254 4.03011e-13
+
+0.256 4.0179e-13
+
+0.258 4.00791e-13
+
+0.26 3.9968e-13
+
+0.262 3.9857e-13
+
+0.264 3.97349e-13
+
+0.266 3.9635e-13
+
+0.268 3.9535e-13
+
+0.27 3.94018e-13
+
+0.272 3.93019e-13
+
+0.274 3.9202e-13
+
+0.276 3.90799e-13
+
+0.278 3.89799e-13
+
+0.28 3.88689e-13
+
+0.282 3.87579e-13
+
+0.284 3.86469e-13
+
+0.286 3.85247e-13
+
+0.288 3.84248e-13
+
+0.29 3.83249e-13
+
+0.292 3.82028e-13
+
+0.294 3.81029e-13
+
+0.296 3.79918e-13
+
+0.298 3.78808e-13
+
+0.3 3.77809e-13
+
+0.302 3.76699e-13
+
+0.304 3.75588e-13
+
+0.306 3.74589e-13
+
+0.308 3.73257e-13
+
+0.31 3.72369e-13
+
+0.312 3.71037e-13
+
+0.314 3.70037e-13
+
+0.316 3.68816e-13
+
+0.318 3.67817e-13
+
+0.32 3.66707e-13
+
+0.322 3.65707e-13
+
+0.324 3.64486e-13
+
+0.326 3.63487e-13
+
+0.328 3.62377e-13
+
+0.33 3.61378e-13
+
+0.332 3.60045e-13
+
+0.334 3.58935e-13
+
+0.336 3.57936e-13
+
+0.338 3.56826e-13
+
+0.34 3.55826e-13
+
+0.342 3.54605e-13
+
+0.344 3.53495e-13
+
+0.346 3.52496e-13
+
+0.348 3.51497e-13
+
+0.35 3.50164e-13
+
+0.352 3.49165e-13
+
+0.354 3.47944e-13
+
+0.356 3.46834e-13
+
+0.358 3.45834e-13
+
+0.36 3.44613e-13
+
+0.362 3.43614e-13
+
+0.364 3.42504e-13
+
+0.366 3.41394e-13
+
+0.368 3.40283e-13
+
+0.37 3.39173e-13
+
+0.372 3.38063e-13
+
+0.374 3.37064e-13
+
+0.376 3.35953e-13
+
+0.378 3.34732e-13
+
+0.38 3.33733e-13
+
+0.382 3.32623e-13
+
+0.384 3.31624e-13
+
+0.386 3.30402e-13
+
+0.388 3.29292e-13
+
+0.39 3.28293e-13
+
+0.392 3.27072e-13
+
+0.394 3.26073e-13
+
+0.396 3.24851e-13
+
+0.398 3.23852e-13
+
+0.4 3.22742e-13
+
+0.402 3.21743e-13
+
+0.404 3.2041e-13
+
+0.406 3.193e-13
+
+0.408 3.18301e-13
+
+0.41 3.17302e-13
+
+0.412 3.16192e-13
+
+0.414 3.1497e-13
+
+0.416 3.1386e-13
+
+0.418 3.1275e-13
+
+0.42 3.1164e-13
+
+0.422 3.1064e-13
+
+0.424 3.0953e-13
+
+0.426 3.0842e-13
+
+0.428 3.07199e-13
+
+0.43 3.062e-13
+
+0.432 3.052e-13
+
+0.434 3.03868e-13
+
+0.436 3.02869e-13
+
+0.438 3.0187e-13
+
+0.44 3.00648e-13
+
+0.442 2.99538e-13
+
+0.444 2.98428e-13
+
+0.446 2.97429e-13
+
+0.448 2.96319e-13
+
+0.45 2.95208e-13
+
+0.452 2.94098e-13
+
+0.454 2.92988e-13
+
+0.456 2.91989e-13
+
+0.458 2.90767e-13
+
+0.46 2.89657e-13
+
+0.462 2.88547e-13
+
+0.464 2.87548e-13
+
+0.466 2.86438e-13
+
+0.468 2.85327e-13
+
+0.47 2.84217e-13
+
+0.472 2.83107e-13
+
+0.474 2.81997e-13
+
+0.476 2.80886e-13
+
+0.478 2.79776e-13
+
+0.48 2.78666e-13
+
+0.482 2.77667e-13
+
+0.484 2.76557e-13
+
+0.486 2.75557e-13
+
+0.488 2.74336e-13
+
+0.49 2.73337e-13
+
+0.492 2.72116e-13
+
+0.494 2.71227e-13
+
+0.496 2.69895e-13
+
+0.498 2.68896e-13
+
+0.5 2.67897e-13
+
+0.5 2.67897e-13
+
+0.502 2.66676e-13
+
+0.504 2.65565e-13
+
+0.506 2.64677e-13
+
+0.508 2.63456e-13
+
+0.51 2.62457e-13
+
+0.512 2.61346e-13
+
+0.514 2.60347e-13
+
+0.516 2.59237e-13
+
+0.518 2.58127e-13
+
+0.52 2.57017e-13
+
+0.522 2.56128e-13
+
+0.524 2.55018e-13
+
+0.526 2.53908e-13
+
+0.528 2.52798e-13
+
+0.53 2.51688e-13
+
+0.532 2.50688e-13
+
+0.534 2.49578e-13
+
+0.536 2.48579e-13
+
+0.538 2.47358e-13
+
+0.54 2.4647e-13
+
+0.542 2.45248e-13
+
+0.544 2.44249e-13
+
+0.546 2.4325e-13
+
+0.548 2.42029e-13
+
+0.55 2.41029e-13
+
+0.552 2.39919e-13
+
+0.554 2.38809e-13
+
+0.556 2.37699e-13
+
+0.558 2.367e-13
+
+0.56 2.357e-13
+
+0.562 2.3459e-13
+
+0.564 2.3348e-13
+
+0.566 2.32592e-13
+
+0.568 2.3137e-13
+
+0.57 2.3026e-13
+
+0.572 2.2915e-13
+
+0.574 2.28151e-13
+
+0.576 2.27152e-13
+
+0.578 2.2593e-13
+
+0.58 2.24931e-13
+
+0.582 2.23821e-13
+
+0.584 2.22822e-13
+
+0.586 2.21712e-13
+
+0.588 2.20712e-13
+
+0.59 2.19602e-13
+
+0.592 2.18603e-13
+
+0.594 2.17382e-13
+
+0.596 2.16271e-13
+
+0.598 2.15383e-13
+
+0.6 2.14273e-13
+
+0.602 2.13163e-13
+
+0.604 2.12053e-13
+
+0.606 2.11053e-13
+
+0.608 2.09943e-13
+
+0.61 2.08944e-13
+
+0.612 2.07723e-13
+
+0.614 2.06724e-13
+
+0.616 2.05724e-13
+
+0.618 2.04725e-13
+
+0.62 2.03504e-13
+
+0.622 2.02394e-13
+
+0.624 2.01394e-13
+
+0.626 2.00284e-13
+
+0.628 1.99174e-13
+
+0.63 1.98175e-13
+
+0.632 1.97065e-13
+
+0.634 1.96065e-13
+
+0.636 1.94955e-13
+
+0.638 1.93845e-13
+
+0.64 1.92735e-13
+
+0.642 1.91736e-13
+
+0.644 1.90736e-13
+
+0.646 1.89626e-13
+
+0.648 1.88516e-13
+
+0.65 1.87517e-13
+
+0.652 1.86406e-13
+
+0.654 1.85296e-13
+
+0.656 1.84186e-13
+
+0.658 1.83187e-13
+
+0.66 1.82077e-13
+
+0.662 1.81077e-13
+
+0.664 1.80078e-13
+
+0.666 1.78857e-13
+
+0.668 1.77858e-13
+
+0.67 1.76748e-13
+
+0.672 1.75637e-13
+
+0.674 1.74638e-13
+
+0.676 1.73528e-13
+
+0.678 1.72418e-13
+
+0.68 1.71418e-13
+
+0.682 1.70308e-13
+
+0.684 1.69198e-13
+
+0.686 1.68199e-13
+
+0.688 1.67089e-13
+
+0.69 1.65978e-13
+
+0.692 1.6509e-13
+
+0.694 1.6398e-13
+
+0.696 1.6287e-13
+
+0.698 1.61759e-13
+
+0.7 1.60649e-13
+
+0.702 1.5965e-13
+
+0.704 1.5854e-13
+
+0.706 1.57541e-13
+
+0.708 1.56319e-13
+
+0.71 1.5532e-13
+
+0.712 1.54265e-13
+
+0.714 1.53211e-13
+
+0.716 1.52101e-13
+
+0.718 1.51046e-13
+
+0.72 1.49991e-13
+
+0.722 1.48881e-13
+
+0.724 1.47771e-13
+
+0.726 1.46771e-13
+
+0.728 1.45661e-13
+
+0.73 1.44607e-13
+
+0.732 1.43552e-13
+
+0.734 1.42442e-13
+
+0.736 1.41387e-13
+
+0.738 1.40332e-13
+
+0.74 1.39222e-13
+
+0.742 1.38167e-13
+
+0.744 1.37113e-13
+
+0.746 1.36113e-13
+
+0.748 1.35059e-13
+
+0.75 1.33893e-13
+
+0.752 1.32838e-13
+
+0.754 1.31783e-13
+
+0.756 1.30673e-13
+
+0.758 1.29619e-13
+
+0.76 1.28508e-13
+
+0.762 1.27454e-13
+
+0.764 1.26399e-13
+
+0.766 1.25344e-13
+
+0.768 1.24234e-13
+
+0.77 1.23235e-13
+
+0.772 1.22125e-13
+
+0.774 1.21014e-13
+
+0.776 1.1996e-13
+
+0.778 1.18849e-13
+
+0.78 1.17906e-13
+
+0.782 1.16795e-13
+
+0.784 1.15741e-13
+
+0.786 1.14631e-13
+
+0.788 1.13576e-13
+
+0.79 1.12466e-13
+
+0.792 1.11466e-13
+
+0.794 1.10356e-13
+
+0.796 1.09246e-13
+
+0.798 1.08136e-13
+
+0.8 1.07137e-13
+
+0.802 1.06082e-13
+
+0.804 1.04916e-13
+
+0.806 1.03917e-13
+
+0.808 1.02807e-13
+
+0.81 1.01807e-13
+
+0.812 1.00697e-13
+
+0.814 9.96425e-14
+
+0.816 9.85323e-14
+
+0.818 9.75331e-14
+
+0.82 9.64784e-14
+
+0.822 9.53126e-14
+
+0.824 9.43134e-14
+
+0.826 9.31477e-14
+
+0.828 9.21485e-14
+
+0.83 9.10383e-14
+
+0.832 8.99836e-14
+
+0.834 8.89289e-14
+
+0.836 8.78742e-14
+
+0.838 8.67639e-14
+
+0.84 8.57092e-14
+
+0.842 8.4599e-14
+
+0.844 8.35443e-14
+
+0.846 8.24896e-14
+
+0.848 8.14349e-14
+
+0.85 8.03246e-14
+
+0.852 7.92699e-14
+
+0.854 7.82152e-14
+
+0.856 7.7105e-14
+
+0.858 7.59948e-14
+
+0.86 7.49956e-14
+
+0.862 7.39409e-14
+
+0.864 7.28306e-14
+
+0.866 7.17759e-14
+
+0.868 7.07212e-14
+
+0.87 6.9611e-14
+
+0.872 6.8584e-14
+
+0.874 6.75016e-14
+
+0.876 6.64191e-14
+
+0.878 6.53089e-14
+
+0.88 6.42819e-14
+
+0.882 6.31717e-14
+
+0.884 6.21447e-14
+
+0.886 6.10623e-14
+
+0.888 6.00076e-14
+
+0.89 5.89251e-14
+
+0.892 5.78426e-14
+
+0.894 5.67879e-14
+
+0.896 5.57054e-14
+
+0.898 5.4623e-14
+
+0.9 5.35683e-14
+
+0.902 5.24858e-14
+
+0.904 5.14311e-14
+
+0.906 5.03209e-14
+
+0.908 4.92939e-14
+
+0.91 4.82114e-14
+
+0.912 4.71845e-14
+
+0.914 4.60743e-14
+
+0.916 4.50195e-14
+
+0.918 4.39371e-14
+
+0.92 4.28269e-14
+
+0.922 4.17999e-14
+
+0.924 4.06897e-14
+
+0.926 3.96072e-14
+
+0.928 3.85525e-14
+
+0.93 3.74978e-14
+
+0.932 3.64153e-14
+
+0.934 3.53328e-14
+
+0.936 3.43198e-14
+
+0.938 3.31818e-14
+
+0.94 3.2141e-14
+
+0.942 3.10446e-14
+
+0.944 2.99899e-14
+
+0.946 2.89213e-14
+
+0.948 2.78666e-14
+
+0.95 2.67841e-14
+
+0.952 2.57017e-14
+
+0.954 2.46331e-14
+
+0.956 2.35784e-14
+
+0.958 2.2482e-14
+
+0.96 2.14412e-14
+
+0.962 2.03587e-14
+
+0.964 1.92762e-14
+
+0.966 1.82215e-14
+
+0.968 1.71252e-14
+
+0.97 1.60705e-14
+
+0.972 1.50088e-14
+
+0.974 1.39402e-14
+
+0.976 1.2837e-14
+
+0.978 1.17822e-14
+
+0.98 1.06998e-14
+
+0.982 9.63118e-15
+
+0.984 8.57647e-15
+
+0.986 7.50788e-15
+
+0.988 6.42889e-15
+
+0.99 5.34642e-15
+
+0.992 4.27783e-15
+
+0.994 3.21444e-15
+
+0.996 2.16147e-15
+
+0.998 1.07119e-15
+
+1 0
+
@@ -0,0 +1,1004 @@
+-1 0
+-0.998 2.68882e-17
+-0.996 5.37764e-17
+-0.994 1.17961e-16
+-0.992 6.93889e-17
+-0.99 1.31839e-16
+-0.988 1.94289e-16
+-0.986 1.49186e-16
+-0.984 2.498e-16
+-0.982 2.35922e-16
+-0.98 2.22045e-16
+-0.978 3.26128e-16
+-0.976 3.53884e-16
+-0.974 3.40006e-16
+-0.972 3.60822e-16
+-0.97 3.88578e-16
+-0.968 4.57967e-16
+-0.966 4.71845e-16
+-0.964 4.30211e-16
+-0.962 4.996e-16
+-0.96 5.55112e-16
+-0.958 5.41234e-16
+-0.956 6.10623e-16
+-0.954 5.82867e-16
+-0.952 5.82867e-16
+-0.95 6.66134e-16
+-0.948 6.93889e-16
+-0.946 7.21645e-16
+-0.944 7.49401e-16
+-0.942 7.77156e-16
+-0.94 8.04912e-16
+-0.938 7.49401e-16
+-0.936 7.77156e-16
+-0.934 8.60423e-16
+-0.932 8.32667e-16
+-0.93 8.88178e-16
+-0.928 8.60423e-16
+-0.926 9.99201e-16
+-0.924 9.4369e-16
+-0.922 9.71445e-16
+-0.92 9.4369e-16
+-0.918 9.71445e-16
+-0.916 9.4369e-16
+-0.914 1.02696e-15
+-0.912 1.02696e-15
+-0.91 1.11022e-15
+-0.908 1.13798e-15
+-0.906 1.13798e-15
+-0.904 1.16573e-15
+-0.902 1.13798e-15
+-0.9 1.22125e-15
+-0.898 1.22125e-15
+-0.896 1.27676e-15
+-0.894 1.33227e-15
+-0.892 1.27676e-15
+-0.89 1.33227e-15
+-0.888 1.33227e-15
+-0.886 1.38778e-15
+-0.884 1.38778e-15
+-0.882 1.44329e-15
+-0.88 1.38778e-15
+-0.878 1.44329e-15
+-0.876 1.38778e-15
+-0.874 1.4988e-15
+-0.872 1.44329e-15
+-0.87 1.55431e-15
+-0.868 1.52656e-15
+-0.866 1.55431e-15
+-0.864 1.55431e-15
+-0.862 1.55431e-15
+-0.86 1.55431e-15
+-0.858 1.60982e-15
+-0.856 1.60982e-15
+-0.854 1.66533e-15
+-0.852 1.72085e-15
+-0.85 1.66533e-15
+-0.848 1.77636e-15
+-0.846 1.72085e-15
+-0.844 1.77636e-15
+-0.842 1.77636e-15
+-0.84 1.72085e-15
+-0.838 1.88738e-15
+-0.836 1.88738e-15
+-0.834 1.88738e-15
+-0.832 1.88738e-15
+-0.83 1.88738e-15
+-0.828 1.94289e-15
+-0.826 1.88738e-15
+-0.824 1.9984e-15
+-0.822 1.94289e-15
+-0.82 1.9984e-15
+-0.818 1.94289e-15
+-0.816 2.05391e-15
+-0.814 1.9984e-15
+-0.812 1.9984e-15
+-0.81 2.10942e-15
+-0.808 2.10942e-15
+-0.806 2.10942e-15
+-0.804 2.10942e-15
+-0.802 2.16493e-15
+-0.8 2.22045e-15
+-0.798 2.10942e-15
+-0.796 2.22045e-15
+-0.794 2.22045e-15
+-0.792 2.22045e-15
+-0.79 2.27596e-15
+-0.788 2.22045e-15
+-0.786 2.22045e-15
+-0.784 2.33147e-15
+-0.782 2.33147e-15
+-0.78 2.33147e-15
+-0.778 2.33147e-15
+-0.776 2.33147e-15
+-0.774 2.38698e-15
+-0.772 2.38698e-15
+-0.77 2.33147e-15
+-0.768 2.44249e-15
+-0.766 2.44249e-15
+-0.764 2.38698e-15
+-0.762 2.44249e-15
+-0.76 2.44249e-15
+-0.758 2.44249e-15
+-0.756 2.498e-15
+-0.754 2.498e-15
+-0.752 2.498e-15
+-0.75 2.55351e-15
+-0.748 2.55351e-15
+-0.746 2.55351e-15
+-0.744 2.60902e-15
+-0.742 2.55351e-15
+-0.74 2.55351e-15
+-0.738 2.60902e-15
+-0.736 2.55351e-15
+-0.734 2.66454e-15
+-0.732 2.66454e-15
+-0.73 2.66454e-15
+-0.728 2.66454e-15
+-0.726 2.66454e-15
+-0.724 2.66454e-15
+-0.722 2.66454e-15
+-0.72 2.72005e-15
+-0.718 2.77556e-15
+-0.716 2.77556e-15
+-0.714 2.66454e-15
+-0.712 2.77556e-15
+-0.71 2.77556e-15
+-0.708 2.77556e-15
+-0.706 2.66454e-15
+-0.704 2.77556e-15
+-0.702 2.88658e-15
+-0.7 2.88658e-15
+-0.698 2.88658e-15
+-0.696 2.88658e-15
+-0.694 2.88658e-15
+-0.692 2.88658e-15
+-0.69 2.88658e-15
+-0.688 2.9976e-15
+-0.686 2.88658e-15
+-0.684 2.9976e-15
+-0.682 2.88658e-15
+-0.68 2.88658e-15
+-0.678 2.9976e-15
+-0.676 2.9976e-15
+-0.674 2.9976e-15
+-0.672 3.10862e-15
+-0.67 2.88658e-15
+-0.668 3.10862e-15
+-0.666 2.88658e-15
+-0.664 3.10862e-15
+-0.662 2.9976e-15
+-0.66 2.9976e-15
+-0.658 2.9976e-15
+-0.656 2.9976e-15
+-0.654 2.9976e-15
+-0.652 3.10862e-15
+-0.65 3.10862e-15
+-0.648 3.10862e-15
+-0.646 3.10862e-15
+-0.644 3.10862e-15
+-0.642 3.10862e-15
+-0.64 3.10862e-15
+-0.638 3.10862e-15
+-0.636 3.10862e-15
+-0.634 3.10862e-15
+-0.632 3.10862e-15
+-0.63 3.10862e-15
+-0.628 3.21965e-15
+-0.626 3.21965e-15
+-0.624 3.10862e-15
+-0.622 3.10862e-15
+-0.62 3.33067e-15
+-0.618 3.10862e-15
+-0.616 3.21965e-15
+-0.614 3.21965e-15
+-0.612 3.21965e-15
+-0.61 3.21965e-15
+-0.608 3.21965e-15
+-0.606 3.21965e-15
+-0.604 3.33067e-15
+-0.602 3.21965e-15
+-0.6 3.21965e-15
+-0.598 3.33067e-15
+-0.596 3.21965e-15
+-0.594 3.21965e-15
+-0.592 3.10862e-15
+-0.59 3.21965e-15
+-0.588 3.21965e-15
+-0.586 3.33067e-15
+-0.584 3.33067e-15
+-0.582 3.10862e-15
+-0.58 3.33067e-15
+-0.578 3.21965e-15
+-0.576 3.33067e-15
+-0.574 3.33067e-15
+-0.572 3.33067e-15
+-0.57 3.33067e-15
+-0.568 3.33067e-15
+-0.566 3.33067e-15
+-0.564 3.21965e-15
+-0.562 3.33067e-15
+-0.56 3.33067e-15
+-0.558 3.33067e-15
+-0.556 3.33067e-15
+-0.554 3.44169e-15
+-0.552 3.33067e-15
+-0.55 3.21965e-15
+-0.548 3.44169e-15
+-0.546 3.33067e-15
+-0.544 3.33067e-15
+-0.542 3.33067e-15
+-0.54 3.33067e-15
+-0.538 3.33067e-15
+-0.536 3.33067e-15
+-0.534 3.33067e-15
+-0.532 3.44169e-15
+-0.53 3.33067e-15
+-0.528 3.44169e-15
+-0.526 3.33067e-15
+-0.524 3.44169e-15
+-0.522 3.33067e-15
+-0.52 3.33067e-15
+-0.518 3.33067e-15
+-0.516 3.33067e-15
+-0.514 3.33067e-15
+-0.512 3.33067e-15
+-0.51 3.33067e-15
+-0.508 3.44169e-15
+-0.506 3.33067e-15
+-0.504 3.33067e-15
+-0.502 3.44169e-15
+-0.5 3.33067e-15
+-0.498 3.44169e-15
+-0.496 3.33067e-15
+-0.494 3.44169e-15
+-0.492 3.44169e-15
+-0.49 3.33067e-15
+-0.488 3.44169e-15
+-0.486 3.33067e-15
+-0.484 3.33067e-15
+-0.482 3.33067e-15
+-0.48 3.33067e-15
+-0.478 3.44169e-15
+-0.476 3.44169e-15
+-0.474 3.33067e-15
+-0.472 3.44169e-15
+-0.47 3.33067e-15
+-0.468 3.44169e-15
+-0.466 3.33067e-15
+-0.464 3.33067e-15
+-0.462 3.33067e-15
+-0.46 3.33067e-15
+-0.458 3.33067e-15
+-0.456 3.33067e-15
+-0.454 3.33067e-15
+-0.452 3.33067e-15
+-0.45 3.21965e-15
+-0.448 3.33067e-15
+-0.446 3.44169e-15
+-0.444 3.33067e-15
+-0.442 3.33067e-15
+-0.44 3.33067e-15
+-0.438 3.33067e-15
+-0.436 3.21965e-15
+-0.434 3.33067e-15
+-0.432 3.33067e-15
+-0.43 3.33067e-15
+-0.428 3.33067e-15
+-0.426 3.33067e-15
+-0.424 3.33067e-15
+-0.422 3.33067e-15
+-0.42 3.21965e-15
+-0.418 3.21965e-15
+-0.416 3.33067e-15
+-0.414 3.21965e-15
+-0.412 3.21965e-15
+-0.41 3.21965e-15
+-0.408 3.21965e-15
+-0.406 3.21965e-15
+-0.404 3.21965e-15
+-0.402 3.33067e-15
+-0.4 3.21965e-15
+-0.398 3.21965e-15
+-0.396 3.33067e-15
+-0.394 3.21965e-15
+-0.392 3.21965e-15
+-0.39 3.21965e-15
+-0.388 3.21965e-15
+-0.386 3.21965e-15
+-0.384 3.21965e-15
+-0.382 3.10862e-15
+-0.38 3.21965e-15
+-0.378 3.10862e-15
+-0.376 3.10862e-15
+-0.374 3.21965e-15
+-0.372 3.21965e-15
+-0.37 3.10862e-15
+-0.368 3.10862e-15
+-0.366 3.10862e-15
+-0.364 3.10862e-15
+-0.362 3.10862e-15
+-0.36 3.10862e-15
+-0.358 3.10862e-15
+-0.356 3.10862e-15
+-0.354 3.10862e-15
+-0.352 3.10862e-15
+-0.35 2.9976e-15
+-0.348 2.9976e-15
+-0.346 2.9976e-15
+-0.344 3.10862e-15
+-0.342 2.9976e-15
+-0.34 2.9976e-15
+-0.338 2.9976e-15
+-0.336 2.9976e-15
+-0.334 2.9976e-15
+-0.332 2.9976e-15
+-0.33 2.9976e-15
+-0.328 2.9976e-15
+-0.326 2.88658e-15
+-0.324 2.88658e-15
+-0.322 2.9976e-15
+-0.32 2.88658e-15
+-0.318 2.88658e-15
+-0.316 2.88658e-15
+-0.314 2.88658e-15
+-0.312 2.88658e-15
+-0.31 2.88658e-15
+-0.308 2.88658e-15
+-0.306 2.88658e-15
+-0.304 2.77556e-15
+-0.302 2.77556e-15
+-0.3 2.77556e-15
+-0.298 2.77556e-15
+-0.296 2.77556e-15
+-0.294 2.77556e-15
+-0.292 2.77556e-15
+-0.29 2.77556e-15
+-0.288 2.77556e-15
+-0.286 2.66454e-15
+-0.284 2.77556e-15
+-0.282 2.77556e-15
+-0.28 2.66454e-15
+-0.278 2.66454e-15
+-0.276 2.66454e-15
+-0.274 2.66454e-15
+-0.272 2.66454e-15
+-0.27 2.66454e-15
+-0.268 2.66454e-15
+-0.266 2.66454e-15
+-0.264 2.55351e-15
+-0.262 2.55351e-15
+-0.26 2.55351e-15
+-0.258 2.55351e-15
+-0.256 2.66454e-15
+-0.254 2.55351e-15
+-0.252 2.55351e-15
+-0.25 2.55351e-15
+-0.248 2.44249e-15
+-0.246 2.44249e-15
+-0.244 2.44249e-15
+-0.242 2.44249e-15
+-0.24 2.44249e-15
+-0.238 2.44249e-15
+-0.236 2.44249e-15
+-0.234 2.44249e-15
+-0.232 2.44249e-15
+-0.23 2.33147e-15
+-0.228 2.44249e-15
+-0.226 2.33147e-15
+-0.224 2.33147e-15
+-0.222 2.33147e-15
+-0.22 2.33147e-15
+-0.218 2.33147e-15
+-0.216 2.33147e-15
+-0.214 2.22045e-15
+-0.212 2.22045e-15
+-0.21 2.22045e-15
+-0.208 2.22045e-15
+-0.206 2.22045e-15
+-0.204 2.22045e-15
+-0.202 2.10942e-15
+-0.2 2.22045e-15
+-0.198 2.22045e-15
+-0.196 2.10942e-15
+-0.194 2.10942e-15
+-0.192 2.10942e-15
+-0.19 2.10942e-15
+-0.188 1.9984e-15
+-0.186 1.9984e-15
+-0.184 2.10942e-15
+-0.182 1.9984e-15
+-0.18 1.9984e-15
+-0.178 1.88738e-15
+-0.176 1.9984e-15
+-0.174 1.9984e-15
+-0.172 1.88738e-15
+-0.17 1.88738e-15
+-0.168 1.9984e-15
+-0.166 1.88738e-15
+-0.164 1.88738e-15
+-0.162 1.88738e-15
+-0.16 1.77636e-15
+-0.158 1.77636e-15
+-0.156 1.77636e-15
+-0.154 1.66533e-15
+-0.152 1.77636e-15
+-0.15 1.66533e-15
+-0.148 1.66533e-15
+-0.146 1.66533e-15
+-0.144 1.66533e-15
+-0.142 1.55431e-15
+-0.14 1.55431e-15
+-0.138 1.55431e-15
+-0.136 1.55431e-15
+-0.134 1.55431e-15
+-0.132 1.55431e-15
+-0.13 1.55431e-15
+-0.128 1.44329e-15
+-0.126 1.44329e-15
+-0.124 1.44329e-15
+-0.122 1.44329e-15
+-0.12 1.33227e-15
+-0.118 1.44329e-15
+-0.116 1.44329e-15
+-0.114 1.33227e-15
+-0.112 1.33227e-15
+-0.11 1.33227e-15
+-0.108 1.33227e-15
+-0.106 1.33227e-15
+-0.104 1.33227e-15
+-0.102 1.22125e-15
+-0.1 1.22125e-15
+-0.098 1.11022e-15
+-0.096 1.22125e-15
+-0.094 1.11022e-15
+-0.092 1.11022e-15
+-0.09 1.11022e-15
+-0.088 9.99201e-16
+-0.086 9.99201e-16
+-0.084 9.99201e-16
+-0.082 9.99201e-16
+-0.08 9.99201e-16
+-0.078 9.99201e-16
+-0.076 8.88178e-16
+-0.074 9.99201e-16
+-0.072 8.88178e-16
+-0.07 8.88178e-16
+-0.068 7.77156e-16
+-0.066 8.88178e-16
+-0.064 7.77156e-16
+-0.062 7.77156e-16
+-0.06 7.77156e-16
+-0.058 7.77156e-16
+-0.056 6.66134e-16
+-0.054 7.77156e-16
+-0.052 6.66134e-16
+-0.05 5.55112e-16
+-0.048 5.55112e-16
+-0.046 6.66134e-16
+-0.044 5.55112e-16
+-0.042 5.55112e-16
+-0.04 5.55112e-16
+-0.038 4.44089e-16
+-0.036 4.44089e-16
+-0.034 4.44089e-16
+-0.032 4.44089e-16
+-0.03 4.44089e-16
+-0.028 3.33067e-16
+-0.026 3.33067e-16
+-0.024 3.33067e-16
+-0.022 3.33067e-16
+-0.02 2.22045e-16
+-0.018 2.22045e-16
+-0.016 2.22045e-16
+-0.014 1.11022e-16
+-0.012 2.22045e-16
+-0.01 1.11022e-16
+-0.008 1.11022e-16
+-0.006 1.11022e-16
+-0.004 0
+-0.002 0
+0 0
+
+0 0
+0.002 0
+0.004 0
+0.006 1.11022e-16
+0.008 1.11022e-16
+0.01 1.11022e-16
+0.012 2.22045e-16
+0.014 1.11022e-16
+0.016 2.22045e-16
+0.018 2.22045e-16
+0.02 2.22045e-16
+0.022 3.33067e-16
+0.024 3.33067e-16
+0.026 3.33067e-16
+0.028 3.33067e-16
+0.03 4.44089e-16
+0.032 4.44089e-16
+0.034 4.44089e-16
+0.036 4.44089e-16
+0.038 4.44089e-16
+0.04 5.55112e-16
+0.042 4.44089e-16
+0.044 5.55112e-16
+0.046 5.55112e-16
+0.048 5.55112e-16
+0.05 5.55112e-16
+0.052 6.66134e-16
+0.054 6.66134e-16
+0.056 6.66134e-16
+0.058 7.77156e-16
+0.06 7.77156e-16
+0.062 6.66134e-16
+0.064 7.77156e-16
+0.066 7.77156e-16
+0.068 7.77156e-16
+0.07 8.88178e-16
+0.072 7.77156e-16
+0.074 8.88178e-16
+0.076 8.88178e-16
+0.078 8.88178e-16
+0.08 8.88178e-16
+0.082 8.88178e-16
+0.084 9.99201e-16
+0.086 9.99201e-16
+0.088 1.11022e-15
+0.09 1.11022e-15
+0.092 1.11022e-15
+0.094 1.11022e-15
+0.096 1.22125e-15
+0.098 1.11022e-15
+0.1 1.22125e-15
+0.102 1.22125e-15
+0.104 1.33227e-15
+0.106 1.33227e-15
+0.108 1.33227e-15
+0.11 1.33227e-15
+0.112 1.33227e-15
+0.114 1.44329e-15
+0.116 1.44329e-15
+0.118 1.44329e-15
+0.12 1.44329e-15
+0.122 1.44329e-15
+0.124 1.44329e-15
+0.126 1.55431e-15
+0.128 1.44329e-15
+0.13 1.66533e-15
+0.132 1.55431e-15
+0.134 1.55431e-15
+0.136 1.55431e-15
+0.138 1.55431e-15
+0.14 1.55431e-15
+0.142 1.66533e-15
+0.144 1.66533e-15
+0.146 1.66533e-15
+0.148 1.77636e-15
+0.15 1.77636e-15
+0.152 1.77636e-15
+0.154 1.77636e-15
+0.156 1.77636e-15
+0.158 1.77636e-15
+0.16 1.77636e-15
+0.162 1.88738e-15
+0.164 1.88738e-15
+0.166 1.88738e-15
+0.168 1.9984e-15
+0.17 1.9984e-15
+0.172 1.9984e-15
+0.174 1.9984e-15
+0.176 2.10942e-15
+0.178 2.10942e-15
+0.18 2.10942e-15
+0.182 2.10942e-15
+0.184 2.10942e-15
+0.186 2.10942e-15
+0.188 2.22045e-15
+0.19 2.22045e-15
+0.192 2.22045e-15
+0.194 2.22045e-15
+0.196 2.22045e-15
+0.198 2.22045e-15
+0.2 2.22045e-15
+0.202 2.33147e-15
+0.204 2.22045e-15
+0.206 2.33147e-15
+0.208 2.33147e-15
+0.21 2.33147e-15
+0.212 2.33147e-15
+0.214 2.22045e-15
+0.216 2.33147e-15
+0.218 2.33147e-15
+0.22 2.33147e-15
+0.222 2.33147e-15
+0.224 2.44249e-15
+0.226 2.44249e-15
+0.228 2.44249e-15
+0.23 2.44249e-15
+0.232 2.44249e-15
+0.234 2.44249e-15
+0.236 2.44249e-15
+0.238 2.55351e-15
+0.24 2.55351e-15
+0.242 2.55351e-15
+0.244 2.55351e-15
+0.246 2.55351e-15
+0.248 2.55351e-15
+0.25 2.55351e-15
+0.252 2.55351e-15
+0.254 2.55351e-15
+0.256 2.66454e-15
+0.258 2.55351e-15
+0.26 2.66454e-15
+0.262 2.66454e-15
+0.264 2.66454e-15
+0.266 2.66454e-15
+0.268 2.66454e-15
+0.27 2.66454e-15
+0.272 2.77556e-15
+0.274 2.77556e-15
+0.276 2.77556e-15
+0.278 2.77556e-15
+0.28 2.77556e-15
+0.282 2.77556e-15
+0.284 2.88658e-15
+0.286 2.77556e-15
+0.288 2.77556e-15
+0.29 2.66454e-15
+0.292 2.77556e-15
+0.294 2.77556e-15
+0.296 2.77556e-15
+0.298 2.77556e-15
+0.3 2.77556e-15
+0.302 2.77556e-15
+0.304 2.88658e-15
+0.306 2.88658e-15
+0.308 2.88658e-15
+0.31 2.77556e-15
+0.312 2.88658e-15
+0.314 2.88658e-15
+0.316 2.88658e-15
+0.318 2.88658e-15
+0.32 2.9976e-15
+0.322 2.88658e-15
+0.324 2.88658e-15
+0.326 2.9976e-15
+0.328 2.9976e-15
+0.33 2.88658e-15
+0.332 2.9976e-15
+0.334 2.9976e-15
+0.336 2.9976e-15
+0.338 2.9976e-15
+0.34 2.9976e-15
+0.342 3.10862e-15
+0.344 2.9976e-15
+0.346 3.10862e-15
+0.348 2.9976e-15
+0.35 3.10862e-15
+0.352 3.10862e-15
+0.354 3.10862e-15
+0.356 3.10862e-15
+0.358 3.10862e-15
+0.36 3.10862e-15
+0.362 3.10862e-15
+0.364 3.10862e-15
+0.366 3.10862e-15
+0.368 3.21965e-15
+0.37 3.21965e-15
+0.372 3.33067e-15
+0.374 3.21965e-15
+0.376 3.21965e-15
+0.378 3.21965e-15
+0.38 3.21965e-15
+0.382 3.10862e-15
+0.384 3.21965e-15
+0.386 3.21965e-15
+0.388 3.33067e-15
+0.39 3.21965e-15
+0.392 3.33067e-15
+0.394 3.33067e-15
+0.396 3.33067e-15
+0.398 3.21965e-15
+0.4 3.33067e-15
+0.402 3.33067e-15
+0.404 3.33067e-15
+0.406 3.33067e-15
+0.408 3.33067e-15
+0.41 3.33067e-15
+0.412 3.33067e-15
+0.414 3.33067e-15
+0.416 3.44169e-15
+0.418 3.33067e-15
+0.42 3.44169e-15
+0.422 3.44169e-15
+0.424 3.33067e-15
+0.426 3.33067e-15
+0.428 3.44169e-15
+0.43 3.44169e-15
+0.432 3.44169e-15
+0.434 3.44169e-15
+0.436 3.55271e-15
+0.438 3.44169e-15
+0.44 3.44169e-15
+0.442 3.44169e-15
+0.444 3.44169e-15
+0.446 3.44169e-15
+0.448 3.44169e-15
+0.45 3.44169e-15
+0.452 3.44169e-15
+0.454 3.33067e-15
+0.456 3.44169e-15
+0.458 3.55271e-15
+0.46 3.44169e-15
+0.462 3.44169e-15
+0.464 3.44169e-15
+0.466 3.44169e-15
+0.468 3.44169e-15
+0.47 3.55271e-15
+0.472 3.55271e-15
+0.474 3.55271e-15
+0.476 3.44169e-15
+0.478 3.44169e-15
+0.48 3.44169e-15
+0.482 3.44169e-15
+0.484 3.44169e-15
+0.486 3.44169e-15
+0.488 3.44169e-15
+0.49 3.44169e-15
+0.492 3.55271e-15
+0.494 3.44169e-15
+0.496 3.44169e-15
+0.498 3.44169e-15
+0.5 3.33067e-15
+0.502 3.44169e-15
+0.504 3.44169e-15
+0.506 3.33067e-15
+0.508 3.55271e-15
+0.51 3.44169e-15
+0.512 3.33067e-15
+0.514 3.44169e-15
+0.516 3.44169e-15
+0.518 3.44169e-15
+0.52 3.44169e-15
+0.522 3.33067e-15
+0.524 3.44169e-15
+0.526 3.44169e-15
+0.528 3.44169e-15
+0.53 3.44169e-15
+0.532 3.44169e-15
+0.534 3.33067e-15
+0.536 3.33067e-15
+0.538 3.44169e-15
+0.54 3.44169e-15
+0.542 3.44169e-15
+0.544 3.33067e-15
+0.546 3.33067e-15
+0.548 3.44169e-15
+0.55 3.33067e-15
+0.552 3.44169e-15
+0.554 3.44169e-15
+0.556 3.44169e-15
+0.558 3.44169e-15
+0.56 3.44169e-15
+0.562 3.33067e-15
+0.564 3.33067e-15
+0.566 3.33067e-15
+0.568 3.33067e-15
+0.57 3.44169e-15
+0.572 3.44169e-15
+0.574 3.33067e-15
+0.576 3.33067e-15
+0.578 3.33067e-15
+0.58 3.44169e-15
+0.582 3.44169e-15
+0.584 3.44169e-15
+0.586 3.44169e-15
+0.588 3.33067e-15
+0.59 3.33067e-15
+0.592 3.21965e-15
+0.594 3.33067e-15
+0.596 3.33067e-15
+0.598 3.33067e-15
+0.6 3.33067e-15
+0.602 3.21965e-15
+0.604 3.33067e-15
+0.606 3.33067e-15
+0.608 3.33067e-15
+0.61 3.21965e-15
+0.612 3.33067e-15
+0.614 3.21965e-15
+0.616 3.21965e-15
+0.618 3.10862e-15
+0.62 3.33067e-15
+0.622 3.21965e-15
+0.624 3.21965e-15
+0.626 3.21965e-15
+0.628 3.33067e-15
+0.63 3.21965e-15
+0.632 3.21965e-15
+0.634 3.10862e-15
+0.636 3.10862e-15
+0.638 3.10862e-15
+0.64 3.10862e-15
+0.642 3.10862e-15
+0.644 3.10862e-15
+0.646 3.10862e-15
+0.648 3.10862e-15
+0.65 3.21965e-15
+0.652 3.10862e-15
+0.654 3.10862e-15
+0.656 3.10862e-15
+0.658 3.10862e-15
+0.66 3.10862e-15
+0.662 3.10862e-15
+0.664 2.9976e-15
+0.666 3.10862e-15
+0.668 2.9976e-15
+0.67 3.10862e-15
+0.672 2.9976e-15
+0.674 3.10862e-15
+0.676 2.9976e-15
+0.678 2.88658e-15
+0.68 3.10862e-15
+0.682 2.9976e-15
+0.684 2.88658e-15
+0.686 2.88658e-15
+0.688 2.9976e-15
+0.69 2.88658e-15
+0.692 2.9976e-15
+0.694 2.88658e-15
+0.696 2.88658e-15
+0.698 2.88658e-15
+0.7 2.88658e-15
+0.702 2.77556e-15
+0.704 2.88658e-15
+0.706 2.77556e-15
+0.708 2.88658e-15
+0.71 2.88658e-15
+0.712 2.77556e-15
+0.714 2.77556e-15
+0.716 2.83107e-15
+0.718 2.83107e-15
+0.72 2.77556e-15
+0.722 2.77556e-15
+0.724 2.77556e-15
+0.726 2.77556e-15
+0.728 2.77556e-15
+0.73 2.66454e-15
+0.732 2.66454e-15
+0.734 2.72005e-15
+0.736 2.66454e-15
+0.738 2.66454e-15
+0.74 2.66454e-15
+0.742 2.60902e-15
+0.744 2.66454e-15
+0.746 2.55351e-15
+0.748 2.55351e-15
+0.75 2.55351e-15
+0.752 2.55351e-15
+0.754 2.55351e-15
+0.756 2.55351e-15
+0.758 2.498e-15
+0.76 2.498e-15
+0.762 2.55351e-15
+0.764 2.44249e-15
+0.766 2.498e-15
+0.768 2.44249e-15
+0.77 2.38698e-15
+0.772 2.44249e-15
+0.774 2.44249e-15
+0.776 2.38698e-15
+0.778 2.38698e-15
+0.78 2.33147e-15
+0.782 2.33147e-15
+0.784 2.33147e-15
+0.786 2.27596e-15
+0.788 2.27596e-15
+0.79 2.33147e-15
+0.792 2.22045e-15
+0.794 2.27596e-15
+0.796 2.22045e-15
+0.798 2.22045e-15
+0.8 2.22045e-15
+0.802 2.22045e-15
+0.804 2.22045e-15
+0.806 2.16493e-15
+0.808 2.16493e-15
+0.81 2.10942e-15
+0.812 2.05391e-15
+0.814 2.05391e-15
+0.816 2.10942e-15
+0.818 1.9984e-15
+0.82 1.9984e-15
+0.822 1.9984e-15
+0.824 1.9984e-15
+0.826 1.9984e-15
+0.828 1.88738e-15
+0.83 1.88738e-15
+0.832 1.9984e-15
+0.834 1.88738e-15
+0.836 1.88738e-15
+0.838 1.88738e-15
+0.84 1.77636e-15
+0.842 1.77636e-15
+0.844 1.77636e-15
+0.846 1.77636e-15
+0.848 1.77636e-15
+0.85 1.72085e-15
+0.852 1.77636e-15
+0.854 1.72085e-15
+0.856 1.66533e-15
+0.858 1.66533e-15
+0.86 1.60982e-15
+0.862 1.55431e-15
+0.864 1.55431e-15
+0.866 1.55431e-15
+0.868 1.55431e-15
+0.87 1.60982e-15
+0.872 1.47105e-15
+0.874 1.4988e-15
+0.876 1.41553e-15
+0.878 1.4988e-15
+0.88 1.41553e-15
+0.882 1.4988e-15
+0.884 1.41553e-15
+0.886 1.38778e-15
+0.888 1.36002e-15
+0.89 1.36002e-15
+0.892 1.33227e-15
+0.894 1.33227e-15
+0.896 1.33227e-15
+0.898 1.22125e-15
+0.9 1.22125e-15
+0.902 1.16573e-15
+0.904 1.19349e-15
+0.906 1.16573e-15
+0.908 1.16573e-15
+0.91 1.11022e-15
+0.912 1.05471e-15
+0.914 1.05471e-15
+0.916 9.99201e-16
+0.918 9.99201e-16
+0.92 9.71445e-16
+0.922 9.99201e-16
+0.924 9.4369e-16
+0.926 9.99201e-16
+0.928 8.88178e-16
+0.93 9.4369e-16
+0.932 8.32667e-16
+0.934 8.88178e-16
+0.936 7.77156e-16
+0.938 8.04912e-16
+0.94 8.04912e-16
+0.942 8.32667e-16
+0.944 7.21645e-16
+0.946 7.35523e-16
+0.948 7.21645e-16
+0.95 6.10623e-16
+0.952 5.82867e-16
+0.954 6.38378e-16
+0.956 6.10623e-16
+0.958 5.55112e-16
+0.96 5.55112e-16
+0.962 4.996e-16
+0.964 4.44089e-16
+0.966 4.85723e-16
+0.968 4.57967e-16
+0.97 4.02456e-16
+0.972 3.747e-16
+0.974 3.46945e-16
+0.976 3.60822e-16
+0.978 3.33067e-16
+0.98 2.35922e-16
+0.982 2.42861e-16
+0.984 2.498e-16
+0.986 1.52656e-16
+0.988 1.97758e-16
+0.99 1.35308e-16
+0.992 7.28584e-17
+0.994 1.17961e-16
+0.996 5.55112e-17
+0.998 2.77556e-17
+1 0
+
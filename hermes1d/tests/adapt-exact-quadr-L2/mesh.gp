@@ -0,0 +1,10 @@
+-1 0
+-1 2
+0 2
+0 0
+
+0 0
+0 2
+1 2
+1 0
+
@@ -0,0 +1,103 @@
+-1 0
+-0.98 0.0396
+-0.96 0.0784
+-0.94 0.1164
+-0.92 0.1536
+-0.9 0.19
+-0.88 0.2256
+-0.86 0.2604
+-0.84 0.2944
+-0.82 0.3276
+-0.8 0.36
+-0.78 0.3916
+-0.76 0.4224
+-0.74 0.4524
+-0.72 0.4816
+-0.7 0.51
+-0.68 0.5376
+-0.66 0.5644
+-0.64 0.5904
+-0.62 0.6156
+-0.6 0.64
+-0.58 0.6636
+-0.56 0.6864
+-0.54 0.7084
+-0.52 0.7296
+-0.5 0.75
+-0.48 0.7696
+-0.46 0.7884
+-0.44 0.8064
+-0.42 0.8236
+-0.4 0.84
+-0.38 0.8556
+-0.36 0.8704
+-0.34 0.8844
+-0.32 0.8976
+-0.3 0.91
+-0.28 0.9216
+-0.26 0.9324
+-0.24 0.9424
+-0.22 0.9516
+-0.2 0.96
+-0.18 0.9676
+-0.16 0.9744
+-0.14 0.9804
+-0.12 0.9856
+-0.1 0.99
+-0.08 0.9936
+-0.06 0.9964
+-0.04 0.9984
+-0.02 0.9996
+0 1
+0 1
+0.02 0.9996
+0.04 0.9984
+0.06 0.9964
+0.08 0.9936
+0.1 0.99
+0.12 0.9856
+0.14 0.9804
+0.16 0.9744
+0.18 0.9676
+0.2 0.96
+0.22 0.9516
+0.24 0.9424
+0.26 0.9324
+0.28 0.9216
+0.3 0.91
+0.32 0.8976
+0.34 0.8844
+0.36 0.8704
+0.38 0.8556
+0.4 0.84
+0.42 0.8236
+0.44 0.8064
+0.46 0.7884
+0.48 0.7696
+0.5 0.75
+0.52 0.7296
+0.54 0.7084
+0.56 0.6864
+0.58 0.6636
+0.6 0.64
+0.62 0.6156
+0.64 0.5904
+0.66 0.5644
+0.68 0.5376
+0.7 0.51
+0.72 0.4816
+0.74 0.4524
+0.76 0.4224
+0.78 0.3916
+0.8 0.36
+0.82 0.3276
+0.84 0.2944
+0.86 0.2604
+0.88 0.2256
+0.9 0.19
+0.92 0.1536
+0.94 0.1164
+0.96 0.0784
+0.98 0.0396
+1 0
+
@@ -0,0 +1,24 @@
+set terminal postscript eps enhanced
+set output 'conv_dof.eps'
+set size 0.8, 0.8
+set logscale y
+set grid
+set title 'Convergence History'
+set xlabel 'Degrees of Freedom'
+set ylabel 'Error [%]'
+plot '-' w lp linetype 1 pointtype 6 title 'exact error' ,  '-' w lp linetype 2 pointtype 0 title 'error estimate' 
+1  100
+3  8.966718915075
+7  0.28320737714503
+11  0.0042386814166808
+15  3.6797337277285e-05
+19  2.0832658547906e-07
+e
+1  100
+3  8.9390446121624
+7  0.28317052834355
+11  0.0042386543392116
+15  3.6797327345414e-05
+19  2.0832875582426e-07
+e
+set terminal x11
@@ -0,0 +1,2008 @@
+-3.14159 9.89745e-09
+
+-3.13531 7.45414e-09
+
+-3.12903 5.32198e-09
+
+-3.12274 3.47538e-09
+
+-3.11646 1.89103e-09
+
+-3.11018 5.55953e-10
+
+-3.10389 6.14236e-10
+
+-3.09761 1.53983e-09
+
+-3.09133 2.2964e-09
+
+-3.08504 2.89442e-09
+
+-3.07876 3.34945e-09
+
+-3.07248 3.67655e-09
+
+-3.06619 3.88991e-09
+
+-3.05991 4.00273e-09
+
+-3.05363 4.02731e-09
+
+-3.04734 3.97505e-09
+
+-3.04106 3.85648e-09
+
+-3.03478 3.68134e-09
+
+-3.0285 3.45861e-09
+
+-3.02221 3.19654e-09
+
+-3.01593 2.9027e-09
+
+-3.00965 2.58404e-09
+
+-3.00336 2.24696e-09
+
+-2.99708 1.89733e-09
+
+-2.9908 1.5407e-09
+
+-2.98451 1.18254e-09
+
+-2.97823 8.29295e-10
+
+-2.97195 4.93225e-10
+
+-2.96566 2.36631e-10
+
+-2.95938 3.28954e-10
+
+-2.9531 6.12733e-10
+
+-2.94681 9.10064e-10
+
+-2.94053 1.19739e-09
+
+-2.93425 1.46884e-09
+
+-2.92796 1.72173e-09
+
+-2.92168 1.95451e-09
+
+-2.9154 2.16612e-09
+
+-2.90911 2.35588e-09
+
+-2.90283 2.52336e-09
+
+-2.89655 2.66834e-09
+
+-2.89027 2.7908e-09
+
+-2.88398 2.89089e-09
+
+-2.8777 2.96888e-09
+
+-2.87142 3.02521e-09
+
+-2.86513 3.06039e-09
+
+-2.85885 3.07507e-09
+
+-2.85257 3.06995e-09
+
+-2.84628 3.04586e-09
+
+-2.84 3.00365e-09
+
+-2.83372 2.94425e-09
+
+-2.82743 2.86864e-09
+
+-2.82115 2.77784e-09
+
+-2.81487 2.6729e-09
+
+-2.80858 2.5549e-09
+
+-2.8023 2.42493e-09
+
+-2.79602 2.28413e-09
+
+-2.78973 2.13361e-09
+
+-2.78345 1.97453e-09
+
+-2.77717 1.80805e-09
+
+-2.77088 1.63534e-09
+
+-2.7646 1.45764e-09
+
+-2.75832 1.27625e-09
+
+-2.75204 1.09261e-09
+
+-2.74575 9.08513e-10
+
+-2.73947 7.26512e-10
+
+-2.73319 5.51155e-10
+
+-2.7269 3.93076e-10
+
+-2.72062 2.8265e-10
+
+-2.71434 2.80121e-10
+
+-2.70805 3.84156e-10
+
+-2.70177 5.32397e-10
+
+-2.69549 6.93782e-10
+
+-2.6892 8.57696e-10
+
+-2.68292 1.01983e-09
+
+-2.67664 1.17801e-09
+
+-2.67035 1.3309e-09
+
+-2.66407 1.47756e-09
+
+-2.65779 1.61728e-09
+
+-2.6515 1.74951e-09
+
+-2.64522 1.87377e-09
+
+-2.63894 1.98967e-09
+
+-2.63265 2.09687e-09
+
+-2.62637 2.19512e-09
+
+-2.62009 2.28418e-09
+
+-2.61381 2.36388e-09
+
+-2.60752 2.43409e-09
+
+-2.60124 2.49471e-09
+
+-2.59496 2.54569e-09
+
+-2.58867 2.58702e-09
+
+-2.58239 2.61872e-09
+
+-2.57611 2.64084e-09
+
+-2.56982 2.65346e-09
+
+-2.56354 2.65672e-09
+
+-2.55726 2.65074e-09
+
+-2.55097 2.63572e-09
+
+-2.54469 2.61184e-09
+
+-2.53841 2.57934e-09
+
+-2.53212 2.53847e-09
+
+-2.52584 2.4895e-09
+
+-2.51956 2.43273e-09
+
+-2.51327 2.36846e-09
+
+-2.50699 2.29704e-09
+
+-2.50071 2.21881e-09
+
+-2.49442 2.13414e-09
+
+-2.48814 2.04341e-09
+
+-2.48186 1.94702e-09
+
+-2.47558 1.84539e-09
+
+-2.46929 1.73895e-09
+
+-2.46301 1.62815e-09
+
+-2.45673 1.51347e-09
+
+-2.45044 1.39541e-09
+
+-2.44416 1.27452e-09
+
+-2.43788 1.15141e-09
+
+-2.43159 1.02679e-09
+
+-2.42531 9.01511e-10
+
+-2.41903 7.76756e-10
+
+-2.41274 6.54246e-10
+
+-2.40646 5.36863e-10
+
+-2.40018 4.29998e-10
+
+-2.39389 3.44419e-10
+
+-2.38761 2.99205e-10
+
+-2.38133 3.11925e-10
+
+-2.37504 3.75813e-10
+
+-2.36876 4.69296e-10
+
+-2.36248 5.7692e-10
+
+-2.35619 6.90808e-10
+
+-2.34991 8.06999e-10
+
+-2.34363 9.23317e-10
+
+-2.33734 1.03844e-09
+
+-2.33106 1.15146e-09
+
+-2.32478 1.26174e-09
+
+-2.3185 1.36877e-09
+
+-2.31221 1.47212e-09
+
+-2.30593 1.57145e-09
+
+-2.29965 1.66643e-09
+
+-2.29336 1.75681e-09
+
+-2.28708 1.84234e-09
+
+-2.2808 1.92281e-09
+
+-2.27451 1.99803e-09
+
+-2.26823 2.06782e-09
+
+-2.26195 2.13204e-09
+
+-2.25566 2.19056e-09
+
+-2.24938 2.24326e-09
+
+-2.2431 2.29005e-09
+
+-2.23681 2.33086e-09
+
+-2.23053 2.36562e-09
+
+-2.22425 2.39429e-09
+
+-2.21796 2.41685e-09
+
+-2.21168 2.43329e-09
+
+-2.2054 2.44361e-09
+
+-2.19911 2.44782e-09
+
+-2.19283 2.44598e-09
+
+-2.18655 2.43812e-09
+
+-2.18027 2.42432e-09
+
+-2.17398 2.40465e-09
+
+-2.1677 2.37921e-09
+
+-2.16142 2.34809e-09
+
+-2.15513 2.31143e-09
+
+-2.14885 2.26935e-09
+
+-2.14257 2.22199e-09
+
+-2.13628 2.16952e-09
+
+-2.13 2.1121e-09
+
+-2.12372 2.04991e-09
+
+-2.11743 1.98315e-09
+
+-2.11115 1.91201e-09
+
+-2.10487 1.83672e-09
+
+-2.09858 1.7575e-09
+
+-2.0923 1.67459e-09
+
+-2.08602 1.58825e-09
+
+-2.07973 1.49875e-09
+
+-2.07345 1.40638e-09
+
+-2.06717 1.31146e-09
+
+-2.06088 1.21433e-09
+
+-2.0546 1.11539e-09
+
+-2.04832 1.01511e-09
+
+-2.04204 9.14027e-10
+
+-2.03575 8.12873e-10
+
+-2.02947 7.12629e-10
+
+-2.02319 6.14748e-10
+
+-2.0169 5.21543e-10
+
+-2.01062 4.36929e-10
+
+-2.00434 3.67665e-10
+
+-1.99805 3.24266e-10
+
+-1.99177 3.1767e-10
+
+-1.98549 3.4977e-10
+
+-1.9792 4.11168e-10
+
+-1.97292 4.90393e-10
+
+-1.96664 5.79495e-10
+
+-1.96035 6.73824e-10
+
+-1.95407 7.70681e-10
+
+-1.94779 8.68423e-10
+
+-1.9415 9.65976e-10
+
+-1.93522 1.06258e-09
+
+-1.92894 1.15769e-09
+
+-1.92265 1.25084e-09
+
+-1.91637 1.34167e-09
+
+-1.91009 1.42987e-09
+
+-1.90381 1.51516e-09
+
+-1.89752 1.5973e-09
+
+-1.89124 1.67607e-09
+
+-1.88496 1.75126e-09
+
+-1.87867 1.8227e-09
+
+-1.87239 1.89021e-09
+
+-1.86611 1.95364e-09
+
+-1.85982 2.01284e-09
+
+-1.85354 2.06769e-09
+
+-1.84726 2.11807e-09
+
+-1.84097 2.16387e-09
+
+-1.83469 2.20501e-09
+
+-1.82841 2.2414e-09
+
+-1.82212 2.27296e-09
+
+-1.81584 2.29965e-09
+
+-1.80956 2.32141e-09
+
+-1.80327 2.33821e-09
+
+-1.79699 2.35002e-09
+
+-1.79071 2.35683e-09
+
+-1.78442 2.35865e-09
+
+-1.77814 2.35547e-09
+
+-1.77186 2.34731e-09
+
+-1.76558 2.33422e-09
+
+-1.75929 2.31623e-09
+
+-1.75301 2.29339e-09
+
+-1.74673 2.26576e-09
+
+-1.74044 2.23343e-09
+
+-1.73416 2.19647e-09
+
+-1.72788 2.15499e-09
+
+-1.72159 2.10907e-09
+
+-1.71531 2.05885e-09
+
+-1.70903 2.00444e-09
+
+-1.70274 1.94597e-09
+
+-1.69646 1.8836e-09
+
+-1.69018 1.81748e-09
+
+-1.68389 1.74776e-09
+
+-1.67761 1.67463e-09
+
+-1.67133 1.59827e-09
+
+-1.66504 1.51889e-09
+
+-1.65876 1.43669e-09
+
+-1.65248 1.3519e-09
+
+-1.64619 1.26479e-09
+
+-1.63991 1.17562e-09
+
+-1.63363 1.08473e-09
+
+-1.62734 9.92493e-10
+
+-1.62106 8.99375e-10
+
+-1.61478 8.05982e-10
+
+-1.6085 7.13146e-10
+
+-1.60221 6.22086e-10
+
+-1.59593 5.34713e-10
+
+-1.58965 4.5419e-10
+
+-1.58336 3.85869e-10
+
+-1.57708 3.38218e-10
+
+-1.5708 3.21404e-10
+
+-1.5708 3.21404e-10
+
+-1.56451 3.38219e-10
+
+-1.55823 3.8587e-10
+
+-1.55195 4.54191e-10
+
+-1.54566 5.34713e-10
+
+-1.53938 6.22086e-10
+
+-1.5331 7.13146e-10
+
+-1.52681 8.05983e-10
+
+-1.52053 8.99375e-10
+
+-1.51425 9.92493e-10
+
+-1.50796 1.08473e-09
+
+-1.50168 1.17562e-09
+
+-1.4954 1.26479e-09
+
+-1.48911 1.3519e-09
+
+-1.48283 1.43669e-09
+
+-1.47655 1.51889e-09
+
+-1.47027 1.59828e-09
+
+-1.46398 1.67463e-09
+
+-1.4577 1.74776e-09
+
+-1.45142 1.81748e-09
+
+-1.44513 1.8836e-09
+
+-1.43885 1.94598e-09
+
+-1.43257 2.00444e-09
+
+-1.42628 2.05885e-09
+
+-1.42 2.10908e-09
+
+-1.41372 2.15499e-09
+
+-1.40743 2.19648e-09
+
+-1.40115 2.23343e-09
+
+-1.39487 2.26577e-09
+
+-1.38858 2.29339e-09
+
+-1.3823 2.31623e-09
+
+-1.37602 2.33422e-09
+
+-1.36973 2.34732e-09
+
+-1.36345 2.35547e-09
+
+-1.35717 2.35865e-09
+
+-1.35088 2.35684e-09
+
+-1.3446 2.35002e-09
+
+-1.33832 2.33821e-09
+
+-1.33204 2.32141e-09
+
+-1.32575 2.29965e-09
+
+-1.31947 2.27296e-09
+
+-1.31319 2.2414e-09
+
+-1.3069 2.20501e-09
+
+-1.30062 2.16388e-09
+
+-1.29434 2.11807e-09
+
+-1.28805 2.06769e-09
+
+-1.28177 2.01284e-09
+
+-1.27549 1.95364e-09
+
+-1.2692 1.89021e-09
+
+-1.26292 1.8227e-09
+
+-1.25664 1.75126e-09
+
+-1.25035 1.67607e-09
+
+-1.24407 1.5973e-09
+
+-1.23779 1.51516e-09
+
+-1.2315 1.42986e-09
+
+-1.22522 1.34167e-09
+
+-1.21894 1.25083e-09
+
+-1.21265 1.15768e-09
+
+-1.20637 1.06258e-09
+
+-1.20009 9.65974e-10
+
+-1.19381 8.68421e-10
+
+-1.18752 7.70679e-10
+
+-1.18124 6.73821e-10
+
+-1.17496 5.79493e-10
+
+-1.16867 4.90391e-10
+
+-1.16239 4.11166e-10
+
+-1.15611 3.49769e-10
+
+-1.14982 3.1767e-10
+
+-1.14354 3.24267e-10
+
+-1.13726 3.67667e-10
+
+-1.13097 4.36931e-10
+
+-1.12469 5.21545e-10
+
+-1.11841 6.1475e-10
+
+-1.11212 7.12631e-10
+
+-1.10584 8.12875e-10
+
+-1.09956 9.14028e-10
+
+-1.09327 1.01511e-09
+
+-1.08699 1.11539e-09
+
+-1.08071 1.21433e-09
+
+-1.07442 1.31146e-09
+
+-1.06814 1.40638e-09
+
+-1.06186 1.49875e-09
+
+-1.05558 1.58825e-09
+
+-1.04929 1.67459e-09
+
+-1.04301 1.7575e-09
+
+-1.03673 1.83672e-09
+
+-1.03044 1.91201e-09
+
+-1.02416 1.98314e-09
+
+-1.01788 2.04991e-09
+
+-1.01159 2.1121e-09
+
+-1.00531 2.16952e-09
+
+-0.999026 2.22199e-09
+
+-0.992743 2.26934e-09
+
+-0.98646 2.31142e-09
+
+-0.980177 2.34809e-09
+
+-0.973894 2.3792e-09
+
+-0.967611 2.40465e-09
+
+-0.961327 2.42432e-09
+
+-0.955044 2.43812e-09
+
+-0.948761 2.44598e-09
+
+-0.942478 2.44782e-09
+
+-0.936195 2.4436e-09
+
+-0.929911 2.43328e-09
+
+-0.923628 2.41685e-09
+
+-0.917345 2.39429e-09
+
+-0.911062 2.36561e-09
+
+-0.904779 2.33085e-09
+
+-0.898495 2.29004e-09
+
+-0.892212 2.24325e-09
+
+-0.885929 2.19055e-09
+
+-0.879646 2.13203e-09
+
+-0.873363 2.06781e-09
+
+-0.86708 1.99802e-09
+
+-0.860796 1.92281e-09
+
+-0.854513 1.84234e-09
+
+-0.84823 1.75681e-09
+
+-0.841947 1.66643e-09
+
+-0.835664 1.57144e-09
+
+-0.82938 1.47211e-09
+
+-0.823097 1.36876e-09
+
+-0.816814 1.26174e-09
+
+-0.810531 1.15146e-09
+
+-0.804248 1.03843e-09
+
+-0.797965 9.23311e-10
+
+-0.791681 8.06993e-10
+
+-0.785398 6.90803e-10
+
+-0.779115 5.76915e-10
+
+-0.772832 4.69291e-10
+
+-0.766549 3.75809e-10
+
+-0.760265 3.11922e-10
+
+-0.753982 2.99204e-10
+
+-0.747699 3.44419e-10
+
+-0.741416 4.29999e-10
+
+-0.735133 5.36864e-10
+
+-0.728849 6.54248e-10
+
+-0.722566 7.76757e-10
+
+-0.716283 9.01512e-10
+
+-0.71 1.02679e-09
+
+-0.703717 1.15141e-09
+
+-0.697434 1.27452e-09
+
+-0.69115 1.39541e-09
+
+-0.684867 1.51347e-09
+
+-0.678584 1.62815e-09
+
+-0.672301 1.73895e-09
+
+-0.666018 1.84539e-09
+
+-0.659734 1.94702e-09
+
+-0.653451 2.0434e-09
+
+-0.647168 2.13413e-09
+
+-0.640885 2.2188e-09
+
+-0.634602 2.29704e-09
+
+-0.628319 2.36846e-09
+
+-0.622035 2.43272e-09
+
+-0.615752 2.4895e-09
+
+-0.609469 2.53847e-09
+
+-0.603186 2.57934e-09
+
+-0.596903 2.61183e-09
+
+-0.590619 2.63571e-09
+
+-0.584336 2.65074e-09
+
+-0.578053 2.65671e-09
+
+-0.57177 2.65346e-09
+
+-0.565487 2.64083e-09
+
+-0.559203 2.61871e-09
+
+-0.55292 2.58702e-09
+
+-0.546637 2.54569e-09
+
+-0.540354 2.4947e-09
+
+-0.534071 2.43408e-09
+
+-0.527788 2.36387e-09
+
+-0.521504 2.28417e-09
+
+-0.515221 2.19511e-09
+
+-0.508938 2.09687e-09
+
+-0.502655 1.98966e-09
+
+-0.496372 1.87376e-09
+
+-0.490088 1.74951e-09
+
+-0.483805 1.61728e-09
+
+-0.477522 1.47755e-09
+
+-0.471239 1.33089e-09
+
+-0.464956 1.17801e-09
+
+-0.458673 1.01983e-09
+
+-0.452389 8.57693e-10
+
+-0.446106 6.9378e-10
+
+-0.439823 5.32396e-10
+
+-0.43354 3.84155e-10
+
+-0.427257 2.80122e-10
+
+-0.420973 2.8265e-10
+
+-0.41469 3.93076e-10
+
+-0.408407 5.51155e-10
+
+-0.402124 7.26511e-10
+
+-0.395841 9.08511e-10
+
+-0.389557 1.0926e-09
+
+-0.383274 1.27624e-09
+
+-0.376991 1.45764e-09
+
+-0.370708 1.63534e-09
+
+-0.364425 1.80804e-09
+
+-0.358142 1.97452e-09
+
+-0.351858 2.1336e-09
+
+-0.345575 2.28412e-09
+
+-0.339292 2.42492e-09
+
+-0.333009 2.55489e-09
+
+-0.326726 2.67289e-09
+
+-0.320442 2.77783e-09
+
+-0.314159 2.86863e-09
+
+-0.307876 2.94424e-09
+
+-0.301593 3.00364e-09
+
+-0.29531 3.04585e-09
+
+-0.289027 3.06994e-09
+
+-0.282743 3.07505e-09
+
+-0.27646 3.06038e-09
+
+-0.270177 3.0252e-09
+
+-0.263894 2.96887e-09
+
+-0.257611 2.89087e-09
+
+-0.251327 2.79079e-09
+
+-0.245044 2.66833e-09
+
+-0.238761 2.52335e-09
+
+-0.232478 2.35587e-09
+
+-0.226195 2.16611e-09
+
+-0.219911 1.9545e-09
+
+-0.213628 1.72172e-09
+
+-0.207345 1.46883e-09
+
+-0.201062 1.19739e-09
+
+-0.194779 9.10059e-10
+
+-0.188496 6.12728e-10
+
+-0.182212 3.2895e-10
+
+-0.175929 2.36629e-10
+
+-0.169646 4.93224e-10
+
+-0.163363 8.29294e-10
+
+-0.15708 1.18254e-09
+
+-0.150796 1.54069e-09
+
+-0.144513 1.89733e-09
+
+-0.13823 2.24695e-09
+
+-0.131947 2.58404e-09
+
+-0.125664 2.90269e-09
+
+-0.119381 3.19653e-09
+
+-0.113097 3.4586e-09
+
+-0.106814 3.68133e-09
+
+-0.100531 3.85647e-09
+
+-0.0942478 3.97504e-09
+
+-0.0879646 4.0273e-09
+
+-0.0816814 4.00272e-09
+
+-0.0753982 3.88989e-09
+
+-0.069115 3.67654e-09
+
+-0.0628319 3.34944e-09
+
+-0.0565487 2.89441e-09
+
+-0.0502655 2.29639e-09
+
+-0.0439823 1.53983e-09
+
+-0.0376991 6.14235e-10
+
+-0.0314159 5.55952e-10
+
+-0.0251327 1.89103e-09
+
+-0.0188496 3.47537e-09
+
+-0.0125664 5.32196e-09
+
+-0.00628319 7.45411e-09
+
+0 9.89742e-09
+
+0 9.89745e-09
+
+0.00628319 7.45414e-09
+
+0.0125664 5.32198e-09
+
+0.0188496 3.47538e-09
+
+0.0251327 1.89103e-09
+
+0.0314159 5.55953e-10
+
+0.0376991 6.14236e-10
+
+0.0439823 1.53983e-09
+
+0.0502655 2.2964e-09
+
+0.0565487 2.89442e-09
+
+0.0628319 3.34945e-09
+
+0.069115 3.67655e-09
+
+0.0753982 3.88991e-09
+
+0.0816814 4.00273e-09
+
+0.0879646 4.02731e-09
+
+0.0942478 3.97505e-09
+
+0.100531 3.85648e-09
+
+0.106814 3.68134e-09
+
+0.113097 3.45861e-09
+
+0.119381 3.19654e-09
+
+0.125664 2.9027e-09
+
+0.131947 2.58404e-09
+
+0.13823 2.24696e-09
+
+0.144513 1.89733e-09
+
+0.150796 1.5407e-09
+
+0.15708 1.18254e-09
+
+0.163363 8.29296e-10
+
+0.169646 4.93226e-10
+
+0.175929 2.36632e-10
+
+0.182212 3.28955e-10
+
+0.188496 6.12733e-10
+
+0.194779 9.10065e-10
+
+0.201062 1.1974e-09
+
+0.207345 1.46884e-09
+
+0.213628 1.72173e-09
+
+0.219911 1.95451e-09
+
+0.226195 2.16612e-09
+
+0.232478 2.35588e-09
+
+0.238761 2.52336e-09
+
+0.245044 2.66834e-09
+
+0.251327 2.7908e-09
+
+0.257611 2.89089e-09
+
+0.263894 2.96888e-09
+
+0.270177 3.02521e-09
+
+0.27646 3.06039e-09
+
+0.282743 3.07507e-09
+
+0.289027 3.06995e-09
+
+0.29531 3.04586e-09
+
+0.301593 3.00365e-09
+
+0.307876 2.94425e-09
+
+0.314159 2.86864e-09
+
+0.320442 2.77784e-09
+
+0.326726 2.6729e-09
+
+0.333009 2.5549e-09
+
+0.339292 2.42493e-09
+
+0.345575 2.28413e-09
+
+0.351858 2.13361e-09
+
+0.358142 1.97453e-09
+
+0.364425 1.80805e-09
+
+0.370708 1.63534e-09
+
+0.376991 1.45764e-09
+
+0.383274 1.27624e-09
+
+0.389557 1.09261e-09
+
+0.395841 9.08513e-10
+
+0.402124 7.26512e-10
+
+0.408407 5.51155e-10
+
+0.41469 3.93075e-10
+
+0.420973 2.82648e-10
+
+0.427257 2.8012e-10
+
+0.43354 3.84155e-10
+
+0.439823 5.32396e-10
+
+0.446106 6.93782e-10
+
+0.452389 8.57695e-10
+
+0.458673 1.01983e-09
+
+0.464956 1.17801e-09
+
+0.471239 1.3309e-09
+
+0.477522 1.47756e-09
+
+0.483805 1.61728e-09
+
+0.490088 1.74951e-09
+
+0.496372 1.87377e-09
+
+0.502655 1.98967e-09
+
+0.508938 2.09687e-09
+
+0.515221 2.19512e-09
+
+0.521504 2.28418e-09
+
+0.527788 2.36388e-09
+
+0.534071 2.43409e-09
+
+0.540354 2.49471e-09
+
+0.546637 2.54569e-09
+
+0.55292 2.58702e-09
+
+0.559203 2.61872e-09
+
+0.565487 2.64084e-09
+
+0.57177 2.65346e-09
+
+0.578053 2.65672e-09
+
+0.584336 2.65074e-09
+
+0.590619 2.63572e-09
+
+0.596903 2.61184e-09
+
+0.603186 2.57934e-09
+
+0.609469 2.53847e-09
+
+0.615752 2.4895e-09
+
+0.622035 2.43273e-09
+
+0.628319 2.36846e-09
+
+0.634602 2.29704e-09
+
+0.640885 2.21881e-09
+
+0.647168 2.13414e-09
+
+0.653451 2.04341e-09
+
+0.659734 1.94702e-09
+
+0.666018 1.84539e-09
+
+0.672301 1.73895e-09
+
+0.678584 1.62815e-09
+
+0.684867 1.51347e-09
+
+0.69115 1.39541e-09
+
+0.697434 1.27452e-09
+
+0.703717 1.15141e-09
+
+0.71 1.02679e-09
+
+0.716283 9.01512e-10
+
+0.722566 7.76756e-10
+
+0.728849 6.54247e-10
+
+0.735133 5.36864e-10
+
+0.741416 4.29999e-10
+
+0.747699 3.4442e-10
+
+0.753982 2.99207e-10
+
+0.760265 3.11926e-10
+
+0.766549 3.75815e-10
+
+0.772832 4.69297e-10
+
+0.779115 5.76921e-10
+
+0.785398 6.90809e-10
+
+0.791681 8.07e-10
+
+0.797965 9.23318e-10
+
+0.804248 1.03844e-09
+
+0.810531 1.15146e-09
+
+0.816814 1.26175e-09
+
+0.823097 1.36877e-09
+
+0.82938 1.47212e-09
+
+0.835664 1.57145e-09
+
+0.841947 1.66643e-09
+
+0.84823 1.75681e-09
+
+0.854513 1.84235e-09
+
+0.860796 1.92281e-09
+
+0.86708 1.99803e-09
+
+0.873363 2.06782e-09
+
+0.879646 2.13204e-09
+
+0.885929 2.19056e-09
+
+0.892212 2.24326e-09
+
+0.898495 2.29005e-09
+
+0.904779 2.33086e-09
+
+0.911062 2.36562e-09
+
+0.917345 2.39429e-09
+
+0.923628 2.41685e-09
+
+0.929911 2.43329e-09
+
+0.936195 2.44361e-09
+
+0.942478 2.44782e-09
+
+0.948761 2.44598e-09
+
+0.955044 2.43813e-09
+
+0.961327 2.42432e-09
+
+0.967611 2.40465e-09
+
+0.973894 2.37921e-09
+
+0.980177 2.34809e-09
+
+0.98646 2.31143e-09
+
+0.992743 2.26934e-09
+
+0.999026 2.22199e-09
+
+1.00531 2.16952e-09
+
+1.01159 2.1121e-09
+
+1.01788 2.04991e-09
+
+1.02416 1.98315e-09
+
+1.03044 1.91201e-09
+
+1.03673 1.83672e-09
+
+1.04301 1.7575e-09
+
+1.04929 1.67459e-09
+
+1.05558 1.58825e-09
+
+1.06186 1.49875e-09
+
+1.06814 1.40638e-09
+
+1.07442 1.31146e-09
+
+1.08071 1.21433e-09
+
+1.08699 1.11539e-09
+
+1.09327 1.01511e-09
+
+1.09956 9.14026e-10
+
+1.10584 8.12872e-10
+
+1.11212 7.12628e-10
+
+1.11841 6.14748e-10
+
+1.12469 5.21542e-10
+
+1.13097 4.36928e-10
+
+1.13726 3.67664e-10
+
+1.14354 3.24264e-10
+
+1.14982 3.17668e-10
+
+1.15611 3.49769e-10
+
+1.16239 4.11166e-10
+
+1.16867 4.90391e-10
+
+1.17496 5.79494e-10
+
+1.18124 6.73823e-10
+
+1.18752 7.7068e-10
+
+1.19381 8.68423e-10
+
+1.20009 9.65975e-10
+
+1.20637 1.06258e-09
+
+1.21265 1.15769e-09
+
+1.21894 1.25084e-09
+
+1.22522 1.34167e-09
+
+1.2315 1.42987e-09
+
+1.23779 1.51516e-09
+
+1.24407 1.5973e-09
+
+1.25035 1.67607e-09
+
+1.25664 1.75126e-09
+
+1.26292 1.8227e-09
+
+1.2692 1.89021e-09
+
+1.27549 1.95364e-09
+
+1.28177 2.01284e-09
+
+1.28805 2.06769e-09
+
+1.29434 2.11807e-09
+
+1.30062 2.16387e-09
+
+1.3069 2.20501e-09
+
+1.31319 2.2414e-09
+
+1.31947 2.27296e-09
+
+1.32575 2.29965e-09
+
+1.33204 2.32141e-09
+
+1.33832 2.33821e-09
+
+1.3446 2.35002e-09
+
+1.35088 2.35683e-09
+
+1.35717 2.35865e-09
+
+1.36345 2.35547e-09
+
+1.36973 2.34731e-09
+
+1.37602 2.33422e-09
+
+1.3823 2.31623e-09
+
+1.38858 2.29339e-09
+
+1.39487 2.26576e-09
+
+1.40115 2.23343e-09
+
+1.40743 2.19647e-09
+
+1.41372 2.15499e-09
+
+1.42 2.10907e-09
+
+1.42628 2.05885e-09
+
+1.43257 2.00444e-09
+
+1.43885 1.94597e-09
+
+1.44513 1.8836e-09
+
+1.45142 1.81748e-09
+
+1.4577 1.74776e-09
+
+1.46398 1.67463e-09
+
+1.47027 1.59827e-09
+
+1.47655 1.51889e-09
+
+1.48283 1.43669e-09
+
+1.48911 1.3519e-09
+
+1.4954 1.26479e-09
+
+1.50168 1.17562e-09
+
+1.50796 1.08473e-09
+
+1.51425 9.92493e-10
+
+1.52053 8.99376e-10
+
+1.52681 8.05983e-10
+
+1.5331 7.13146e-10
+
+1.53938 6.22087e-10
+
+1.54566 5.34714e-10
+
+1.55195 4.54191e-10
+
+1.55823 3.85871e-10
+
+1.56451 3.3822e-10
+
+1.5708 3.21406e-10
+
+1.5708 3.21406e-10
+
+1.57708 3.38221e-10
+
+1.58336 3.85872e-10
+
+1.58965 4.54192e-10
+
+1.59593 5.34714e-10
+
+1.60221 6.22087e-10
+
+1.6085 7.13147e-10
+
+1.61478 8.05983e-10
+
+1.62106 8.99376e-10
+
+1.62734 9.92494e-10
+
+1.63363 1.08473e-09
+
+1.63991 1.17562e-09
+
+1.64619 1.26479e-09
+
+1.65248 1.3519e-09
+
+1.65876 1.43669e-09
+
+1.66504 1.51889e-09
+
+1.67133 1.59828e-09
+
+1.67761 1.67463e-09
+
+1.68389 1.74776e-09
+
+1.69018 1.81748e-09
+
+1.69646 1.8836e-09
+
+1.70274 1.94598e-09
+
+1.70903 2.00444e-09
+
+1.71531 2.05885e-09
+
+1.72159 2.10908e-09
+
+1.72788 2.15499e-09
+
+1.73416 2.19648e-09
+
+1.74044 2.23343e-09
+
+1.74673 2.26577e-09
+
+1.75301 2.29339e-09
+
+1.75929 2.31623e-09
+
+1.76558 2.33422e-09
+
+1.77186 2.34732e-09
+
+1.77814 2.35547e-09
+
+1.78442 2.35865e-09
+
+1.79071 2.35684e-09
+
+1.79699 2.35002e-09
+
+1.80327 2.33821e-09
+
+1.80956 2.32141e-09
+
+1.81584 2.29965e-09
+
+1.82212 2.27296e-09
+
+1.82841 2.2414e-09
+
+1.83469 2.20501e-09
+
+1.84097 2.16388e-09
+
+1.84726 2.11807e-09
+
+1.85354 2.06769e-09
+
+1.85982 2.01284e-09
+
+1.86611 1.95364e-09
+
+1.87239 1.89021e-09
+
+1.87867 1.8227e-09
+
+1.88496 1.75126e-09
+
+1.89124 1.67607e-09
+
+1.89752 1.5973e-09
+
+1.90381 1.51516e-09
+
+1.91009 1.42986e-09
+
+1.91637 1.34167e-09
+
+1.92265 1.25083e-09
+
+1.92894 1.15768e-09
+
+1.93522 1.06258e-09
+
+1.9415 9.65973e-10
+
+1.94779 8.68421e-10
+
+1.95407 7.70678e-10
+
+1.96035 6.73821e-10
+
+1.96664 5.79492e-10
+
+1.97292 4.9039e-10
+
+1.9792 4.11165e-10
+
+1.98549 3.49768e-10
+
+1.99177 3.17668e-10
+
+1.99805 3.24265e-10
+
+2.00434 3.67665e-10
+
+2.01062 4.3693e-10
+
+2.0169 5.21544e-10
+
+2.02319 6.14749e-10
+
+2.02947 7.1263e-10
+
+2.03575 8.12874e-10
+
+2.04204 9.14028e-10
+
+2.04832 1.01511e-09
+
+2.0546 1.11539e-09
+
+2.06088 1.21433e-09
+
+2.06717 1.31146e-09
+
+2.07345 1.40638e-09
+
+2.07973 1.49875e-09
+
+2.08602 1.58825e-09
+
+2.0923 1.67459e-09
+
+2.09858 1.7575e-09
+
+2.10487 1.83672e-09
+
+2.11115 1.91201e-09
+
+2.11743 1.98314e-09
+
+2.12372 2.04991e-09
+
+2.13 2.1121e-09
+
+2.13628 2.16952e-09
+
+2.14257 2.22199e-09
+
+2.14885 2.26934e-09
+
+2.15513 2.31142e-09
+
+2.16142 2.34809e-09
+
+2.1677 2.3792e-09
+
+2.17398 2.40465e-09
+
+2.18027 2.42432e-09
+
+2.18655 2.43812e-09
+
+2.19283 2.44598e-09
+
+2.19911 2.44782e-09
+
+2.2054 2.4436e-09
+
+2.21168 2.43328e-09
+
+2.21796 2.41685e-09
+
+2.22425 2.39429e-09
+
+2.23053 2.36561e-09
+
+2.23681 2.33085e-09
+
+2.2431 2.29004e-09
+
+2.24938 2.24325e-09
+
+2.25566 2.19055e-09
+
+2.26195 2.13203e-09
+
+2.26823 2.06782e-09
+
+2.27451 1.99802e-09
+
+2.2808 1.92281e-09
+
+2.28708 1.84234e-09
+
+2.29336 1.75681e-09
+
+2.29965 1.66643e-09
+
+2.30593 1.57144e-09
+
+2.31221 1.47212e-09
+
+2.3185 1.36876e-09
+
+2.32478 1.26174e-09
+
+2.33106 1.15146e-09
+
+2.33734 1.03843e-09
+
+2.34363 9.23311e-10
+
+2.34991 8.06993e-10
+
+2.35619 6.90803e-10
+
+2.36248 5.76916e-10
+
+2.36876 4.69292e-10
+
+2.37504 3.7581e-10
+
+2.38133 3.11924e-10
+
+2.38761 2.99206e-10
+
+2.39389 3.44421e-10
+
+2.40018 4.30001e-10
+
+2.40646 5.36865e-10
+
+2.41274 6.54248e-10
+
+2.41903 7.76758e-10
+
+2.42531 9.01513e-10
+
+2.43159 1.02679e-09
+
+2.43788 1.15141e-09
+
+2.44416 1.27452e-09
+
+2.45044 1.39541e-09
+
+2.45673 1.51347e-09
+
+2.46301 1.62815e-09
+
+2.46929 1.73895e-09
+
+2.47558 1.84539e-09
+
+2.48186 1.94702e-09
+
+2.48814 2.0434e-09
+
+2.49442 2.13413e-09
+
+2.50071 2.2188e-09
+
+2.50699 2.29704e-09
+
+2.51327 2.36846e-09
+
+2.51956 2.43272e-09
+
+2.52584 2.4895e-09
+
+2.53212 2.53847e-09
+
+2.53841 2.57934e-09
+
+2.54469 2.61184e-09
+
+2.55097 2.63571e-09
+
+2.55726 2.65074e-09
+
+2.56354 2.65671e-09
+
+2.56982 2.65346e-09
+
+2.57611 2.64083e-09
+
+2.58239 2.61871e-09
+
+2.58867 2.58701e-09
+
+2.59496 2.54569e-09
+
+2.60124 2.4947e-09
+
+2.60752 2.43408e-09
+
+2.61381 2.36387e-09
+
+2.62009 2.28417e-09
+
+2.62637 2.19511e-09
+
+2.63265 2.09687e-09
+
+2.63894 1.98966e-09
+
+2.64522 1.87376e-09
+
+2.6515 1.7495e-09
+
+2.65779 1.61728e-09
+
+2.66407 1.47755e-09
+
+2.67035 1.33089e-09
+
+2.67664 1.17801e-09
+
+2.68292 1.01983e-09
+
+2.6892 8.57692e-10
+
+2.69549 6.93779e-10
+
+2.70177 5.32395e-10
+
+2.70805 3.84154e-10
+
+2.71434 2.8012e-10
+
+2.72062 2.82648e-10
+
+2.7269 3.93075e-10
+
+2.73319 5.51154e-10
+
+2.73947 7.2651e-10
+
+2.74575 9.0851e-10
+
+2.75204 1.0926e-09
+
+2.75832 1.27624e-09
+
+2.7646 1.45764e-09
+
+2.77088 1.63534e-09
+
+2.77717 1.80804e-09
+
+2.78345 1.97452e-09
+
+2.78973 2.1336e-09
+
+2.79602 2.28412e-09
+
+2.8023 2.42492e-09
+
+2.80858 2.55489e-09
+
+2.81487 2.67289e-09
+
+2.82115 2.77783e-09
+
+2.82743 2.86863e-09
+
+2.83372 2.94424e-09
+
+2.84 3.00364e-09
+
+2.84628 3.04585e-09
+
+2.85257 3.06994e-09
+
+2.85885 3.07505e-09
+
+2.86513 3.06038e-09
+
+2.87142 3.0252e-09
+
+2.8777 2.96887e-09
+
+2.88398 2.89087e-09
+
+2.89027 2.79079e-09
+
+2.89655 2.66833e-09
+
+2.90283 2.52335e-09
+
+2.90911 2.35587e-09
+
+2.9154 2.16611e-09
+
+2.92168 1.9545e-09
+
+2.92796 1.72172e-09
+
+2.93425 1.46883e-09
+
+2.94053 1.19739e-09
+
+2.94681 9.10059e-10
+
+2.9531 6.12728e-10
+
+2.95938 3.28951e-10
+
+2.96566 2.36631e-10
+
+2.97195 4.93225e-10
+
+2.97823 8.29295e-10
+
+2.98451 1.18254e-09
+
+2.9908 1.54069e-09
+
+2.99708 1.89733e-09
+
+3.00336 2.24695e-09
+
+3.00965 2.58403e-09
+
+3.01593 2.90269e-09
+
+3.02221 3.19653e-09
+
+3.0285 3.4586e-09
+
+3.03478 3.68133e-09
+
+3.04106 3.85647e-09
+
+3.04734 3.97504e-09
+
+3.05363 4.0273e-09
+
+3.05991 4.00272e-09
+
+3.06619 3.88989e-09
+
+3.07248 3.67654e-09
+
+3.07876 3.34944e-09
+
+3.08504 2.89441e-09
+
+3.09133 2.29639e-09
+
+3.09761 1.53983e-09
+
+3.10389 6.14234e-10
+
+3.11018 5.55951e-10
+
+3.11646 1.89102e-09
+
+3.12274 3.47537e-09
+
+3.12903 5.32196e-09
+
+3.13531 7.45411e-09
+
+3.14159 9.89742e-09
+
@@ -0,0 +1,1004 @@
+-3.14159 9.90103e-09
+-3.13531 7.45615e-09
+-3.12903 5.32281e-09
+-3.12274 3.47536e-09
+-3.11646 1.89043e-09
+-3.11018 5.55019e-10
+-3.10389 6.1537e-10
+-3.09761 1.54104e-09
+-3.09133 2.29756e-09
+-3.08504 2.89545e-09
+-3.07876 3.35028e-09
+-3.07248 3.67716e-09
+-3.06619 3.89028e-09
+-3.05991 4.00285e-09
+-3.05363 4.02719e-09
+-3.04734 3.9747e-09
+-3.04106 3.85593e-09
+-3.03478 3.68061e-09
+-3.0285 3.45773e-09
+-3.02221 3.19553e-09
+-3.01593 2.9016e-09
+-3.00965 2.58288e-09
+-3.00336 2.24577e-09
+-2.99708 1.89615e-09
+-2.9908 1.53954e-09
+-2.98451 1.18143e-09
+-2.97823 8.28274e-10
+-2.97195 4.92343e-10
+-2.96566 2.36244e-10
+-2.95938 3.29463e-10
+-2.9531 6.13277e-10
+-2.94681 9.10508e-10
+-2.94053 1.19771e-09
+-2.93425 1.46902e-09
+-2.92796 1.72178e-09
+-2.92168 1.95443e-09
+-2.9154 2.16592e-09
+-2.90911 2.35555e-09
+-2.90283 2.52292e-09
+-2.89655 2.6678e-09
+-2.89027 2.79017e-09
+-2.88398 2.89018e-09
+-2.8777 2.96811e-09
+-2.87142 3.02439e-09
+-2.86513 3.05953e-09
+-2.85885 3.07418e-09
+-2.85257 3.06906e-09
+-2.84628 3.04497e-09
+-2.84 3.00277e-09
+-2.83372 2.9434e-09
+-2.82743 2.86783e-09
+-2.82115 2.77708e-09
+-2.81487 2.67219e-09
+-2.80858 2.55426e-09
+-2.8023 2.42437e-09
+-2.79602 2.28364e-09
+-2.78973 2.13321e-09
+-2.78345 1.97422e-09
+-2.77717 1.80782e-09
+-2.77088 1.63521e-09
+-2.7646 1.4576e-09
+-2.75832 1.2763e-09
+-2.75204 1.09275e-09
+-2.74575 9.08737e-10
+-2.73947 7.26809e-10
+-2.73319 5.51505e-10
+-2.7269 3.93425e-10
+-2.72062 2.82837e-10
+-2.71434 2.79922e-10
+-2.70805 3.83676e-10
+-2.70177 5.31781e-10
+-2.69549 6.9309e-10
+-2.6892 8.56955e-10
+-2.68292 1.01906e-09
+-2.67664 1.17722e-09
+-2.67035 1.3301e-09
+-2.66407 1.47676e-09
+-2.65779 1.61649e-09
+-2.6515 1.74874e-09
+-2.64522 1.87302e-09
+-2.63894 1.98895e-09
+-2.63265 2.0962e-09
+-2.62637 2.1945e-09
+-2.62009 2.28362e-09
+-2.61381 2.36338e-09
+-2.60752 2.43365e-09
+-2.60124 2.49435e-09
+-2.59496 2.5454e-09
+-2.58867 2.58681e-09
+-2.58239 2.61859e-09
+-2.57611 2.64079e-09
+-2.56982 2.6535e-09
+-2.56354 2.65683e-09
+-2.55726 2.65094e-09
+-2.55097 2.636e-09
+-2.54469 2.6122e-09
+-2.53841 2.57978e-09
+-2.53212 2.53898e-09
+-2.52584 2.49008e-09
+-2.51956 2.43337e-09
+-2.51327 2.36916e-09
+-2.50699 2.29779e-09
+-2.50071 2.21961e-09
+-2.49442 2.13498e-09
+-2.48814 2.04428e-09
+-2.48186 1.94792e-09
+-2.47558 1.84631e-09
+-2.46929 1.73988e-09
+-2.46301 1.62909e-09
+-2.45673 1.51441e-09
+-2.45044 1.39634e-09
+-2.44416 1.27544e-09
+-2.43788 1.1523e-09
+-2.43159 1.02764e-09
+-2.42531 9.02321e-10
+-2.41903 7.77513e-10
+-2.41274 6.54938e-10
+-2.40646 5.37472e-10
+-2.40018 4.30495e-10
+-2.39389 3.44753e-10
+-2.38761 2.99317e-10
+-2.38133 3.11829e-10
+-2.37504 3.75618e-10
+-2.36876 4.6909e-10
+-2.36248 5.76749e-10
+-2.35619 6.90693e-10
+-2.34991 8.06948e-10
+-2.34363 9.23336e-10
+-2.33734 1.03853e-09
+-2.33106 1.15162e-09
+-2.32478 1.26198e-09
+-2.3185 1.36907e-09
+-2.31221 1.47249e-09
+-2.30593 1.57187e-09
+-2.29965 1.66691e-09
+-2.29336 1.75735e-09
+-2.28708 1.84292e-09
+-2.2808 1.92343e-09
+-2.27451 1.99869e-09
+-2.26823 2.06851e-09
+-2.26195 2.13275e-09
+-2.25566 2.19128e-09
+-2.24938 2.24399e-09
+-2.2431 2.29078e-09
+-2.23681 2.33158e-09
+-2.23053 2.36632e-09
+-2.22425 2.39498e-09
+-2.21796 2.41751e-09
+-2.21168 2.43391e-09
+-2.2054 2.44419e-09
+-2.19911 2.44836e-09
+-2.19283 2.44646e-09
+-2.18655 2.43854e-09
+-2.18027 2.42468e-09
+-2.17398 2.40494e-09
+-2.1677 2.37942e-09
+-2.16142 2.34823e-09
+-2.15513 2.31149e-09
+-2.14885 2.26933e-09
+-2.14257 2.22189e-09
+-2.13628 2.16934e-09
+-2.13 2.11184e-09
+-2.12372 2.04957e-09
+-2.11743 1.98273e-09
+-2.11115 1.91152e-09
+-2.10487 1.83616e-09
+-2.09858 1.75687e-09
+-2.0923 1.6739e-09
+-2.08602 1.58751e-09
+-2.07973 1.49796e-09
+-2.07345 1.40555e-09
+-2.06717 1.31059e-09
+-2.06088 1.21344e-09
+-2.0546 1.11449e-09
+-2.04832 1.01419e-09
+-2.04204 9.13118e-10
+-2.03575 8.11982e-10
+-2.02947 7.1177e-10
+-2.02319 6.1394e-10
+-2.0169 5.20809e-10
+-2.01062 4.36307e-10
+-2.00434 3.67206e-10
+-1.99805 3.24031e-10
+-1.99177 3.17679e-10
+-1.98549 3.49958e-10
+-1.9792 4.11435e-10
+-1.97292 4.90664e-10
+-1.96664 5.79727e-10
+-1.96035 6.7399e-10
+-1.95407 7.70767e-10
+-1.94779 8.6842e-10
+-1.9415 9.65878e-10
+-1.93522 1.06239e-09
+-1.92894 1.15739e-09
+-1.92265 1.25045e-09
+-1.91637 1.34118e-09
+-1.91009 1.42929e-09
+-1.90381 1.5145e-09
+-1.89752 1.59656e-09
+-1.89124 1.67526e-09
+-1.88496 1.75039e-09
+-1.87867 1.82178e-09
+-1.87239 1.88925e-09
+-1.86611 1.95265e-09
+-1.85982 2.01184e-09
+-1.85354 2.06669e-09
+-1.84726 2.11708e-09
+-1.84097 2.16291e-09
+-1.83469 2.20409e-09
+-1.82841 2.24053e-09
+-1.82212 2.27217e-09
+-1.81584 2.29894e-09
+-1.80956 2.3208e-09
+-1.80327 2.3377e-09
+-1.79699 2.34963e-09
+-1.79071 2.35657e-09
+-1.78442 2.35852e-09
+-1.77814 2.35547e-09
+-1.77186 2.34746e-09
+-1.76558 2.33451e-09
+-1.75929 2.31665e-09
+-1.75301 2.29394e-09
+-1.74673 2.26644e-09
+-1.74044 2.23421e-09
+-1.73416 2.19735e-09
+-1.72788 2.15593e-09
+-1.72159 2.11007e-09
+-1.71531 2.05987e-09
+-1.70903 2.00546e-09
+-1.70274 1.94696e-09
+-1.69646 1.88452e-09
+-1.69018 1.8183e-09
+-1.68389 1.74845e-09
+-1.67761 1.67516e-09
+-1.67133 1.5986e-09
+-1.66504 1.51899e-09
+-1.65876 1.43655e-09
+-1.65248 1.3515e-09
+-1.64619 1.26412e-09
+-1.63991 1.1747e-09
+-1.63363 1.08357e-09
+-1.62734 9.91135e-10
+-1.62106 8.97885e-10
+-1.61478 8.04449e-10
+-1.6085 7.11688e-10
+-1.60221 6.20849e-10
+-1.59593 5.33863e-10
+-1.58965 4.53879e-10
+-1.58336 3.86135e-10
+-1.57708 3.38771e-10
+-1.5708 3.21386e-10
+-1.56451 3.38771e-10
+-1.55823 3.86135e-10
+-1.55195 4.5388e-10
+-1.54566 5.33864e-10
+-1.53938 6.2085e-10
+-1.5331 7.11688e-10
+-1.52681 8.0445e-10
+-1.52053 8.97885e-10
+-1.51425 9.91135e-10
+-1.50796 1.08357e-09
+-1.50168 1.1747e-09
+-1.4954 1.26412e-09
+-1.48911 1.3515e-09
+-1.48283 1.43655e-09
+-1.47655 1.51899e-09
+-1.47027 1.5986e-09
+-1.46398 1.67516e-09
+-1.4577 1.74845e-09
+-1.45142 1.8183e-09
+-1.44513 1.88452e-09
+-1.43885 1.94696e-09
+-1.43257 2.00546e-09
+-1.42628 2.05987e-09
+-1.42 2.11007e-09
+-1.41372 2.15593e-09
+-1.40743 2.19735e-09
+-1.40115 2.23421e-09
+-1.39487 2.26644e-09
+-1.38858 2.29394e-09
+-1.3823 2.31665e-09
+-1.37602 2.33451e-09
+-1.36973 2.34746e-09
+-1.36345 2.35547e-09
+-1.35717 2.35852e-09
+-1.35088 2.35657e-09
+-1.3446 2.34963e-09
+-1.33832 2.3377e-09
+-1.33204 2.3208e-09
+-1.32575 2.29894e-09
+-1.31947 2.27217e-09
+-1.31319 2.24053e-09
+-1.3069 2.20409e-09
+-1.30062 2.16291e-09
+-1.29434 2.11708e-09
+-1.28805 2.06669e-09
+-1.28177 2.01184e-09
+-1.27549 1.95265e-09
+-1.2692 1.88925e-09
+-1.26292 1.82178e-09
+-1.25664 1.75039e-09
+-1.25035 1.67526e-09
+-1.24407 1.59656e-09
+-1.23779 1.5145e-09
+-1.2315 1.42929e-09
+-1.22522 1.34118e-09
+-1.21894 1.25045e-09
+-1.21265 1.15739e-09
+-1.20637 1.06239e-09
+-1.20009 9.65878e-10
+-1.19381 8.68421e-10
+-1.18752 7.70768e-10
+-1.18124 6.7399e-10
+-1.17496 5.79727e-10
+-1.16867 4.90665e-10
+-1.16239 4.11435e-10
+-1.15611 3.49959e-10
+-1.14982 3.1768e-10
+-1.14354 3.24031e-10
+-1.13726 3.67206e-10
+-1.13097 4.36306e-10
+-1.12469 5.20809e-10
+-1.11841 6.13939e-10
+-1.11212 7.11769e-10
+-1.10584 8.11981e-10
+-1.09956 9.13118e-10
+-1.09327 1.01419e-09
+-1.08699 1.11449e-09
+-1.08071 1.21344e-09
+-1.07442 1.31059e-09
+-1.06814 1.40555e-09
+-1.06186 1.49796e-09
+-1.05558 1.58751e-09
+-1.04929 1.6739e-09
+-1.04301 1.75687e-09
+-1.03673 1.83616e-09
+-1.03044 1.91152e-09
+-1.02416 1.98273e-09
+-1.01788 2.04957e-09
+-1.01159 2.11184e-09
+-1.00531 2.16934e-09
+-0.999026 2.22189e-09
+-0.992743 2.26933e-09
+-0.98646 2.31149e-09
+-0.980177 2.34823e-09
+-0.973894 2.37942e-09
+-0.967611 2.40494e-09
+-0.961327 2.42468e-09
+-0.955044 2.43854e-09
+-0.948761 2.44646e-09
+-0.942478 2.44836e-09
+-0.936195 2.44419e-09
+-0.929911 2.43391e-09
+-0.923628 2.41751e-09
+-0.917345 2.39498e-09
+-0.911062 2.36632e-09
+-0.904779 2.33158e-09
+-0.898495 2.29078e-09
+-0.892212 2.24398e-09
+-0.885929 2.19128e-09
+-0.879646 2.13275e-09
+-0.873363 2.0685e-09
+-0.86708 1.99868e-09
+-0.860796 1.92343e-09
+-0.854513 1.84292e-09
+-0.84823 1.75735e-09
+-0.841947 1.66691e-09
+-0.835664 1.57187e-09
+-0.82938 1.47249e-09
+-0.823097 1.36907e-09
+-0.816814 1.26197e-09
+-0.810531 1.15162e-09
+-0.804248 1.03853e-09
+-0.797965 9.23335e-10
+-0.791681 8.06948e-10
+-0.785398 6.90692e-10
+-0.779115 5.76749e-10
+-0.772832 4.6909e-10
+-0.766549 3.75617e-10
+-0.760265 3.11829e-10
+-0.753982 2.99317e-10
+-0.747699 3.44753e-10
+-0.741416 4.30495e-10
+-0.735133 5.37472e-10
+-0.728849 6.54938e-10
+-0.722566 7.77513e-10
+-0.716283 9.02321e-10
+-0.71 1.02764e-09
+-0.703717 1.1523e-09
+-0.697434 1.27544e-09
+-0.69115 1.39634e-09
+-0.684867 1.51441e-09
+-0.678584 1.62909e-09
+-0.672301 1.73989e-09
+-0.666018 1.84631e-09
+-0.659734 1.94792e-09
+-0.653451 2.04428e-09
+-0.647168 2.13498e-09
+-0.640885 2.21961e-09
+-0.634602 2.29779e-09
+-0.628319 2.36916e-09
+-0.622035 2.43337e-09
+-0.615752 2.49008e-09
+-0.609469 2.53898e-09
+-0.603186 2.57978e-09
+-0.596903 2.6122e-09
+-0.590619 2.636e-09
+-0.584336 2.65094e-09
+-0.578053 2.65683e-09
+-0.57177 2.6535e-09
+-0.565487 2.64079e-09
+-0.559203 2.61859e-09
+-0.55292 2.58681e-09
+-0.546637 2.5454e-09
+-0.540354 2.49435e-09
+-0.534071 2.43365e-09
+-0.527788 2.36338e-09
+-0.521504 2.28362e-09
+-0.515221 2.1945e-09
+-0.508938 2.09621e-09
+-0.502655 1.98895e-09
+-0.496372 1.87302e-09
+-0.490088 1.74874e-09
+-0.483805 1.61649e-09
+-0.477522 1.47676e-09
+-0.471239 1.3301e-09
+-0.464956 1.17722e-09
+-0.458673 1.01906e-09
+-0.452389 8.56955e-10
+-0.446106 6.93091e-10
+-0.439823 5.31782e-10
+-0.43354 3.83676e-10
+-0.427257 2.79923e-10
+-0.420973 2.82837e-10
+-0.41469 3.93425e-10
+-0.408407 5.51505e-10
+-0.402124 7.26809e-10
+-0.395841 9.08737e-10
+-0.389557 1.09275e-09
+-0.383274 1.2763e-09
+-0.376991 1.4576e-09
+-0.370708 1.63521e-09
+-0.364425 1.80782e-09
+-0.358142 1.97422e-09
+-0.351858 2.13321e-09
+-0.345575 2.28364e-09
+-0.339292 2.42437e-09
+-0.333009 2.55426e-09
+-0.326726 2.67219e-09
+-0.320442 2.77708e-09
+-0.314159 2.86783e-09
+-0.307876 2.9434e-09
+-0.301593 3.00277e-09
+-0.29531 3.04497e-09
+-0.289027 3.06906e-09
+-0.282743 3.07418e-09
+-0.27646 3.05953e-09
+-0.270177 3.02439e-09
+-0.263894 2.96811e-09
+-0.257611 2.89018e-09
+-0.251327 2.79017e-09
+-0.245044 2.6678e-09
+-0.238761 2.52292e-09
+-0.232478 2.35555e-09
+-0.226195 2.16591e-09
+-0.219911 1.95443e-09
+-0.213628 1.72178e-09
+-0.207345 1.46902e-09
+-0.201062 1.19771e-09
+-0.194779 9.10507e-10
+-0.188496 6.13276e-10
+-0.182212 3.29462e-10
+-0.175929 2.36244e-10
+-0.169646 4.92343e-10
+-0.163363 8.28274e-10
+-0.15708 1.18143e-09
+-0.150796 1.53954e-09
+-0.144513 1.89615e-09
+-0.13823 2.24577e-09
+-0.131947 2.58289e-09
+-0.125664 2.9016e-09
+-0.119381 3.19553e-09
+-0.113097 3.45773e-09
+-0.106814 3.68061e-09
+-0.100531 3.85593e-09
+-0.0942478 3.9747e-09
+-0.0879646 4.0272e-09
+-0.0816814 4.00285e-09
+-0.0753982 3.89028e-09
+-0.069115 3.67716e-09
+-0.0628319 3.35028e-09
+-0.0565487 2.89545e-09
+-0.0502655 2.29756e-09
+-0.0439823 1.54104e-09
+-0.0376991 6.1537e-10
+-0.0314159 5.55018e-10
+-0.0251327 1.89043e-09
+-0.0188496 3.47536e-09
+-0.0125664 5.32281e-09
+-0.00628319 7.45615e-09
+0 9.90103e-09
+
+0 9.90103e-09
+0.00628319 7.45615e-09
+0.0125664 5.32281e-09
+0.0188496 3.47536e-09
+0.0251327 1.89043e-09
+0.0314159 5.55019e-10
+0.0376991 6.1537e-10
+0.0439823 1.54104e-09
+0.0502655 2.29756e-09
+0.0565487 2.89545e-09
+0.0628319 3.35028e-09
+0.069115 3.67716e-09
+0.0753982 3.89028e-09
+0.0816814 4.00285e-09
+0.0879646 4.0272e-09
+0.0942478 3.9747e-09
+0.100531 3.85593e-09
+0.106814 3.68061e-09
+0.113097 3.45773e-09
+0.119381 3.19553e-09
+0.125664 2.9016e-09
+0.131947 2.58288e-09
+0.13823 2.24577e-09
+0.144513 1.89615e-09
+0.150796 1.53954e-09
+0.15708 1.18143e-09
+0.163363 8.28274e-10
+0.169646 4.92344e-10
+0.175929 2.36245e-10
+0.182212 3.29463e-10
+0.188496 6.13277e-10
+0.194779 9.10508e-10
+0.201062 1.19771e-09
+0.207345 1.46902e-09
+0.213628 1.72178e-09
+0.219911 1.95443e-09
+0.226195 2.16591e-09
+0.232478 2.35555e-09
+0.238761 2.52292e-09
+0.245044 2.6678e-09
+0.251327 2.79017e-09
+0.257611 2.89018e-09
+0.263894 2.96811e-09
+0.270177 3.02439e-09
+0.27646 3.05953e-09
+0.282743 3.07418e-09
+0.289027 3.06906e-09
+0.29531 3.04497e-09
+0.301593 3.00277e-09
+0.307876 2.9434e-09
+0.314159 2.86783e-09
+0.320442 2.77708e-09
+0.326726 2.67219e-09
+0.333009 2.55426e-09
+0.339292 2.42437e-09
+0.345575 2.28364e-09
+0.351858 2.13321e-09
+0.358142 1.97422e-09
+0.364425 1.80782e-09
+0.370708 1.63521e-09
+0.376991 1.4576e-09
+0.383274 1.2763e-09
+0.389557 1.09275e-09
+0.395841 9.08737e-10
+0.402124 7.26809e-10
+0.408407 5.51505e-10
+0.41469 3.93425e-10
+0.420973 2.82837e-10
+0.427257 2.79922e-10
+0.43354 3.83675e-10
+0.439823 5.31782e-10
+0.446106 6.9309e-10
+0.452389 8.56955e-10
+0.458673 1.01906e-09
+0.464956 1.17722e-09
+0.471239 1.3301e-09
+0.477522 1.47676e-09
+0.483805 1.61649e-09
+0.490088 1.74874e-09
+0.496372 1.87302e-09
+0.502655 1.98895e-09
+0.508938 2.09621e-09
+0.515221 2.1945e-09
+0.521504 2.28362e-09
+0.527788 2.36338e-09
+0.534071 2.43365e-09
+0.540354 2.49435e-09
+0.546637 2.5454e-09
+0.55292 2.58681e-09
+0.559203 2.61859e-09
+0.565487 2.64079e-09
+0.57177 2.6535e-09
+0.578053 2.65683e-09
+0.584336 2.65094e-09
+0.590619 2.636e-09
+0.596903 2.6122e-09
+0.603186 2.57978e-09
+0.609469 2.53898e-09
+0.615752 2.49008e-09
+0.622035 2.43337e-09
+0.628319 2.36916e-09
+0.634602 2.29779e-09
+0.640885 2.21961e-09
+0.647168 2.13498e-09
+0.653451 2.04428e-09
+0.659734 1.94792e-09
+0.666018 1.84631e-09
+0.672301 1.73988e-09
+0.678584 1.62909e-09
+0.684867 1.51441e-09
+0.69115 1.39634e-09
+0.697434 1.27544e-09
+0.703717 1.1523e-09
+0.71 1.02764e-09
+0.716283 9.02321e-10
+0.722566 7.77513e-10
+0.728849 6.54938e-10
+0.735133 5.37472e-10
+0.741416 4.30495e-10
+0.747699 3.44753e-10
+0.753982 2.99317e-10
+0.760265 3.11829e-10
+0.766549 3.75618e-10
+0.772832 4.69091e-10
+0.779115 5.76749e-10
+0.785398 6.90693e-10
+0.791681 8.06948e-10
+0.797965 9.23336e-10
+0.804248 1.03853e-09
+0.810531 1.15162e-09
+0.816814 1.26198e-09
+0.823097 1.36907e-09
+0.82938 1.47249e-09
+0.835664 1.57187e-09
+0.841947 1.66691e-09
+0.84823 1.75735e-09
+0.854513 1.84292e-09
+0.860796 1.92343e-09
+0.86708 1.99868e-09
+0.873363 2.06851e-09
+0.879646 2.13275e-09
+0.885929 2.19128e-09
+0.892212 2.24399e-09
+0.898495 2.29078e-09
+0.904779 2.33158e-09
+0.911062 2.36632e-09
+0.917345 2.39498e-09
+0.923628 2.41751e-09
+0.929911 2.43391e-09
+0.936195 2.44419e-09
+0.942478 2.44836e-09
+0.948761 2.44646e-09
+0.955044 2.43854e-09
+0.961327 2.42468e-09
+0.967611 2.40494e-09
+0.973894 2.37942e-09
+0.980177 2.34823e-09
+0.98646 2.31149e-09
+0.992743 2.26933e-09
+0.999026 2.22189e-09
+1.00531 2.16934e-09
+1.01159 2.11184e-09
+1.01788 2.04957e-09
+1.02416 1.98273e-09
+1.03044 1.91152e-09
+1.03673 1.83616e-09
+1.04301 1.75687e-09
+1.04929 1.6739e-09
+1.05558 1.58751e-09
+1.06186 1.49796e-09
+1.06814 1.40555e-09
+1.07442 1.31059e-09
+1.08071 1.21344e-09
+1.08699 1.11449e-09
+1.09327 1.01419e-09
+1.09956 9.13118e-10
+1.10584 8.11981e-10
+1.11212 7.11769e-10
+1.11841 6.13939e-10
+1.12469 5.20809e-10
+1.13097 4.36306e-10
+1.13726 3.67206e-10
+1.14354 3.24031e-10
+1.14982 3.17679e-10
+1.15611 3.49958e-10
+1.16239 4.11435e-10
+1.16867 4.90664e-10
+1.17496 5.79727e-10
+1.18124 6.7399e-10
+1.18752 7.70767e-10
+1.19381 8.6842e-10
+1.20009 9.65878e-10
+1.20637 1.06239e-09
+1.21265 1.15739e-09
+1.21894 1.25045e-09
+1.22522 1.34118e-09
+1.2315 1.42929e-09
+1.23779 1.5145e-09
+1.24407 1.59656e-09
+1.25035 1.67526e-09
+1.25664 1.75039e-09
+1.26292 1.82178e-09
+1.2692 1.88925e-09
+1.27549 1.95265e-09
+1.28177 2.01184e-09
+1.28805 2.06669e-09
+1.29434 2.11708e-09
+1.30062 2.16291e-09
+1.3069 2.20409e-09
+1.31319 2.24053e-09
+1.31947 2.27217e-09
+1.32575 2.29894e-09
+1.33204 2.3208e-09
+1.33832 2.3377e-09
+1.3446 2.34963e-09
+1.35088 2.35657e-09
+1.35717 2.35852e-09
+1.36345 2.35547e-09
+1.36973 2.34746e-09
+1.37602 2.33451e-09
+1.3823 2.31665e-09
+1.38858 2.29394e-09
+1.39487 2.26644e-09
+1.40115 2.23421e-09
+1.40743 2.19735e-09
+1.41372 2.15593e-09
+1.42 2.11007e-09
+1.42628 2.05987e-09
+1.43257 2.00546e-09
+1.43885 1.94696e-09
+1.44513 1.88452e-09
+1.45142 1.8183e-09
+1.4577 1.74845e-09
+1.46398 1.67516e-09
+1.47027 1.5986e-09
+1.47655 1.51899e-09
+1.48283 1.43655e-09
+1.48911 1.3515e-09
+1.4954 1.26412e-09
+1.50168 1.1747e-09
+1.50796 1.08357e-09
+1.51425 9.91135e-10
+1.52053 8.97885e-10
+1.52681 8.04449e-10
+1.5331 7.11688e-10
+1.53938 6.2085e-10
+1.54566 5.33864e-10
+1.55195 4.5388e-10
+1.55823 3.86135e-10
+1.56451 3.38771e-10
+1.5708 3.21387e-10
+1.57708 3.38772e-10
+1.58336 3.86136e-10
+1.58965 4.5388e-10
+1.59593 5.33864e-10
+1.60221 6.2085e-10
+1.6085 7.11688e-10
+1.61478 8.0445e-10
+1.62106 8.97885e-10
+1.62734 9.91135e-10
+1.63363 1.08357e-09
+1.63991 1.1747e-09
+1.64619 1.26412e-09
+1.65248 1.3515e-09
+1.65876 1.43655e-09
+1.66504 1.51899e-09
+1.67133 1.5986e-09
+1.67761 1.67516e-09
+1.68389 1.74845e-09
+1.69018 1.8183e-09
+1.69646 1.88452e-09
+1.70274 1.94696e-09
+1.70903 2.00546e-09
+1.71531 2.05987e-09
+1.72159 2.11007e-09
+1.72788 2.15593e-09
+1.73416 2.19735e-09
+1.74044 2.23421e-09
+1.74673 2.26644e-09
+1.75301 2.29394e-09
+1.75929 2.31665e-09
+1.76558 2.33451e-09
+1.77186 2.34746e-09
+1.77814 2.35547e-09
+1.78442 2.35852e-09
+1.79071 2.35657e-09
+1.79699 2.34963e-09
+1.80327 2.3377e-09
+1.80956 2.3208e-09
+1.81584 2.29894e-09
+1.82212 2.27217e-09
+1.82841 2.24053e-09
+1.83469 2.20409e-09
+1.84097 2.16291e-09
+1.84726 2.11708e-09
+1.85354 2.06669e-09
+1.85982 2.01184e-09
+1.86611 1.95265e-09
+1.87239 1.88925e-09
+1.87867 1.82178e-09
+1.88496 1.75039e-09
+1.89124 1.67526e-09
+1.89752 1.59656e-09
+1.90381 1.5145e-09
+1.91009 1.42929e-09
+1.91637 1.34118e-09
+1.92265 1.25045e-09
+1.92894 1.15739e-09
+1.93522 1.06239e-09
+1.9415 9.65878e-10
+1.94779 8.68421e-10
+1.95407 7.70767e-10
+1.96035 6.7399e-10
+1.96664 5.79727e-10
+1.97292 4.90664e-10
+1.9792 4.11435e-10
+1.98549 3.49958e-10
+1.99177 3.17679e-10
+1.99805 3.24031e-10
+2.00434 3.67206e-10
+2.01062 4.36306e-10
+2.0169 5.20809e-10
+2.02319 6.13939e-10
+2.02947 7.11769e-10
+2.03575 8.11981e-10
+2.04204 9.13118e-10
+2.04832 1.01419e-09
+2.0546 1.11449e-09
+2.06088 1.21344e-09
+2.06717 1.31059e-09
+2.07345 1.40555e-09
+2.07973 1.49796e-09
+2.08602 1.58751e-09
+2.0923 1.6739e-09
+2.09858 1.75687e-09
+2.10487 1.83616e-09
+2.11115 1.91152e-09
+2.11743 1.98273e-09
+2.12372 2.04957e-09
+2.13 2.11184e-09
+2.13628 2.16934e-09
+2.14257 2.22189e-09
+2.14885 2.26933e-09
+2.15513 2.31149e-09
+2.16142 2.34823e-09
+2.1677 2.37942e-09
+2.17398 2.40494e-09
+2.18027 2.42468e-09
+2.18655 2.43854e-09
+2.19283 2.44646e-09
+2.19911 2.44836e-09
+2.2054 2.44419e-09
+2.21168 2.43391e-09
+2.21796 2.41751e-09
+2.22425 2.39498e-09
+2.23053 2.36632e-09
+2.23681 2.33158e-09
+2.2431 2.29078e-09
+2.24938 2.24398e-09
+2.25566 2.19128e-09
+2.26195 2.13275e-09
+2.26823 2.06851e-09
+2.27451 1.99868e-09
+2.2808 1.92343e-09
+2.28708 1.84292e-09
+2.29336 1.75735e-09
+2.29965 1.66691e-09
+2.30593 1.57187e-09
+2.31221 1.47248e-09
+2.3185 1.36907e-09
+2.32478 1.26198e-09
+2.33106 1.15162e-09
+2.33734 1.03853e-09
+2.34363 9.23336e-10
+2.34991 8.06948e-10
+2.35619 6.90693e-10
+2.36248 5.76749e-10
+2.36876 4.6909e-10
+2.37504 3.75618e-10
+2.38133 3.11829e-10
+2.38761 2.99317e-10
+2.39389 3.44753e-10
+2.40018 4.30495e-10
+2.40646 5.37472e-10
+2.41274 6.54938e-10
+2.41903 7.77513e-10
+2.42531 9.02321e-10
+2.43159 1.02764e-09
+2.43788 1.1523e-09
+2.44416 1.27544e-09
+2.45044 1.39634e-09
+2.45673 1.51441e-09
+2.46301 1.62909e-09
+2.46929 1.73988e-09
+2.47558 1.84631e-09
+2.48186 1.94792e-09
+2.48814 2.04428e-09
+2.49442 2.13498e-09
+2.50071 2.21961e-09
+2.50699 2.29779e-09
+2.51327 2.36916e-09
+2.51956 2.43337e-09
+2.52584 2.49008e-09
+2.53212 2.53898e-09
+2.53841 2.57978e-09
+2.54469 2.6122e-09
+2.55097 2.636e-09
+2.55726 2.65094e-09
+2.56354 2.65683e-09
+2.56982 2.6535e-09
+2.57611 2.64079e-09
+2.58239 2.61859e-09
+2.58867 2.58681e-09
+2.59496 2.5454e-09
+2.60124 2.49435e-09
+2.60752 2.43365e-09
+2.61381 2.36338e-09
+2.62009 2.28362e-09
+2.62637 2.1945e-09
+2.63265 2.09621e-09
+2.63894 1.98895e-09
+2.64522 1.87302e-09
+2.6515 1.74874e-09
+2.65779 1.61649e-09
+2.66407 1.47676e-09
+2.67035 1.3301e-09
+2.67664 1.17722e-09
+2.68292 1.01906e-09
+2.6892 8.56955e-10
+2.69549 6.93091e-10
+2.70177 5.31782e-10
+2.70805 3.83676e-10
+2.71434 2.79922e-10
+2.72062 2.82837e-10
+2.7269 3.93425e-10
+2.73319 5.51505e-10
+2.73947 7.26808e-10
+2.74575 9.08737e-10
+2.75204 1.09275e-09
+2.75832 1.2763e-09
+2.7646 1.4576e-09
+2.77088 1.63521e-09
+2.77717 1.80782e-09
+2.78345 1.97422e-09
+2.78973 2.13321e-09
+2.79602 2.28364e-09
+2.8023 2.42437e-09
+2.80858 2.55426e-09
+2.81487 2.67219e-09
+2.82115 2.77708e-09
+2.82743 2.86783e-09
+2.83372 2.9434e-09
+2.84 3.00277e-09
+2.84628 3.04497e-09
+2.85257 3.06906e-09
+2.85885 3.07418e-09
+2.86513 3.05953e-09
+2.87142 3.02439e-09
+2.8777 2.96811e-09
+2.88398 2.89018e-09
+2.89027 2.79017e-09
+2.89655 2.6678e-09
+2.90283 2.52292e-09
+2.90911 2.35555e-09
+2.9154 2.16591e-09
+2.92168 1.95443e-09
+2.92796 1.72178e-09
+2.93425 1.46902e-09
+2.94053 1.19771e-09
+2.94681 9.10507e-10
+2.9531 6.13276e-10
+2.95938 3.29463e-10
+2.96566 2.36245e-10
+2.97195 4.92344e-10
+2.97823 8.28274e-10
+2.98451 1.18143e-09
+2.9908 1.53954e-09
+2.99708 1.89615e-09
+3.00336 2.24577e-09
+3.00965 2.58288e-09
+3.01593 2.9016e-09
+3.02221 3.19553e-09
+3.0285 3.45773e-09
+3.03478 3.68061e-09
+3.04106 3.85593e-09
+3.04734 3.9747e-09
+3.05363 4.0272e-09
+3.05991 4.00285e-09
+3.06619 3.89028e-09
+3.07248 3.67716e-09
+3.07876 3.35028e-09
+3.08504 2.89545e-09
+3.09133 2.29756e-09
+3.09761 1.54104e-09
+3.10389 6.1537e-10
+3.11018 5.55018e-10
+3.11646 1.89043e-09
+3.12274 3.47536e-09
+3.12903 5.32281e-09
+3.13531 7.45614e-09
+3.14159 9.90103e-09
+
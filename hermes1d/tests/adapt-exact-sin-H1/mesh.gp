@@ -0,0 +1,10 @@
+-3.14159 0
+-3.14159 10
+0 10
+0 0
+
+0 0
+0 10
+3.14159 10
+3.14159 0
+
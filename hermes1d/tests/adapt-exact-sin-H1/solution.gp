@@ -0,0 +1,103 @@
+-3.14159 0
+-3.07876 -0.0627905
+-3.01593 -0.125333
+-2.9531 -0.187381
+-2.89027 -0.24869
+-2.82743 -0.309017
+-2.7646 -0.368125
+-2.70177 -0.425779
+-2.63894 -0.481754
+-2.57611 -0.535827
+-2.51327 -0.587785
+-2.45044 -0.637424
+-2.38761 -0.684547
+-2.32478 -0.728969
+-2.26195 -0.770513
+-2.19911 -0.809017
+-2.13628 -0.844328
+-2.07345 -0.876307
+-2.01062 -0.904827
+-1.94779 -0.929776
+-1.88496 -0.951057
+-1.82212 -0.968583
+-1.75929 -0.982287
+-1.69646 -0.992115
+-1.63363 -0.998027
+-1.5708 -1
+-1.50796 -0.998027
+-1.44513 -0.992115
+-1.3823 -0.982287
+-1.31947 -0.968583
+-1.25664 -0.951057
+-1.19381 -0.929776
+-1.13097 -0.904827
+-1.06814 -0.876307
+-1.00531 -0.844328
+-0.942478 -0.809017
+-0.879646 -0.770513
+-0.816814 -0.728969
+-0.753982 -0.684547
+-0.69115 -0.637424
+-0.628319 -0.587785
+-0.565487 -0.535827
+-0.502655 -0.481754
+-0.439823 -0.425779
+-0.376991 -0.368125
+-0.314159 -0.309017
+-0.251327 -0.24869
+-0.188496 -0.187381
+-0.125664 -0.125333
+-0.0628319 -0.0627905
+4.44089e-16 1.40771e-16
+0 -3.48787e-16
+0.0628319 0.0627905
+0.125664 0.125333
+0.188496 0.187381
+0.251327 0.24869
+0.314159 0.309017
+0.376991 0.368125
+0.439823 0.425779
+0.502655 0.481754
+0.565487 0.535827
+0.628319 0.587785
+0.69115 0.637424
+0.753982 0.684547
+0.816814 0.728969
+0.879646 0.770513
+0.942478 0.809017
+1.00531 0.844328
+1.06814 0.876307
+1.13097 0.904827
+1.19381 0.929776
+1.25664 0.951057
+1.31947 0.968583
+1.3823 0.982287
+1.44513 0.992115
+1.50796 0.998027
+1.5708 1
+1.63363 0.998027
+1.69646 0.992115
+1.75929 0.982287
+1.82212 0.968583
+1.88496 0.951057
+1.94779 0.929776
+2.01062 0.904827
+2.07345 0.876307
+2.13628 0.844328
+2.19911 0.809017
+2.26195 0.770513
+2.32478 0.728969
+2.38761 0.684547
+2.45044 0.637424
+2.51327 0.587785
+2.57611 0.535827
+2.63894 0.481754
+2.70177 0.425779
+2.7646 0.368125
+2.82743 0.309017
+2.89027 0.24869
+2.9531 0.187381
+3.01593 0.125333
+3.07876 0.0627905
+3.14159 -6.97581e-16
+
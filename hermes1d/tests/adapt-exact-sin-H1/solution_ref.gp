@@ -0,0 +1,205 @@
+-3.14159 0
+-3.11018 -0.0314108
+-3.07876 -0.0627905
+-3.04734 -0.0941083
+-3.01593 -0.125333
+-2.98451 -0.156434
+-2.9531 -0.187381
+-2.92168 -0.218143
+-2.89027 -0.24869
+-2.85885 -0.278991
+-2.82743 -0.309017
+-2.79602 -0.338738
+-2.7646 -0.368125
+-2.73319 -0.397148
+-2.70177 -0.425779
+-2.67035 -0.45399
+-2.63894 -0.481754
+-2.60752 -0.509041
+-2.57611 -0.535827
+-2.54469 -0.562083
+-2.51327 -0.587785
+-2.48186 -0.612907
+-2.45044 -0.637424
+-2.41903 -0.661312
+-2.38761 -0.684547
+-2.35619 -0.707107
+-2.32478 -0.728969
+-2.29336 -0.750111
+-2.26195 -0.770513
+-2.23053 -0.790155
+-2.19911 -0.809017
+-2.1677 -0.827081
+-2.13628 -0.844328
+-2.10487 -0.860742
+-2.07345 -0.876307
+-2.04204 -0.891007
+-2.01062 -0.904827
+-1.9792 -0.917755
+-1.94779 -0.929776
+-1.91637 -0.940881
+-1.88496 -0.951057
+-1.85354 -0.960294
+-1.82212 -0.968583
+-1.79071 -0.975917
+-1.75929 -0.982287
+-1.72788 -0.987688
+-1.69646 -0.992115
+-1.66504 -0.995562
+-1.63363 -0.998027
+-1.60221 -0.999507
+-1.5708 -1
+-1.5708 -1
+-1.53938 -0.999507
+-1.50796 -0.998027
+-1.47655 -0.995562
+-1.44513 -0.992115
+-1.41372 -0.987688
+-1.3823 -0.982287
+-1.35088 -0.975917
+-1.31947 -0.968583
+-1.28805 -0.960294
+-1.25664 -0.951057
+-1.22522 -0.940881
+-1.19381 -0.929776
+-1.16239 -0.917755
+-1.13097 -0.904827
+-1.09956 -0.891007
+-1.06814 -0.876307
+-1.03673 -0.860742
+-1.00531 -0.844328
+-0.973894 -0.827081
+-0.942478 -0.809017
+-0.911062 -0.790155
+-0.879646 -0.770513
+-0.84823 -0.750111
+-0.816814 -0.728969
+-0.785398 -0.707107
+-0.753982 -0.684547
+-0.722566 -0.661312
+-0.69115 -0.637424
+-0.659734 -0.612907
+-0.628319 -0.587785
+-0.596903 -0.562083
+-0.565487 -0.535827
+-0.534071 -0.509041
+-0.502655 -0.481754
+-0.471239 -0.45399
+-0.439823 -0.425779
+-0.408407 -0.397148
+-0.376991 -0.368125
+-0.345575 -0.338738
+-0.314159 -0.309017
+-0.282743 -0.278991
+-0.251327 -0.24869
+-0.219911 -0.218143
+-0.188496 -0.187381
+-0.15708 -0.156434
+-0.125664 -0.125333
+-0.0942478 -0.0941083
+-0.0628319 -0.0627905
+-0.0314159 -0.0314108
+2.22045e-16 1.7403e-15
+0 1.54048e-15
+0.0314159 0.0314108
+0.0628319 0.0627905
+0.0942478 0.0941083
+0.125664 0.125333
+0.15708 0.156434
+0.188496 0.187381
+0.219911 0.218143
+0.251327 0.24869
+0.282743 0.278991
+0.314159 0.309017
+0.345575 0.338738
+0.376991 0.368125
+0.408407 0.397148
+0.439823 0.425779
+0.471239 0.45399
+0.502655 0.481754
+0.534071 0.509041
+0.565487 0.535827
+0.596903 0.562083
+0.628319 0.587785
+0.659734 0.612907
+0.69115 0.637424
+0.722566 0.661312
+0.753982 0.684547
+0.785398 0.707107
+0.816814 0.728969
+0.84823 0.750111
+0.879646 0.770513
+0.911062 0.790155
+0.942478 0.809017
+0.973894 0.827081
+1.00531 0.844328
+1.03673 0.860742
+1.06814 0.876307
+1.09956 0.891007
+1.13097 0.904827
+1.16239 0.917755
+1.19381 0.929776
+1.22522 0.940881
+1.25664 0.951057
+1.28805 0.960294
+1.31947 0.968583
+1.35088 0.975917
+1.3823 0.982287
+1.41372 0.987688
+1.44513 0.992115
+1.47655 0.995562
+1.50796 0.998027
+1.53938 0.999507
+1.5708 1
+1.5708 1
+1.60221 0.999507
+1.63363 0.998027
+1.66504 0.995562
+1.69646 0.992115
+1.72788 0.987688
+1.75929 0.982287
+1.79071 0.975917
+1.82212 0.968583
+1.85354 0.960294
+1.88496 0.951057
+1.91637 0.940881
+1.94779 0.929776
+1.9792 0.917755
+2.01062 0.904827
+2.04204 0.891007
+2.07345 0.876307
+2.10487 0.860742
+2.13628 0.844328
+2.1677 0.827081
+2.19911 0.809017
+2.23053 0.790155
+2.26195 0.770513
+2.29336 0.750111
+2.32478 0.728969
+2.35619 0.707107
+2.38761 0.684547
+2.41903 0.661312
+2.45044 0.637424
+2.48186 0.612907
+2.51327 0.587785
+2.54469 0.562083
+2.57611 0.535827
+2.60752 0.509041
+2.63894 0.481754
+2.67035 0.45399
+2.70177 0.425779
+2.73319 0.397148
+2.7646 0.368125
+2.79602 0.338738
+2.82743 0.309017
+2.85885 0.278991
+2.89027 0.24869
+2.92168 0.218143
+2.9531 0.187381
+2.98451 0.156434
+3.01593 0.125333
+3.04734 0.0941083
+3.07876 0.0627905
+3.11018 0.0314108
+3.14159 0
+
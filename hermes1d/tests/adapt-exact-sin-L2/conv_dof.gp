@@ -0,0 +1,24 @@
+set terminal postscript eps enhanced
+set output 'conv_dof.eps'
+set size 0.8, 0.8
+set logscale y
+set grid
+set title 'Convergence History'
+set xlabel 'Degrees of Freedom'
+set ylabel 'Error [%]'
+plot '-' w lp linetype 1 pointtype 6 title 'exact error' ,  '-' w lp linetype 2 pointtype 0 title 'error estimate' 
+1  100
+5  4.0184201683668
+7  0.080977163648701
+11  0.00088880007450918
+15  6.0902469400012e-06
+19  2.8477641906739e-08
+e
+1  100
+5  4.0149975735498
+7  0.081256585048081
+11  0.00088921619320355
+15  6.0905524123541e-06
+19  2.8477814316283e-08
+e
+set terminal x11
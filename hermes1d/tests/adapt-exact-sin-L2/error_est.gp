@@ -0,0 +1,2008 @@
+-3.14159 0
+
+-3.13531 5.43427e-11
+
+-3.12903 9.43224e-11
+
+-3.12274 1.2181e-10
+
+-3.11646 1.38517e-10
+
+-3.11018 1.4601e-10
+
+-3.10389 1.45714e-10
+
+-3.09761 1.38925e-10
+
+-3.09133 1.26817e-10
+
+-3.08504 1.10449e-10
+
+-3.07876 9.07737e-11
+
+-3.07248 6.86445e-11
+
+-3.06619 4.48217e-11
+
+-3.05991 1.99788e-11
+
+-3.05363 5.29045e-12
+
+-3.04734 3.04666e-11
+
+-3.04106 5.50999e-11
+
+-3.03478 7.8803e-11
+
+-3.0285 1.01248e-10
+
+-3.02221 1.22162e-10
+
+-3.01593 1.41319e-10
+
+-3.00965 1.58541e-10
+
+-3.00336 1.73689e-10
+
+-2.99708 1.86663e-10
+
+-2.9908 1.97398e-10
+
+-2.98451 2.05856e-10
+
+-2.97823 2.12031e-10
+
+-2.97195 2.15939e-10
+
+-2.96566 2.17618e-10
+
+-2.95938 2.17127e-10
+
+-2.9531 2.1454e-10
+
+-2.94681 2.09945e-10
+
+-2.94053 2.03447e-10
+
+-2.93425 1.95155e-10
+
+-2.92796 1.85193e-10
+
+-2.92168 1.73688e-10
+
+-2.9154 1.60774e-10
+
+-2.90911 1.46588e-10
+
+-2.90283 1.31273e-10
+
+-2.89655 1.14969e-10
+
+-2.89027 9.78193e-11
+
+-2.88398 7.99665e-11
+
+-2.8777 6.15512e-11
+
+-2.87142 4.27115e-11
+
+-2.86513 2.35833e-11
+
+-2.85885 4.29734e-12
+
+-2.85257 1.5018e-11
+
+-2.84628 3.42406e-11
+
+-2.84 5.32531e-11
+
+-2.83372 7.19436e-11
+
+-2.82743 9.02066e-11
+
+-2.82115 1.07942e-10
+
+-2.81487 1.25058e-10
+
+-2.80858 1.41467e-10
+
+-2.8023 1.57089e-10
+
+-2.79602 1.71852e-10
+
+-2.78973 1.8569e-10
+
+-2.78345 1.98544e-10
+
+-2.77717 2.10361e-10
+
+-2.77088 2.21096e-10
+
+-2.7646 2.30711e-10
+
+-2.75832 2.39173e-10
+
+-2.75204 2.46457e-10
+
+-2.74575 2.52543e-10
+
+-2.73947 2.5742e-10
+
+-2.73319 2.61079e-10
+
+-2.7269 2.6352e-10
+
+-2.72062 2.64747e-10
+
+-2.71434 2.64769e-10
+
+-2.70805 2.63601e-10
+
+-2.70177 2.61264e-10
+
+-2.69549 2.5778e-10
+
+-2.6892 2.53179e-10
+
+-2.68292 2.47493e-10
+
+-2.67664 2.40758e-10
+
+-2.67035 2.33015e-10
+
+-2.66407 2.24306e-10
+
+-2.65779 2.14678e-10
+
+-2.6515 2.04179e-10
+
+-2.64522 1.9286e-10
+
+-2.63894 1.80775e-10
+
+-2.63265 1.67978e-10
+
+-2.62637 1.54527e-10
+
+-2.62009 1.40481e-10
+
+-2.61381 1.25897e-10
+
+-2.60752 1.10837e-10
+
+-2.60124 9.53604e-11
+
+-2.59496 7.95299e-11
+
+-2.58867 6.34055e-11
+
+-2.58239 4.70495e-11
+
+-2.57611 3.05223e-11
+
+-2.56982 1.38849e-11
+
+-2.56354 2.80276e-12
+
+-2.55726 1.94817e-11
+
+-2.55097 3.6094e-11
+
+-2.54469 5.25824e-11
+
+-2.53841 6.88918e-11
+
+-2.53212 8.49676e-11
+
+-2.52584 1.00757e-10
+
+-2.51956 1.1621e-10
+
+-2.51327 1.31278e-10
+
+-2.50699 1.45913e-10
+
+-2.50071 1.60072e-10
+
+-2.49442 1.73711e-10
+
+-2.48814 1.86789e-10
+
+-2.48186 1.9927e-10
+
+-2.47558 2.11118e-10
+
+-2.46929 2.22299e-10
+
+-2.46301 2.32782e-10
+
+-2.45673 2.42541e-10
+
+-2.45044 2.51548e-10
+
+-2.44416 2.59783e-10
+
+-2.43788 2.67223e-10
+
+-2.43159 2.73852e-10
+
+-2.42531 2.79656e-10
+
+-2.41903 2.8462e-10
+
+-2.41274 2.88736e-10
+
+-2.40646 2.91997e-10
+
+-2.40018 2.94398e-10
+
+-2.39389 2.95937e-10
+
+-2.38761 2.96614e-10
+
+-2.38133 2.96432e-10
+
+-2.37504 2.95398e-10
+
+-2.36876 2.93518e-10
+
+-2.36248 2.90801e-10
+
+-2.35619 2.87262e-10
+
+-2.34991 2.82913e-10
+
+-2.34363 2.77772e-10
+
+-2.33734 2.71856e-10
+
+-2.33106 2.65186e-10
+
+-2.32478 2.57784e-10
+
+-2.3185 2.49675e-10
+
+-2.31221 2.40882e-10
+
+-2.30593 2.31435e-10
+
+-2.29965 2.21362e-10
+
+-2.29336 2.10691e-10
+
+-2.28708 1.99456e-10
+
+-2.2808 1.87689e-10
+
+-2.27451 1.75422e-10
+
+-2.26823 1.6269e-10
+
+-2.26195 1.49531e-10
+
+-2.25566 1.35978e-10
+
+-2.24938 1.2207e-10
+
+-2.2431 1.07844e-10
+
+-2.23681 9.33388e-11
+
+-2.23053 7.8592e-11
+
+-2.22425 6.36422e-11
+
+-2.21796 4.85292e-11
+
+-2.21168 3.32918e-11
+
+-2.2054 1.7969e-11
+
+-2.19911 2.59959e-12
+
+-2.19283 1.27771e-11
+
+-2.18655 2.81227e-11
+
+-2.18027 4.33995e-11
+
+-2.17398 5.85691e-11
+
+-2.1677 7.35948e-11
+
+-2.16142 8.84398e-11
+
+-2.15513 1.03068e-10
+
+-2.14885 1.17444e-10
+
+-2.14257 1.31535e-10
+
+-2.13628 1.45306e-10
+
+-2.13 1.58725e-10
+
+-2.12372 1.7176e-10
+
+-2.11743 1.84383e-10
+
+-2.11115 1.96563e-10
+
+-2.10487 2.08272e-10
+
+-2.09858 2.19485e-10
+
+-2.0923 2.30176e-10
+
+-2.08602 2.4032e-10
+
+-2.07973 2.49896e-10
+
+-2.07345 2.58883e-10
+
+-2.06717 2.6726e-10
+
+-2.06088 2.7501e-10
+
+-2.0546 2.82117e-10
+
+-2.04832 2.88565e-10
+
+-2.04204 2.94342e-10
+
+-2.03575 2.99435e-10
+
+-2.02947 3.03834e-10
+
+-2.02319 3.07532e-10
+
+-2.0169 3.1052e-10
+
+-2.01062 3.12795e-10
+
+-2.00434 3.14352e-10
+
+-1.99805 3.15189e-10
+
+-1.99177 3.15307e-10
+
+-1.98549 3.14706e-10
+
+-1.9792 3.13391e-10
+
+-1.97292 3.11363e-10
+
+-1.96664 3.08631e-10
+
+-1.96035 3.05203e-10
+
+-1.95407 3.01085e-10
+
+-1.94779 2.96291e-10
+
+-1.9415 2.90831e-10
+
+-1.93522 2.8472e-10
+
+-1.92894 2.77972e-10
+
+-1.92265 2.70603e-10
+
+-1.91637 2.62631e-10
+
+-1.91009 2.54076e-10
+
+-1.90381 2.44956e-10
+
+-1.89752 2.35293e-10
+
+-1.89124 2.2511e-10
+
+-1.88496 2.1443e-10
+
+-1.87867 2.03277e-10
+
+-1.87239 1.91677e-10
+
+-1.86611 1.79655e-10
+
+-1.85982 1.6724e-10
+
+-1.85354 1.54459e-10
+
+-1.84726 1.41339e-10
+
+-1.84097 1.27911e-10
+
+-1.83469 1.14205e-10
+
+-1.82841 1.0025e-10
+
+-1.82212 8.60778e-11
+
+-1.81584 7.17187e-11
+
+-1.80956 5.72042e-11
+
+-1.80327 4.25669e-11
+
+-1.79699 2.78377e-11
+
+-1.79071 1.3049e-11
+
+-1.78442 1.76736e-12
+
+-1.77814 1.65792e-11
+
+-1.77186 3.13548e-11
+
+-1.76558 4.60623e-11
+
+-1.75929 6.06702e-11
+
+-1.75301 7.51476e-11
+
+-1.74673 8.94633e-11
+
+-1.74044 1.03586e-10
+
+-1.73416 1.17488e-10
+
+-1.72788 1.31138e-10
+
+-1.72159 1.44508e-10
+
+-1.71531 1.57569e-10
+
+-1.70903 1.70294e-10
+
+-1.70274 1.82656e-10
+
+-1.69646 1.9463e-10
+
+-1.69018 2.0619e-10
+
+-1.68389 2.17312e-10
+
+-1.67761 2.27973e-10
+
+-1.67133 2.38151e-10
+
+-1.66504 2.47825e-10
+
+-1.65876 2.56974e-10
+
+-1.65248 2.65579e-10
+
+-1.64619 2.73624e-10
+
+-1.63991 2.8109e-10
+
+-1.63363 2.87961e-10
+
+-1.62734 2.94225e-10
+
+-1.62106 2.99867e-10
+
+-1.61478 3.04874e-10
+
+-1.6085 3.09237e-10
+
+-1.60221 3.12944e-10
+
+-1.59593 3.15987e-10
+
+-1.58965 3.1836e-10
+
+-1.58336 3.20054e-10
+
+-1.57708 3.21064e-10
+
+-1.5708 3.21386e-10
+
+-1.5708 3.21386e-10
+
+-1.56451 3.21064e-10
+
+-1.55823 3.20054e-10
+
+-1.55195 3.1836e-10
+
+-1.54566 3.15987e-10
+
+-1.53938 3.12944e-10
+
+-1.5331 3.09237e-10
+
+-1.52681 3.04874e-10
+
+-1.52053 2.99867e-10
+
+-1.51425 2.94225e-10
+
+-1.50796 2.87961e-10
+
+-1.50168 2.8109e-10
+
+-1.4954 2.73624e-10
+
+-1.48911 2.6558e-10
+
+-1.48283 2.56974e-10
+
+-1.47655 2.47825e-10
+
+-1.47027 2.38151e-10
+
+-1.46398 2.27973e-10
+
+-1.4577 2.17312e-10
+
+-1.45142 2.0619e-10
+
+-1.44513 1.9463e-10
+
+-1.43885 1.82656e-10
+
+-1.43257 1.70294e-10
+
+-1.42628 1.57569e-10
+
+-1.42 1.44508e-10
+
+-1.41372 1.31138e-10
+
+-1.40743 1.17488e-10
+
+-1.40115 1.03586e-10
+
+-1.39487 8.9463e-11
+
+-1.38858 7.51474e-11
+
+-1.3823 6.067e-11
+
+-1.37602 4.60619e-11
+
+-1.36973 3.13545e-11
+
+-1.36345 1.65787e-11
+
+-1.35717 1.76692e-12
+
+-1.35088 1.30495e-11
+
+-1.3446 2.78382e-11
+
+-1.33832 4.25671e-11
+
+-1.33204 5.72048e-11
+
+-1.32575 7.17192e-11
+
+-1.31947 8.60783e-11
+
+-1.31319 1.00251e-10
+
+-1.3069 1.14205e-10
+
+-1.30062 1.27912e-10
+
+-1.29434 1.4134e-10
+
+-1.28805 1.54459e-10
+
+-1.28177 1.6724e-10
+
+-1.27549 1.79656e-10
+
+-1.2692 1.91677e-10
+
+-1.26292 2.03278e-10
+
+-1.25664 2.1443e-10
+
+-1.25035 2.25111e-10
+
+-1.24407 2.35294e-10
+
+-1.23779 2.44956e-10
+
+-1.2315 2.54076e-10
+
+-1.22522 2.62632e-10
+
+-1.21894 2.70603e-10
+
+-1.21265 2.77972e-10
+
+-1.20637 2.8472e-10
+
+-1.20009 2.90832e-10
+
+-1.19381 2.96291e-10
+
+-1.18752 3.01086e-10
+
+-1.18124 3.05203e-10
+
+-1.17496 3.08632e-10
+
+-1.16867 3.11363e-10
+
+-1.16239 3.13391e-10
+
+-1.15611 3.14707e-10
+
+-1.14982 3.15307e-10
+
+-1.14354 3.1519e-10
+
+-1.13726 3.14352e-10
+
+-1.13097 3.12795e-10
+
+-1.12469 3.1052e-10
+
+-1.11841 3.07532e-10
+
+-1.11212 3.03834e-10
+
+-1.10584 2.99435e-10
+
+-1.09956 2.94342e-10
+
+-1.09327 2.88565e-10
+
+-1.08699 2.82117e-10
+
+-1.08071 2.7501e-10
+
+-1.07442 2.6726e-10
+
+-1.06814 2.58883e-10
+
+-1.06186 2.49896e-10
+
+-1.05558 2.4032e-10
+
+-1.04929 2.30175e-10
+
+-1.04301 2.19485e-10
+
+-1.03673 2.08272e-10
+
+-1.03044 1.96563e-10
+
+-1.02416 1.84383e-10
+
+-1.01788 1.7176e-10
+
+-1.01159 1.58725e-10
+
+-1.00531 1.45306e-10
+
+-0.999026 1.31535e-10
+
+-0.992743 1.17444e-10
+
+-0.98646 1.03068e-10
+
+-0.980177 8.84398e-11
+
+-0.973894 7.35948e-11
+
+-0.967611 5.85696e-11
+
+-0.961327 4.33998e-11
+
+-0.955044 2.81229e-11
+
+-0.948761 1.27774e-11
+
+-0.942478 2.59937e-12
+
+-0.936195 1.79684e-11
+
+-0.929911 3.32913e-11
+
+-0.923628 4.85287e-11
+
+-0.917345 6.3642e-11
+
+-0.911062 7.85916e-11
+
+-0.904779 9.33383e-11
+
+-0.898495 1.07844e-10
+
+-0.892212 1.2207e-10
+
+-0.885929 1.35978e-10
+
+-0.879646 1.4953e-10
+
+-0.873363 1.6269e-10
+
+-0.86708 1.75421e-10
+
+-0.860796 1.87688e-10
+
+-0.854513 1.99456e-10
+
+-0.84823 2.1069e-10
+
+-0.841947 2.21361e-10
+
+-0.835664 2.31434e-10
+
+-0.82938 2.40881e-10
+
+-0.823097 2.49674e-10
+
+-0.816814 2.57783e-10
+
+-0.810531 2.65185e-10
+
+-0.804248 2.71855e-10
+
+-0.797965 2.77771e-10
+
+-0.791681 2.82912e-10
+
+-0.785398 2.87261e-10
+
+-0.779115 2.908e-10
+
+-0.772832 2.93516e-10
+
+-0.766549 2.95397e-10
+
+-0.760265 2.96431e-10
+
+-0.753982 2.96612e-10
+
+-0.747699 2.95935e-10
+
+-0.741416 2.94397e-10
+
+-0.735133 2.91996e-10
+
+-0.728849 2.88735e-10
+
+-0.722566 2.84619e-10
+
+-0.716283 2.79654e-10
+
+-0.71 2.73851e-10
+
+-0.703717 2.67222e-10
+
+-0.697434 2.59781e-10
+
+-0.69115 2.51547e-10
+
+-0.684867 2.42539e-10
+
+-0.678584 2.3278e-10
+
+-0.672301 2.22297e-10
+
+-0.666018 2.11116e-10
+
+-0.659734 1.99269e-10
+
+-0.653451 1.86788e-10
+
+-0.647168 1.73709e-10
+
+-0.640885 1.6007e-10
+
+-0.634602 1.45912e-10
+
+-0.628319 1.31277e-10
+
+-0.622035 1.16209e-10
+
+-0.615752 1.00756e-10
+
+-0.609469 8.49661e-11
+
+-0.603186 6.88903e-11
+
+-0.596903 5.25812e-11
+
+-0.590619 3.60931e-11
+
+-0.584336 1.94809e-11
+
+-0.578053 2.80187e-12
+
+-0.57177 1.38861e-11
+
+-0.565487 3.05234e-11
+
+-0.559203 4.70505e-11
+
+-0.55292 6.34066e-11
+
+-0.546637 7.95306e-11
+
+-0.540354 9.53615e-11
+
+-0.534071 1.10837e-10
+
+-0.527788 1.25898e-10
+
+-0.521504 1.40482e-10
+
+-0.515221 1.54528e-10
+
+-0.508938 1.67979e-10
+
+-0.502655 1.80775e-10
+
+-0.496372 1.92861e-10
+
+-0.490088 2.04179e-10
+
+-0.483805 2.14678e-10
+
+-0.477522 2.24307e-10
+
+-0.471239 2.33016e-10
+
+-0.464956 2.40759e-10
+
+-0.458673 2.47493e-10
+
+-0.452389 2.53179e-10
+
+-0.446106 2.5778e-10
+
+-0.439823 2.61264e-10
+
+-0.43354 2.63602e-10
+
+-0.427257 2.64769e-10
+
+-0.420973 2.64747e-10
+
+-0.41469 2.6352e-10
+
+-0.408407 2.6108e-10
+
+-0.402124 2.5742e-10
+
+-0.395841 2.52544e-10
+
+-0.389557 2.46457e-10
+
+-0.383274 2.39173e-10
+
+-0.376991 2.30711e-10
+
+-0.370708 2.21096e-10
+
+-0.364425 2.10361e-10
+
+-0.358142 1.98544e-10
+
+-0.351858 1.85691e-10
+
+-0.345575 1.71853e-10
+
+-0.339292 1.5709e-10
+
+-0.333009 1.41467e-10
+
+-0.326726 1.25059e-10
+
+-0.320442 1.07943e-10
+
+-0.314159 9.02073e-11
+
+-0.307876 7.19445e-11
+
+-0.301593 5.3254e-11
+
+-0.29531 3.42418e-11
+
+-0.289027 1.50189e-11
+
+-0.282743 4.29634e-12
+
+-0.27646 2.3582e-11
+
+-0.270177 4.27102e-11
+
+-0.263894 6.15498e-11
+
+-0.257611 7.99651e-11
+
+-0.251327 9.78179e-11
+
+-0.245044 1.14967e-10
+
+-0.238761 1.31271e-10
+
+-0.232478 1.46587e-10
+
+-0.226195 1.60772e-10
+
+-0.219911 1.73686e-10
+
+-0.213628 1.85191e-10
+
+-0.207345 1.95153e-10
+
+-0.201062 2.03445e-10
+
+-0.194779 2.09943e-10
+
+-0.188496 2.14538e-10
+
+-0.182212 2.17125e-10
+
+-0.175929 2.17616e-10
+
+-0.169646 2.15937e-10
+
+-0.163363 2.12029e-10
+
+-0.15708 2.05854e-10
+
+-0.150796 1.97396e-10
+
+-0.144513 1.86661e-10
+
+-0.13823 1.73687e-10
+
+-0.131947 1.58539e-10
+
+-0.125664 1.41317e-10
+
+-0.119381 1.2216e-10
+
+-0.113097 1.01247e-10
+
+-0.106814 7.88013e-11
+
+-0.100531 5.50981e-11
+
+-0.0942478 3.04651e-11
+
+-0.0879646 5.28903e-12
+
+-0.0816814 1.99801e-11
+
+-0.0753982 4.4823e-11
+
+-0.069115 6.86456e-11
+
+-0.0628319 9.07747e-11
+
+-0.0565487 1.1045e-10
+
+-0.0502655 1.26818e-10
+
+-0.0439823 1.38926e-10
+
+-0.0376991 1.45715e-10
+
+-0.0314159 1.46011e-10
+
+-0.0251327 1.38518e-10
+
+-0.0188496 1.21811e-10
+
+-0.0125664 9.43235e-11
+
+-0.00628319 5.43439e-11
+
+0 1.43148e-15
+
+0 1.43148e-15
+
+0.00628319 5.43413e-11
+
+0.0125664 9.4321e-11
+
+0.0188496 1.21808e-10
+
+0.0251327 1.38516e-10
+
+0.0314159 1.46008e-10
+
+0.0376991 1.45712e-10
+
+0.0439823 1.38923e-10
+
+0.0502655 1.26815e-10
+
+0.0565487 1.10447e-10
+
+0.0628319 9.07722e-11
+
+0.069115 6.86431e-11
+
+0.0753982 4.48203e-11
+
+0.0816814 1.99774e-11
+
+0.0879646 5.29178e-12
+
+0.0942478 3.04681e-11
+
+0.100531 5.51011e-11
+
+0.106814 7.88043e-11
+
+0.113097 1.0125e-10
+
+0.119381 1.22163e-10
+
+0.125664 1.41321e-10
+
+0.131947 1.58542e-10
+
+0.13823 1.7369e-10
+
+0.144513 1.86665e-10
+
+0.150796 1.97399e-10
+
+0.15708 2.05857e-10
+
+0.163363 2.12032e-10
+
+0.169646 2.1594e-10
+
+0.175929 2.1762e-10
+
+0.182212 2.17128e-10
+
+0.188496 2.14541e-10
+
+0.194779 2.09947e-10
+
+0.201062 2.03448e-10
+
+0.207345 1.95157e-10
+
+0.213628 1.85195e-10
+
+0.219911 1.73689e-10
+
+0.226195 1.60775e-10
+
+0.232478 1.4659e-10
+
+0.238761 1.31274e-10
+
+0.245044 1.1497e-10
+
+0.251327 9.78207e-11
+
+0.257611 7.9968e-11
+
+0.263894 6.15525e-11
+
+0.270177 4.27131e-11
+
+0.27646 2.35847e-11
+
+0.282743 4.29884e-12
+
+0.289027 1.50165e-11
+
+0.29531 3.42392e-11
+
+0.301593 5.32515e-11
+
+0.307876 7.19422e-11
+
+0.314159 9.02051e-11
+
+0.320442 1.07941e-10
+
+0.326726 1.25056e-10
+
+0.333009 1.41466e-10
+
+0.339292 1.57088e-10
+
+0.345575 1.71851e-10
+
+0.351858 1.85689e-10
+
+0.358142 1.98542e-10
+
+0.364425 2.10359e-10
+
+0.370708 2.21095e-10
+
+0.376991 2.30709e-10
+
+0.383274 2.39171e-10
+
+0.389557 2.46455e-10
+
+0.395841 2.52542e-10
+
+0.402124 2.57419e-10
+
+0.408407 2.61078e-10
+
+0.41469 2.63519e-10
+
+0.420973 2.64745e-10
+
+0.427257 2.64767e-10
+
+0.43354 2.636e-10
+
+0.439823 2.61262e-10
+
+0.446106 2.57779e-10
+
+0.452389 2.53178e-10
+
+0.458673 2.47492e-10
+
+0.464956 2.40757e-10
+
+0.471239 2.33014e-10
+
+0.477522 2.24305e-10
+
+0.483805 2.14677e-10
+
+0.490088 2.04177e-10
+
+0.496372 1.92858e-10
+
+0.502655 1.80773e-10
+
+0.508938 1.67977e-10
+
+0.515221 1.54526e-10
+
+0.521504 1.4048e-10
+
+0.527788 1.25896e-10
+
+0.534071 1.10835e-10
+
+0.540354 9.53592e-11
+
+0.546637 7.95284e-11
+
+0.55292 6.34041e-11
+
+0.559203 4.7048e-11
+
+0.565487 3.0521e-11
+
+0.57177 1.38838e-11
+
+0.578053 2.80409e-12
+
+0.584336 1.94831e-11
+
+0.590619 3.60955e-11
+
+0.596903 5.25837e-11
+
+0.603186 6.8893e-11
+
+0.609469 8.49688e-11
+
+0.615752 1.00758e-10
+
+0.622035 1.16212e-10
+
+0.628319 1.31279e-10
+
+0.634602 1.45915e-10
+
+0.640885 1.60073e-10
+
+0.647168 1.73712e-10
+
+0.653451 1.86791e-10
+
+0.659734 1.99271e-10
+
+0.666018 2.11119e-10
+
+0.672301 2.223e-10
+
+0.678584 2.32783e-10
+
+0.684867 2.42542e-10
+
+0.69115 2.5155e-10
+
+0.697434 2.59784e-10
+
+0.703717 2.67225e-10
+
+0.71 2.73854e-10
+
+0.716283 2.79657e-10
+
+0.722566 2.84622e-10
+
+0.728849 2.88738e-10
+
+0.735133 2.91999e-10
+
+0.741416 2.94399e-10
+
+0.747699 2.95938e-10
+
+0.753982 2.96615e-10
+
+0.760265 2.96434e-10
+
+0.766549 2.95399e-10
+
+0.772832 2.93519e-10
+
+0.779115 2.90803e-10
+
+0.785398 2.87263e-10
+
+0.791681 2.82914e-10
+
+0.797965 2.77773e-10
+
+0.804248 2.71857e-10
+
+0.810531 2.65187e-10
+
+0.816814 2.57786e-10
+
+0.823097 2.49676e-10
+
+0.82938 2.40884e-10
+
+0.835664 2.31437e-10
+
+0.841947 2.21363e-10
+
+0.84823 2.10693e-10
+
+0.854513 1.99458e-10
+
+0.860796 1.8769e-10
+
+0.86708 1.75423e-10
+
+0.873363 1.62692e-10
+
+0.879646 1.49532e-10
+
+0.885929 1.35979e-10
+
+0.892212 1.22072e-10
+
+0.898495 1.07846e-10
+
+0.904779 9.334e-11
+
+0.911062 7.85932e-11
+
+0.917345 6.36434e-11
+
+0.923628 4.85304e-11
+
+0.929911 3.3293e-11
+
+0.936195 1.79701e-11
+
+0.942478 2.60048e-12
+
+0.948761 1.2776e-11
+
+0.955044 2.81215e-11
+
+0.961327 4.33983e-11
+
+0.967611 5.85679e-11
+
+0.973894 7.35934e-11
+
+0.980177 8.84387e-11
+
+0.98646 1.03067e-10
+
+0.992743 1.17443e-10
+
+0.999026 1.31533e-10
+
+1.00531 1.45304e-10
+
+1.01159 1.58723e-10
+
+1.01788 1.71759e-10
+
+1.02416 1.84382e-10
+
+1.03044 1.96562e-10
+
+1.03673 2.08271e-10
+
+1.04301 2.19484e-10
+
+1.04929 2.30174e-10
+
+1.05558 2.40319e-10
+
+1.06186 2.49895e-10
+
+1.06814 2.58881e-10
+
+1.07442 2.67259e-10
+
+1.08071 2.75009e-10
+
+1.08699 2.82116e-10
+
+1.09327 2.88564e-10
+
+1.09956 2.94341e-10
+
+1.10584 2.99433e-10
+
+1.11212 3.03833e-10
+
+1.11841 3.0753e-10
+
+1.12469 3.10519e-10
+
+1.13097 3.12793e-10
+
+1.13726 3.1435e-10
+
+1.14354 3.15188e-10
+
+1.14982 3.15306e-10
+
+1.15611 3.14705e-10
+
+1.16239 3.13389e-10
+
+1.16867 3.11362e-10
+
+1.17496 3.0863e-10
+
+1.18124 3.05202e-10
+
+1.18752 3.01084e-10
+
+1.19381 2.9629e-10
+
+1.20009 2.9083e-10
+
+1.20637 2.84719e-10
+
+1.21265 2.77971e-10
+
+1.21894 2.70602e-10
+
+1.22522 2.6263e-10
+
+1.2315 2.54075e-10
+
+1.23779 2.44955e-10
+
+1.24407 2.35292e-10
+
+1.25035 2.25109e-10
+
+1.25664 2.14429e-10
+
+1.26292 2.03276e-10
+
+1.2692 1.91676e-10
+
+1.27549 1.79654e-10
+
+1.28177 1.67239e-10
+
+1.28805 1.54457e-10
+
+1.29434 1.41338e-10
+
+1.30062 1.2791e-10
+
+1.3069 1.14204e-10
+
+1.31319 1.00249e-10
+
+1.31947 8.60766e-11
+
+1.32575 7.17175e-11
+
+1.33204 5.7203e-11
+
+1.33832 4.25658e-11
+
+1.3446 2.78366e-11
+
+1.35088 1.30479e-11
+
+1.35717 1.76836e-12
+
+1.36345 1.65802e-11
+
+1.36973 3.13559e-11
+
+1.37602 4.60636e-11
+
+1.3823 6.06715e-11
+
+1.38858 7.51487e-11
+
+1.39487 8.94642e-11
+
+1.40115 1.03587e-10
+
+1.40743 1.17489e-10
+
+1.41372 1.31139e-10
+
+1.42 1.44509e-10
+
+1.42628 1.5757e-10
+
+1.43257 1.70295e-10
+
+1.43885 1.82657e-10
+
+1.44513 1.94631e-10
+
+1.45142 2.06191e-10
+
+1.4577 2.17313e-10
+
+1.46398 2.27974e-10
+
+1.47027 2.38152e-10
+
+1.47655 2.47826e-10
+
+1.48283 2.56975e-10
+
+1.48911 2.65581e-10
+
+1.4954 2.73625e-10
+
+1.50168 2.81091e-10
+
+1.50796 2.87963e-10
+
+1.51425 2.94226e-10
+
+1.52053 2.99868e-10
+
+1.52681 3.04875e-10
+
+1.5331 3.09238e-10
+
+1.53938 3.12946e-10
+
+1.54566 3.15989e-10
+
+1.55195 3.18361e-10
+
+1.55823 3.20055e-10
+
+1.56451 3.21065e-10
+
+1.5708 3.21387e-10
+
+1.5708 3.21387e-10
+
+1.57708 3.21065e-10
+
+1.58336 3.20055e-10
+
+1.58965 3.18361e-10
+
+1.59593 3.15989e-10
+
+1.60221 3.12945e-10
+
+1.6085 3.09238e-10
+
+1.61478 3.04875e-10
+
+1.62106 2.99868e-10
+
+1.62734 2.94226e-10
+
+1.63363 2.87963e-10
+
+1.63991 2.81091e-10
+
+1.64619 2.73625e-10
+
+1.65248 2.65581e-10
+
+1.65876 2.56975e-10
+
+1.66504 2.47826e-10
+
+1.67133 2.38152e-10
+
+1.67761 2.27974e-10
+
+1.68389 2.17313e-10
+
+1.69018 2.06191e-10
+
+1.69646 1.94631e-10
+
+1.70274 1.82657e-10
+
+1.70903 1.70295e-10
+
+1.71531 1.5757e-10
+
+1.72159 1.44509e-10
+
+1.72788 1.31139e-10
+
+1.73416 1.17489e-10
+
+1.74044 1.03587e-10
+
+1.74673 8.94641e-11
+
+1.75301 7.51486e-11
+
+1.75929 6.06712e-11
+
+1.76558 4.60633e-11
+
+1.77186 3.13556e-11
+
+1.77814 1.65802e-11
+
+1.78442 1.76814e-12
+
+1.79071 1.30483e-11
+
+1.79699 2.7837e-11
+
+1.80327 4.2566e-11
+
+1.80956 5.72037e-11
+
+1.81584 7.1718e-11
+
+1.82212 8.60769e-11
+
+1.82841 1.0025e-10
+
+1.83469 1.14204e-10
+
+1.84097 1.27911e-10
+
+1.84726 1.41338e-10
+
+1.85354 1.54458e-10
+
+1.85982 1.67239e-10
+
+1.86611 1.79655e-10
+
+1.87239 1.91676e-10
+
+1.87867 2.03277e-10
+
+1.88496 2.14429e-10
+
+1.89124 2.25109e-10
+
+1.89752 2.35293e-10
+
+1.90381 2.44955e-10
+
+1.91009 2.54075e-10
+
+1.91637 2.62631e-10
+
+1.92265 2.70602e-10
+
+1.92894 2.77971e-10
+
+1.93522 2.84719e-10
+
+1.9415 2.9083e-10
+
+1.94779 2.9629e-10
+
+1.95407 3.01084e-10
+
+1.96035 3.05202e-10
+
+1.96664 3.08631e-10
+
+1.97292 3.11362e-10
+
+1.9792 3.1339e-10
+
+1.98549 3.14705e-10
+
+1.99177 3.15306e-10
+
+1.99805 3.15188e-10
+
+2.00434 3.14351e-10
+
+2.01062 3.12794e-10
+
+2.0169 3.10519e-10
+
+2.02319 3.0753e-10
+
+2.02947 3.03833e-10
+
+2.03575 2.99433e-10
+
+2.04204 2.9434e-10
+
+2.04832 2.88564e-10
+
+2.0546 2.82115e-10
+
+2.06088 2.75009e-10
+
+2.06717 2.67259e-10
+
+2.07345 2.58881e-10
+
+2.07973 2.49895e-10
+
+2.08602 2.40318e-10
+
+2.0923 2.30174e-10
+
+2.09858 2.19484e-10
+
+2.10487 2.08271e-10
+
+2.11115 1.96561e-10
+
+2.11743 1.84382e-10
+
+2.12372 1.71759e-10
+
+2.13 1.58723e-10
+
+2.13628 1.45304e-10
+
+2.14257 1.31533e-10
+
+2.14885 1.17443e-10
+
+2.15513 1.03067e-10
+
+2.16142 8.84385e-11
+
+2.1677 7.35936e-11
+
+2.17398 5.85682e-11
+
+2.18027 4.33986e-11
+
+2.18655 2.81216e-11
+
+2.19283 1.27764e-11
+
+2.19911 2.60036e-12
+
+2.2054 1.79696e-11
+
+2.21168 3.32927e-11
+
+2.21796 4.85302e-11
+
+2.22425 6.36431e-11
+
+2.23053 7.85928e-11
+
+2.23681 9.33397e-11
+
+2.2431 1.07845e-10
+
+2.24938 1.22071e-10
+
+2.25566 1.35979e-10
+
+2.26195 1.49531e-10
+
+2.26823 1.62691e-10
+
+2.27451 1.75422e-10
+
+2.2808 1.87689e-10
+
+2.28708 1.99457e-10
+
+2.29336 2.10692e-10
+
+2.29965 2.21362e-10
+
+2.30593 2.31436e-10
+
+2.31221 2.40883e-10
+
+2.3185 2.49675e-10
+
+2.32478 2.57784e-10
+
+2.33106 2.65186e-10
+
+2.33734 2.71856e-10
+
+2.34363 2.77772e-10
+
+2.34991 2.82913e-10
+
+2.35619 2.87262e-10
+
+2.36248 2.90801e-10
+
+2.36876 2.93517e-10
+
+2.37504 2.95398e-10
+
+2.38133 2.96432e-10
+
+2.38761 2.96614e-10
+
+2.39389 2.95937e-10
+
+2.40018 2.94398e-10
+
+2.40646 2.91997e-10
+
+2.41274 2.88736e-10
+
+2.41903 2.8462e-10
+
+2.42531 2.79655e-10
+
+2.43159 2.73852e-10
+
+2.43788 2.67223e-10
+
+2.44416 2.59782e-10
+
+2.45044 2.51548e-10
+
+2.45673 2.42541e-10
+
+2.46301 2.32782e-10
+
+2.46929 2.22298e-10
+
+2.47558 2.11117e-10
+
+2.48186 1.9927e-10
+
+2.48814 1.86789e-10
+
+2.49442 1.7371e-10
+
+2.50071 1.60072e-10
+
+2.50699 1.45913e-10
+
+2.51327 1.31278e-10
+
+2.51956 1.1621e-10
+
+2.52584 1.00757e-10
+
+2.53212 8.49674e-11
+
+2.53841 6.88917e-11
+
+2.54469 5.25825e-11
+
+2.55097 3.60943e-11
+
+2.55726 1.94822e-11
+
+2.56354 2.8032e-12
+
+2.56982 1.38846e-11
+
+2.57611 3.0522e-11
+
+2.58239 4.7049e-11
+
+2.58867 6.34048e-11
+
+2.59496 7.95292e-11
+
+2.60124 9.53598e-11
+
+2.60752 1.10836e-10
+
+2.61381 1.25896e-10
+
+2.62009 1.4048e-10
+
+2.62637 1.54527e-10
+
+2.63265 1.67977e-10
+
+2.63894 1.80774e-10
+
+2.64522 1.92859e-10
+
+2.6515 2.04178e-10
+
+2.65779 2.14677e-10
+
+2.66407 2.24305e-10
+
+2.67035 2.33014e-10
+
+2.67664 2.40757e-10
+
+2.68292 2.47492e-10
+
+2.6892 2.53178e-10
+
+2.69549 2.57779e-10
+
+2.70177 2.61262e-10
+
+2.70805 2.636e-10
+
+2.71434 2.64768e-10
+
+2.72062 2.64746e-10
+
+2.7269 2.63519e-10
+
+2.73319 2.61078e-10
+
+2.73947 2.57419e-10
+
+2.74575 2.52542e-10
+
+2.75204 2.46455e-10
+
+2.75832 2.39172e-10
+
+2.7646 2.30709e-10
+
+2.77088 2.21095e-10
+
+2.77717 2.1036e-10
+
+2.78345 1.98543e-10
+
+2.78973 1.85689e-10
+
+2.79602 1.71851e-10
+
+2.8023 1.57088e-10
+
+2.80858 1.41466e-10
+
+2.81487 1.25057e-10
+
+2.82115 1.07942e-10
+
+2.82743 9.02059e-11
+
+2.83372 7.19431e-11
+
+2.84 5.32525e-11
+
+2.84628 3.42403e-11
+
+2.85257 1.50175e-11
+
+2.85885 4.29767e-12
+
+2.86513 2.35835e-11
+
+2.87142 4.27118e-11
+
+2.8777 6.15514e-11
+
+2.88398 7.99666e-11
+
+2.89027 9.78194e-11
+
+2.89655 1.14969e-10
+
+2.90283 1.31272e-10
+
+2.90911 1.46588e-10
+
+2.9154 1.60773e-10
+
+2.92168 1.73688e-10
+
+2.92796 1.85193e-10
+
+2.93425 1.95155e-10
+
+2.94053 2.03446e-10
+
+2.94681 2.09945e-10
+
+2.9531 2.14539e-10
+
+2.95938 2.17126e-10
+
+2.96566 2.17618e-10
+
+2.97195 2.15938e-10
+
+2.97823 2.1203e-10
+
+2.98451 2.05855e-10
+
+2.9908 1.97397e-10
+
+2.99708 1.86663e-10
+
+3.00336 1.73688e-10
+
+3.00965 1.5854e-10
+
+3.01593 1.41319e-10
+
+3.02221 1.22162e-10
+
+3.0285 1.01248e-10
+
+3.03478 7.88028e-11
+
+3.04106 5.50997e-11
+
+3.04734 3.04665e-11
+
+3.05363 5.29045e-12
+
+3.05991 1.99787e-11
+
+3.06619 4.48213e-11
+
+3.07248 6.86442e-11
+
+3.07876 9.07732e-11
+
+3.08504 1.10448e-10
+
+3.09133 1.26816e-10
+
+3.09761 1.38924e-10
+
+3.10389 1.45713e-10
+
+3.11018 1.46009e-10
+
+3.11646 1.38517e-10
+
+3.12274 1.21809e-10
+
+3.12903 9.43221e-11
+
+3.13531 5.43426e-11
+
+3.14159 0
+
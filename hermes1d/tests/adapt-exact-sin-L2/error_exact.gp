@@ -0,0 +1,1004 @@
+-3.14159 1.22465e-16
+-3.13531 5.43584e-11
+-3.12903 9.43454e-11
+-3.12274 1.21834e-10
+-3.11646 1.38537e-10
+-3.11018 1.46024e-10
+-3.10389 1.4572e-10
+-3.09761 1.38922e-10
+-3.09133 1.26805e-10
+-3.08504 1.10429e-10
+-3.07876 9.07472e-11
+-3.07248 6.86123e-11
+-3.06619 4.47853e-11
+-3.05991 1.99399e-11
+-3.05363 5.33051e-12
+-3.04734 3.05062e-11
+-3.04106 5.51377e-11
+-3.03478 7.88374e-11
+-3.0285 1.01279e-10
+-3.02221 1.22187e-10
+-3.01593 1.41339e-10
+-3.00965 1.58554e-10
+-3.00336 1.73696e-10
+-2.99708 1.86663e-10
+-2.9908 1.97391e-10
+-2.98451 2.05843e-10
+-2.97823 2.12012e-10
+-2.97195 2.15914e-10
+-2.96566 2.17588e-10
+-2.95938 2.17092e-10
+-2.9531 2.14502e-10
+-2.94681 2.09904e-10
+-2.94053 2.03404e-10
+-2.93425 1.95111e-10
+-2.92796 1.85149e-10
+-2.92168 1.73644e-10
+-2.9154 1.60731e-10
+-2.90911 1.46548e-10
+-2.90283 1.31235e-10
+-2.89655 1.14934e-10
+-2.89027 9.77891e-11
+-2.88398 7.99409e-11
+-2.8777 6.15306e-11
+-2.87142 4.26961e-11
+-2.86513 2.35734e-11
+-2.85885 4.29301e-12
+-2.85257 1.50163e-11
+-2.84628 3.42335e-11
+-2.84 5.32401e-11
+-2.83372 7.19251e-11
+-2.82743 9.01826e-11
+-2.82115 1.07913e-10
+-2.81487 1.25024e-10
+-2.80858 1.41429e-10
+-2.8023 1.57047e-10
+-2.79602 1.71807e-10
+-2.78973 1.85642e-10
+-2.78345 1.98494e-10
+-2.77717 2.10309e-10
+-2.77088 2.21043e-10
+-2.7646 2.30657e-10
+-2.75832 2.3912e-10
+-2.75204 2.46404e-10
+-2.74575 2.52493e-10
+-2.73947 2.57371e-10
+-2.73319 2.61033e-10
+-2.7269 2.63476e-10
+-2.72062 2.64706e-10
+-2.71434 2.64732e-10
+-2.70805 2.63569e-10
+-2.70177 2.61236e-10
+-2.69549 2.57757e-10
+-2.6892 2.53161e-10
+-2.68292 2.47481e-10
+-2.67664 2.40751e-10
+-2.67035 2.33014e-10
+-2.66407 2.2431e-10
+-2.65779 2.14687e-10
+-2.6515 2.04193e-10
+-2.64522 1.9288e-10
+-2.63894 1.808e-10
+-2.63265 1.68008e-10
+-2.62637 1.54562e-10
+-2.62009 1.40519e-10
+-2.61381 1.25939e-10
+-2.60752 1.10883e-10
+-2.60124 9.54092e-11
+-2.59496 7.9581e-11
+-2.58867 6.34588e-11
+-2.58239 4.71043e-11
+-2.57611 3.05781e-11
+-2.56982 1.39413e-11
+-2.56354 2.74636e-12
+-2.55726 1.94255e-11
+-2.55097 3.60388e-11
+-2.54469 5.25286e-11
+-2.53841 6.88397e-11
+-2.53212 8.49182e-11
+-2.52584 1.00711e-10
+-2.51956 1.16167e-10
+-2.51327 1.31238e-10
+-2.50699 1.45878e-10
+-2.50071 1.6004e-10
+-2.49442 1.73684e-10
+-2.48814 1.86767e-10
+-2.48186 1.99253e-10
+-2.47558 2.11106e-10
+-2.46929 2.22292e-10
+-2.46301 2.32781e-10
+-2.45673 2.42545e-10
+-2.45044 2.51558e-10
+-2.44416 2.59797e-10
+-2.43788 2.67243e-10
+-2.43159 2.73877e-10
+-2.42531 2.79685e-10
+-2.41903 2.84654e-10
+-2.41274 2.88774e-10
+-2.40646 2.92039e-10
+-2.40018 2.94443e-10
+-2.39389 2.95985e-10
+-2.38761 2.96665e-10
+-2.38133 2.96486e-10
+-2.37504 2.95454e-10
+-2.36876 2.93575e-10
+-2.36248 2.90859e-10
+-2.35619 2.8732e-10
+-2.34991 2.82972e-10
+-2.34363 2.7783e-10
+-2.33734 2.71913e-10
+-2.33106 2.65242e-10
+-2.32478 2.57838e-10
+-2.3185 2.49726e-10
+-2.31221 2.40931e-10
+-2.30593 2.31481e-10
+-2.29965 2.21403e-10
+-2.29336 2.10729e-10
+-2.28708 1.9949e-10
+-2.2808 1.87718e-10
+-2.27451 1.75447e-10
+-2.26823 1.6271e-10
+-2.26195 1.49545e-10
+-2.25566 1.35988e-10
+-2.24938 1.22074e-10
+-2.2431 1.07843e-10
+-2.23681 9.33325e-11
+-2.23053 7.85804e-11
+-2.22425 6.36258e-11
+-2.21796 4.85079e-11
+-2.21168 3.32656e-11
+-2.2054 1.79384e-11
+-2.19911 2.56495e-12
+-2.19283 1.28159e-11
+-2.18655 2.8165e-11
+-2.18027 4.34447e-11
+-2.17398 5.86171e-11
+-2.1677 7.36449e-11
+-2.16142 8.84914e-11
+-2.15513 1.03121e-10
+-2.14885 1.17498e-10
+-2.14257 1.31588e-10
+-2.13628 1.45359e-10
+-2.13 1.58778e-10
+-2.12372 1.71812e-10
+-2.11743 1.84433e-10
+-2.11115 1.9661e-10
+-2.10487 2.08317e-10
+-2.09858 2.19526e-10
+-2.0923 2.30213e-10
+-2.08602 2.40354e-10
+-2.07973 2.49925e-10
+-2.07345 2.58907e-10
+-2.06717 2.6728e-10
+-2.06088 2.75024e-10
+-2.0546 2.82126e-10
+-2.04832 2.88569e-10
+-2.04204 2.9434e-10
+-2.03575 2.99427e-10
+-2.02947 3.03821e-10
+-2.02319 3.07513e-10
+-2.0169 3.10497e-10
+-2.01062 3.12766e-10
+-2.00434 3.14318e-10
+-1.99805 3.15152e-10
+-1.99177 3.15265e-10
+-1.98549 3.14661e-10
+-1.9792 3.13342e-10
+-1.97292 3.11312e-10
+-1.96664 3.08578e-10
+-1.96035 3.05148e-10
+-1.95407 3.0103e-10
+-1.94779 2.96235e-10
+-1.9415 2.90776e-10
+-1.93522 2.84665e-10
+-1.92894 2.77919e-10
+-1.92265 2.70552e-10
+-1.91637 2.62583e-10
+-1.91009 2.54031e-10
+-1.90381 2.44915e-10
+-1.89752 2.35257e-10
+-1.89124 2.25079e-10
+-1.88496 2.14404e-10
+-1.87867 2.03257e-10
+-1.87239 1.91662e-10
+-1.86611 1.79647e-10
+-1.85982 1.67238e-10
+-1.85354 1.54463e-10
+-1.84726 1.41349e-10
+-1.84097 1.27928e-10
+-1.83469 1.14227e-10
+-1.82841 1.00278e-10
+-1.82212 8.61102e-11
+-1.81584 7.17557e-11
+-1.80956 5.72451e-11
+-1.80327 4.26111e-11
+-1.79699 2.78844e-11
+-1.79071 1.30974e-11
+-1.78442 1.71807e-12
+-1.77814 1.653e-11
+-1.77186 3.13065e-11
+-1.76558 4.60159e-11
+-1.75929 6.06265e-11
+-1.75301 7.51075e-11
+-1.74673 8.94276e-11
+-1.74044 1.03556e-10
+-1.73416 1.17463e-10
+-1.72788 1.3112e-10
+-1.72159 1.44496e-10
+-1.71531 1.57564e-10
+-1.70903 1.70296e-10
+-1.70274 1.82665e-10
+-1.69646 1.94646e-10
+-1.69018 2.06212e-10
+-1.68389 2.1734e-10
+-1.67761 2.28006e-10
+-1.67133 2.38187e-10
+-1.66504 2.47863e-10
+-1.65876 2.57013e-10
+-1.65248 2.65618e-10
+-1.64619 2.73659e-10
+-1.63991 2.81121e-10
+-1.63363 2.87987e-10
+-1.62734 2.94243e-10
+-1.62106 2.99876e-10
+-1.61478 3.04875e-10
+-1.6085 3.09228e-10
+-1.60221 3.12927e-10
+-1.59593 3.15964e-10
+-1.58965 3.18333e-10
+-1.58336 3.20028e-10
+-1.57708 3.21047e-10
+-1.5708 3.21387e-10
+-1.56451 3.21047e-10
+-1.55823 3.20028e-10
+-1.55195 3.18333e-10
+-1.54566 3.15964e-10
+-1.53938 3.12927e-10
+-1.5331 3.09228e-10
+-1.52681 3.04875e-10
+-1.52053 2.99876e-10
+-1.51425 2.94243e-10
+-1.50796 2.87987e-10
+-1.50168 2.81121e-10
+-1.4954 2.73659e-10
+-1.48911 2.65618e-10
+-1.48283 2.57013e-10
+-1.47655 2.47863e-10
+-1.47027 2.38187e-10
+-1.46398 2.28006e-10
+-1.4577 2.1734e-10
+-1.45142 2.06212e-10
+-1.44513 1.94646e-10
+-1.43885 1.82665e-10
+-1.43257 1.70296e-10
+-1.42628 1.57564e-10
+-1.42 1.44496e-10
+-1.41372 1.3112e-10
+-1.40743 1.17463e-10
+-1.40115 1.03556e-10
+-1.39487 8.94275e-11
+-1.38858 7.51074e-11
+-1.3823 6.06266e-11
+-1.37602 4.60159e-11
+-1.36973 3.13066e-11
+-1.36345 1.653e-11
+-1.35717 1.71807e-12
+-1.35088 1.30975e-11
+-1.3446 2.78845e-11
+-1.33832 4.26111e-11
+-1.33204 5.72452e-11
+-1.32575 7.17557e-11
+-1.31947 8.61103e-11
+-1.31319 1.00278e-10
+-1.3069 1.14227e-10
+-1.30062 1.27928e-10
+-1.29434 1.41349e-10
+-1.28805 1.54463e-10
+-1.28177 1.67238e-10
+-1.27549 1.79647e-10
+-1.2692 1.91663e-10
+-1.26292 2.03257e-10
+-1.25664 2.14404e-10
+-1.25035 2.25079e-10
+-1.24407 2.35257e-10
+-1.23779 2.44915e-10
+-1.2315 2.54031e-10
+-1.22522 2.62583e-10
+-1.21894 2.70552e-10
+-1.21265 2.77919e-10
+-1.20637 2.84665e-10
+-1.20009 2.90776e-10
+-1.19381 2.96235e-10
+-1.18752 3.0103e-10
+-1.18124 3.05148e-10
+-1.17496 3.08578e-10
+-1.16867 3.11312e-10
+-1.16239 3.13342e-10
+-1.15611 3.14661e-10
+-1.14982 3.15265e-10
+-1.14354 3.15152e-10
+-1.13726 3.14319e-10
+-1.13097 3.12766e-10
+-1.12469 3.10497e-10
+-1.11841 3.07513e-10
+-1.11212 3.03821e-10
+-1.10584 2.99427e-10
+-1.09956 2.9434e-10
+-1.09327 2.88569e-10
+-1.08699 2.82126e-10
+-1.08071 2.75025e-10
+-1.07442 2.67279e-10
+-1.06814 2.58907e-10
+-1.06186 2.49925e-10
+-1.05558 2.40354e-10
+-1.04929 2.30213e-10
+-1.04301 2.19527e-10
+-1.03673 2.08317e-10
+-1.03044 1.9661e-10
+-1.02416 1.84433e-10
+-1.01788 1.71812e-10
+-1.01159 1.58777e-10
+-1.00531 1.45359e-10
+-0.999026 1.31589e-10
+-0.992743 1.17498e-10
+-0.98646 1.03121e-10
+-0.980177 8.84912e-11
+-0.973894 7.36449e-11
+-0.967611 5.86174e-11
+-0.961327 4.34449e-11
+-0.955044 2.81654e-11
+-0.948761 1.2816e-11
+-0.942478 2.56484e-12
+-0.936195 1.79381e-11
+-0.929911 3.32655e-11
+-0.923628 4.85075e-11
+-0.917345 6.36257e-11
+-0.911062 7.85801e-11
+-0.904779 9.33322e-11
+-0.898495 1.07843e-10
+-0.892212 1.22074e-10
+-0.885929 1.35988e-10
+-0.879646 1.49545e-10
+-0.873363 1.6271e-10
+-0.86708 1.75446e-10
+-0.860796 1.87718e-10
+-0.854513 1.9949e-10
+-0.84823 2.10729e-10
+-0.841947 2.21403e-10
+-0.835664 2.31481e-10
+-0.82938 2.40931e-10
+-0.823097 2.49726e-10
+-0.816814 2.57838e-10
+-0.810531 2.65241e-10
+-0.804248 2.71913e-10
+-0.797965 2.7783e-10
+-0.791681 2.82972e-10
+-0.785398 2.8732e-10
+-0.779115 2.90859e-10
+-0.772832 2.93575e-10
+-0.766549 2.95453e-10
+-0.760265 2.96486e-10
+-0.753982 2.96665e-10
+-0.747699 2.95985e-10
+-0.741416 2.94443e-10
+-0.735133 2.92039e-10
+-0.728849 2.88774e-10
+-0.722566 2.84654e-10
+-0.716283 2.79685e-10
+-0.71 2.73877e-10
+-0.703717 2.67243e-10
+-0.697434 2.59797e-10
+-0.69115 2.51558e-10
+-0.684867 2.42545e-10
+-0.678584 2.32781e-10
+-0.672301 2.22292e-10
+-0.666018 2.11105e-10
+-0.659734 1.99253e-10
+-0.653451 1.86767e-10
+-0.647168 1.73684e-10
+-0.640885 1.6004e-10
+-0.634602 1.45878e-10
+-0.628319 1.31238e-10
+-0.622035 1.16167e-10
+-0.615752 1.0071e-10
+-0.609469 8.49179e-11
+-0.603186 6.88396e-11
+-0.596903 5.25285e-11
+-0.590619 3.60389e-11
+-0.584336 1.94255e-11
+-0.578053 2.74614e-12
+-0.57177 1.39417e-11
+-0.565487 3.05782e-11
+-0.559203 4.71044e-11
+-0.55292 6.34591e-11
+-0.546637 7.95811e-11
+-0.540354 9.54093e-11
+-0.534071 1.10883e-10
+-0.527788 1.2594e-10
+-0.521504 1.4052e-10
+-0.515221 1.54562e-10
+-0.508938 1.68008e-10
+-0.502655 1.808e-10
+-0.496372 1.9288e-10
+-0.490088 2.04194e-10
+-0.483805 2.14687e-10
+-0.477522 2.2431e-10
+-0.471239 2.33014e-10
+-0.464956 2.40752e-10
+-0.458673 2.47481e-10
+-0.452389 2.53161e-10
+-0.446106 2.57757e-10
+-0.439823 2.61236e-10
+-0.43354 2.63569e-10
+-0.427257 2.64733e-10
+-0.420973 2.64707e-10
+-0.41469 2.63476e-10
+-0.408407 2.61033e-10
+-0.402124 2.57371e-10
+-0.395841 2.52493e-10
+-0.389557 2.46405e-10
+-0.383274 2.3912e-10
+-0.376991 2.30657e-10
+-0.370708 2.21043e-10
+-0.364425 2.10309e-10
+-0.358142 1.98494e-10
+-0.351858 1.85642e-10
+-0.345575 1.71807e-10
+-0.339292 1.57048e-10
+-0.333009 1.41429e-10
+-0.326726 1.25024e-10
+-0.320442 1.07914e-10
+-0.314159 9.01828e-11
+-0.307876 7.19252e-11
+-0.301593 5.32402e-11
+-0.29531 3.42336e-11
+-0.289027 1.50166e-11
+-0.282743 4.29307e-12
+-0.27646 2.3573e-11
+-0.270177 4.26959e-11
+-0.263894 6.15302e-11
+-0.257611 7.99407e-11
+-0.251327 9.77889e-11
+-0.245044 1.14934e-10
+-0.238761 1.31235e-10
+-0.232478 1.46548e-10
+-0.226195 1.60731e-10
+-0.219911 1.73644e-10
+-0.213628 1.85149e-10
+-0.207345 1.95111e-10
+-0.201062 2.03404e-10
+-0.194779 2.09904e-10
+-0.188496 2.14501e-10
+-0.182212 2.17092e-10
+-0.175929 2.17588e-10
+-0.169646 2.15914e-10
+-0.163363 2.12011e-10
+-0.15708 2.05843e-10
+-0.150796 1.97391e-10
+-0.144513 1.86663e-10
+-0.13823 1.73696e-10
+-0.131947 1.58554e-10
+-0.125664 1.41338e-10
+-0.119381 1.22187e-10
+-0.113097 1.01279e-10
+-0.106814 7.88373e-11
+-0.100531 5.51373e-11
+-0.0942478 3.0506e-11
+-0.0879646 5.33026e-12
+-0.0816814 1.994e-11
+-0.0753982 4.47853e-11
+-0.069115 6.86127e-11
+-0.0628319 9.07473e-11
+-0.0565487 1.10429e-10
+-0.0502655 1.26806e-10
+-0.0439823 1.38922e-10
+-0.0376991 1.4572e-10
+-0.0314159 1.46024e-10
+-0.0251327 1.38538e-10
+-0.0188496 1.21834e-10
+-0.0125664 9.43456e-11
+-0.00628319 5.43588e-11
+0 4.73317e-30
+
+0 4.73317e-30
+0.00628319 5.43586e-11
+0.0125664 9.43456e-11
+0.0188496 1.21834e-10
+0.0251327 1.38538e-10
+0.0314159 1.46024e-10
+0.0376991 1.4572e-10
+0.0439823 1.38922e-10
+0.0502655 1.26806e-10
+0.0565487 1.1043e-10
+0.0628319 9.07474e-11
+0.069115 6.86126e-11
+0.0753982 4.47856e-11
+0.0816814 1.994e-11
+0.0879646 5.33017e-12
+0.0942478 3.0506e-11
+0.100531 5.51371e-11
+0.106814 7.88373e-11
+0.113097 1.01278e-10
+0.119381 1.22187e-10
+0.125664 1.41338e-10
+0.131947 1.58554e-10
+0.13823 1.73695e-10
+0.144513 1.86663e-10
+0.150796 1.97391e-10
+0.15708 2.05843e-10
+0.163363 2.12012e-10
+0.169646 2.15914e-10
+0.175929 2.17588e-10
+0.182212 2.17092e-10
+0.188496 2.14501e-10
+0.194779 2.09904e-10
+0.201062 2.03404e-10
+0.207345 1.95111e-10
+0.213628 1.85149e-10
+0.219911 1.73644e-10
+0.226195 1.60731e-10
+0.232478 1.46548e-10
+0.238761 1.31235e-10
+0.245044 1.14934e-10
+0.251327 9.77889e-11
+0.257611 7.99407e-11
+0.263894 6.15302e-11
+0.270177 4.26959e-11
+0.27646 2.3573e-11
+0.282743 4.29301e-12
+0.289027 1.50165e-11
+0.29531 3.42334e-11
+0.301593 5.32401e-11
+0.307876 7.19252e-11
+0.314159 9.01828e-11
+0.320442 1.07914e-10
+0.326726 1.25024e-10
+0.333009 1.41429e-10
+0.339292 1.57047e-10
+0.345575 1.71807e-10
+0.351858 1.85642e-10
+0.358142 1.98494e-10
+0.364425 2.10309e-10
+0.370708 2.21043e-10
+0.376991 2.30657e-10
+0.383274 2.3912e-10
+0.389557 2.46404e-10
+0.395841 2.52493e-10
+0.402124 2.57371e-10
+0.408407 2.61033e-10
+0.41469 2.63476e-10
+0.420973 2.64707e-10
+0.427257 2.64733e-10
+0.43354 2.63569e-10
+0.439823 2.61236e-10
+0.446106 2.57757e-10
+0.452389 2.53161e-10
+0.458673 2.47481e-10
+0.464956 2.40752e-10
+0.471239 2.33014e-10
+0.477522 2.24311e-10
+0.483805 2.14688e-10
+0.490088 2.04194e-10
+0.496372 1.9288e-10
+0.502655 1.808e-10
+0.508938 1.68008e-10
+0.515221 1.54562e-10
+0.521504 1.4052e-10
+0.527788 1.2594e-10
+0.534071 1.10883e-10
+0.540354 9.54095e-11
+0.546637 7.95811e-11
+0.55292 6.3459e-11
+0.559203 4.71047e-11
+0.565487 3.05785e-11
+0.57177 1.39417e-11
+0.578053 2.74603e-12
+0.584336 1.94254e-11
+0.590619 3.60387e-11
+0.596903 5.25284e-11
+0.603186 6.88396e-11
+0.609469 8.49177e-11
+0.615752 1.0071e-10
+0.622035 1.16167e-10
+0.628319 1.31238e-10
+0.634602 1.45878e-10
+0.640885 1.6004e-10
+0.647168 1.73683e-10
+0.653451 1.86767e-10
+0.659734 1.99253e-10
+0.666018 2.11106e-10
+0.672301 2.22292e-10
+0.678584 2.32781e-10
+0.684867 2.42545e-10
+0.69115 2.51558e-10
+0.697434 2.59797e-10
+0.703717 2.67243e-10
+0.71 2.73877e-10
+0.716283 2.79685e-10
+0.722566 2.84654e-10
+0.728849 2.88774e-10
+0.735133 2.92039e-10
+0.741416 2.94443e-10
+0.747699 2.95985e-10
+0.753982 2.96665e-10
+0.760265 2.96486e-10
+0.766549 2.95453e-10
+0.772832 2.93574e-10
+0.779115 2.90859e-10
+0.785398 2.8732e-10
+0.791681 2.82972e-10
+0.797965 2.7783e-10
+0.804248 2.71913e-10
+0.810531 2.65241e-10
+0.816814 2.57838e-10
+0.823097 2.49726e-10
+0.82938 2.40931e-10
+0.835664 2.31481e-10
+0.841947 2.21403e-10
+0.84823 2.10729e-10
+0.854513 1.9949e-10
+0.860796 1.87718e-10
+0.86708 1.75446e-10
+0.873363 1.6271e-10
+0.879646 1.49545e-10
+0.885929 1.35987e-10
+0.892212 1.22074e-10
+0.898495 1.07843e-10
+0.904779 9.33322e-11
+0.911062 7.85801e-11
+0.917345 6.36254e-11
+0.923628 4.85075e-11
+0.929911 3.32654e-11
+0.936195 1.7938e-11
+0.942478 2.56428e-12
+0.948761 1.28162e-11
+0.955044 2.81652e-11
+0.961327 4.34449e-11
+0.967611 5.86173e-11
+0.973894 7.36449e-11
+0.980177 8.84918e-11
+0.98646 1.03121e-10
+0.992743 1.17498e-10
+0.999026 1.31589e-10
+1.00531 1.4536e-10
+1.01159 1.58778e-10
+1.01788 1.71812e-10
+1.02416 1.84433e-10
+1.03044 1.96611e-10
+1.03673 2.08317e-10
+1.04301 2.19527e-10
+1.04929 2.30214e-10
+1.05558 2.40354e-10
+1.06186 2.49925e-10
+1.06814 2.58907e-10
+1.07442 2.6728e-10
+1.08071 2.75025e-10
+1.08699 2.82126e-10
+1.09327 2.88569e-10
+1.09956 2.9434e-10
+1.10584 2.99427e-10
+1.11212 3.03822e-10
+1.11841 3.07514e-10
+1.12469 3.10497e-10
+1.13097 3.12766e-10
+1.13726 3.14319e-10
+1.14354 3.15152e-10
+1.14982 3.15266e-10
+1.15611 3.14661e-10
+1.16239 3.13342e-10
+1.16867 3.11313e-10
+1.17496 3.08579e-10
+1.18124 3.05148e-10
+1.18752 3.0103e-10
+1.19381 2.96235e-10
+1.20009 2.90776e-10
+1.20637 2.84666e-10
+1.21265 2.77919e-10
+1.21894 2.70553e-10
+1.22522 2.62584e-10
+1.2315 2.54031e-10
+1.23779 2.44915e-10
+1.24407 2.35257e-10
+1.25035 2.25079e-10
+1.25664 2.14404e-10
+1.26292 2.03257e-10
+1.2692 1.91663e-10
+1.27549 1.79647e-10
+1.28177 1.67238e-10
+1.28805 1.54463e-10
+1.29434 1.4135e-10
+1.30062 1.27928e-10
+1.3069 1.14227e-10
+1.31319 1.00278e-10
+1.31947 8.61105e-11
+1.32575 7.17558e-11
+1.33204 5.72454e-11
+1.33832 4.26114e-11
+1.3446 2.78846e-11
+1.35088 1.30976e-11
+1.35717 1.71796e-12
+1.36345 1.65297e-11
+1.36973 3.13063e-11
+1.37602 4.60157e-11
+1.3823 6.06263e-11
+1.38858 7.51073e-11
+1.39487 8.94271e-11
+1.40115 1.03556e-10
+1.40743 1.17463e-10
+1.41372 1.31119e-10
+1.42 1.44496e-10
+1.42628 1.57564e-10
+1.43257 1.70296e-10
+1.43885 1.82665e-10
+1.44513 1.94646e-10
+1.45142 2.06212e-10
+1.4577 2.17339e-10
+1.46398 2.28005e-10
+1.47027 2.38187e-10
+1.47655 2.47863e-10
+1.48283 2.57013e-10
+1.48911 2.65617e-10
+1.4954 2.73659e-10
+1.50168 2.81121e-10
+1.50796 2.87987e-10
+1.51425 2.94243e-10
+1.52053 2.99876e-10
+1.52681 3.04874e-10
+1.5331 3.09228e-10
+1.53938 3.12927e-10
+1.54566 3.15964e-10
+1.55195 3.18333e-10
+1.55823 3.20028e-10
+1.56451 3.21047e-10
+1.5708 3.21387e-10
+1.57708 3.21047e-10
+1.58336 3.20028e-10
+1.58965 3.18333e-10
+1.59593 3.15964e-10
+1.60221 3.12927e-10
+1.6085 3.09228e-10
+1.61478 3.04874e-10
+1.62106 2.99876e-10
+1.62734 2.94243e-10
+1.63363 2.87987e-10
+1.63991 2.81121e-10
+1.64619 2.73659e-10
+1.65248 2.65618e-10
+1.65876 2.57013e-10
+1.66504 2.47863e-10
+1.67133 2.38187e-10
+1.67761 2.28005e-10
+1.68389 2.17339e-10
+1.69018 2.06212e-10
+1.69646 1.94646e-10
+1.70274 1.82665e-10
+1.70903 1.70296e-10
+1.71531 1.57564e-10
+1.72159 1.44496e-10
+1.72788 1.31119e-10
+1.73416 1.17463e-10
+1.74044 1.03556e-10
+1.74673 8.94271e-11
+1.75301 7.51071e-11
+1.75929 6.06265e-11
+1.76558 4.60157e-11
+1.77186 3.13064e-11
+1.77814 1.65299e-11
+1.78442 1.71796e-12
+1.79071 1.30976e-11
+1.79699 2.78846e-11
+1.80327 4.26114e-11
+1.80956 5.72453e-11
+1.81584 7.17558e-11
+1.82212 8.61105e-11
+1.82841 1.00278e-10
+1.83469 1.14227e-10
+1.84097 1.27928e-10
+1.84726 1.41349e-10
+1.85354 1.54463e-10
+1.85982 1.67238e-10
+1.86611 1.79647e-10
+1.87239 1.91663e-10
+1.87867 2.03257e-10
+1.88496 2.14404e-10
+1.89124 2.25079e-10
+1.89752 2.35257e-10
+1.90381 2.44915e-10
+1.91009 2.54031e-10
+1.91637 2.62584e-10
+1.92265 2.70552e-10
+1.92894 2.77919e-10
+1.93522 2.84665e-10
+1.9415 2.90776e-10
+1.94779 2.96235e-10
+1.95407 3.0103e-10
+1.96035 3.05148e-10
+1.96664 3.08579e-10
+1.97292 3.11312e-10
+1.9792 3.13342e-10
+1.98549 3.14661e-10
+1.99177 3.15265e-10
+1.99805 3.15152e-10
+2.00434 3.14319e-10
+2.01062 3.12766e-10
+2.0169 3.10497e-10
+2.02319 3.07513e-10
+2.02947 3.03821e-10
+2.03575 2.99427e-10
+2.04204 2.9434e-10
+2.04832 2.88569e-10
+2.0546 2.82126e-10
+2.06088 2.75025e-10
+2.06717 2.6728e-10
+2.07345 2.58907e-10
+2.07973 2.49926e-10
+2.08602 2.40354e-10
+2.0923 2.30213e-10
+2.09858 2.19527e-10
+2.10487 2.08317e-10
+2.11115 1.9661e-10
+2.11743 1.84433e-10
+2.12372 1.71812e-10
+2.13 1.58777e-10
+2.13628 1.45359e-10
+2.14257 1.31589e-10
+2.14885 1.17498e-10
+2.15513 1.03121e-10
+2.16142 8.84913e-11
+2.1677 7.3645e-11
+2.17398 5.86174e-11
+2.18027 4.3445e-11
+2.18655 2.81649e-11
+2.19283 1.28161e-11
+2.19911 2.56462e-12
+2.2054 1.79382e-11
+2.21168 3.32655e-11
+2.21796 4.85078e-11
+2.22425 6.36255e-11
+2.23053 7.85801e-11
+2.23681 9.33322e-11
+2.2431 1.07843e-10
+2.24938 1.22074e-10
+2.25566 1.35988e-10
+2.26195 1.49545e-10
+2.26823 1.6271e-10
+2.27451 1.75446e-10
+2.2808 1.87718e-10
+2.28708 1.9949e-10
+2.29336 2.10729e-10
+2.29965 2.21403e-10
+2.30593 2.31481e-10
+2.31221 2.40931e-10
+2.3185 2.49726e-10
+2.32478 2.57838e-10
+2.33106 2.65242e-10
+2.33734 2.71913e-10
+2.34363 2.7783e-10
+2.34991 2.82972e-10
+2.35619 2.8732e-10
+2.36248 2.90859e-10
+2.36876 2.93574e-10
+2.37504 2.95453e-10
+2.38133 2.96486e-10
+2.38761 2.96665e-10
+2.39389 2.95985e-10
+2.40018 2.94443e-10
+2.40646 2.92039e-10
+2.41274 2.88774e-10
+2.41903 2.84654e-10
+2.42531 2.79685e-10
+2.43159 2.73877e-10
+2.43788 2.67243e-10
+2.44416 2.59797e-10
+2.45044 2.51558e-10
+2.45673 2.42545e-10
+2.46301 2.32781e-10
+2.46929 2.22292e-10
+2.47558 2.11106e-10
+2.48186 1.99253e-10
+2.48814 1.86767e-10
+2.49442 1.73684e-10
+2.50071 1.6004e-10
+2.50699 1.45878e-10
+2.51327 1.31238e-10
+2.51956 1.16167e-10
+2.52584 1.0071e-10
+2.53212 8.49177e-11
+2.53841 6.88397e-11
+2.54469 5.25286e-11
+2.55097 3.60391e-11
+2.55726 1.94258e-11
+2.56354 2.74636e-12
+2.56982 1.39414e-11
+2.57611 3.05782e-11
+2.58239 4.71043e-11
+2.58867 6.34589e-11
+2.59496 7.95811e-11
+2.60124 9.54093e-11
+2.60752 1.10882e-10
+2.61381 1.2594e-10
+2.62009 1.40519e-10
+2.62637 1.54562e-10
+2.63265 1.68008e-10
+2.63894 1.808e-10
+2.64522 1.9288e-10
+2.6515 2.04194e-10
+2.65779 2.14687e-10
+2.66407 2.2431e-10
+2.67035 2.33014e-10
+2.67664 2.40751e-10
+2.68292 2.4748e-10
+2.6892 2.53161e-10
+2.69549 2.57757e-10
+2.70177 2.61236e-10
+2.70805 2.63569e-10
+2.71434 2.64733e-10
+2.72062 2.64706e-10
+2.7269 2.63476e-10
+2.73319 2.61033e-10
+2.73947 2.57371e-10
+2.74575 2.52492e-10
+2.75204 2.46404e-10
+2.75832 2.3912e-10
+2.7646 2.30657e-10
+2.77088 2.21043e-10
+2.77717 2.10309e-10
+2.78345 1.98494e-10
+2.78973 1.85642e-10
+2.79602 1.71807e-10
+2.8023 1.57047e-10
+2.80858 1.41429e-10
+2.81487 1.25024e-10
+2.82115 1.07913e-10
+2.82743 9.01826e-11
+2.83372 7.19251e-11
+2.84 5.32401e-11
+2.84628 3.42335e-11
+2.85257 1.50163e-11
+2.85885 4.29323e-12
+2.86513 2.35733e-11
+2.87142 4.2696e-11
+2.8777 6.15306e-11
+2.88398 7.99409e-11
+2.89027 9.77891e-11
+2.89655 1.14934e-10
+2.90283 1.31235e-10
+2.90911 1.46548e-10
+2.9154 1.60731e-10
+2.92168 1.73644e-10
+2.92796 1.85149e-10
+2.93425 1.95111e-10
+2.94053 2.03404e-10
+2.94681 2.09904e-10
+2.9531 2.14502e-10
+2.95938 2.17092e-10
+2.96566 2.17588e-10
+2.97195 2.15914e-10
+2.97823 2.12012e-10
+2.98451 2.05843e-10
+2.9908 1.97391e-10
+2.99708 1.86663e-10
+3.00336 1.73696e-10
+3.00965 1.58554e-10
+3.01593 1.41339e-10
+3.02221 1.22187e-10
+3.0285 1.01279e-10
+3.03478 7.88374e-11
+3.04106 5.51377e-11
+3.04734 3.05063e-11
+3.05363 5.3305e-12
+3.05991 1.99399e-11
+3.06619 4.47851e-11
+3.07248 6.86125e-11
+3.07876 9.07472e-11
+3.08504 1.10429e-10
+3.09133 1.26805e-10
+3.09761 1.38922e-10
+3.10389 1.4572e-10
+3.11018 1.46024e-10
+3.11646 1.38537e-10
+3.12274 1.21834e-10
+3.12903 9.43455e-11
+3.13531 5.43586e-11
+3.14159 1.22465e-16
+
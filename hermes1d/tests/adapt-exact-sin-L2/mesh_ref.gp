@@ -0,0 +1,20 @@
+-3.14159 0
+-3.14159 11
+-1.5708 11
+-1.5708 0
+
+-1.5708 0
+-1.5708 11
+0 11
+0 0
+
+0 0
+0 11
+1.5708 11
+1.5708 0
+
+1.5708 0
+1.5708 11
+3.14159 11
+3.14159 0
+
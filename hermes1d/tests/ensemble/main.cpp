@@ -0,0 +1,125 @@
+#include "hermes1d.h"
+
+// This test solves the parameter-dependent problem 
+// -u'' = a*sin(x) in (0, pi), u(0) = u(pi) = 0, 
+// with the exact solution a*sin(x), for several values of a 
+// at once by solve_linear_ensemble(), and compares the results 
+// with individual Newton solves.
+
+#define ERROR_SUCCESS                               0
+#define ERROR_FAILURE                               -1
+
+// General input:
+static int N_eq = 1;
+int N_elem = 10;                        // Number of elements
+double A = 0, B = M_PI;                 // Domain end points
+int P_init = 3;                         // Initial polynomal degree
+
+// Newton's method
+const double NEWTON_TOL = 1e-10;
+const int NEWTON_MAXITER = 150;
+
+// Parameter values
+const int N_SAMPLES = 4;
+double PARAMS[N_SAMPLES] = {1, -2, 0.5, 10};
+
+// Parameter used when the forms get no user data
+double A_global = 1;
+
+// Exact solution (for A_global)
+double exact_sol(double x, double u[MAX_EQN_NUM], double dudx[MAX_EQN_NUM]) {
+  u[0] = A_global*sin(x);
+  dudx[0] = A_global*cos(x);
+}
+
+// ********************************************************************
+
+// bilinear form for the Jacobi matrix 
+double jacobian(int num, double *x, double *weights, 
+                double *u, double *dudx, double *v, double *dvdx, 
+                double u_prev[MAX_SLN_NUM][MAX_EQN_NUM][MAX_QUAD_PTS_NUM], 
+                double du_prevdx[MAX_SLN_NUM][MAX_EQN_NUM][MAX_QUAD_PTS_NUM], 
+                void *user_data)
+{
+  double val = 0;
+  for(int i = 0; i<num; i++) {
+    val += dudx[i]*dvdx[i]*weights[i];
+  }
+  return val;
+};
+
+// form for the residual vector, the parameter a is passed 
+// in user_data
+double residual(int num, double *x, double *weights, 
+                double u_prev[MAX_SLN_NUM][MAX_EQN_NUM][MAX_QUAD_PTS_NUM], 
+                double du_prevdx[MAX_SLN_NUM][MAX_EQN_NUM][MAX_QUAD_PTS_NUM],  
+                double *v, double *dvdx, void *user_data)
+{
+  double a = user_data ? *(double*)user_data : A_global;
+  double val = 0;
+  for(int i = 0; i<num; i++) {
+    val += (du_prevdx[0][0][i]*dvdx[i] - a*sin(x[i])*v[i])*weights[i];
+  }
+  return val;
+};
+
+Mesh *create_mesh()
+{
+  Mesh *mesh = new Mesh(A, B, N_elem, P_init, N_eq);
+  mesh->set_bc_left_dirichlet(0, 0);
+  mesh->set_bc_right_dirichlet(0, 0);
+  mesh->assign_dofs();
+  return mesh;
+}
+
+/******************************************************************************/
+int main() {
+  DiscreteProblem *dp = new DiscreteProblem();
+  dp->add_matrix_form(0, 0, jacobian);
+  dp->add_vector_form(0, residual);
+
+  // all parameter values at once
+  Mesh *mesh = create_mesh();
+  int n_dof = mesh->get_n_dof();
+  printf("N_dof = %d\n", n_dof);
+  void *user_data[N_SAMPLES];
+  for (int k=0; k < N_SAMPLES; k++) user_data[k] = &PARAMS[k];
+  double *y_ens = new double[n_dof*N_SAMPLES];
+  solve_linear_ensemble(dp, mesh, N_SAMPLES, user_data, y_ens);
+  delete mesh;
+
+  int success = 1;
+  double *y = new double[n_dof];
+  for (int k=0; k < N_SAMPLES; k++) {
+    A_global = PARAMS[k];
+    // reference solution by Newton's method
+    mesh = create_mesh();
+    newton(dp, mesh, NULL, NEWTON_TOL, NEWTON_MAXITER, false);
+    copy_mesh_to_vector(mesh, y);
+    double err_newton = calc_error_exact(1, mesh, exact_sol);
+    // ensemble solution
+    double diff = 0;
+    for (int i=0; i < n_dof; i++) {
+      diff = std::max(diff, fabs(y_ens[i*N_SAMPLES + k] - y[i]));
+      y[i] = y_ens[i*N_SAMPLES + k];
+    }
+    copy_vector_to_mesh(y, mesh);
+    double err = calc_error_exact(1, mesh, exact_sol);
+    printf("a = %g: H1 error = %g (Newton %g), diff to Newton = %g\n", 
+           PARAMS[k], err, err_newton, diff);
+    if (diff > 1e-10 || fabs(err - err_newton) > 1e-8) success = 0;
+    delete mesh;
+  }
+  delete [] y;
+  delete [] y_ens;
+  delete dp;
+
+  if (success) {
+    printf("Success!\n");
+    return ERROR_SUCCESS;
+  }
+  else {
+    printf("Failure!\n");
+    return ERROR_FAILURE;
+  }
+}
@@ -0,0 +1,128 @@
+#include "hermes1d.h"
+
+// This test solves the nonlinear nonsymmetric problem 
+// -u'' + K*u' + u^3 = f in (0, pi), u(0) = u(pi) = 0, 
+// with the exact solution sin(x), by jfnk_gmres() with all 
+// available preconditioners, and compares the results with 
+// Newton's method.
+
+#define ERROR_SUCCESS                               0
+#define ERROR_FAILURE                               -1
+
+// General input:
+static int N_eq = 1;
+int N_elem = 10;                        // Number of elements
+double A = 0, B = M_PI;                 // Domain end points
+int P_init = 3;                         // Initial polynomal degree
+double K = 5;                           // Convection coefficient
+
+// Newton's method
+const double NEWTON_TOL = 1e-10;
+const int NEWTON_MAXITER = 150;
+
+// JFNK
+const double MATRIX_SOLVER_TOL = 1e-8;
+const int MATRIX_SOLVER_MAXITER = 500;
+const double JFNK_EPSILON = 1e-6;
+const double JFNK_TOL = 1e-8;
+const int JFNK_MAXITER = 50;
+
+// Function f(x)
+double f(double x) {
+  return sin(x) + K*cos(x) + pow(sin(x), 3);
+}
+
+// Exact solution
+double exact_sol(double x, double u[MAX_EQN_NUM], double dudx[MAX_EQN_NUM]) {
+  u[0] = sin(x);
+  dudx[0] = cos(x);
+}
+
+// ********************************************************************
+
+// bilinear form for the Jacobi matrix 
+double jacobian(int num, double *x, double *weights, 
+                double *u, double *dudx, double *v, double *dvdx, 
+                double u_prev[MAX_SLN_NUM][MAX_EQN_NUM][MAX_QUAD_PTS_NUM], 
+                double du_prevdx[MAX_SLN_NUM][MAX_EQN_NUM][MAX_QUAD_PTS_NUM], 
+                void *user_data)
+{
+  double val = 0;
+  for(int i = 0; i<num; i++) {
+    val += (dudx[i]*dvdx[i] + K*dudx[i]*v[i] 
+            + 3*u_prev[0][0][i]*u_prev[0][0][i]*u[i]*v[i])*weights[i];
+  }
+  return val;
+};
+
+// (nonlinear) form for the residual vector
+double residual(int num, double *x, double *weights, 
+                double u_prev[MAX_SLN_NUM][MAX_EQN_NUM][MAX_QUAD_PTS_NUM], 
+                double du_prevdx[MAX_SLN_NUM][MAX_EQN_NUM][MAX_QUAD_PTS_NUM],  
+                double *v, double *dvdx, void *user_data)
+{
+  double val = 0;
+  for(int i = 0; i<num; i++) {
+    double u = u_prev[0][0][i];
+    val += (du_prevdx[0][0][i]*dvdx[i] + K*du_prevdx[0][0][i]*v[i] 
+            + u*u*u*v[i] - f(x[i])*v[i])*weights[i];
+  }
+  return val;
+};
+
+Mesh *create_mesh()
+{
+  Mesh *mesh = new Mesh(A, B, N_elem, P_init, N_eq);
+  mesh->set_bc_left_dirichlet(0, 0);
+  mesh->set_bc_right_dirichlet(0, 0);
+  mesh->assign_dofs();
+  return mesh;
+}
+
+/******************************************************************************/
+int main() {
+  DiscreteProblem *dp = new DiscreteProblem();
+  dp->add_matrix_form(0, 0, jacobian);
+  dp->add_vector_form(0, residual);
+
+  // reference solution by Newton's method
+  Mesh *mesh = create_mesh();
+  int n_dof = mesh->get_n_dof();
+  printf("N_dof = %d\n", n_dof);
+  newton(dp, mesh, NULL, NEWTON_TOL, NEWTON_MAXITER, false);
+  double *y_newton = new double[n_dof];
+  copy_mesh_to_vector(mesh, y_newton);
+  double err_newton = calc_error_exact(1, mesh, exact_sol);
+  printf("Newton: H1 error = %g\n", err_newton);
+  delete mesh;
+
+  int success = 1;
+  int precond[3] = {JFNK_PRECOND_NONE, JFNK_PRECOND_BLOCK_DIAG, 
+                    JFNK_PRECOND_JACOBIAN};
+  double *y = new double[n_dof];
+  for (int k=0; k < 3; k++) {
+    mesh = create_mesh();
+    jfnk_gmres(dp, mesh, MATRIX_SOLVER_TOL, MATRIX_SOLVER_MAXITER, 
+               JFNK_EPSILON, JFNK_TOL, JFNK_MAXITER, precond[k], 2, 20, false);
+    copy_mesh_to_vector(mesh, y);
+    double diff = 0;
+    for (int i=0; i < n_dof; i++) diff = std::max(diff, fabs(y[i] - y_newton[i]));
+    double err = calc_error_exact(1, mesh, exact_sol);
+    printf("JFNK-GMRES (precond %d): H1 error = %g, diff to Newton = %g\n", 
+           precond[k], err, diff);
+    if (diff > 1e-6 || fabs(err - err_newton) > 1e-6) success = 0;
+    delete mesh;
+  }
+  delete [] y;
+  delete [] y_newton;
+  delete dp;
+
+  if (success) {
+    printf("Success!\n");
+    return ERROR_SUCCESS;
+  }
+  else {
+    printf("Failure!\n");
+    return ERROR_FAILURE;
+  }
+}
@@ -240,6 +240,8 @@ cdef extern from "hermes2d.h":
         void copy(c_Solution *s)
         void set_fe_solution(c_H1Space *s, c_PrecalcShapeset *pss, scalar *vec)
         void get_fe_solution(int *Ylen, scalar **Y)
+        scalar *get_mono_coefs()
+        int get_num_coefs()
     c_Solution *new_Solution "new Solution" ()
 
     cdef struct c_VonMisesFilter "VonMisesFilter"
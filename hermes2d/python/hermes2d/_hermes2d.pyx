@@ -1,4 +1,4 @@
-from _hermes_common cimport c2numpy_double, c2numpy_int
+from _hermes_common cimport c2numpy_double, c2numpy_int, c2numpy_double_view
 
 H2D_FN_DX = c_H2D_FN_DX
 H2D_FN_DY = c_H2D_FN_DY
@@ -1022,6 +1022,20 @@ cdef class Solution(MeshFunction):
         #(<c_Solution *>(self.thisptr)).set_fe_solution(s.thisptr, pss.thisptr,
         #        pvec)
 
+    def get_mono_coefs(self):
+        """
+        Returns the monomial coefficients of the solution as a numpy array.
+
+        The array shares the memory with the solution (no data is copied), so
+        it is only valid until the solution is set again (e.g. by copy() or
+        set_zero()), which reallocates the coefficients.
+        """
+        cdef c_Solution *s = <c_Solution *>(self.thisptr)
+        cdef scalar *coefs = s.get_mono_coefs()
+        if coefs == NULL:
+            raise Exception("The solution has no coefficients.")
+        return c2numpy_double_view(coefs, s.get_num_coefs(), self)
+
     def plot(self, *args, **kwargs):
         """
         Plots the solution and shows it to the user.
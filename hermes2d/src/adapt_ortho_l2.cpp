@@ -637,15 +637,11 @@ scalar L2OrthoHP::eval_error(biform_val_t bi_fn, biform_ord_t bi_ord,
 
   // eval the form
   Quad2D* quad = sln1->get_quad_2d();
-  double3* pt = quad->get_points(order);
   int np = quad->get_num_points(order);
 
   // init geometry and jacobian*weights
   Geom<double>* e = init_geom_vol(rrv1, order);
-  double* jac = rrv1->get_jacobian(order);
-  double* jwt = new double[np];
-  for(int i = 0; i < np; i++)
-    jwt[i] = pt[i][2] * jac[i];
+  double* jwt = init_jwt_vol(rrv1, order);
 
   // function values and values of external functions
   Func<scalar>* err1 = init_fn(sln1, rv1, order);
@@ -697,15 +693,11 @@ scalar L2OrthoHP::eval_norm(biform_val_t bi_fn, biform_ord_t bi_ord,
 
   // eval the form
   Quad2D* quad = rsln1->get_quad_2d();
-  double3* pt = quad->get_points(order);
   int np = quad->get_num_points(order);
 
   // init geometry and jacobian*weights
   Geom<double>* e = init_geom_vol(rrv1, order);
-  double* jac = rrv1->get_jacobian(order);
-  double* jwt = new double[np];
-  for(int i = 0; i < np; i++)
-    jwt[i] = pt[i][2] * jac[i];
+  double* jwt = init_jwt_vol(rrv1, order);
 
   // function values
   Func<scalar>* v1 = init_fn(rsln1, rrv1, order);
@@ -26,6 +26,7 @@
 #include "config.h"
 #include "neighbor.h"
 #include "limit_order.h"
+#include "weakform_parser.h"
 #include <algorithm>
 #include "views/view.h"
 #include "views/scalar_view.h"
@@ -45,7 +46,7 @@ void DiscreteProblem::init(WeakForm* wf_, CommonSolver* solver_)
 {
   if (wf_ == NULL) error("DiscreteProblem: a weak form must be given.");
   this->wf = wf_;
-  this->solver_default = new CommonSolverSciPyUmfpack();
+  this->solver_default = create_direct_solver();
   this->solver = (solver_) ? solver_ : solver_default;
   this->wf_seq = -1;
 
@@ -300,6 +301,9 @@ void DiscreteProblem::assemble(Vector* init_vec, Matrix* mat_ext, Vector* dir_ex
   mat_size = 0;
   get_matrix_buffer(9);
 
+  // The forms or the weak form may have changed since the last assembling.
+  cache_ord.clear();
+
   // obtain a list of assembling stages
   std::vector<WeakForm::Stage> stages;
   // Returns assembling stages with correct meshes, ext_functions that are needed in a particular stage.
@@ -784,6 +788,53 @@ Func<double>* DiscreteProblem::get_fn(PrecalcShapeset *fu, RefMap *rm, const int
   return cache_fn[key];
 }
 
+// Values of a previous solution or an external function (fill in the cache). They
+// depend only on the active element of the function, so all pairs of shape functions
+// and all forms on the element share them.
+Func<scalar>* DiscreteProblem::get_fn(MeshFunction *fu, const int order)
+{
+  std::pair<MeshFunction*, int> key(fu, order);
+  std::map<std::pair<MeshFunction*, int>, Func<scalar>*>::iterator it = cache_ext_fn.find(key);
+  if (it != cache_ext_fn.end()) return it->second;
+
+  // The reference map is not used for mesh functions.
+  return cache_ext_fn[key] = init_fn(fu, NULL, order);
+}
+
+// Like init_ext_fns(), but the functions are owned by the cache: free the result
+// only by "delete [] ext->fn; delete ext;".
+ExtData<scalar>* DiscreteProblem::get_ext_fns(std::vector<MeshFunction *> &ext, const int order)
+{
+  ExtData<scalar>* ext_data = new ExtData<scalar>;
+  Func<scalar>** ext_fn = new Func<scalar>*[ext.size()];
+  for (unsigned int i = 0; i < ext.size(); i++)
+    ext_fn[i] = get_fn(ext[i], order);
+  ext_data->nf = ext.size();
+  ext_data->fn = ext_fn;
+
+  return ext_data;
+}
+
+// Orders of the arguments of the ord() callback of a form: previous solutions,
+// shape functions (fu is NULL for vector forms) and external functions. For
+// surface forms (edge >= 0) the orders on the edge are used.
+void DiscreteProblem::init_ord_key(Tuple<Solution *> &sln, int inc, PrecalcShapeset *fu, PrecalcShapeset *fv,
+                                   std::vector<MeshFunction *> &ext, int edge)
+{
+  ord_key.clear();
+  bool have_sln = (sln != Tuple<Solution *>());
+  for (int i = 0; i < wf->neq; i++)
+  {
+    Solution* u = have_sln ? sln[i] : NULL;
+    if (u == NULL) ord_key.push_back(0);
+    else ord_key.push_back((edge < 0 ? u->get_fn_order() : u->get_edge_fn_order(edge)) + inc);
+  }
+  if (fu != NULL) ord_key.push_back((edge < 0 ? fu->get_fn_order() : fu->get_edge_fn_order(edge)) + inc);
+  ord_key.push_back((edge < 0 ? fv->get_fn_order() : fv->get_edge_fn_order(edge)) + inc);
+  for (unsigned int i = 0; i < ext.size(); i++)
+    ord_key.push_back(edge < 0 ? ext[i]->get_fn_order() : ext[i]->get_edge_fn_order(edge));
+}
+
 // Caching transformed values
 void DiscreteProblem::init_cache()
 {
@@ -809,6 +860,11 @@ void DiscreteProblem::delete_cache()
     (it->second)->free_fn(); delete (it->second);
   }
   cache_fn.clear();
+  for (std::map<std::pair<MeshFunction*, int>, Func<scalar>*>::iterator it = cache_ext_fn.begin(); it != cache_ext_fn.end(); it++)
+  {
+    (it->second)->free_fn(); delete (it->second);
+  }
+  cache_ext_fn.clear();
 }
 
 //// evaluation of forms, general case ///////////////////////////////////////////////////////////
@@ -819,66 +875,55 @@ scalar DiscreteProblem::eval_form(WeakForm::MatrixFormVol *mfv, Tuple<Solution *
 {
   // Determine the integration order.
   int inc = (fu->get_num_components() == 2) ? 1 : 0;
-  
-  // Order of solutions from the previous Newton iteration.
-  AUTOLA_OR(Func<Ord>*, oi, wf->neq);
-  //for (int i = 0; i < wf->neq; i++) oi[i] = init_fn_ord(sln[i]->get_fn_order() + inc);
-  if (sln != Tuple<Solution *>()) {
-    for (int i = 0; i < wf->neq; i++) {
-      if (sln[i] != NULL) oi[i] = init_fn_ord(sln[i]->get_fn_order() + inc);
-      else oi[i] = init_fn_ord(0);
-    }
-  }
-  else {
-    for (int i = 0; i < wf->neq; i++) oi[i] = init_fn_ord(0);
+  init_ord_key(sln, inc, fu, fv, mfv->ext, -1);
+
+  // The order of the form depends only on the orders of its arguments, so the
+  // user's ord() callback is evaluated only once for every combination of them.
+  std::map<std::vector<int>, int>& form_ord = cache_ord[mfv];
+  std::map<std::vector<int>, int>::iterator it = form_ord.find(ord_key);
+  if (it == form_ord.end())
+  {
+    // Orders of solutions from the previous Newton iteration and of shape functions.
+    AUTOLA_OR(Func<Ord>*, oi, wf->neq);
+    for (int i = 0; i < wf->neq; i++) oi[i] = init_fn_ord(ord_key[i]);
+    Func<Ord>* ou = init_fn_ord(ord_key[wf->neq]);
+    Func<Ord>* ov = init_fn_ord(ord_key[wf->neq + 1]);
+
+    // Order of additional external functions.
+    ExtData<Ord>* fake_ext = init_ext_fns_ord(mfv->ext);
+
+    // Order of geometric attributes (eg. for multiplication of a solution with coordinates, normals, etc.).
+    double fake_wt = 1.0;
+    Geom<Ord>* fake_e = init_geom_ord();
+
+    // Total order of the matrix form.
+    Ord o = (mfv->compiled != NULL) ? mfv->compiled->ord(1, &fake_wt, oi, ou, ov, fake_e, fake_ext)
+                                    : mfv->ord(1, &fake_wt, oi, ou, ov, fake_e, fake_ext);
+    it = form_ord.insert(std::make_pair(ord_key, o.get_order())).first;
+
+    // Clean up.
+    for (int i = 0; i < wf->neq; i++) { oi[i]->free_ord(); delete oi[i]; }
+    ou->free_ord(); delete ou;
+    ov->free_ord(); delete ov;
+    delete fake_e;
+    fake_ext->free_ord(); delete fake_ext;
   }
-  
-  // Order of shape functions.
-  Func<Ord>* ou = init_fn_ord(fu->get_fn_order() + inc);
-  Func<Ord>* ov = init_fn_ord(fv->get_fn_order() + inc);
-  
-  // Order of additional external functions.
-  ExtData<Ord>* fake_ext = init_ext_fns_ord(mfv->ext);
-  
-  // Order of geometric attributes (eg. for multiplication of a solution with coordinates, normals, etc.).
-  double fake_wt = 1.0;
-  Geom<Ord>* fake_e = init_geom_ord();
-  
-  // Total order of the matrix form.
-  Ord o = mfv->ord(1, &fake_wt, oi, ou, ov, fake_e, fake_ext);
-  
+
   // Increase due to reference map.
   int order = ru->get_inv_ref_order();
-  
-  order += o.get_order();
+
+  order += it->second;
   limit_order_nowarn(order);
   
-  // Clean up.
-  for (int i = 0; i < wf->neq; i++) {  
-    if (oi[i] != NULL) { oi[i]->free_ord(); delete oi[i]; }
-  }
-  if (ou != NULL) {
-    ou->free_ord(); delete ou;
-  }
-  if (ov != NULL) {
-    ov->free_ord(); delete ov;
-  }
-  if (fake_e != NULL) delete fake_e;
-  if (fake_ext != NULL) {fake_ext->free_ord(); delete fake_ext;}
-  
   // Evaluate the form using the quadrature of the just calculated order.
   Quad2D* quad = fu->get_quad_2d();
-  double3* pt = quad->get_points(order);
   int np = quad->get_num_points(order);
 
   // Init geometry and jacobian*weights.
   if (cache_e[order] == NULL)
   {
     cache_e[order] = init_geom_vol(ru, order);
-    double* jac = ru->get_jacobian(order);
-    cache_jwt[order] = new double[np];
-    for(int i = 0; i < np; i++)
-      cache_jwt[order][i] = pt[i][2] * jac[i];
+    cache_jwt[order] = init_jwt_vol(ru, order);
   }
   Geom<double>* e = cache_e[order];
   double* jwt = cache_jwt[order];
@@ -888,7 +933,7 @@ scalar DiscreteProblem::eval_form(WeakForm::MatrixFormVol *mfv, Tuple<Solution *
   //for (int i = 0; i < wf->neq; i++) prev[i]  = init_fn(sln[i], rv, order);
   if (sln != Tuple<Solution *>()) {
     for (int i = 0; i < wf->neq; i++) {
-      if (sln[i] != NULL) prev[i] = init_fn(sln[i], rv, order);
+      if (sln[i] != NULL) prev[i] = get_fn(sln[i], order);
       else prev[i] = NULL;
     }
   }
@@ -898,15 +943,13 @@ scalar DiscreteProblem::eval_form(WeakForm::MatrixFormVol *mfv, Tuple<Solution *
 
   Func<double>* u = get_fn(fu, ru, order);
   Func<double>* v = get_fn(fv, rv, order);
-  ExtData<scalar>* ext = init_ext_fns(mfv->ext, rv, order);
+  ExtData<scalar>* ext = get_ext_fns(mfv->ext, order);
 
-  scalar res = mfv->fn(np, jwt, prev, u, v, e, ext);
+  scalar res = (mfv->compiled != NULL) ? mfv->compiled->fn(np, jwt, prev, u, v, e, ext)
+                                       : mfv->fn(np, jwt, prev, u, v, e, ext);
 
-  // Clean up.
-  for (int i = 0; i < wf->neq; i++) {  
-    if (prev[i] != NULL) prev[i]->free_fn(); delete prev[i]; 
-  }
-  if (ext != NULL) {ext->free(); delete ext;}
+  // Clean up (the values themselves stay in the cache).
+  if (ext != NULL) { delete [] ext->fn; delete ext; }
   return res;
 }
 
@@ -916,62 +959,52 @@ scalar DiscreteProblem::eval_form(WeakForm::VectorFormVol *vfv, Tuple<Solution *
 {
   // Determine the integration order.
   int inc = (fv->get_num_components() == 2) ? 1 : 0;
-  
-  // Order of solutions from the previous Newton iteration.
-  AUTOLA_OR(Func<Ord>*, oi, wf->neq);
-  //for (int i = 0; i < wf->neq; i++) oi[i] = init_fn_ord(sln[i]->get_fn_order() + inc);
-  if (sln != Tuple<Solution *>()) {
-    for (int i = 0; i < wf->neq; i++) {
-      if (sln[i] != NULL) oi[i] = init_fn_ord(sln[i]->get_fn_order() + inc);
-      else oi[i] = init_fn_ord(0);
-    }
-  }
-  else {
-    for (int i = 0; i < wf->neq; i++) oi[i] = init_fn_ord(0);
+  init_ord_key(sln, inc, NULL, fv, vfv->ext, -1);
+
+  // Memoized order of the form, see eval_form(WeakForm::MatrixFormVol *, ...).
+  std::map<std::vector<int>, int>& form_ord = cache_ord[vfv];
+  std::map<std::vector<int>, int>::iterator it = form_ord.find(ord_key);
+  if (it == form_ord.end())
+  {
+    // Orders of solutions from the previous Newton iteration and of shape functions.
+    AUTOLA_OR(Func<Ord>*, oi, wf->neq);
+    for (int i = 0; i < wf->neq; i++) oi[i] = init_fn_ord(ord_key[i]);
+    Func<Ord>* ov = init_fn_ord(ord_key[wf->neq]);
+
+    // Order of additional external functions.
+    ExtData<Ord>* fake_ext = init_ext_fns_ord(vfv->ext);
+
+    // Order of geometric attributes (eg. for multiplication of a solution with coordinates, normals, etc.).
+    double fake_wt = 1.0;
+    Geom<Ord>* fake_e = init_geom_ord();
+
+    // Total order of the vector form.
+    Ord o = (vfv->compiled != NULL) ? vfv->compiled->ord(1, &fake_wt, oi, ov, fake_e, fake_ext)
+                                    : vfv->ord(1, &fake_wt, oi, ov, fake_e, fake_ext);
+    it = form_ord.insert(std::make_pair(ord_key, o.get_order())).first;
+
+    // Clean up.
+    for (int i = 0; i < wf->neq; i++) { oi[i]->free_ord(); delete oi[i]; }
+    ov->free_ord(); delete ov;
+    delete fake_e;
+    fake_ext->free_ord(); delete fake_ext;
   }
-  
-  // Order of the shape function.
-  Func<Ord>* ov = init_fn_ord(fv->get_fn_order() + inc);
-  
-  // Order of additional external functions.
-  ExtData<Ord>* fake_ext = init_ext_fns_ord(vfv->ext);
-  
-  // Order of geometric attributes (eg. for multiplication of a solution with coordinates, normals, etc.).
-  double fake_wt = 1.0;
-  Geom<Ord>* fake_e = init_geom_ord();
-  
-  // Total order of the vector form.
-  Ord o = vfv->ord(1, &fake_wt, oi, ov, fake_e, fake_ext);
-  
+
   // Increase due to reference map.
   int order = rv->get_inv_ref_order();
-  
-  order += o.get_order();
-  limit_order_nowarn(order);
 
-  // Clean up.
-  for (int i = 0; i < wf->neq; i++) { 
-    if (oi[i] != NULL) {
-      oi[i]->free_ord(); delete oi[i]; 
-    }
-  }
-  if (ov != NULL) {ov->free_ord(); delete ov;}
-  if (fake_e != NULL) delete fake_e;
-  if (fake_ext != NULL) {fake_ext->free_ord(); delete fake_ext;}
+  order += it->second;
+  limit_order_nowarn(order);
 
   // Evaluate the form using the quadrature of the just calculated order.
   Quad2D* quad = fv->get_quad_2d();
-  double3* pt = quad->get_points(order);
   int np = quad->get_num_points(order);
 
   // Init geometry and jacobian*weights.
   if (cache_e[order] == NULL)
   {
     cache_e[order] = init_geom_vol(rv, order);
-    double* jac = rv->get_jacobian(order);
-    cache_jwt[order] = new double[np];
-    for(int i = 0; i < np; i++)
-      cache_jwt[order][i] = pt[i][2] * jac[i];
+    cache_jwt[order] = init_jwt_vol(rv, order);
   }
   Geom<double>* e = cache_e[order];
   double* jwt = cache_jwt[order];
@@ -981,7 +1014,7 @@ scalar DiscreteProblem::eval_form(WeakForm::VectorFormVol *vfv, Tuple<Solution *
   //for (int i = 0; i < wf->neq; i++) prev[i]  = init_fn(sln[i], rv, order);
   if (sln != Tuple<Solution *>()) {
     for (int i = 0; i < wf->neq; i++) {
-      if (sln[i] != NULL) prev[i]  = init_fn(sln[i], rv, order);
+      if (sln[i] != NULL) prev[i] = get_fn(sln[i], order);
       else prev[i] = NULL;
     }
   }
@@ -990,17 +1023,13 @@ scalar DiscreteProblem::eval_form(WeakForm::VectorFormVol *vfv, Tuple<Solution *
   }
 
   Func<double>* v = get_fn(fv, rv, order);
-  ExtData<scalar>* ext = init_ext_fns(vfv->ext, rv, order);
+  ExtData<scalar>* ext = get_ext_fns(vfv->ext, order);
 
-  scalar res = vfv->fn(np, jwt, prev, v, e, ext);
+  scalar res = (vfv->compiled != NULL) ? vfv->compiled->fn(np, jwt, prev, v, e, ext)
+                                       : vfv->fn(np, jwt, prev, v, e, ext);
 
-  // Clean up.
-  for (int i = 0; i < wf->neq; i++) { 
-    if (prev[i] != NULL) {
-      prev[i]->free_fn(); delete prev[i]; 
-    }
-  }
-  if (ext != NULL) {ext->free(); delete ext;}
+  // Clean up (the values themselves stay in the cache).
+  if (ext != NULL) { delete [] ext->fn; delete ext; }
   
   return res;
 }
@@ -1011,53 +1040,45 @@ scalar DiscreteProblem::eval_form(WeakForm::MatrixFormSurf *mfs, Tuple<Solution
 {
   // Determine the integration order.
   int inc = (fu->get_num_components() == 2) ? 1 : 0;
-  
-  // Order of solutions from the previous Newton iteration.
-  AUTOLA_OR(Func<Ord>*, oi, wf->neq);
-  //for (int i = 0; i < wf->neq; i++) oi[i] = init_fn_ord(sln[i]->get_fn_order() + inc);
-  if (sln != Tuple<Solution *>()) {
-    for (int i = 0; i < wf->neq; i++) {
-      if (sln[i] != NULL) oi[i] = init_fn_ord(sln[i]->get_edge_fn_order(ep->edge) + inc);
-      else oi[i] = init_fn_ord(0);
-    }
-  }
-  else {
-    for (int i = 0; i < wf->neq; i++) oi[i] = init_fn_ord(0);
+  init_ord_key(sln, inc, fu, fv, mfs->ext, ep->edge);
+
+  // Memoized order of the form, see eval_form(WeakForm::MatrixFormVol *, ...).
+  std::map<std::vector<int>, int>& form_ord = cache_ord[mfs];
+  std::map<std::vector<int>, int>::iterator it = form_ord.find(ord_key);
+  if (it == form_ord.end())
+  {
+    // Orders of solutions from the previous Newton iteration and of shape functions.
+    AUTOLA_OR(Func<Ord>*, oi, wf->neq);
+    for (int i = 0; i < wf->neq; i++) oi[i] = init_fn_ord(ord_key[i]);
+    Func<Ord>* ou = init_fn_ord(ord_key[wf->neq]);
+    Func<Ord>* ov = init_fn_ord(ord_key[wf->neq + 1]);
+
+    // Order of additional external functions.
+    ExtData<Ord>* fake_ext = init_ext_fns_ord(mfs->ext, ep->edge);
+
+    // Order of geometric attributes (eg. for multiplication of a solution with coordinates, normals, etc.).
+    double fake_wt = 1.0;
+    Geom<Ord>* fake_e = init_geom_ord();
+
+    // Total order of the matrix form.
+    Ord o = (mfs->compiled != NULL) ? mfs->compiled->ord(1, &fake_wt, oi, ou, ov, fake_e, fake_ext)
+                                    : mfs->ord(1, &fake_wt, oi, ou, ov, fake_e, fake_ext);
+    it = form_ord.insert(std::make_pair(ord_key, o.get_order())).first;
+
+    // Clean up.
+    for (int i = 0; i < wf->neq; i++) { oi[i]->free_ord(); delete oi[i]; }
+    ou->free_ord(); delete ou;
+    ov->free_ord(); delete ov;
+    delete fake_e;
+    fake_ext->free_ord(); delete fake_ext;
   }
-  
-  // Order of shape functions.
-  Func<Ord>* ou = init_fn_ord(fu->get_edge_fn_order(ep->edge) + inc);
-  Func<Ord>* ov = init_fn_ord(fv->get_edge_fn_order(ep->edge) + inc);
-  
-  // Order of additional external functions.
-  ExtData<Ord>* fake_ext = init_ext_fns_ord(mfs->ext, ep->edge);
-  
-  // Order of geometric attributes (eg. for multiplication of a solution with coordinates, normals, etc.).
-  double fake_wt = 1.0;
-  Geom<Ord>* fake_e = init_geom_ord();
-  
-  // Total order of the matrix form.
-  Ord o = mfs->ord(1, &fake_wt, oi, ou, ov, fake_e, fake_ext);
-  
+
   // Increase due to reference map.
   int order = ru->get_inv_ref_order();
-  
-  order += o.get_order();
+
+  order += it->second;
   limit_order_nowarn(order);
   
-  // Clean up.
-  for (int i = 0; i < wf->neq; i++) {  
-    if (oi[i] != NULL) { oi[i]->free_ord(); delete oi[i]; }
-  }
-  if (ou != NULL) {
-    ou->free_ord(); delete ou;
-  }
-  if (ov != NULL) {
-    ov->free_ord(); delete ov;
-  }
-  if (fake_e != NULL) delete fake_e;
-  if (fake_ext != NULL) {fake_ext->free_ord(); delete fake_ext;}
-  
   // Evaluate the form using the quadrature of the just calculated order.
   Quad2D* quad = fu->get_quad_2d();
   
@@ -1082,7 +1103,7 @@ scalar DiscreteProblem::eval_form(WeakForm::MatrixFormSurf *mfs, Tuple<Solution
   //for (int i = 0; i < wf->neq; i++) prev[i]  = init_fn(sln[i], rv, eo);
   if (sln != Tuple<Solution *>()) {
     for (int i = 0; i < wf->neq; i++) {
-      if (sln[i] != NULL) prev[i]  = init_fn(sln[i], rv, eo);
+      if (sln[i] != NULL) prev[i] = get_fn(sln[i], eo);
       else prev[i] = NULL;
     }
   }
@@ -1092,17 +1113,13 @@ scalar DiscreteProblem::eval_form(WeakForm::MatrixFormSurf *mfs, Tuple<Solution
 
   Func<double>* u = get_fn(fu, ru, eo);
   Func<double>* v = get_fn(fv, rv, eo);
-  ExtData<scalar>* ext = init_ext_fns(mfs->ext, rv, eo);
+  ExtData<scalar>* ext = get_ext_fns(mfs->ext, eo);
 
-  scalar res = mfs->fn(np, jwt, prev, u, v, e, ext);
+  scalar res = (mfs->compiled != NULL) ? mfs->compiled->fn(np, jwt, prev, u, v, e, ext)
+                                       : mfs->fn(np, jwt, prev, u, v, e, ext);
 
-  // Clean up.
-  for (int i = 0; i < wf->neq; i++) { 
-    if (prev[i] != NULL) {
-      prev[i]->free_fn(); delete prev[i]; 
-    }
-  }
-  if (ext != NULL) {ext->free(); delete ext;}
+  // Clean up (the values themselves stay in the cache).
+  if (ext != NULL) { delete [] ext->fn; delete ext; }
   
   return 0.5 * res; // Edges are parameterized from 0 to 1 while integration weights
                     // are defined in (-1, 1). Thus multiplying with 0.5 to correct
@@ -1116,49 +1133,43 @@ scalar DiscreteProblem::eval_form(WeakForm::VectorFormSurf *vfs, Tuple<Solution
 {
   // Determine the integration order.
   int inc = (fv->get_num_components() == 2) ? 1 : 0;
-  
-  // Order of solutions from the previous Newton iteration.
-  AUTOLA_OR(Func<Ord>*, oi, wf->neq);
-  //for (int i = 0; i < wf->neq; i++) oi[i] = init_fn_ord(sln[i]->get_fn_order() + inc);
-  if (sln != Tuple<Solution *>()) {
-    for (int i = 0; i < wf->neq; i++) {
-      if (sln[i] != NULL) oi[i] = init_fn_ord(sln[i]->get_edge_fn_order(ep->edge) + inc);
-      else oi[i] = init_fn_ord(0);
-    }
-  }
-  else {
-    for (int i = 0; i < wf->neq; i++) oi[i] = init_fn_ord(0);
+  init_ord_key(sln, inc, NULL, fv, vfs->ext, ep->edge);
+
+  // Memoized order of the form, see eval_form(WeakForm::MatrixFormVol *, ...).
+  std::map<std::vector<int>, int>& form_ord = cache_ord[vfs];
+  std::map<std::vector<int>, int>::iterator it = form_ord.find(ord_key);
+  if (it == form_ord.end())
+  {
+    // Orders of solutions from the previous Newton iteration and of shape functions.
+    AUTOLA_OR(Func<Ord>*, oi, wf->neq);
+    for (int i = 0; i < wf->neq; i++) oi[i] = init_fn_ord(ord_key[i]);
+    Func<Ord>* ov = init_fn_ord(ord_key[wf->neq]);
+
+    // Order of additional external functions.
+    ExtData<Ord>* fake_ext = init_ext_fns_ord(vfs->ext, ep->edge);
+
+    // Order of geometric attributes (eg. for multiplication of a solution with coordinates, normals, etc.).
+    double fake_wt = 1.0;
+    Geom<Ord>* fake_e = init_geom_ord();
+
+    // Total order of the vector form.
+    Ord o = (vfs->compiled != NULL) ? vfs->compiled->ord(1, &fake_wt, oi, ov, fake_e, fake_ext)
+                                    : vfs->ord(1, &fake_wt, oi, ov, fake_e, fake_ext);
+    it = form_ord.insert(std::make_pair(ord_key, o.get_order())).first;
+
+    // Clean up.
+    for (int i = 0; i < wf->neq; i++) { oi[i]->free_ord(); delete oi[i]; }
+    ov->free_ord(); delete ov;
+    delete fake_e;
+    fake_ext->free_ord(); delete fake_ext;
   }
-  
-  // Order of the shape function.
-  Func<Ord>* ov = init_fn_ord(fv->get_edge_fn_order(ep->edge) + inc);
-  
-  // Order of additional external functions.
-  ExtData<Ord>* fake_ext = init_ext_fns_ord(vfs->ext, ep->edge);
-  
-  // Order of geometric attributes (eg. for multiplication of a solution with coordinates, normals, etc.).
-  double fake_wt = 1.0;
-  Geom<Ord>* fake_e = init_geom_ord();
-  
-  // Total order of the vector form.
-  Ord o = vfs->ord(1, &fake_wt, oi, ov, fake_e, fake_ext);
-  
+
   // Increase due to reference map.
   int order = rv->get_inv_ref_order();
-  
-  order += o.get_order();
+
+  order += it->second;
   limit_order_nowarn(order);
   
-  // Clean up.
-  for (int i = 0; i < wf->neq; i++) { 
-    if (oi[i] != NULL) {
-      oi[i]->free_ord(); delete oi[i]; 
-    }
-  }
-  if (ov != NULL) {ov->free_ord(); delete ov;}
-  if (fake_e != NULL) delete fake_e;
-  if (fake_ext != NULL) {fake_ext->free_ord(); delete fake_ext;}
-  
   // Evaluate the form using the quadrature of the just calculated order.
   Quad2D* quad = fv->get_quad_2d();
   
@@ -1183,7 +1194,7 @@ scalar DiscreteProblem::eval_form(WeakForm::VectorFormSurf *vfs, Tuple<Solution
   //for (int i = 0; i < wf->neq; i++) prev[i]  = init_fn(sln[i], rv, eo);
   if (sln != Tuple<Solution *>()) {
     for (int i = 0; i < wf->neq; i++) {
-      if (sln[i] != NULL) prev[i]  = init_fn(sln[i], rv, eo);
+      if (sln[i] != NULL) prev[i] = get_fn(sln[i], eo);
       else prev[i] = NULL;
     }
   }
@@ -1192,16 +1203,14 @@ scalar DiscreteProblem::eval_form(WeakForm::VectorFormSurf *vfs, Tuple<Solution
   }
 
   Func<double>* v = get_fn(fv, rv, eo);
-  ExtData<scalar>* ext = init_ext_fns(vfs->ext, rv, eo);
+  ExtData<scalar>* ext = get_ext_fns(vfs->ext, eo);
 
-  scalar res = vfs->fn(np, jwt, prev, v, e, ext);
+  scalar res = (vfs->compiled != NULL) ? vfs->compiled->fn(np, jwt, prev, v, e, ext)
+                                       : vfs->fn(np, jwt, prev, v, e, ext);
 
-  for (int i = 0; i < wf->neq; i++) {  
-    if (prev[i] != NULL) {prev[i]->free_fn(); delete prev[i]; }
-  }
-  if (ext != NULL) {ext->free(); delete ext;}
+  // Clean up (the values themselves stay in the cache).
+  if (ext != NULL) { delete [] ext->fn; delete ext; }
   
-  // Clean up.
   return 0.5 * res; // Edges are parameterized from 0 to 1 while integration weights
                     // are defined in (-1, 1). Thus multiplying with 0.5 to correct
                     // the weights.
@@ -1555,7 +1564,7 @@ void project_internal(Tuple<Space *> spaces, WeakForm *wf,
 
   // FIXME: enable other types of matrices and vectors.
   CooMatrix mat(ndof, is_complex);
-  CommonSolverSciPyUmfpack solver;
+  CommonSolver* solver = create_direct_solver();
   Vector* dir = new AVector(ndof, is_complex);
   
   // Allocate the resulting coefficient vector.  
@@ -1573,7 +1582,8 @@ void project_internal(Tuple<Space *> spaces, WeakForm *wf,
       for (int i=0; i < ndof; i++) rhs->add(i, -dir->get(i));
 
   // Calculate the Newton coefficient vector.
-  solver.solve(&mat, rhs);
+  solver->solve(&mat, rhs);
+  delete solver;
 
   // If the user wants the resulting Solutions.
   if (target_slns != Tuple<Solution *>()) {
@@ -1727,11 +1737,11 @@ void init_matrix_solver(MatrixSolverType matrix_solver, int ndof,
                         CommonSolver* &solver, bool is_complex) 
 {
   // Initialize stiffness matrix, load vector, and matrix solver.
-  // UMFpack.
+  // UMFpack (the native sparse LU if hermes_common was built without UMFPACK;
+  // no Python is involved in the solve).
   CooMatrix* mat_umfpack = new CooMatrix(ndof, is_complex);
   Vector* rhs_umfpack = new AVector(ndof, is_complex);
-  CommonSolverSciPyUmfpack* solver_umfpack = new CommonSolverSciPyUmfpack();
-  //CommonSolverSciPyUmfpack* solver_umfpack = new CommonSolverSciPyUmfpack();
+  CommonSolver* solver_umfpack = create_direct_solver();
   // PETSc.
   /* FIXME - PETSc solver needs to be ported from H3D.
   PetscMatrix mat_petsc(ndof);
@@ -168,15 +168,26 @@ protected:
   ExtData<scalar>* init_ext_fns(std::vector<MeshFunction *> &ext, RefMap *rm, const int order);
   ExtData<scalar>* init_ext_fns(std::vector<MeshFunction *> &ext, NeighborSearch* nbs);
   Func<double>* get_fn(PrecalcShapeset *fu, RefMap *rm, const int order);
+  Func<scalar>* get_fn(MeshFunction *fu, const int order);
+  ExtData<scalar>* get_ext_fns(std::vector<MeshFunction *> &ext, const int order);
 
   // Caching transformed values for element
   std::map<PrecalcShapeset::Key, Func<double>*, PrecalcShapeset::Compare> cache_fn;
+  // Values of previous solutions and external functions, by (function, order).
+  std::map<std::pair<MeshFunction*, int>, Func<scalar>*> cache_ext_fn;
   Geom<double>* cache_e[g_max_quad + 1 + 4 * g_max_quad + 4];
   double* cache_jwt[g_max_quad + 1 + 4 * g_max_quad + 4];
 
   void init_cache();
   void delete_cache();
 
+  // Memoized integration orders of the forms (by the form and the orders
+  // of its arguments, see init_ord_key()).
+  std::map<void*, std::map<std::vector<int>, int> > cache_ord;
+  std::vector<int> ord_key;
+  void init_ord_key(Tuple<Solution *> &sln, int inc, PrecalcShapeset *fu, PrecalcShapeset *fv,
+                    std::vector<MeshFunction *> &ext, int edge);
+
   // Evaluation of forms, continuous FEM case.
   scalar eval_form(WeakForm::MatrixFormVol *bf, Tuple<Solution *> sln, PrecalcShapeset *fu, 
                    PrecalcShapeset *fv, RefMap *ru, RefMap *rv);
@@ -23,6 +23,7 @@
 #include "solution.h"
 #include "config.h"
 #include "discrete_problem.h"
+#include "weakform_parser.h"
 
 FeProblem::FeProblem(WeakForm* wf, Tuple<Space *> spaces)
 {
@@ -626,7 +627,8 @@ scalar FeProblem::eval_form(WeakForm::MatrixFormVol *mfv, Tuple<Solution *> u_ex
   
   // Total order of the matrix form.
   double fake_wt = 1.0;
-  Ord o = mfv->ord(1, &fake_wt, oi, ou, ov, fake_e, fake_ext);
+  Ord o = (mfv->compiled != NULL) ? mfv->compiled->ord(1, &fake_wt, oi, ou, ov, fake_e, fake_ext)
+                                  : mfv->ord(1, &fake_wt, oi, ou, ov, fake_e, fake_ext);
   
   // Order increase due to reference map.
   int order = ru->get_inv_ref_order();
@@ -643,17 +645,13 @@ scalar FeProblem::eval_form(WeakForm::MatrixFormVol *mfv, Tuple<Solution *> u_ex
 
   // Evaluate the form using the quadrature of determined order.
   Quad2D* quad = fu->get_quad_2d();
-  double3* pt = quad->get_points(order);
   int np = quad->get_num_points(order);
 
   // Initialize geometry and jacobian*weights.
   if (cache_e[order] == NULL)
   {
     cache_e[order] = init_geom_vol(ru, order);
-    double* jac = ru->get_jacobian(order);
-    cache_jwt[order] = new double[np];
-    for(int i = 0; i < np; i++)
-      cache_jwt[order][i] = pt[i][2] * jac[i];
+    cache_jwt[order] = init_jwt_vol(ru, order);
   }
   Geom<double>* e = cache_e[order];
   double* jwt = cache_jwt[order];
@@ -674,7 +672,8 @@ scalar FeProblem::eval_form(WeakForm::MatrixFormVol *mfv, Tuple<Solution *> u_ex
   Func<double>* v = get_fn(fv, rv, order);
   ExtData<scalar>* ext = init_ext_fns(mfv->ext, rv, order);
 
-  scalar res = mfv->fn(np, jwt, prev, u, v, e, ext);
+  scalar res = (mfv->compiled != NULL) ? mfv->compiled->fn(np, jwt, prev, u, v, e, ext)
+                                       : mfv->fn(np, jwt, prev, u, v, e, ext);
   
   // Clean up.
   for (int i = 0; i < wf->neq; i++) {  prev[i]->free_fn(); delete prev[i]; }
@@ -711,7 +710,8 @@ scalar FeProblem::eval_form(WeakForm::VectorFormVol *vfv, Tuple<Solution *> u_ex
   
   // Total order of the matrix form.
   double fake_wt = 1.0;
-  Ord o = vfv->ord(1, &fake_wt, oi, ov, fake_e, fake_ext);
+  Ord o = (vfv->compiled != NULL) ? vfv->compiled->ord(1, &fake_wt, oi, ov, fake_e, fake_ext)
+                                  : vfv->ord(1, &fake_wt, oi, ov, fake_e, fake_ext);
   
   // Order increase due to reference map.
   int order = rv->get_inv_ref_order();
@@ -727,17 +727,13 @@ scalar FeProblem::eval_form(WeakForm::VectorFormVol *vfv, Tuple<Solution *> u_ex
 
   // Evaluate the form using the quadrature of determined order.
   Quad2D* quad = fv->get_quad_2d();
-  double3* pt = quad->get_points(order);
   int np = quad->get_num_points(order);
 
   // Initialize geometry and jacobian*weights.
   if (cache_e[order] == NULL)
   {
     cache_e[order] = init_geom_vol(rv, order);
-    double* jac = rv->get_jacobian(order);
-    cache_jwt[order] = new double[np];
-    for(int i = 0; i < np; i++)
-      cache_jwt[order][i] = pt[i][2] * jac[i];
+    cache_jwt[order] = init_jwt_vol(rv, order);
   }
   Geom<double>* e = cache_e[order];
   double* jwt = cache_jwt[order];
@@ -757,7 +753,8 @@ scalar FeProblem::eval_form(WeakForm::VectorFormVol *vfv, Tuple<Solution *> u_ex
   Func<double>* v = get_fn(fv, rv, order);
   ExtData<scalar>* ext = init_ext_fns(vfv->ext, rv, order);
 
-  scalar res = vfv->fn(np, jwt, prev, v, e, ext);
+  scalar res = (vfv->compiled != NULL) ? vfv->compiled->fn(np, jwt, prev, v, e, ext)
+                                       : vfv->fn(np, jwt, prev, v, e, ext);
 
   // Clean up.
   for (int i = 0; i < wf->neq; i++) {  prev[i]->free_fn(); delete prev[i]; }
@@ -795,7 +792,8 @@ scalar FeProblem::eval_form(WeakForm::MatrixFormSurf *mfs, Tuple<Solution *> u_e
   
   // Total order of the matrix form.
   double fake_wt = 1.0;
-  Ord o = mfs->ord(1, &fake_wt, oi, ou, ov, fake_e, fake_ext);
+  Ord o = (mfs->compiled != NULL) ? mfs->compiled->ord(1, &fake_wt, oi, ou, ov, fake_e, fake_ext)
+                                  : mfs->ord(1, &fake_wt, oi, ou, ov, fake_e, fake_ext);
   
   // Order increase due to reference map.
   int order = ru->get_inv_ref_order();
@@ -844,7 +842,8 @@ scalar FeProblem::eval_form(WeakForm::MatrixFormSurf *mfs, Tuple<Solution *> u_e
   Func<double>* v = get_fn(fv, rv, eo);
   ExtData<scalar>* ext = init_ext_fns(mfs->ext, rv, eo);
 
-  scalar res = mfs->fn(np, jwt, prev, u, v, e, ext);
+  scalar res = (mfs->compiled != NULL) ? mfs->compiled->fn(np, jwt, prev, u, v, e, ext)
+                                       : mfs->fn(np, jwt, prev, u, v, e, ext);
 
   // Clean up.
   for (int i = 0; i < wf->neq; i++) {  prev[i]->free_fn(); delete prev[i]; }
@@ -881,7 +880,8 @@ scalar FeProblem::eval_form(WeakForm::VectorFormSurf *vfs, Tuple<Solution *> u_e
   
   // Total order of the matrix form.
   double fake_wt = 1.0;
-  Ord o = vfs->ord(1, &fake_wt, oi, ov, fake_e, fake_ext);
+  Ord o = (vfs->compiled != NULL) ? vfs->compiled->ord(1, &fake_wt, oi, ov, fake_e, fake_ext)
+                                  : vfs->ord(1, &fake_wt, oi, ov, fake_e, fake_ext);
   
   // Order increase due to reference map.
   int order = rv->get_inv_ref_order();
@@ -928,7 +928,8 @@ scalar FeProblem::eval_form(WeakForm::VectorFormSurf *vfs, Tuple<Solution *> u_e
   Func<double>* v = get_fn(fv, rv, eo);
   ExtData<scalar>* ext = init_ext_fns(vfs->ext, rv, eo);
 
-  scalar res = vfs->fn(np, jwt, prev, v, e, ext);
+  scalar res = (vfs->compiled != NULL) ? vfs->compiled->fn(np, jwt, prev, v, e, ext)
+                                       : vfs->fn(np, jwt, prev, v, e, ext);
 
   // Clean up.
   for (int i = 0; i < wf->neq; i++) {  prev[i]->free_fn(); delete prev[i]; }
@@ -63,6 +63,30 @@ Geom<double>* init_geom_vol(RefMap *rm, const int order)
     return e;
 }
 
+// Jacobian times weights of the quadrature points. For elements with a constant
+// jacobian (straight triangles and parallelograms) the per-point tables of the
+// reference map are not needed.
+double* init_jwt_vol(RefMap *rm, const int order)
+{
+  Quad2D* quad = rm->get_quad_2d();
+  double3* pt = quad->get_points(order);
+  int np = quad->get_num_points(order);
+  double* jwt = new double[np];
+  if (rm->is_jacobian_const())
+  {
+    double jac = rm->get_const_jacobian();
+    for (int i = 0; i < np; i++)
+      jwt[i] = pt[i][2] * jac;
+  }
+  else
+  {
+    double* jac = rm->get_jacobian(order);
+    for (int i = 0; i < np; i++)
+      jwt[i] = pt[i][2] * jac[i];
+  }
+  return jwt;
+}
+
 // Initialize edge marker, coordinates, tangent and normals
 Geom<double>* init_geom_surf(RefMap *rm, EdgePos* ep, const int order)
 {
@@ -136,29 +160,50 @@ Func<double>* init_fn(PrecalcShapeset *fu, RefMap *rm, const int order)
                 double *dyy = fu->get_dyy_values();
 #endif
 
-		double2x2 *m = rm->get_inv_ref_map(order);
+    memcpy(u->val, fn, np * sizeof(double));
+
+    // Affine elements: one matrix transforms the derivatives in all points and
+    // the second derivatives of the reference map vanish.
+    if (rm->is_jacobian_const())
+    {
+      double2x2& cm = *rm->get_const_inv_ref_map();
+      double m00 = cm[0][0], m01 = cm[0][1], m10 = cm[1][0], m11 = cm[1][1];
+      for (int i = 0; i < np; i++)
+      {
+        u->dx[i] = (dx[i] * m00 + dy[i] * m01);
+        u->dy[i] = (dx[i] * m10 + dy[i] * m11);
+      }
 #ifdef H2D_SECOND_DERIVATIVES_ENABLED
-                double3x2 *mm = rm->get_second_ref_map(order);
+      double axx = (sqr(m00) + sqr(m10));
+      double ayy = (sqr(m01) + sqr(m11));
+      double axy = 2.0 * (m00*m01 + m10*m11);
+      for (int i = 0; i < np; i++)
+        u->laplace[i] = ( dxx[i] * axx + dxy[i] * axy + dyy[i] * ayy );
 #endif
+    }
+    else
+    {
+      double2x2 *m = rm->get_inv_ref_map(order);
 #ifdef H2D_SECOND_DERIVATIVES_ENABLED
-		for (int i = 0; i < np; i++, m++, mm++)
+      double3x2 *mm = rm->get_second_ref_map(order);
+      for (int i = 0; i < np; i++, m++, mm++)
 #else
-		for (int i = 0; i < np; i++, m++)
+      for (int i = 0; i < np; i++, m++)
 #endif
-    {
-			u->val[i] = fn[i];
-			u->dx[i] = (dx[i] * (*m)[0][0] + dy[i] * (*m)[0][1]);
-			u->dy[i] = (dx[i] * (*m)[1][0] + dy[i] * (*m)[1][1]);
+      {
+        u->dx[i] = (dx[i] * (*m)[0][0] + dy[i] * (*m)[0][1]);
+        u->dy[i] = (dx[i] * (*m)[1][0] + dy[i] * (*m)[1][1]);
 
 #ifdef H2D_SECOND_DERIVATIVES_ENABLED
-                        double axx = (sqr((*m)[0][0]) + sqr((*m)[1][0]));
-                        double ayy = (sqr((*m)[0][1]) + sqr((*m)[1][1]));
-                        double axy = 2.0 * ((*m)[0][0]*(*m)[0][1] + (*m)[1][0]*(*m)[1][1]);
-                        double ax = (*mm)[0][0] + (*mm)[2][0];
-                        double ay = (*mm)[0][1] + (*mm)[2][1];
-                        u->laplace[i] = ( dx[i] * ax + dy[i] * ay + dxx[i] * axx + dxy[i] * axy + dyy[i] * ayy );
+        double axx = (sqr((*m)[0][0]) + sqr((*m)[1][0]));
+        double ayy = (sqr((*m)[0][1]) + sqr((*m)[1][1]));
+        double axy = 2.0 * ((*m)[0][0]*(*m)[0][1] + (*m)[1][0]*(*m)[1][1]);
+        double ax = (*mm)[0][0] + (*mm)[2][0];
+        double ay = (*mm)[0][1] + (*mm)[2][1];
+        u->laplace[i] = ( dx[i] * ax + dy[i] * ay + dxx[i] * axx + dxy[i] * axy + dyy[i] * ayy );
 #endif
-		}
+      }
+    }
 	}
   // Hcurl space.
 	else if (space_type == 1)
@@ -171,8 +216,10 @@ Func<double>* init_fn(PrecalcShapeset *fu, RefMap *rm, const int order)
     double *fn1 = fu->get_fn_values(1);
     double *dx1 = fu->get_dx_values(1);
     double *dy0 = fu->get_dy_values(0);
-    double2x2 *m = rm->get_inv_ref_map(order);
-    for (int i = 0; i < np; i++, m++)
+    double2x2 *m = rm->get_const_inv_ref_map();
+    int mstep = 0;
+    if (!rm->is_jacobian_const()) { m = rm->get_inv_ref_map(order); mstep = 1; }
+    for (int i = 0; i < np; i++, m += mstep)
     {
       u->val0[i] = (fn0[i] * (*m)[0][0] + fn1[i] * (*m)[0][1]);
       u->val1[i] = (fn0[i] * (*m)[1][0] + fn1[i] * (*m)[1][1]);
@@ -187,8 +234,10 @@ Func<double>* init_fn(PrecalcShapeset *fu, RefMap *rm, const int order)
 
     double *fn0 = fu->get_fn_values(0);
     double *fn1 = fu->get_fn_values(1);
-    double2x2 *m = rm->get_inv_ref_map(order);
-    for (int i = 0; i < np; i++, m++)
+    double2x2 *m = rm->get_const_inv_ref_map();
+    int mstep = 0;
+    if (!rm->is_jacobian_const()) { m = rm->get_inv_ref_map(order); mstep = 1; }
+    for (int i = 0; i < np; i++, m += mstep)
     {
       u->val0[i] = (  fn0[i] * (*m)[1][1] - fn1[i] * (*m)[1][0]);
       u->val1[i] = (- fn0[i] * (*m)[0][1] + fn1[i] * (*m)[0][0]);
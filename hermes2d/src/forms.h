@@ -343,6 +343,8 @@ Geom<Ord>* init_geom_ord();
 Geom<double>* init_geom_vol(RefMap *rm, const int order);
 /// Init element geometry for surface integrals
 Geom<double>* init_geom_surf(RefMap *rm, EdgePos* ep, const int order);
+/// Init jacobian*weights for volumetric integrals (the caller deletes the array)
+double* init_jwt_vol(RefMap *rm, const int order);
 
 
 /// Init the function for calculation the integration order
@@ -18,6 +18,7 @@
 
 #include "common.h"
 #include "solution.h"
+#include "shapeset/shapeset_h1_all.h"
 
 
 const double H2D_EPS_LOW    = 0.0014;
@@ -64,6 +65,18 @@ public:
   virtual void save_data(const char* filename);
   virtual void load_data(const char* filename);
 
+  /// Exchanges the vertices, triangles and edges with 'lin' (for double buffering).
+  void swap_data(Linearizer* lin);
+
+  /// Enables caching of the linearized mesh. When the next solution passed to
+  /// process_solution() has the same mesh (sequence number), element orders, 'item',
+  /// 'eps' and 'max_abs' as the previous one, the triangles and edges are reused and
+  /// only the vertex values are recalculated, element by element. The subdivision
+  /// then follows the solution that was linearized first, which is usually fine
+  /// for the steps of a transient problem. Only scalar values of a Solution are
+  /// cached (not filters, derivatives or displacements).
+  void set_caching(bool enable = true);
+
   void free();
 
 protected:
@@ -91,6 +104,41 @@ protected:
   bool curved, disp;
   double min_val, max_val;
 
+  struct VertexSource ///< where the value of a vertex comes from
+  {
+    int id;          ///< element id
+    double xi1, xi2; ///< reference coordinates in the element
+  };
+
+  bool caching, record;
+  VertexSource* src;  ///< sources of the vertices being created (if 'record')
+  double2* ref;       ///< reference coordinates of the vertices in the current element (if 'record')
+
+  struct Cache ///< the linearized mesh of the previous solution (see set_caching())
+  {
+    bool valid;
+    unsigned seq;
+    int* orders;
+    int num_orders, item;
+    double eps, max_abs;
+    int nv, nt, ne;
+    double2* xy;      ///< vertex coordinates
+    int3* tris;
+    int3* edges;
+    int* elems;       ///< ids of the elements containing vertices,...
+    int* first;       ///< ...their first vertex in 'pts' and 'vidx' (num_elems + 1 entries),...
+    int num_elems;
+    double2* pts;     ///< ...reference coordinates of the vertices, grouped by elements,...
+    int* vidx;        ///< ...and the vertex indices
+  } cache;
+
+  bool use_cache(Solution* sln, int item, double eps, double max_abs);
+  void store_cache(Solution* sln, int item, double eps, double max_abs);
+  void free_cache();
+  void set_source(int i, int id, double xi1, double xi2)
+    { src[i].id = id; src[i].xi1 = xi1; src[i].xi2 = xi2; }
+  int get_mid_vertex(int p1, int p2, double x, double y, double value);
+
   int get_vertex(int p1, int p2, double x, double y, double value);
   int get_top_vertex(int id, double value);
   int peek_vertex(int p1, int p2);
@@ -104,6 +152,10 @@ protected:
       cv *= 2;
       verts = (double3*) realloc(verts, sizeof(double3) * cv);
       info = (int4*) realloc(info, sizeof(int4) * cv);
+      if (record) {
+        src = (VertexSource*) realloc(src, sizeof(VertexSource) * cv);
+        ref = (double2*) realloc(ref, sizeof(double2) * cv);
+      }
       verbose("Linearizer::add_vertex(): realloc to %d", cv);
     }
     return nv++;
@@ -264,6 +316,84 @@ protected:
 };
 
 
+/// \brief Linearizes solutions in a worker thread (implemented in linear4.cpp).
+///
+/// process_solution() takes a snapshot of the solution and returns immediately, so
+/// that the calculation can continue. The snapshot copies the coefficients; the mesh
+/// is copied only if it has changed (see Mesh::get_seq()) since the previous snapshot,
+/// otherwise the snapshots share one copy. A worker thread linearizes the snapshots
+/// into a back buffer and exchanges it with the front Linearizer (e.g., that of a
+/// view), which is thus locked only for the exchange. At most 'queue_length' snapshots
+/// wait for the worker; when the queue is full, the oldest waiting snapshot is dropped.
+///
+class H2D_API AsyncLinearizer
+{
+public:
+
+  AsyncLinearizer(Linearizer* front, int queue_length = 1);
+  ~AsyncLinearizer(); ///< Processes the queued snapshots and stops the worker thread.
+
+  /// Called by the worker thread after the front Linearizer has been updated.
+  /// 'sln' is the snapshot that was linearized.
+  typedef void (*Callback)(Linearizer* front, Solution* sln, void* data);
+  void set_callback(Callback callback, void* data) { update_fn = callback; update_data = data; }
+
+  /// Queues a snapshot of 'sln'. Returns false if a waiting snapshot had to be dropped.
+  bool process_solution(Solution* sln, int item = H2D_FN_VAL_0,
+                        double eps = H2D_EPS_NORMAL, double max_abs = -1.0);
+
+  /// Waits until all queued snapshots are linearized.
+  void flush();
+
+  /// Enables caching of the linearized mesh in the worker (see Linearizer::set_caching()).
+  void set_caching(bool enable = true) { back.set_caching(enable); }
+
+  int get_num_processed() const { return num_processed; }
+  int get_num_dropped() const { return num_dropped; }
+
+protected:
+
+  struct SharedMesh
+  {
+    Mesh mesh;
+    int refs;
+  };
+
+  struct Snapshot
+  {
+    Solution* sln;
+    SharedMesh* mesh;
+    int item;
+    double eps, max_abs;
+  };
+
+  Linearizer* front;
+  Linearizer back;
+  Callback update_fn;
+  void* update_data;
+
+  std::deque<Snapshot> queue;
+  int queue_length;
+  bool working, quit;
+  int num_processed, num_dropped;
+
+  Mesh* last_src;        ///< the mesh of the last snapshot...
+  unsigned last_seq;     ///< ...its sequence number...
+  SharedMesh* last_mesh; ///< ...and its copy
+
+  H1ShapesetJacobi shapeset; ///< the reference maps of the snapshots use these in the worker thread
+  PrecalcShapeset pss;
+
+  pthread_t thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond_work, cond_idle;
+
+  void release(SharedMesh* mesh);
+  void run();
+
+  friend void* async_linearizer_thread(void*);
+};
+
 // maximum subdivision level (2^N)
 const int LIN_MAX_LEVEL = 6;
 
@@ -118,9 +118,33 @@ public:
     np = lin_np;
   };
 
+  // deleted by delete_quad_lin() when its thread exits
+  virtual ~Quad2DLin() {}
+
   virtual void dummy_fn() {}
 
-} quad_lin;
+};
+
+// The mode of the quadrature is set for every element, so linearizers running in
+// several threads (see AsyncLinearizer) cannot share one. Each thread has its own
+// (not each linearizer: a function keeps only a few quadratures).
+static pthread_key_t quad_lin_key;
+static pthread_once_t quad_lin_once = PTHREAD_ONCE_INIT;
+
+static void delete_quad_lin(void* quad) { delete (Quad2DLin*) quad; }
+static void create_quad_lin_key() { pthread_key_create(&quad_lin_key, delete_quad_lin); }
+
+Quad2D* get_quad_lin()
+{
+  pthread_once(&quad_lin_once, create_quad_lin_key);
+  Quad2DLin* quad = (Quad2DLin*) pthread_getspecific(quad_lin_key);
+  if (quad == NULL)
+  {
+    quad = new Quad2DLin;
+    pthread_setspecific(quad_lin_key, quad);
+  }
+  return quad;
+}
 
 
 
@@ -133,6 +157,11 @@ Linearizer::Linearizer()
   tris = NULL;
   edges = NULL;
 
+  caching = record = false;
+  src = NULL;
+  ref = NULL;
+  memset(&cache, 0, sizeof(cache));
+
   pthread_mutexattr_t attr;
   pthread_mutexattr_init(&attr);
   pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
@@ -159,6 +188,7 @@ int Linearizer::get_vertex(int p1, int p2, double x, double y, double value)
 
   // if not found, create a new one
   i = add_vertex();
+  if (record) src[i].id = -1;
   verts[i][0] = x;
   verts[i][1] = y;
   verts[i][2] = value;
@@ -170,6 +200,21 @@ int Linearizer::get_vertex(int p1, int p2, double x, double y, double value)
 }
 
 
+int Linearizer::get_mid_vertex(int p1, int p2, double x, double y, double value)
+{
+  int n = nv;
+  int i = get_vertex(p1, p2, x, y, value);
+  if (record)
+  {
+    // the vertices of the current (sub)element have their reference coordinates in 'ref'
+    ref[i][0] = (ref[p1][0] + ref[p2][0]) * 0.5;
+    ref[i][1] = (ref[p1][1] + ref[p2][1]) * 0.5;
+    if (i >= n) set_source(i, sln->get_active_element()->id, ref[i][0], ref[i][1]);
+  }
+  return i;
+}
+
+
 int Linearizer::get_top_vertex(int id, double value)
 {
   if (fabs(value - verts[id][2]) < max*1e-4) return id;
@@ -343,9 +388,9 @@ void Linearizer::process_triangle(int iv0, int iv1, int iv2, int level,
         }
 
       // obtain mid-edge vertices
-      int mid0 = get_vertex(iv0, iv1, midval[0][0], midval[1][0], getval(idx[0]));
-      int mid1 = get_vertex(iv1, iv2, midval[0][1], midval[1][1], getval(idx[1]));
-      int mid2 = get_vertex(iv2, iv0, midval[0][2], midval[1][2], getval(idx[2]));
+      int mid0 = get_mid_vertex(iv0, iv1, midval[0][0], midval[1][0], getval(idx[0]));
+      int mid1 = get_mid_vertex(iv1, iv2, midval[0][1], midval[1][1], getval(idx[1]));
+      int mid2 = get_mid_vertex(iv2, iv0, midval[0][2], midval[1][2], getval(idx[2]));
 
       // recur to sub-elements
       sln->push_transform(0);  process_triangle(iv0, mid0, mid2,  level+1, val, phx, phy, tri_indices[1]);  sln->pop_transform();
@@ -490,11 +535,11 @@ void Linearizer::process_quad(int iv0, int iv1, int iv2, int iv3, int level,
 
       // obtain mid-edge and mid-element vertices
       int mid0, mid1, mid2, mid3, mid4;
-      if (split != 1) mid0 = get_vertex(iv0,  iv1,  midval[0][0], midval[1][0], getval(idx[0]));
-      if (split != 2) mid1 = get_vertex(iv1,  iv2,  midval[0][1], midval[1][1], getval(idx[1]));
-      if (split != 1) mid2 = get_vertex(iv2,  iv3,  midval[0][2], midval[1][2], getval(idx[2]));
-      if (split != 2) mid3 = get_vertex(iv3,  iv0,  midval[0][3], midval[1][3], getval(idx[3]));
-      if (split == 3) mid4 = get_vertex(mid0, mid2, midval[0][4], midval[1][4], getval(idx[4]));
+      if (split != 1) mid0 = get_mid_vertex(iv0,  iv1,  midval[0][0], midval[1][0], getval(idx[0]));
+      if (split != 2) mid1 = get_mid_vertex(iv1,  iv2,  midval[0][1], midval[1][1], getval(idx[1]));
+      if (split != 1) mid2 = get_mid_vertex(iv2,  iv3,  midval[0][2], midval[1][2], getval(idx[2]));
+      if (split != 2) mid3 = get_mid_vertex(iv3,  iv0,  midval[0][3], midval[1][3], getval(idx[3]));
+      if (split == 3) mid4 = get_mid_vertex(mid0, mid2, midval[0][4], midval[1][4], getval(idx[4]));
 
       // recur to sub-elements
       if (split == 3)
@@ -627,6 +672,16 @@ void Linearizer::find_min_max()
 
 //// process_solution //////////////////////////////////////////////////////////////////////////////
 
+// returns the solution if its linearized mesh can be cached (see Linearizer::set_caching())
+static Solution* cacheable_solution(MeshFunction* sln, int ia, int ib, bool disp)
+{
+  Solution* s = dynamic_cast<Solution*>(sln);
+  if (s == NULL || disp || ia != 0 || ib != 0) return NULL;
+  if (s->get_num_components() != 1 || s->get_element_orders() == NULL || s->get_mono_coefs() == NULL)
+    return NULL;
+  return s;
+}
+
 void Linearizer::process_solution(MeshFunction* sln, int item, double eps, double max_abs,
                                   MeshFunction* xdisp, MeshFunction* ydisp, double dmult)
 {
@@ -675,6 +730,15 @@ void Linearizer::process_solution(MeshFunction* sln, int item, double eps, doubl
       error("Displacements must be defined on the same mesh as the solution.");
   }
 
+  // reuse the cached triangles and edges, if possible
+  Solution* cached_sln = caching ? cacheable_solution(sln, ia, ib, disp) : NULL;
+  if (cached_sln != NULL && use_cache(cached_sln, item, eps, max_abs))
+  {
+    find_min_max();
+    unlock_data();
+    return;
+  }
+
   // reuse or allocate vertex, triangle and edge arrays
   lin_init_array(verts, double3, cv, ev);
   lin_init_array(tris, int3, ct, et);
@@ -688,14 +752,23 @@ void Linearizer::process_solution(MeshFunction* sln, int item, double eps, doubl
   memset(hash_table, 0xff, sizeof(int) * size);
   mask = size-1;
 
+  // record the sources of the vertex values for the cache
+  record = (cached_sln != NULL);
+  if (record)
+  {
+    src = (VertexSource*) malloc(sizeof(VertexSource) * cv);
+    ref = (double2*) malloc(sizeof(double2) * cv);
+  }
+
   // select the linearization quadrature
+  Quad2D* quad_lin = get_quad_lin();
   Quad2D *old_quad, *old_quad_x, *old_quad_y;
   old_quad = sln->get_quad_2d();
-  sln->set_quad_2d(&quad_lin);
+  sln->set_quad_2d(quad_lin);
   if (disp) { old_quad_x = xdisp->get_quad_2d();
               old_quad_y = ydisp->get_quad_2d();
-              xdisp->set_quad_2d(&quad_lin);
-              ydisp->set_quad_2d(&quad_lin); }
+              xdisp->set_quad_2d(quad_lin);
+              ydisp->set_quad_2d(quad_lin); }
 
   // create all top-level vertices (corresponding to vertex nodes), with
   // all parent-son relations preserved; this is necessary for regularization to
@@ -744,12 +817,14 @@ void Linearizer::process_solution(MeshFunction* sln, int item, double eps, doubl
       dy = ydisp->get_fn_values();
     }
 
+    double3* pts0 = e->is_triangle() ? lin_pts_0_tri : lin_pts_0_quad;
     for (unsigned int i = 0; i < e->nvert; i++)
     {
       double f = getval(i);
       if (auto_max && finite(f) && fabs(f) > max) max = fabs(f);
       int id = id2id[e->vn[i]->id];
       verts[id][2] = f;
+      if (record) set_source(id, e->id, pts0[i][0], pts0[i][1]);
 
       if (disp)
       {
@@ -772,8 +847,17 @@ void Linearizer::process_solution(MeshFunction* sln, int item, double eps, doubl
     }
 
     int iv[4];
+    double3* pts0 = e->is_triangle() ? lin_pts_0_tri : lin_pts_0_quad;
     for (unsigned int i = 0; i < e->nvert; i++)
+    {
       iv[i] = get_top_vertex(id2id[e->vn[i]->id], getval(i));
+      if (record)
+      {
+        ref[iv[i]][0] = pts0[i][0];
+        ref[iv[i]][1] = pts0[i][1];
+        if (iv[i] != id2id[e->vn[i]->id]) set_source(iv[i], e->id, ref[iv[i]][0], ref[iv[i]][1]);
+      }
+    }
 
     // we won't bother calculating physical coordinates from the refmap if this is not a curved element
     curved = e->is_curved();
@@ -807,6 +891,15 @@ void Linearizer::process_solution(MeshFunction* sln, int item, double eps, doubl
   }
 
   find_min_max();
+  if (record)
+  {
+    store_cache(cached_sln, item, eps, max_abs);
+    ::free(src);
+    ::free(ref);
+    src = NULL;
+    ref = NULL;
+    record = false;
+  }
   //verbose("Linearizer: %d verts, %d tris in %0.3g sec", nv, nt, time_period.tick().last());
   //if (verbose_mode) print_hash_stats();
   unlock_data();
@@ -822,6 +915,23 @@ void Linearizer::process_solution(MeshFunction* sln, int item, double eps, doubl
 }
 
 
+void Linearizer::swap_data(Linearizer* lin)
+{
+  lock_data();
+  lin->lock_data();
+  std::swap(verts, lin->verts);
+  std::swap(tris, lin->tris);
+  std::swap(edges, lin->edges);
+  std::swap(nv, lin->nv);  std::swap(cv, lin->cv);
+  std::swap(nt, lin->nt);  std::swap(ct, lin->ct);
+  std::swap(ne, lin->ne);  std::swap(ce, lin->ce);
+  std::swap(min_val, lin->min_val);
+  std::swap(max_val, lin->max_val);
+  lin->unlock_data();
+  unlock_data();
+}
+
+
 void Linearizer::free()
 {
   lin_free_array(verts, nv, cv);
@@ -833,10 +943,144 @@ void Linearizer::free()
 Linearizer::~Linearizer()
 {
   free();
+  free_cache();
   pthread_mutex_destroy(&data_mutex);
 }
 
 
+//// caching ///////////////////////////////////////////////////////////////////////////////////////
+
+void Linearizer::set_caching(bool enable)
+{
+  lock_data();
+  caching = enable;
+  if (!enable) free_cache();
+  unlock_data();
+}
+
+
+void Linearizer::free_cache()
+{
+  ::free(cache.orders);
+  ::free(cache.xy);
+  ::free(cache.tris);
+  ::free(cache.edges);
+  ::free(cache.elems);
+  ::free(cache.first);
+  ::free(cache.pts);
+  ::free(cache.vidx);
+  memset(&cache, 0, sizeof(cache));
+}
+
+
+void Linearizer::store_cache(Solution* sln, int item, double eps, double max_abs)
+{
+  free_cache();
+  Mesh* mesh = sln->get_mesh();
+
+  cache.seq = mesh->get_seq();
+  cache.num_orders = mesh->get_max_element_id();
+  cache.orders = (int*) malloc(sizeof(int) * cache.num_orders);
+  memcpy(cache.orders, sln->get_element_orders(), sizeof(int) * cache.num_orders);
+  cache.item = item;
+  cache.eps = eps;
+  cache.max_abs = max_abs;
+
+  cache.nv = nv;
+  cache.nt = nt;
+  cache.ne = ne;
+  cache.xy = (double2*) malloc(sizeof(double2) * nv);
+  for (int i = 0; i < nv; i++) {
+    cache.xy[i][0] = verts[i][0];
+    cache.xy[i][1] = verts[i][1];
+  }
+  cache.tris = (int3*) malloc(sizeof(int3) * nt);
+  memcpy(cache.tris, tris, sizeof(int3) * nt);
+  cache.edges = (int3*) malloc(sizeof(int3) * ne);
+  memcpy(cache.edges, edges, sizeof(int3) * ne);
+
+  // group the vertices by their elements (counting sort); vertex nodes which are
+  // not vertices of any active element have no source and stay zero
+  int num = cache.num_orders;
+  int* first = new int[num + 1];
+  memset(first, 0, sizeof(int) * (num + 1));
+  int i, n = 0;
+  for (i = 0; i < nv; i++)
+    if (src[i].id >= 0) { first[src[i].id + 1]++; n++; }
+
+  cache.num_elems = 0;
+  for (i = 0; i < num; i++)
+    if (first[i+1]) cache.num_elems++;
+  cache.elems = (int*) malloc(sizeof(int) * cache.num_elems);
+  cache.first = (int*) malloc(sizeof(int) * (cache.num_elems + 1));
+  cache.pts = (double2*) malloc(sizeof(double2) * n);
+  cache.vidx = (int*) malloc(sizeof(int) * n);
+
+  int k = 0;
+  for (i = 0; i < num; i++)
+  {
+    if (first[i+1]) {
+      cache.elems[k] = i;
+      cache.first[k++] = first[i];
+    }
+    first[i+1] += first[i];
+  }
+  cache.first[k] = n;
+
+  for (i = 0; i < nv; i++)
+  {
+    if (src[i].id < 0) continue;
+    int j = first[src[i].id]++;
+    cache.pts[j][0] = src[i].xi1;
+    cache.pts[j][1] = src[i].xi2;
+    cache.vidx[j] = i;
+  }
+  delete [] first;
+  cache.valid = true;
+}
+
+
+bool Linearizer::use_cache(Solution* sln, int item, double eps, double max_abs)
+{
+  Mesh* mesh = sln->get_mesh();
+  if (!cache.valid || cache.seq != mesh->get_seq() || cache.item != item ||
+      cache.eps != eps || cache.max_abs != max_abs ||
+      cache.num_orders != mesh->get_max_element_id() ||
+      memcmp(cache.orders, sln->get_element_orders(), sizeof(int) * cache.num_orders))
+    return false;
+
+  lin_init_array(verts, double3, cv, cache.nv);
+  lin_init_array(tris, int3, ct, cache.nt);
+  lin_init_array(edges, int3, ce, cache.ne);
+  nv = cache.nv;
+  nt = cache.nt;
+  ne = cache.ne;
+  memcpy(tris, cache.tris, sizeof(int3) * nt);
+  memcpy(edges, cache.edges, sizeof(int3) * ne);
+  for (int i = 0; i < nv; i++)
+  {
+    verts[i][0] = cache.xy[i][0];
+    verts[i][1] = cache.xy[i][1];
+    verts[i][2] = 0.0;
+  }
+
+  // evaluate the solution at all vertices of an element at once
+  int max_np = 0;
+  for (int k = 0; k < cache.num_elems; k++)
+    max_np = std::max(max_np, cache.first[k+1] - cache.first[k]);
+  scalar* val = new scalar[max_np];
+  for (int k = 0; k < cache.num_elems; k++)
+  {
+    int first = cache.first[k], np = cache.first[k+1] - first;
+    sln->get_ref_values(mesh->get_element(cache.elems[k]), np, cache.pts + first, val);
+    for (int j = 0; j < np; j++)
+      verts[cache.vidx[first + j]][2] = realpart(val[j]);
+  }
+  delete [] val;
+  return true;
+}
+
+
 //// save & load ///////////////////////////////////////////////////////////////////////////////////
 
 void Linearizer::save_data(const char* filename)
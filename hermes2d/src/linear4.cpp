@@ -0,0 +1,170 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "common.h"
+#include "linear.h"
+
+
+//// AsyncLinearizer ///////////////////////////////////////////////////////////////////////////////
+
+void* async_linearizer_thread(void* arg)
+{
+  ((AsyncLinearizer*) arg)->run();
+  return NULL;
+}
+
+
+AsyncLinearizer::AsyncLinearizer(Linearizer* front, int queue_length)
+               : pss(&shapeset)
+{
+  if (front == NULL) error("front == NULL in AsyncLinearizer::AsyncLinearizer().");
+  if (queue_length < 1) error("The queue length must be positive.");
+
+  this->front = front;
+  this->queue_length = queue_length;
+  update_fn = NULL;
+  update_data = NULL;
+
+  working = quit = false;
+  num_processed = num_dropped = 0;
+  last_src = NULL;
+  last_seq = 0;
+  last_mesh = NULL;
+
+  pthread_mutex_init(&mutex, NULL);
+  pthread_cond_init(&cond_work, NULL);
+  pthread_cond_init(&cond_idle, NULL);
+  if (pthread_create(&thread, NULL, async_linearizer_thread, this))
+    error("Could not create the linearizer thread.");
+}
+
+
+AsyncLinearizer::~AsyncLinearizer()
+{
+  pthread_mutex_lock(&mutex);
+  quit = true;
+  pthread_cond_signal(&cond_work);
+  pthread_mutex_unlock(&mutex);
+  pthread_join(thread, NULL);
+
+  if (last_mesh != NULL) release(last_mesh);
+  pthread_cond_destroy(&cond_idle);
+  pthread_cond_destroy(&cond_work);
+  pthread_mutex_destroy(&mutex);
+}
+
+
+void AsyncLinearizer::release(SharedMesh* mesh)
+{
+  // called with the mutex locked (or after the worker has stopped)
+  if (--mesh->refs == 0) delete mesh;
+}
+
+
+bool AsyncLinearizer::process_solution(Solution* sln, int item, double eps, double max_abs)
+{
+  if (sln == NULL) error("Solution is NULL in AsyncLinearizer::process_solution().");
+  Mesh* src = sln->get_mesh();
+  if (src == NULL) error("Mesh is NULL in AsyncLinearizer::process_solution().");
+
+  // copy the mesh only if it has changed; the worker never touches 'last_src'
+  pthread_mutex_lock(&mutex);
+  if (last_mesh == NULL || src != last_src || src->get_seq() != last_seq)
+  {
+    pthread_mutex_unlock(&mutex);
+    SharedMesh* copy = new SharedMesh;
+    copy->mesh.copy(src);
+    copy->refs = 1;
+    pthread_mutex_lock(&mutex);
+    if (last_mesh != NULL) release(last_mesh);
+    last_mesh = copy;
+    last_src = src;
+    last_seq = src->get_seq();
+  }
+  SharedMesh* mesh = last_mesh;
+  mesh->refs++;
+  pthread_mutex_unlock(&mutex);
+
+  Snapshot snapshot;
+  snapshot.sln = new Solution;
+  snapshot.sln->copy(sln, &mesh->mesh);
+  snapshot.mesh = mesh;
+  snapshot.item = item;
+  snapshot.eps = eps;
+  snapshot.max_abs = max_abs;
+
+  // enqueue, dropping the oldest waiting snapshot if the queue is full
+  bool dropped = false;
+  Snapshot old = Snapshot();
+  pthread_mutex_lock(&mutex);
+  if ((int) queue.size() >= queue_length)
+  {
+    old = queue.front();
+    queue.pop_front();
+    release(old.mesh);
+    num_dropped++;
+    dropped = true;
+  }
+  queue.push_back(snapshot);
+  pthread_cond_signal(&cond_work);
+  pthread_mutex_unlock(&mutex);
+
+  if (dropped)
+  {
+    verbose("AsyncLinearizer: the linearizer is busy, a snapshot was dropped.");
+    delete old.sln;
+  }
+  return !dropped;
+}
+
+
+void AsyncLinearizer::flush()
+{
+  pthread_mutex_lock(&mutex);
+  while (!queue.empty() || working)
+    pthread_cond_wait(&cond_idle, &mutex);
+  pthread_mutex_unlock(&mutex);
+}
+
+
+void AsyncLinearizer::run()
+{
+  pthread_mutex_lock(&mutex);
+  while (true)
+  {
+    while (queue.empty() && !quit)
+      pthread_cond_wait(&cond_work, &mutex);
+    if (queue.empty()) break; // quit, after the queue is processed
+
+    Snapshot snapshot = queue.front();
+    queue.pop_front();
+    working = true;
+    pthread_mutex_unlock(&mutex);
+
+    // the shared reference map shapeset may be in use by the calculation
+    snapshot.sln->set_refmap_pss(&pss);
+    back.process_solution(snapshot.sln, snapshot.item, snapshot.eps, snapshot.max_abs);
+    front->swap_data(&back);
+    if (update_fn != NULL) update_fn(front, snapshot.sln, update_data);
+    delete snapshot.sln;
+
+    pthread_mutex_lock(&mutex);
+    release(snapshot.mesh);
+    num_processed++;
+    working = false;
+    if (queue.empty()) pthread_cond_broadcast(&cond_idle);
+  }
+  pthread_mutex_unlock(&mutex);
+}
@@ -130,6 +130,8 @@ Mesh::Mesh() : HashTable()
 {
   nbase = nactive = ntopvert = ninitial = 0;
   seq = g_mesh_seq++;
+  base_order = H2D_BASE_ORDER_NATURAL;
+  base_ids_calcs = 0;
 }
 
 
@@ -962,6 +964,8 @@ void Mesh::copy(const Mesh* mesh)
   ntopvert = mesh->ntopvert;
   ninitial = mesh->ninitial;
   seq = mesh->seq;
+  base_order = mesh->base_order;
+  base_ids = mesh->base_ids;
 }
 
 
@@ -1021,6 +1025,8 @@ void Mesh::copy_base(Mesh* mesh)
   nbase = nactive = ninitial = mesh->nbase;
   ntopvert = mesh->ntopvert;
   seq = g_mesh_seq++;
+  base_order = mesh->base_order;
+  base_ids = mesh->base_ids;
 }
 
 
@@ -1039,6 +1045,7 @@ void Mesh::free()
 
   elements.free();
   HashTable::free();
+  base_ids.clear();
 }
 
 void Mesh::copy_converted(Mesh* mesh)
@@ -1689,6 +1696,83 @@ void Mesh::load_str(char *mesh)
   loader.load_str(mesh, this);
 }
 
+//// base element order ////////////////////////////////////////////////////////////////////////////
+
+// the distance of the point (x, y) of the grid 2^bits x 2^bits along the Hilbert curve
+static uint64_t hilbert_index(unsigned x, unsigned y, int bits)
+{
+  unsigned n = 1u << bits;
+  uint64_t d = 0;
+  for (unsigned s = n >> 1; s > 0; s >>= 1)
+  {
+    unsigned rx = (x & s) ? 1 : 0;
+    unsigned ry = (y & s) ? 1 : 0;
+    d += (uint64_t) s * s * ((3 * rx) ^ ry);
+    if (ry == 0) // rotate the quadrant
+    {
+      if (rx == 1) { x = n-1 - x; y = n-1 - y; }
+      std::swap(x, y);
+    }
+  }
+  return d;
+}
+
+// the distance of the point (x, y) along the Morton curve (the interleaved bits of x and y)
+static uint64_t morton_index(unsigned x, unsigned y, int bits)
+{
+  uint64_t d = 0;
+  for (int i = 0; i < bits; i++)
+    d |= ((uint64_t) ((x >> i) & 1) << (2*i)) | ((uint64_t) ((y >> i) & 1) << (2*i + 1));
+  return d;
+}
+
+
+const int* Mesh::get_base_order_ids()
+{
+  if (base_order == H2D_BASE_ORDER_NATURAL || nbase == 0) return NULL;
+  if (!base_ids.empty()) return &base_ids.front();
+
+  // centroids of the base elements and their bounding box
+  std::vector<double2> c(nbase);
+  double x0 = 1e300, y0 = 1e300, x1 = -1e300, y1 = -1e300;
+  Element* e;
+  for_all_base_elements(e, this)
+  {
+    double x = 0, y = 0;
+    for (unsigned i = 0; i < e->nvert; i++)
+      { x += e->vn[i]->x; y += e->vn[i]->y; }
+    c[e->id][0] = x /= e->nvert;
+    c[e->id][1] = y /= e->nvert;
+    x0 = std::min(x0, x); x1 = std::max(x1, x);
+    y0 = std::min(y0, y); y1 = std::max(y1, y);
+  }
+
+  // sort the elements by the position of the centroid on the curve (unused ids go last)
+  const int bits = 16;
+  double scale = ((1 << bits) - 1) / std::max(std::max(x1 - x0, y1 - y0), 1e-300);
+  std::vector<std::pair<uint64_t, int> > keys(nbase);
+  for (int id = 0; id < nbase; id++)
+  {
+    keys[id].first = (uint64_t) -1;
+    keys[id].second = id;
+  }
+  for_all_base_elements(e, this)
+  {
+    unsigned x = (unsigned) ((c[e->id][0] - x0) * scale + 0.5);
+    unsigned y = (unsigned) ((c[e->id][1] - y0) * scale + 0.5);
+    keys[e->id].first = (base_order == H2D_BASE_ORDER_HILBERT) ? hilbert_index(x, y, bits)
+                                                               : morton_index(x, y, bits);
+  }
+  std::sort(keys.begin(), keys.end());
+
+  base_ids.resize(nbase);
+  for (int i = 0; i < nbase; i++)
+    base_ids[i] = keys[i].second;
+  base_ids_calcs++;
+  return &base_ids.front();
+}
+
+
 //// save_raw, load_raw ////////////////////////////////////////////////////////////////////////////
 
 void Mesh::save_raw(FILE* f)
@@ -25,6 +25,15 @@ class Space;
 struct MItem;
 
 
+/// Orders in which Traverse visits the base elements (see Mesh::set_base_order()):
+enum BaseOrder
+{
+  H2D_BASE_ORDER_NATURAL, ///< By the element id (the default).
+  H2D_BASE_ORDER_HILBERT, ///< Along a Hilbert curve through the element centroids.
+  H2D_BASE_ORDER_MORTON   ///< Along a Morton (Z-order) curve through the element centroids.
+};
+
+
 /// \brief Stores one node of a mesh.
 ///
 /// There are are two variants of this structure, depending on the value of
@@ -256,6 +265,21 @@ public:
   /// makes it active.
   void unrefine_element(int id);
 
+  /// Selects the order in which Traverse (and so the assembly, the adaptivity and the
+  /// filters) visits the base elements. Along a space-filling curve, consecutive elements
+  /// are neighbors, which makes the assembly touch nearby entries of the matrix and of the
+  /// precalculated tables, and independent of the ordering of the mesh file. Consecutive
+  /// parts of the order are also compact pieces of the domain.
+  void set_base_order(BaseOrder order) { base_order = order; base_ids.clear(); }
+  BaseOrder get_base_order() const { return base_order; }
+
+  /// Returns the ids of the base elements in the order selected by set_base_order(),
+  /// or NULL for the natural order. The order is calculated again only when the base
+  /// elements change (refinements keep it).
+  const int* get_base_order_ids();
+  /// Returns how many times the order of the base elements was calculated.
+  int get_num_base_order_calcs() const { return base_ids_calcs; }
+
   /// Unrefines all elements with immediate active sons. In effect, this
   /// shaves off one layer of refinements from the mesh. If done immediately
   /// after refine_all_elements(), this function reverts the mesh to its
@@ -297,6 +321,10 @@ protected:
   int nactive, ninitial;
   unsigned seq;
 
+  BaseOrder base_order;
+  std::vector<int> base_ids; ///< base element ids in the base_order, empty if not calculated
+  int base_ids_calcs;        ///< number of calculations of base_ids
+
   Element* create_triangle(int marker, Node* v0, Node* v1, Node* v2, CurvMap* cm);
   Element* create_quad(int marker, Node* v0, Node* v1, Node* v2, Node* v3, CurvMap* cm);
 
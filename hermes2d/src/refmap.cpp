@@ -17,29 +17,63 @@
 #include "mesh.h"
 #include "refmap.h"
 #include "shapeset/shapeset_h1_all.h"
+#include <list>
 
 
 H1ShapesetJacobi ref_map_shapeset;
 PrecalcShapeset ref_map_pss(&ref_map_shapeset);
 
 
+// An element in the geometry cache: the tables of all its sub-elements for one quadrature.
+struct GeomCacheEntry
+{
+  Element* e;
+  Quad2D* quad;
+  int mode, num_tables;
+  std::vector<double> coefs;  ///< the coefficients of the reference map (the geometry)
+  void* nodes;
+  size_t bytes;
+  int refs;                   ///< number of reference maps using the entry
+  pthread_t owner;            ///< the thread of the reference maps using the entry
+  std::list<GeomCacheEntry*>::iterator lru; ///< position in geom_lru (if refs == 0)
+};
+
+typedef std::map<std::pair<Element*, Quad2D*>, GeomCacheEntry*> GeomCacheMap;
+
+static GeomCacheMap geom_cache;
+static std::list<GeomCacheEntry*> geom_lru; ///< entries not in use, the most recent first
+static size_t geom_max_memory = 0, geom_memory = 0;
+static int geom_hits = 0, geom_misses = 0;
+static pthread_mutex_t geom_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+
 RefMap::RefMap()
 {
   quad_2d = NULL;
   num_tables = 0;
   nodes = NULL;
+  pnodes = &nodes;
   cur_node = NULL;
   overflow = NULL;
+  entry = NULL;
+  pss = &ref_map_pss;
   set_quad_2d(&g_quad_2d_std); // default quadrature
 }
 
 
+void RefMap::set_pss(PrecalcShapeset* pss)
+{
+  this->pss = pss;
+  pss->set_quad_2d(quad_2d);
+}
+
+
 
 void RefMap::set_quad_2d(Quad2D* quad_2d)
 {
   free();
   this->quad_2d = quad_2d;
-  ref_map_pss.set_quad_2d(quad_2d);
+  pss->set_quad_2d(quad_2d);
 }
 
 
@@ -47,7 +81,7 @@ void RefMap::set_active_element(Element* e)
 {
   if (e != element) free();
 
-  ref_map_pss.set_active_element(e);
+  pss->set_active_element(e);
   quad_2d->set_mode(e->get_mode());
   num_tables = quad_2d->get_num_tables();
   assert(num_tables <= H2D_MAX_TABLES);
@@ -56,7 +90,6 @@ void RefMap::set_active_element(Element* e)
   element = e;
 
   reset_transform();
-  update_cur_node();
 
   is_const = !element->is_curved() &&
              (element->is_triangle() || is_parallelogram());
@@ -64,7 +97,7 @@ void RefMap::set_active_element(Element* e)
   // prepare the shapes and coefficients of the reference map
   int j, k = 0;
   for (unsigned int i = 0; i < e->nvert; i++)
-    indices[k++] = ref_map_shapeset.get_vertex_index(i);
+    indices[k++] = pss->get_shapeset()->get_vertex_index(i);
 
   // straight-edged element
   if (e->cm == NULL)
@@ -82,16 +115,19 @@ void RefMap::set_active_element(Element* e)
     int o = e->cm->order;
     for (unsigned int i = 0; i < e->nvert; i++)
       for (j = 2; j <= o; j++)
-        indices[k++] = ref_map_shapeset.get_edge_index(i, 0, j);
+        indices[k++] = pss->get_shapeset()->get_edge_index(i, 0, j);
 
     if (e->is_quad()) o = H2D_MAKE_QUAD_ORDER(o, o);
-    memcpy(indices + k, ref_map_shapeset.get_bubble_indices(o),
-           ref_map_shapeset.get_num_bubbles(o) * sizeof(int));
+    memcpy(indices + k, pss->get_shapeset()->get_bubble_indices(o),
+           pss->get_shapeset()->get_num_bubbles(o) * sizeof(int));
 
     coefs = e->cm->coefs;
     nc = e->cm->nc;
   }
 
+  if (geom_max_memory > 0) attach_cache();
+  update_cur_node();
+
   // calculate the order of the inverse reference map
   if (element->iro_cache == -1 && quad_2d->get_max_order() > 1)
   {
@@ -104,19 +140,23 @@ void RefMap::set_active_element(Element* e)
 }
 
 
+// The sons of anisotropic refinements of quads (4-7) halve the area only,
+// so const_jacobian follows the jacobian of the actual transform.
 void RefMap::push_transform(int son)
 {
+  double trj = get_transform_jacobian();
   Transformable::push_transform(son);
   update_cur_node();
-  const_jacobian *= 0.25;
+  const_jacobian *= get_transform_jacobian() / trj;
 }
 
 
 void RefMap::pop_transform()
 {
+  double trj = get_transform_jacobian();
   Transformable::pop_transform();
   update_cur_node();
-  const_jacobian *= 4;
+  const_jacobian *= get_transform_jacobian() / trj;
 }
 
 
@@ -129,13 +169,13 @@ void RefMap::calc_inv_ref_map(int order)
 
   AUTOLA_OR(double2x2, m, np);
   memset(m, 0, m.size);
-  ref_map_pss.force_transform(sub_idx, ctm);
+  pss->force_transform(sub_idx, ctm);
   for (i = 0; i < nc; i++)
   {
     double *dx, *dy;
-    ref_map_pss.set_active_shape(indices[i]);
-    ref_map_pss.set_quad_order(order);
-    ref_map_pss.get_dx_dy_values(dx, dy);
+    pss->set_active_shape(indices[i]);
+    pss->set_quad_order(order);
+    pss->get_dx_dy_values(dx, dy);
     for (j = 0; j < np; j++)
     {
       m[j][0][0] += coefs[i][0] * dx[j];
@@ -149,6 +189,7 @@ void RefMap::calc_inv_ref_map(int order)
   double trj = get_transform_jacobian();
   double2x2* irm = cur_node->inv_ref_map[order] = new double2x2[np];
   double* jac = cur_node->jacobian[order] = new double[np];
+  count_memory(np * (sizeof(double2x2) + sizeof(double)));
   for (i = 0; i < np; i++)
   {
     jac[i] = (m[i][0][0] * m[i][1][1] - m[i][0][1] * m[i][1][0]);
@@ -174,15 +215,15 @@ void RefMap::calc_second_ref_map(int order)
 
   AUTOLA_OR(double3x2, k, np);
   memset(k, 0, k.size);
-  ref_map_pss.force_transform(sub_idx, ctm);
+  pss->force_transform(sub_idx, ctm);
   for (i = 0; i < nc; i++)
   {
     double *dxy, *dxx, *dyy;
-    ref_map_pss.set_active_shape(indices[i]);
-    ref_map_pss.set_quad_order(order, H2D_FN_ALL);
-    dxx = ref_map_pss.get_dxx_values();
-    dyy = ref_map_pss.get_dyy_values();
-    dxy = ref_map_pss.get_dxy_values();
+    pss->set_active_shape(indices[i]);
+    pss->set_quad_order(order, H2D_FN_ALL);
+    dxx = pss->get_dxx_values();
+    dyy = pss->get_dyy_values();
+    dxy = pss->get_dxy_values();
     for (j = 0; j < np; j++)
     {
       k[j][0][0] += coefs[i][0] * dxx[j];
@@ -195,6 +236,7 @@ void RefMap::calc_second_ref_map(int order)
   }
 
   double3x2* mm = cur_node->second_ref_map[order] = new double3x2[np];
+  count_memory(np * sizeof(double3x2));
   double2x2* m = get_inv_ref_map(order);
   for (j = 0; j < np; j++)
   {
@@ -262,13 +304,14 @@ void RefMap::calc_phys_x(int order)
   // transform all x coordinates of the integration points
   int i, j, np = quad_2d->get_num_points(order);
   double* x = cur_node->phys_x[order] = new double[np];
+  count_memory(np * sizeof(double));
   memset(x, 0, np * sizeof(double));
-  ref_map_pss.force_transform(sub_idx, ctm);
+  pss->force_transform(sub_idx, ctm);
   for (i = 0; i < nc; i++)
   {
-    ref_map_pss.set_active_shape(indices[i]);
-    ref_map_pss.set_quad_order(order);
-    double* fn = ref_map_pss.get_fn_values();
+    pss->set_active_shape(indices[i]);
+    pss->set_quad_order(order);
+    double* fn = pss->get_fn_values();
     for (j = 0; j < np; j++)
       x[j] += coefs[i][0] * fn[j];
   }
@@ -280,13 +323,14 @@ void RefMap::calc_phys_y(int order)
   // transform all y coordinates of the integration points
   int i, j, np = quad_2d->get_num_points(order);
   double* y = cur_node->phys_y[order] = new double[np];
+  count_memory(np * sizeof(double));
   memset(y, 0, np * sizeof(double));
-  ref_map_pss.force_transform(sub_idx, ctm);
+  pss->force_transform(sub_idx, ctm);
   for (i = 0; i < nc; i++)
   {
-    ref_map_pss.set_active_shape(indices[i]);
-    ref_map_pss.set_quad_order(order);
-    double* fn = ref_map_pss.get_fn_values();
+    pss->set_active_shape(indices[i]);
+    pss->set_quad_order(order);
+    double* fn = pss->get_fn_values();
     for (j = 0; j < np; j++)
       y[j] += coefs[i][1] * fn[j];
   }
@@ -297,7 +341,8 @@ void RefMap::calc_tangent(int edge, int eo)
 {
   int i, j;
   int np = quad_2d->get_num_points(eo);
-  double3* tan = cur_node->tan[edge] = new double3[np];
+  double3* tan = cur_node->tan[eo] = new double3[np];
+  count_memory(np * sizeof(double3));
   int a = edge, b = element->next_vert(edge);
 
   if (!element->is_curved())
@@ -320,13 +365,13 @@ void RefMap::calc_tangent(int edge, int eo)
     static double2x2 m[15];
     assert(np <= 15);
     memset(m, 0, np*sizeof(double2x2));
-    ref_map_pss.force_transform(sub_idx, ctm);
+    pss->force_transform(sub_idx, ctm);
     for (i = 0; i < nc; i++)
     {
       double *dx, *dy;
-      ref_map_pss.set_active_shape(indices[i]);
-      ref_map_pss.set_quad_order(eo);
-      ref_map_pss.get_dx_dy_values(dx, dy);
+      pss->set_active_shape(indices[i]);
+      pss->set_quad_order(eo);
+      pss->get_dx_dy_values(dx, dy);
       for (j = 0; j < np; j++)
       {
         m[j][0][0] += coefs[i][0] * dx[j];
@@ -337,8 +382,8 @@ void RefMap::calc_tangent(int edge, int eo)
     }
 
     // multiply them by the vector of the reference edge
-    double2* v1 = ref_map_shapeset.get_ref_vertex(a);
-    double2* v2 = ref_map_shapeset.get_ref_vertex(b);
+    double2* v1 = pss->get_shapeset()->get_ref_vertex(a);
+    double2* v2 = pss->get_shapeset()->get_ref_vertex(b);
     double ex = (*v2)[0] - (*v1)[0];
     double ey = (*v2)[1] - (*v1)[1];
     for (i = 0; i < np; i++)
@@ -406,12 +451,12 @@ void RefMap::inv_ref_map_at_point(double xi1, double xi2, double& x, double& y,
   x = y = 0;
   for (int i = 0; i < nc; i++)
   {
-    double val = ref_map_shapeset.get_fn_value(indices[i], xi1, xi2, 0);
+    double val = pss->get_shapeset()->get_fn_value(indices[i], xi1, xi2, 0);
     x += coefs[i][0] * val;
     y += coefs[i][1] * val;
 
-    double dx =  ref_map_shapeset.get_dx_value(indices[i], xi1, xi2, 0);
-    double dy =  ref_map_shapeset.get_dy_value(indices[i], xi1, xi2, 0);
+    double dx =  pss->get_shapeset()->get_dx_value(indices[i], xi1, xi2, 0);
+    double dy =  pss->get_shapeset()->get_dy_value(indices[i], xi1, xi2, 0);
     tmp[0][0] += coefs[i][0] * dx;
     tmp[0][1] += coefs[i][0] * dy;
     tmp[1][0] += coefs[i][1] * dx;
@@ -469,11 +514,11 @@ void RefMap::init_node(Node** pp)
   memset(node->second_ref_map, 0, num_tables * sizeof(double3x2*));
   memset(node->phys_x, 0, num_tables * sizeof(double*));
   memset(node->phys_y, 0, num_tables * sizeof(double*));
-  memset(node->tan, 0, sizeof(node->tan));
+  memset(node->tan, 0, num_tables * sizeof(double3*));
 }
 
 
-void RefMap::free_node(Node* node)
+void RefMap::free_node(Node* node, int num_tables)
 {
   // destroy all precalculated tables
   for (int i = 0; i < num_tables; i++)
@@ -486,34 +531,168 @@ void RefMap::free_node(Node* node)
     if (node->second_ref_map[i] != NULL) delete [] node->second_ref_map[i];
     if (node->phys_x[i] != NULL) delete [] node->phys_x[i];
     if (node->phys_y[i] != NULL) delete [] node->phys_y[i];
+    if (node->tan[i] != NULL) delete [] node->tan[i];
   }
 
-  for (int i = 0; i < 4; i++)
-    if (node->tan[i] != NULL)
-      delete [] node->tan[i];
-
   delete node;
 }
 
 
-void RefMap::free()
+void RefMap::free_nodes(void*& nodes, int num_tables)
 {
   unsigned long idx = 0;
   Node** pp = (Node**) JudyLFirst(nodes, &idx, NULL);
   while (pp != NULL)
   {
-    free_node(*pp);
+    free_node(*pp, num_tables);
     pp = (Node**) JudyLNext(nodes, &idx, NULL);
   }
   JudyLFreeArray(&nodes, NULL);
+}
+
 
-  if (overflow != NULL) { free_node(overflow); overflow = NULL; }
+void RefMap::free()
+{
+  if (entry != NULL) release_cache();
+  free_nodes(nodes, num_tables);
+
+  if (overflow != NULL) { free_node(overflow, num_tables); overflow = NULL; }
 }
 
 
 RefMap::Node** RefMap::handle_overflow()
 {
-  if (overflow != NULL) free_node(overflow);
+  if (overflow != NULL) free_node(overflow, num_tables);
   overflow = NULL;
   return &overflow;
 }
+
+
+//// geometry cache ////////////////////////////////////////////////////////////////////////////////
+
+void RefMap::free_entry(GeomCacheEntry* entry)
+{
+  // called with geom_mutex locked, for entries not in use
+  geom_cache.erase(std::make_pair(entry->e, entry->quad));
+  geom_lru.erase(entry->lru);
+  geom_memory -= entry->bytes;
+  free_nodes(entry->nodes, entry->num_tables);
+  delete entry;
+}
+
+
+void RefMap::attach_cache()
+{
+  pthread_mutex_lock(&geom_mutex);
+  std::pair<Element*, Quad2D*> key(element, quad_2d);
+  GeomCacheMap::iterator it = geom_cache.find(key);
+  GeomCacheEntry* ce = (it != geom_cache.end()) ? it->second : NULL;
+
+  // an element of another geometry at the same address (or a different type)
+  if (ce != NULL && (ce->mode != element->get_mode() || (int) ce->coefs.size() != 2*nc ||
+                     memcmp(&ce->coefs.front(), coefs, nc * sizeof(double2))))
+  {
+    if (ce->refs == 0) free_entry(ce);
+    ce = NULL;
+    if (geom_cache.count(key)) { pthread_mutex_unlock(&geom_mutex); return; }
+  }
+
+  if (ce == NULL)
+  {
+    ce = new GeomCacheEntry;
+    ce->e = element;
+    ce->quad = quad_2d;
+    ce->mode = element->get_mode();
+    ce->num_tables = num_tables;
+    ce->coefs.assign(coefs[0], coefs[0] + 2*nc);
+    ce->nodes = NULL;
+    ce->bytes = 0;
+    ce->refs = 0;
+    geom_cache[key] = ce;
+    geom_misses++;
+  }
+  else if (ce->refs > 0 && !pthread_equal(ce->owner, pthread_self()))
+  {
+    // in use by another thread: calculate the tables privately
+    pthread_mutex_unlock(&geom_mutex);
+    return;
+  }
+  else
+  {
+    if (ce->refs == 0) geom_lru.erase(ce->lru);
+    geom_hits++;
+  }
+
+  if (ce->refs++ == 0) ce->owner = pthread_self();
+  pthread_mutex_unlock(&geom_mutex);
+
+  entry = ce;
+  pnodes = &ce->nodes;
+}
+
+
+void RefMap::release_cache()
+{
+  pthread_mutex_lock(&geom_mutex);
+  if (--entry->refs == 0)
+  {
+    geom_lru.push_front(entry);
+    entry->lru = geom_lru.begin();
+
+    // free the least recently used entries over the limit
+    while (geom_memory > geom_max_memory && !geom_lru.empty())
+      free_entry(geom_lru.back());
+  }
+  pthread_mutex_unlock(&geom_mutex);
+
+  entry = NULL;
+  pnodes = &nodes;
+  cur_node = NULL;
+}
+
+
+void RefMap::count_memory(size_t bytes)
+{
+  if (entry == NULL || cur_node == overflow) return;
+  pthread_mutex_lock(&geom_mutex);
+  entry->bytes += bytes;
+  geom_memory += bytes;
+  pthread_mutex_unlock(&geom_mutex);
+}
+
+
+void RefMap::set_geometry_cache(size_t max_memory)
+{
+  pthread_mutex_lock(&geom_mutex);
+  geom_max_memory = max_memory;
+  while (geom_memory > geom_max_memory && !geom_lru.empty())
+    free_entry(geom_lru.back());
+  pthread_mutex_unlock(&geom_mutex);
+}
+
+
+void RefMap::free_geometry_cache()
+{
+  pthread_mutex_lock(&geom_mutex);
+  while (!geom_lru.empty())
+    free_entry(geom_lru.back());
+  pthread_mutex_unlock(&geom_mutex);
+}
+
+
+size_t RefMap::get_geometry_cache_memory()
+{
+  pthread_mutex_lock(&geom_mutex);
+  size_t memory = geom_memory;
+  pthread_mutex_unlock(&geom_mutex);
+  return memory;
+}
+
+
+void RefMap::get_geometry_cache_stats(int& hits, int& misses)
+{
+  pthread_mutex_lock(&geom_mutex);
+  hits = geom_hits;
+  misses = geom_misses;
+  pthread_mutex_unlock(&geom_mutex);
+}
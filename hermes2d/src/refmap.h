@@ -21,6 +21,7 @@
 #include "quad_all.h"
 
 struct Element;
+struct GeomCacheEntry;
 
 
 /// \brief Represents the reference mapping.
@@ -45,6 +46,11 @@ public:
   /// Returns the current quadrature points.
   Quad2D* get_quad_2d() const { return quad_2d; }
 
+  /// Sets the precalculated shapeset used to evaluate the reference map. By default,
+  /// all reference maps share one; a reference map used in another thread needs its own.
+  /// \param pss [in] A PrecalcShapeset of the H1ShapesetJacobi.
+  void set_pss(PrecalcShapeset* pss);
+
   /// Returns the 1D quadrature for use in surface integrals.
   const Quad1D* get_quad_1d() const { return &quad_1d; }
 
@@ -113,7 +119,7 @@ public:
   /// curved) edge at the 1D integration points along the edge. The maximum
   /// 1D quadrature rule is used by default, but the user may specify his own
   /// order. In this case, the edge pseudo-order is expected (as returned by 
-  /// Quad2D::get_edge_points).
+  /// Quad2D::get_edge_points), which also identifies the edge.
   double3* get_tangent(int edge, int order = -1)
   {
     if(quad_2d == NULL)
@@ -121,15 +127,8 @@ public:
     if (order == -1)
       order = quad_2d->get_edge_points(edge);
   
-    // NOTE: Order-based caching of geometric data is already employed in DiscreteProblem.
-    if(cur_node->tan[edge] != NULL)
-    {
-      delete[] cur_node->tan[edge];
-      cur_node->tan[edge] = NULL;
-    }
-    calc_tangent(edge, order);
-    
-    return cur_node->tan[edge];
+    if (cur_node->tan[order] == NULL) calc_tangent(edge, order);
+    return cur_node->tan[order];
   }
 
   /// Transforms physical coordinates x, y from the element e back to the reference domain.
@@ -148,6 +147,24 @@ public:
   /// Frees all data associated with the instance.
   void free();
 
+  /// \brief Enables the geometry cache shared by all reference maps.
+  /// \details By default, a reference map discards its tables (jacobians, inverse maps,
+  /// physical coordinates) when it moves to another element. With the cache, the tables
+  /// are kept and reused by any reference map visiting an element of the same geometry
+  /// with the same quadrature later, e.g., in the next assembly, in error estimation
+  /// or in norms. Reference maps in one thread share the tables of an element. Once the
+  /// tables of the elements not in use take more than 'max_memory' bytes, the least
+  /// recently used ones are freed. Zero (the default) disables the cache. An element is
+  /// recognized by its address and the coefficients of its reference map, so the tables
+  /// of moved or deleted elements are never reused.
+  static void set_geometry_cache(size_t max_memory);
+  /// Frees all tables in the geometry cache not used at the moment.
+  static void free_geometry_cache();
+  /// Returns the memory taken by the geometry cache, in bytes.
+  static size_t get_geometry_cache_memory();
+  /// Returns the number of elements found and not found in the geometry cache.
+  static void get_geometry_cache_stats(int& hits, int& misses);
+
   /// For internal use only.
   void force_transform(uint64_t sub_idx, Trf* ctm)
   {
@@ -162,6 +179,7 @@ public:
 protected:
 
   Quad2D* quad_2d;
+  PrecalcShapeset* pss;
   int num_tables;
 
   bool is_const;
@@ -179,24 +197,29 @@ protected:
     double3x2* second_ref_map[H2D_MAX_TABLES];
     double* phys_x[H2D_MAX_TABLES];
     double* phys_y[H2D_MAX_TABLES];
-    double3* tan[4];
+    double3* tan[H2D_MAX_TABLES]; ///< by the edge pseudo-order
   };
 
   void* nodes;
+  void** pnodes; ///< the nodes in use: &nodes, or the nodes of the cache entry
   Node* cur_node;
   Node* overflow;
 
+  GeomCacheEntry* entry; ///< the geometry cache entry of the element, or NULL
+
   void update_cur_node()
   {
     Node** pp = NULL;
     if (sub_idx > H2D_MAX_IDX)
       pp = handle_overflow();
     else {
-      pp = (Node**) JudyLIns(&nodes, (Word_t)sub_idx, NULL);
+      pp = (Node**) JudyLIns(pnodes, (Word_t)sub_idx, NULL);
       //debug_assert((sub_idx >> (sizeof(Word_t) * 8)) == 0, "E index is larger than JudyLins can contain (RefMap::update_cur_node)");
     }
-    if (*pp == NULL) init_node(pp);
+    bool created = (*pp == NULL);
+    if (created) init_node(pp);
     cur_node = *pp;
+    if (created && entry != NULL) count_memory(sizeof(Node));
   }
 
   void calc_inv_ref_map(int order);
@@ -214,9 +237,15 @@ protected:
 
 
   void init_node(Node** pp);
-  void free_node(Node* node);
+  static void free_node(Node* node, int num_tables);
+  static void free_nodes(void*& nodes, int num_tables);
   Node** handle_overflow();
 
+  void attach_cache();
+  void release_cache();
+  void count_memory(size_t bytes);
+  static void free_entry(GeomCacheEntry* entry);
+
   Quad1DStd quad_1d;
 
   int indices[70];
@@ -235,12 +235,22 @@ void Solution::copy(const Solution* sln)
 {
   if (sln->type == UNDEF) error("Solution being copied is uninitialized.");
 
-  free();
-
-  mesh = new Mesh;
+  Mesh* mesh = new Mesh;
   //printf("Copying mesh from Solution and setting own_mesh = true.\n");
   mesh->copy(sln->mesh);
+  copy(sln, mesh);
   own_mesh = true;
+}
+
+
+void Solution::copy(const Solution* sln, Mesh* mesh)
+{
+  if (sln->type == UNDEF) error("Solution being copied is uninitialized.");
+
+  free();
+
+  this->mesh = mesh;
+  own_mesh = false;
 
   type = sln->type;
   space_type = sln->space_type;
@@ -1174,6 +1184,39 @@ scalar Solution::get_ref_value(Element* e, double xi1, double xi2, int component
 }
 
 
+void Solution::get_ref_values(Element* e, int np, const double2* pts, scalar* result,
+                              int component, int item)
+{
+  if (type != SLN) error("Solution::get_ref_values() works only for solutions given by coefficients.");
+
+  // the values need no derivative coefficients, so the element is not activated for them
+  scalar* mono;
+  if (item == 0)
+    mono = mono_coefs + elem_coefs[component][e->id];
+  else {
+    set_active_element(e);
+    mono = dxdy_coefs[component][item];
+  }
+
+  int o = elem_orders[e->id];
+  bool quad = e->is_quad();
+  for (int p = 0; p < np; p++)
+  {
+    double xi1 = pts[p][0], xi2 = pts[p][1];
+    scalar r = 0.0;
+    int k = 0;
+    for (int i = 0; i <= o; i++)
+    {
+      scalar row = mono[k++];
+      for (int j = 0; j < (quad ? o : i); j++)
+        row = row * xi1 + mono[k++];
+      r = r * xi2 + row;
+    }
+    result[p] = r;
+  }
+}
+
+
 static inline bool is_in_ref_domain(Element* e, double xi1, double xi2)
 {
   const double TOL = 1e-11;
@@ -72,6 +72,9 @@ public:
     this->sub_idx = sub_idx;
     this->ctm = ctm;
   }
+  /// Makes the reference map use 'pss' instead of the shared one (see RefMap::set_pss()).
+  void set_refmap_pss(PrecalcShapeset* pss)
+    { refmap->set_pss(pss); }
 
 };
 
@@ -99,9 +102,17 @@ public:
   void assign(Solution* sln);
   Solution& operator = (Solution& sln) { assign(&sln); return *this; }
   void copy(const Solution* sln);
+  /// Like copy(), but the copy refers to 'mesh', which must be a copy of the mesh
+  /// of 'sln', instead of copying the mesh. The mesh is not owned by the copy.
+  void copy(const Solution* sln, Mesh* mesh);
 
   int* get_element_orders() { return this->elem_orders;}
 
+  /// Returns the array of monomial coefficients (get_num_coefs() entries). The
+  /// array is reallocated whenever the solution is set again.
+  scalar* get_mono_coefs() { return this->mono_coefs; }
+  int get_num_coefs() const { return this->num_coefs; }
+
   void set_exact(Mesh* mesh, ExactFunction exactfn);
   void set_exact(Mesh* mesh, ExactFunction2 exactfn);
 
@@ -139,6 +150,10 @@ public:
   /// enough for calculations.
   scalar get_ref_value(Element* e, double xi1, double xi2, int component = 0, int item = 0);
 
+  /// Like get_ref_value(), but for 'np' reference domain points of the element at once.
+  void get_ref_values(Element* e, int np, const double2* pts, scalar* result,
+                      int component = 0, int item = 0);
+
   /// Returns solution value or derivatives (correctly transformed) at element e, in its reference
   /// domain point (xi1, xi2). 'item' controls the returned value: 0 = value, 1 = dx, 2 = dy,
   /// 3 = dxx, 4 = dyy, 5 = dxy.
@@ -17,6 +17,7 @@
 #include "space.h"
 #include "../matrix_old.h"
 #include "../auto_local_array.h"
+#include "../../../hermes_common/dof_ordering.h"
 
 Space::Space(Mesh* mesh, Shapeset* shapeset, BCType (*bc_type_callback)(int), 
              scalar (*bc_value_callback_by_coord)(int, double, double), int p_init)
@@ -33,6 +34,7 @@ Space::Space(Mesh* mesh, Shapeset* shapeset, BCType (*bc_type_callback)(int),
   this->seq = 0;
   this->was_assigned = false;
   this->ndof = 0;
+  this->dof_ordering = H2D_DOF_ORDER_NATURAL;
 
   this->set_bc_types_init(bc_type_callback);
   this->set_essential_bc_values(bc_value_callback_by_coord);
@@ -341,6 +343,9 @@ int Space::assign_dofs(int first_dof, int stride)
   assign_edge_dofs();
   assign_bubble_dofs();
 
+  dof_perm.clear();
+  if (dof_ordering == H2D_DOF_ORDER_RCM) reorder_dofs();
+
   free_extra_data();
   update_essential_bc_values();
   update_constraints();
@@ -353,6 +358,46 @@ int Space::assign_dofs(int first_dof, int stride)
   return this->ndof;
 }
 
+void Space::set_dof_ordering(DofOrdering ordering)
+{
+  if (ordering == dof_ordering) return;
+  dof_ordering = ordering;
+  seq++;
+  if (was_assigned) assign_dofs(first_dof, stride);
+}
+
+
+void Space::reorder_dofs()
+{
+  // collect the DOF blocks and the blocks of every element
+  DofBlockGraph g;
+  std::vector<int> node_block(mesh->get_max_node_id(), -1);
+
+  Element* e;
+  for_all_active_elements(e, mesh)
+  {
+    for (unsigned int i = 0; i < e->nvert; i++)
+    {
+      Node* nodes[2] = { e->vn[i], e->en[i] };
+      for (int j = 0; j < 2; j++)
+      {
+        NodeData* nd = ndata + nodes[j]->id;
+        if (nd->dof < 0 || nd->n <= 0) continue;
+        int& b = node_block[nodes[j]->id];
+        if (b < 0) b = g.add_block(&nd->dof, nd->n);
+        else g.add_block(b);
+      }
+    }
+    ElementData* ed = edata + e->id;
+    if (ed->n > 0) g.add_block(&ed->bdof, ed->n);
+    g.end_element();
+  }
+
+  if (!rcm_renumber_dof_blocks(g, first_dof, stride, (next_dof - first_dof) / stride, dof_perm))
+    warn("Unexpected DOF structure of the space, the DOFs were not reordered.");
+}
+
+
 void Space::reset_dof_assignment() {
   // First assume that all vertex nodes are part of a natural BC. the member NodeData::n
   // is misused for this purpose, since it stores nothing at this point. Also assume
@@ -493,6 +538,7 @@ void Space::copy_callbacks(const Space* space)
   bc_type_callback = space->bc_type_callback;
   bc_value_callback_by_coord = space->bc_value_callback_by_coord;
   bc_value_callback_by_edge  = space->bc_value_callback_by_edge;
+  dof_ordering = space->dof_ordering;
 }
 
 
@@ -55,6 +55,7 @@ private:
   int top, size;
 
   int id;
+  const int* base_ids;
   bool tri;
   Element* base;
   int4* sons;
@@ -0,0 +1,720 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef _WIN32
+# include <unistd.h>
+#endif
+#include "../common.h"
+#include "../solution.h"
+#include "../space/space.h"
+#include "image_view.h"
+#include "order_view.h"
+#include "view_data.h"
+
+void* image_view_thread(void* arg);
+void* image_view_band_thread(void* arg);
+
+
+//// ImageView /////////////////////////////////////////////////////////////////////////////////////
+
+ImageView::ImageView(const char* format, int width, int height)
+{
+  this->format = format;
+  const char* ext = strrchr(format, '.');
+  if (ext != NULL && !strcmp(ext, ".png")) png = true;
+  else if (ext != NULL && !strcmp(ext, ".ppm")) png = false;
+  else error("ImageView: unknown image format of '%s' (use .png or .ppm).", format);
+
+  if (width < 16 || height < 16) error("ImageView: invalid image size %d x %d.", width, height);
+  this->width = width;
+  this->height = height;
+  mode = MODE_SCALAR;
+
+  interval = 1;
+  calls = frame_no = dropped = 0;
+#ifdef _WIN32
+  num_threads = 2;
+#else
+  num_threads = std::max(1, std::min(16, (int) sysconf(_SC_NPROCESSORS_ONLN)));
+#endif
+
+  pal_type = H2DV_PT_DEFAULT;
+  pal_steps = 50;
+  create_palette();
+  range_auto = true;
+  range_min = 0;
+  range_max = 1;
+
+  show_edges = false;
+  contours = false;
+  cont_orig = 0.0;
+  cont_step = 0.2;
+  arrow_spacing = 20;
+
+  pixels = new unsigned char[3 * width * height];
+  values = new float[width * height];
+  covered = new bool[width * height];
+  arrows = new float[3 * (width / arrow_spacing + 1) * (height / arrow_spacing + 1)];
+  px = py = NULL;
+
+  async = NULL;
+  thread_running = busy = false;
+  pthread_mutex_init(&busy_mutex, NULL);
+}
+
+
+ImageView::~ImageView()
+{
+  // the writer thread and the worker of 'async' may still use the view
+  wait_for_frame();
+  delete async;
+  async = NULL;
+  pthread_mutex_destroy(&busy_mutex);
+  delete [] pixels;
+  delete [] values;
+  delete [] covered;
+  delete [] arrows;
+  delete [] px;
+  delete [] py;
+}
+
+
+void ImageView::set_interval(int interval)
+{
+  if (interval < 1) error("ImageView: the interval must be positive.");
+  this->interval = interval;
+}
+
+
+void ImageView::set_num_threads(int num)
+{
+  num_threads = std::max(1, num);
+}
+
+
+void ImageView::set_min_max_range(double min, double max)
+{
+  if (max < min) { std::swap(min, max); warn("Upper bound smaller than lower bound: swapping"); }
+  range_auto = false;
+  range_min = min;
+  range_max = max;
+}
+
+
+void ImageView::auto_min_max_range()
+{
+  range_auto = true;
+}
+
+
+void ImageView::set_palette(ViewPaletteType type)
+{
+  wait_for_frame();
+  pal_type = type;
+  create_palette();
+}
+
+
+void ImageView::set_num_palette_steps(int num)
+{
+  wait_for_frame();
+  pal_steps = std::max(2, std::min(256, num));
+  create_palette();
+}
+
+
+void ImageView::show_contours(double step, double orig)
+{
+  if (step == 0.0) step = 1.0;
+  contours = true;
+  cont_orig = orig;
+  cont_step = step;
+}
+
+
+void ImageView::set_arrow_spacing(int pixels)
+{
+  wait_for_frame();
+  arrow_spacing = std::max(4, pixels);
+  delete [] arrows;
+  arrows = new float[3 * (width / arrow_spacing + 1) * (height / arrow_spacing + 1)];
+}
+
+
+//// palette ///////////////////////////////////////////////////////////////////////////////////////
+
+// the same colors as in OrderView
+static int order_palette[] =
+{
+  0x7f7f7f, 0x7f2aff, 0x2a2aff, 0x2a7fff, 0x00d4aa, 0x00aa44,
+  0xabc837, 0xffd42a, 0xc87137, 0xc83737, 0xff0000
+};
+
+
+void ImageView::get_palette_color(double x, float* color)
+{
+  if (pal_type == H2DV_PT_HUESCALE || pal_type == H2DV_PT_DEFAULT) {
+    if (x < 0.0) x = 0.0;
+    else if (x > 1.0) x = 1.0;
+    x *= num_pal_entries;
+    int n = (int)x;
+    color[0] = palette_data[n][0];
+    color[1] = palette_data[n][1];
+    color[2] = palette_data[n][2];
+  }
+  else if (pal_type == H2DV_PT_GRAYSCALE)
+    color[0] = color[1] = color[2] = (float)x;
+  else if (pal_type == H2DV_PT_INVGRAYSCALE)
+    color[0] = color[1] = color[2] = (float)(1.0 - x);
+  else
+    color[0] = color[1] = color[2] = 1.0f;
+}
+
+
+void ImageView::create_palette()
+{
+  // the same as View::create_gl_palette()
+  float color[3];
+  for (int i = 0; i < pal_steps; i++)
+  {
+    get_palette_color((double) i / pal_steps, color);
+    palette[i][0] = (unsigned char) (color[0] * 255);
+    palette[i][1] = (unsigned char) (color[1] * 255);
+    palette[i][2] = (unsigned char) (color[2] * 255);
+  }
+  for (int i = pal_steps; i < 256; i++)
+    memcpy(palette[i], palette[pal_steps-1], 3);
+}
+
+
+//// show //////////////////////////////////////////////////////////////////////////////////////////
+
+void ImageView::show(MeshFunction* sln, double eps, int item)
+{
+  if (!begin_frame()) return;
+  double max_abs = range_auto ? -1.0 : std::max(fabs(range_min), fabs(range_max));
+  lin.process_solution(sln, item, eps, max_abs);
+  mode = MODE_SCALAR;
+  end_frame();
+}
+
+
+void ImageView::show_async(Solution* sln, double eps, int item)
+{
+  if (calls++ % interval) return;
+  if (async == NULL)
+  {
+    // from now on the frames are written by the worker of 'async' only
+    wait_for_frame();
+    async = new AsyncLinearizer(&lin);
+    async->set_callback(async_updated, this);
+  }
+  double max_abs = range_auto ? -1.0 : std::max(fabs(range_min), fabs(range_max));
+  async->process_solution(sln, item, eps, max_abs);
+}
+
+
+void ImageView::async_updated(Linearizer* lin, Solution* sln, void* data)
+{
+  // called in the worker thread of AsyncLinearizer, which also waits for the
+  // frame to be written, so that 'lin' is not swapped while being rasterized.
+  // The calling thread does not touch the frame state in the meantime: show()
+  // refuses to run with show_async() and wait_for_frame() flushes 'async' first.
+  ImageView* view = (ImageView*) data;
+  view->mode = MODE_SCALAR;
+  view->end_frame();
+  if (view->thread_running)
+  {
+    pthread_join(view->thread, NULL);
+    view->thread_running = false;
+  }
+}
+
+
+void ImageView::show(MeshFunction* xsln, MeshFunction* ysln, double eps, int xitem, int yitem)
+{
+  if (!begin_frame()) return;
+  vec.process_solution(xsln, xitem, ysln, yitem, eps);
+  mode = MODE_VECTOR;
+  end_frame();
+}
+
+
+void ImageView::show(Space* space)
+{
+  if (!space->is_up_to_date())
+    error("The space is not up to date.");
+  if (!begin_frame()) return;
+  ord.process_solution(space);
+  mode = MODE_ORDER;
+  end_frame();
+}
+
+
+void ImageView::show(Mesh* mesh)
+{
+  if (mesh == NULL) error("mesh == NULL in ImageView::show().");
+  if (!begin_frame()) return;
+  Solution sln;
+  sln.set_zero(mesh);
+  lin.process_solution(&sln);
+  mode = MODE_MESH;
+  end_frame();
+}
+
+
+bool ImageView::begin_frame()
+{
+  if (async != NULL) error("ImageView: show() cannot be mixed with show_async().");
+  if (calls++ % interval) return false;
+
+  if (thread_running)
+  {
+    pthread_mutex_lock(&busy_mutex);
+    bool still_busy = busy;
+    pthread_mutex_unlock(&busy_mutex);
+    if (still_busy)
+    {
+      dropped++;
+      verbose("ImageView: frame dropped, the previous one is still being written.");
+      return false;
+    }
+    pthread_join(thread, NULL);
+    thread_running = false;
+  }
+  return true;
+}
+
+
+Linearizer* ImageView::get_data()
+{
+  if (mode == MODE_VECTOR) return &vec;
+  if (mode == MODE_ORDER) return &ord;
+  return &lin;
+}
+
+
+void ImageView::end_frame()
+{
+  Linearizer* data = get_data();
+  int nv = data->get_num_vertices();
+  if (nv == 0 || data->get_num_triangles() == 0) { warn("ImageView: nothing to show."); return; }
+
+  // value range
+  value_min = data->get_min_value();
+  value_max = data->get_max_value();
+  if (mode == MODE_SCALAR && (value_max - value_min) < 1e-8) value_min -= 0.5;
+  if (range_auto || mode == MODE_ORDER || mode == MODE_MESH) { range_min = value_min; range_max = value_max; }
+  else { value_min = range_min; value_max = range_max; }
+
+  // fit the bounding box of the vertices into the image, keeping the aspect ratio
+  double max_x, max_y;
+  data->calc_vertices_aabb(&min_x, &max_x, &min_y, &max_y);
+  const int margin = 10;
+  double sx = (width - 2*margin) / std::max(max_x - min_x, 1e-12);
+  double sy = (height - 2*margin) / std::max(max_y - min_y, 1e-12);
+  scale = std::min(sx, sy);
+  off_x = 0.5 * (width - scale * (max_x - min_x));
+  off_y = 0.5 * (height - scale * (max_y - min_y));
+
+  delete [] px;
+  delete [] py;
+  px = new double[nv];
+  py = new double[nv];
+  if (mode == MODE_VECTOR)
+  {
+    double4* verts = vec.get_vertices();
+    for (int i = 0; i < nv; i++) {
+      px[i] = off_x + (verts[i][0] - min_x) * scale;
+      py[i] = height - (off_y + (verts[i][1] - min_y) * scale);
+    }
+  }
+  else
+  {
+    double3* verts = data->get_vertices();
+    for (int i = 0; i < nv; i++) {
+      px[i] = off_x + (verts[i][0] - min_x) * scale;
+      py[i] = height - (off_y + (verts[i][1] - min_y) * scale);
+    }
+  }
+
+  // the data is not touched by show() until the frame is written
+  busy = true;
+  if (pthread_create(&thread, NULL, image_view_thread, this))
+    error("ImageView: could not create the rendering thread.");
+  thread_running = true;
+}
+
+
+int ImageView::get_num_frames() const
+{
+  // frame_no is incremented by the writer thread
+  pthread_mutex_lock(&busy_mutex);
+  int n = frame_no;
+  pthread_mutex_unlock(&busy_mutex);
+  return n;
+}
+
+
+void ImageView::wait_for_frame()
+{
+  if (async != NULL) async->flush();
+  if (!thread_running) return;
+  pthread_join(thread, NULL);
+  thread_running = false;
+}
+
+
+void* image_view_thread(void* arg)
+{
+  ImageView* view = (ImageView*) arg;
+  view->render();
+
+  char filename[1024];
+  snprintf(filename, sizeof(filename), view->format.c_str(), view->frame_no);
+  if (view->png) view->write_png(filename);
+  else view->write_ppm(filename);
+
+  pthread_mutex_lock(&view->busy_mutex);
+  view->frame_no++;
+  view->busy = false;
+  pthread_mutex_unlock(&view->busy_mutex);
+  return NULL;
+}
+
+
+//// rasterization /////////////////////////////////////////////////////////////////////////////////
+
+struct ImageBand
+{
+  ImageView* view;
+  int y0, y1;
+  bool contours;
+};
+
+
+void* image_view_band_thread(void* arg)
+{
+  ImageBand* band = (ImageBand*) arg;
+  if (band->contours) band->view->contour_band(band->y0, band->y1);
+  else band->view->fill_band(band->y0, band->y1);
+  return NULL;
+}
+
+
+void ImageView::render()
+{
+  memset(pixels, 255, 3 * width * height);
+  memset(covered, 0, width * height * sizeof(bool));
+  int na = 3 * (width / arrow_spacing + 1) * (height / arrow_spacing + 1);
+  for (int i = 0; i < na; i += 3) arrows[i] = 0.0f;
+
+  // fill the triangles (and then draw the contours) in horizontal bands, one thread per band
+  int nb = std::min(num_threads, height);
+  ImageBand* bands = new ImageBand[nb];
+  pthread_t* threads = new pthread_t[nb];
+  for (int pass = 0; pass < (contours && mode == MODE_SCALAR ? 2 : 1); pass++)
+  {
+    for (int i = 0; i < nb; i++)
+    {
+      bands[i].view = this;
+      bands[i].y0 = height * i / nb;
+      bands[i].y1 = height * (i+1) / nb;
+      bands[i].contours = (pass == 1);
+    }
+    for (int i = 1; i < nb; i++)
+      if (pthread_create(threads + i, NULL, image_view_band_thread, bands + i))
+        error("ImageView: could not create a rendering thread.");
+    image_view_band_thread(bands);
+    for (int i = 1; i < nb; i++)
+      pthread_join(threads[i], NULL);
+  }
+  delete [] bands;
+  delete [] threads;
+
+  // element edges
+  if (show_edges || mode == MODE_ORDER || mode == MODE_MESH)
+  {
+    static const unsigned char edge_color[3] = { 77, 77, 77 };
+    static const unsigned char mesh_color[3] = { 0, 0, 0 };
+    const unsigned char* color = (mode == MODE_SCALAR || mode == MODE_VECTOR) ? edge_color : mesh_color;
+    Linearizer* data = get_data();
+    int3* edges = data->get_edges();
+    for (int i = 0; i < data->get_num_edges(); i++)
+      draw_line(px[edges[i][0]], py[edges[i][0]], px[edges[i][1]], py[edges[i][1]], color);
+  }
+
+  if (mode == MODE_VECTOR) draw_arrows();
+}
+
+
+void ImageView::fill_band(int y0, int y1)
+{
+  Linearizer* data = get_data();
+  int3* tris = data->get_triangles();
+  int nt = data->get_num_triangles();
+  double3* verts = (mode == MODE_VECTOR) ? NULL : data->get_vertices();
+  double4* vverts = (mode == MODE_VECTOR) ? vec.get_vertices() : NULL;
+
+  double irange = (value_max - value_min) < 1e-8 ? 1.0 : 1.0 / (value_max - value_min);
+  int ncols = width / arrow_spacing + 1;
+  int half = arrow_spacing / 2;
+
+  static const unsigned char mesh_fill[3] = { 230, 230, 230 };
+
+  for (int t = 0; t < nt; t++)
+  {
+    int i0 = tris[t][0], i1 = tris[t][1], i2 = tris[t][2];
+    double x0 = px[i0], x1 = px[i1], x2 = px[i2];
+    double ty0 = py[i0], ty1 = py[i1], ty2 = py[i2];
+
+    // rows of this band covered by the triangle
+    int ymin = std::max(y0, (int) floor(std::min(ty0, std::min(ty1, ty2))));
+    int ymax = std::min(y1 - 1, (int) ceil(std::max(ty0, std::max(ty1, ty2))));
+    if (ymin > ymax) continue;
+    int xmin = std::max(0, (int) floor(std::min(x0, std::min(x1, x2))));
+    int xmax = std::min(width - 1, (int) ceil(std::max(x0, std::max(x1, x2))));
+    if (xmin > xmax) continue;
+
+    double area = (x1 - x0) * (ty2 - ty0) - (x2 - x0) * (ty1 - ty0);
+    if (fabs(area) < 1e-12) continue;
+    double iarea = 1.0 / area;
+
+    // flat color of orders and meshes
+    const unsigned char* flat = mesh_fill;
+    unsigned char order_color[3];
+    if (mode == MODE_ORDER)
+    {
+      int o = std::max(0, std::min(H2DV_MAX_VIEWABLE_ORDER, (int) verts[i0][2]));
+      if (pal_type == H2DV_PT_DEFAULT) {
+        order_color[0] = (unsigned char) (order_palette[o] >> 16);
+        order_color[1] = (unsigned char) ((order_palette[o] >> 8) & 0xff);
+        order_color[2] = (unsigned char) (order_palette[o] & 0xff);
+      }
+      else {
+        float color[3];
+        get_palette_color(o / (double) H2DV_MAX_VIEWABLE_ORDER, color);
+        for (int k = 0; k < 3; k++) order_color[k] = (unsigned char) (color[k] * 255);
+      }
+      flat = order_color;
+    }
+
+    for (int y = ymin; y <= ymax; y++)
+    {
+      double cy = y + 0.5;
+      for (int x = xmin; x <= xmax; x++)
+      {
+        // barycentric coordinates of the pixel center
+        double cx = x + 0.5;
+        double l1 = ((cx - x0) * (ty2 - ty0) - (x2 - x0) * (cy - ty0)) * iarea;
+        double l2 = ((x1 - x0) * (cy - ty0) - (cx - x0) * (ty1 - ty0)) * iarea;
+        double l0 = 1.0 - l1 - l2;
+        const double tol = -1e-9;
+        if (l0 < tol || l1 < tol || l2 < tol) continue;
+
+        int k = y * width + x;
+        unsigned char* pix = pixels + 3*k;
+        covered[k] = true;
+
+        if (mode == MODE_SCALAR || mode == MODE_VECTOR)
+        {
+          double v;
+          if (mode == MODE_SCALAR)
+            v = l0 * verts[i0][2] + l1 * verts[i1][2] + l2 * verts[i2][2];
+          else
+          {
+            double vx = l0 * vverts[i0][2] + l1 * vverts[i1][2] + l2 * vverts[i2][2];
+            double vy = l0 * vverts[i0][3] + l1 * vverts[i1][3] + l2 * vverts[i2][3];
+            v = sqrt(vx*vx + vy*vy);
+            if (x % arrow_spacing == half && y % arrow_spacing == half)
+            {
+              float* a = arrows + 3 * ((y / arrow_spacing) * ncols + x / arrow_spacing);
+              a[0] = 1.0f; a[1] = (float) vx; a[2] = (float) vy;
+            }
+          }
+          values[k] = (float) v;
+          int index = (int) ((v - value_min) * irange * pal_steps);
+          index = std::max(0, std::min(pal_steps - 1, index));
+          memcpy(pix, palette[index], 3);
+        }
+        else
+          memcpy(pix, flat, 3);
+      }
+    }
+  }
+}
+
+
+void ImageView::contour_band(int y0, int y1)
+{
+  // a pixel is on a contour if its right or lower neighbor lies in another
+  // interval [orig + k*step, orig + (k+1)*step)
+  for (int y = y0; y < y1; y++)
+    for (int x = 0; x < width; x++)
+    {
+      int k = y * width + x;
+      if (!covered[k]) continue;
+      double b = floor((values[k] - cont_orig) / cont_step);
+      bool edge = false;
+      if (x + 1 < width && covered[k+1] && floor((values[k+1] - cont_orig) / cont_step) != b) edge = true;
+      if (y + 1 < height && covered[k+width] && floor((values[k+width] - cont_orig) / cont_step) != b) edge = true;
+      if (edge) memset(pixels + 3*k, 0, 3);
+    }
+}
+
+
+void ImageView::draw_line(double x0, double y0, double x1, double y1, const unsigned char* color)
+{
+  int n = (int) ceil(std::max(fabs(x1 - x0), fabs(y1 - y0))) + 1;
+  for (int i = 0; i <= n; i++)
+  {
+    int x = (int) (x0 + (x1 - x0) * i / n);
+    int y = (int) (y0 + (y1 - y0) * i / n);
+    if (x >= 0 && x < width && y >= 0 && y < height)
+      memcpy(pixels + 3 * (y * width + x), color, 3);
+  }
+}
+
+
+void ImageView::draw_arrows()
+{
+  static const unsigned char black[3] = { 0, 0, 0 };
+  int ncols = width / arrow_spacing + 1;
+  int nrows = height / arrow_spacing + 1;
+  double max = std::max(fabs(value_min), fabs(value_max));
+  if (max < 1e-12) return;
+  double len = 0.9 * arrow_spacing / max;
+
+  for (int r = 0; r < nrows; r++)
+    for (int c = 0; c < ncols; c++)
+    {
+      float* a = arrows + 3 * (r * ncols + c);
+      if (a[0] == 0.0f) continue;
+      double x = c * arrow_spacing + arrow_spacing / 2 + 0.5;
+      double y = r * arrow_spacing + arrow_spacing / 2 + 0.5;
+      double dx = a[1] * len, dy = -a[2] * len; // the y axis of the image points down
+      double tx = x + 0.5 * dx, ty = y + 0.5 * dy;
+      draw_line(x - 0.5 * dx, y - 0.5 * dy, tx, ty, black);
+      // arrow head
+      double hx = 0.3 * dx, hy = 0.3 * dy;
+      draw_line(tx, ty, tx - hx - 0.5 * hy, ty - hy + 0.5 * hx, black);
+      draw_line(tx, ty, tx - hx + 0.5 * hy, ty - hy - 0.5 * hx, black);
+    }
+}
+
+
+//// output ////////////////////////////////////////////////////////////////////////////////////////
+
+void ImageView::write_ppm(const char* filename)
+{
+  FILE* f = fopen(filename, "wb");
+  if (f == NULL) { warn("ImageView: could not open '%s' for writing.", filename); return; }
+  fprintf(f, "P6\n%d %d\n255\n", width, height);
+  if (fwrite(pixels, 3, width * height, f) != (size_t) (width * height))
+    warn("ImageView: error writing '%s'.", filename);
+  fclose(f);
+}
+
+
+static void put_uint32(std::vector<unsigned char>& buf, uint32_t x)
+{
+  buf.push_back((unsigned char) (x >> 24));
+  buf.push_back((unsigned char) (x >> 16));
+  buf.push_back((unsigned char) (x >> 8));
+  buf.push_back((unsigned char) x);
+}
+
+
+static void put_png_chunk(FILE* f, const char* type, std::vector<unsigned char>& data)
+{
+  uint32_t crc_table[256];
+  for (uint32_t n = 0; n < 256; n++)
+  {
+    uint32_t c = n;
+    for (int k = 0; k < 8; k++)
+      c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+    crc_table[n] = c;
+  }
+
+  std::vector<unsigned char> head;
+  put_uint32(head, (uint32_t) data.size());
+  head.insert(head.end(), type, type + 4);
+
+  uint32_t crc = 0xffffffffu;
+  for (int i = 4; i < 8; i++)
+    crc = crc_table[(crc ^ head[i]) & 0xff] ^ (crc >> 8);
+  for (size_t i = 0; i < data.size(); i++)
+    crc = crc_table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+  std::vector<unsigned char> tail;
+  put_uint32(tail, crc ^ 0xffffffffu);
+
+  fwrite(&head[0], 1, head.size(), f);
+  if (data.size()) fwrite(&data[0], 1, data.size(), f);
+  fwrite(&tail[0], 1, tail.size(), f);
+}
+
+
+void ImageView::write_png(const char* filename)
+{
+  FILE* f = fopen(filename, "wb");
+  if (f == NULL) { warn("ImageView: could not open '%s' for writing.", filename); return; }
+
+  static const unsigned char signature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+  fwrite(signature, 1, 8, f);
+
+  std::vector<unsigned char> ihdr;
+  put_uint32(ihdr, width);
+  put_uint32(ihdr, height);
+  ihdr.push_back(8); // bit depth
+  ihdr.push_back(2); // RGB
+  ihdr.push_back(0); ihdr.push_back(0); ihdr.push_back(0);
+  put_png_chunk(f, "IHDR", ihdr);
+
+  // the image data: rows with the filter type 0, in uncompressed ("stored")
+  // deflate blocks of a zlib stream, so that no compression library is needed
+  int row = 3 * width + 1;
+  size_t raw_size = (size_t) row * height;
+  std::vector<unsigned char> raw(raw_size);
+  for (int y = 0; y < height; y++)
+  {
+    raw[(size_t) y * row] = 0;
+    memcpy(&raw[(size_t) y * row + 1], pixels + 3 * y * width, 3 * width);
+  }
+
+  std::vector<unsigned char> idat;
+  idat.reserve(raw_size + raw_size / 65535 * 5 + 16);
+  idat.push_back(0x78);
+  idat.push_back(0x01);
+  for (size_t pos = 0; pos < raw_size; pos += 65535)
+  {
+    unsigned len = (unsigned) std::min((size_t) 65535, raw_size - pos);
+    idat.push_back(pos + len == raw_size ? 1 : 0);
+    idat.push_back(len & 0xff); idat.push_back(len >> 8);
+    idat.push_back(~len & 0xff); idat.push_back((~len >> 8) & 0xff);
+    idat.insert(idat.end(), raw.begin() + pos, raw.begin() + pos + len);
+  }
+  uint32_t a = 1, b = 0; // Adler-32
+  for (size_t i = 0; i < raw_size; i++)
+  {
+    a = (a + raw[i]) % 65521;
+    b = (b + a) % 65521;
+  }
+  put_uint32(idat, (b << 16) | a);
+  put_png_chunk(f, "IDAT", idat);
+
+  std::vector<unsigned char> iend;
+  put_png_chunk(f, "IEND", iend);
+  fclose(f);
+}
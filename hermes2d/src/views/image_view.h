@@ -0,0 +1,146 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __H2D_IMAGE_VIEW_H
+#define __H2D_IMAGE_VIEW_H
+
+#include "view.h"
+
+/// \brief Renders solutions to image files, without a display.
+///
+/// ImageView is the headless counterpart of ScalarView, VectorView, OrderView
+/// and MeshView for machines without a display or OpenGL (it is available
+/// even if NOGLUT is defined). The data is processed by the same Linearizer,
+/// Vectorizer and Orderizer as in the windowed views, the triangles are
+/// rasterized in software with the same palettes and every frame is written
+/// to a PPM (".ppm") or PNG (".png") file. The file name is formed printf-style
+/// from the format passed to the constructor and the frame number, e.g.,
+/// "frame%04d.png" gives "frame0000.png", "frame0001.png", etc.
+///
+/// show() only processes the solution; the rasterization (split among several
+/// threads by horizontal bands of the image) and the writing of the file run
+/// in a background thread, so the calculation is not stalled. When the previous
+/// frame is still being written, the new one is dropped. Use set_interval() to
+/// render only every n-th call of show().
+///
+/// show_async() does not even linearize the solution in the calling thread: it
+/// takes a snapshot of the solution and hands it to an AsyncLinearizer, whose
+/// worker thread linearizes, rasterizes and writes it. When the worker is busy,
+/// the waiting snapshot is replaced by the new one. Do not mix show_async() with
+/// the other show() methods in one view.
+///
+class H2D_API ImageView
+{
+public:
+
+  ImageView(const char* format, int width = H2D_DEFAULT_WIDTH, int height = H2D_DEFAULT_HEIGHT);
+  ~ImageView();
+
+  /// Renders a scalar function (like ScalarView).
+  void show(MeshFunction* sln, double eps = H2D_EPS_NORMAL, int item = H2D_FN_VAL_0);
+  /// Renders the magnitude of a vector field and arrows (like VectorView).
+  void show(MeshFunction* xsln, MeshFunction* ysln, double eps = H2D_EPS_NORMAL,
+            int xitem = H2D_FN_VAL_0, int yitem = H2D_FN_VAL_0);
+  /// Renders a scalar function, linearized in a worker thread (see above).
+  void show_async(Solution* sln, double eps = H2D_EPS_NORMAL, int item = H2D_FN_VAL_0);
+  /// Renders the polynomial orders of the elements (like OrderView).
+  void show(Space* space);
+  /// Renders the elements of a mesh (like MeshView).
+  void show(Mesh* mesh);
+
+  void set_interval(int interval);   ///< Renders only every 'interval'-th call of show().
+  void set_num_threads(int num);     ///< Number of threads rasterizing a frame.
+
+  void set_min_max_range(double min, double max);
+  void auto_min_max_range();
+  void set_palette(ViewPaletteType type);
+  void set_num_palette_steps(int num);
+  void show_mesh(bool show = true) { show_edges = show; }
+  void show_contours(double step, double orig = 0.0);
+  void hide_contours() { contours = false; }
+  void set_arrow_spacing(int pixels); ///< Distance of the arrows of a vector field, in pixels.
+
+  /// Waits until the last frame is written (including the snapshots passed to show_async()).
+  void wait_for_frame();
+
+  int get_num_frames() const;   ///< Number of frames written so far.
+  /// Number of frames dropped because the writer was busy.
+  int get_num_dropped() const { return dropped + (async != NULL ? async->get_num_dropped() : 0); }
+
+protected:
+
+  enum { MODE_SCALAR, MODE_VECTOR, MODE_ORDER, MODE_MESH };
+
+  std::string format;
+  bool png;
+  int width, height;
+  int mode;
+
+  int interval, calls;
+  int frame_no, dropped;
+  int num_threads;
+
+  Linearizer lin;
+  Vectorizer vec;
+  Orderizer ord;
+  AsyncLinearizer* async; ///< linearizes the solutions passed to show_async()
+
+  ViewPaletteType pal_type;
+  int pal_steps;
+  unsigned char palette[256][3];
+  bool range_auto;
+  double range_min, range_max;
+  double value_min, value_max; ///< range used by the current frame
+
+  bool show_edges;
+  bool contours;
+  double cont_orig, cont_step;
+  int arrow_spacing;
+
+  unsigned char* pixels; ///< RGB, top row first
+  float* values;         ///< interpolated value in every pixel, for contours
+  bool* covered;         ///< true for pixels inside the domain
+  float* arrows;         ///< vector field sampled at the arrow positions
+
+  double scale, min_x, min_y, off_x, off_y;
+  double* px;            ///< vertices transformed to pixel coordinates
+  double* py;
+
+  pthread_t thread;
+  bool thread_running, busy;
+  mutable pthread_mutex_t busy_mutex;
+
+  bool begin_frame();
+  void end_frame();
+  Linearizer* get_data();
+  static void async_updated(Linearizer* lin, Solution* sln, void* data);
+
+  void create_palette();
+  void get_palette_color(double x, float* color);
+
+  void render();
+  void fill_band(int y0, int y1);
+  void contour_band(int y0, int y1);
+  void draw_line(double x0, double y0, double x1, double y1, const unsigned char* color);
+  void draw_arrows();
+
+  void write_ppm(const char* filename);
+  void write_png(const char* filename);
+
+  friend void* image_view_thread(void*);
+  friend void* image_view_band_thread(void*);
+};
+
+#endif
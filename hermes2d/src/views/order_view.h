@@ -24,11 +24,11 @@
 
 #include "view.h"
 
+#define H2DV_MAX_VIEWABLE_ORDER 10 ///< Maximum viewable order.
+
 // you can define NOGLUT to turn off all OpenGL stuff in Hermes2D
 #ifndef NOGLUT
 
-#define H2DV_MAX_VIEWABLE_ORDER 10 ///< Maximum viewable order.
-
 /// \brief Displays the polynomial degrees of elements.
 ///
 /// OrderView is a tool for displaying the polynomial degrees of the elements in a space.
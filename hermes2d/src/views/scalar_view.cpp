@@ -62,6 +62,7 @@ void ScalarView::init()
 
   show_values = true;
   lin_updated = false;
+  async = NULL;
   gl_coord_buffer = 0; gl_index_buffer = 0; gl_edge_inx_buffer = 0;
 
   do_zoom_to_fit = true;
@@ -111,6 +112,7 @@ ScalarView::ScalarView(char* title, WinGeom* wg)
 
 ScalarView::~ScalarView()
 {
+  delete async;
   delete[] normals;
   vertex_nodes.clear();
 
@@ -247,6 +249,34 @@ void ScalarView::show(MeshFunction* sln, double eps, int item,
   verbose(" Value range of data: [%g, %g]", lin.get_min_value(), lin.get_max_value());
 }
 
+void ScalarView::show_async(Solution* sln, double eps, int item)
+{
+  if (async == NULL)
+  {
+    async = new AsyncLinearizer(&lin);
+    async->set_callback(async_updated, this);
+  }
+  double max_abs = range_auto ? -1.0 : std::max(fabs(range_min), fabs(range_max));
+  async->process_solution(sln, item, eps, max_abs);
+}
+
+void ScalarView::async_updated(Linearizer* lin, Solution* sln, void* data)
+{
+  // called in the worker thread of AsyncLinearizer; 'sln' is the snapshot
+  ScalarView* view = (ScalarView*) data;
+  lin->lock_data();
+  view->update_mesh_info();
+  view->init_vertex_nodes(sln->get_mesh());
+  view->init_element_info(sln->get_mesh());
+  lin->unlock_data();
+
+  view->create();
+  view->update_layout();
+  view->wait_for_draw();
+  view->reset_view(false);
+  view->refresh();
+}
+
 void ScalarView::show_linearizer_data(double eps, int item)
 {
   double max_abs = range_auto ? -1.0 : std::max(fabs(range_min), fabs(range_max));
@@ -62,6 +62,11 @@ public:
 
   void show_linearizer_data(double eps = H2D_EPS_NORMAL, int item = H2D_FN_VAL_0);
 
+  /// Like show(), but returns immediately: a snapshot of the solution is linearized
+  /// in a worker thread (see AsyncLinearizer) and then displayed. When the worker is
+  /// busy, the waiting snapshot is replaced by the new one.
+  void show_async(Solution* sln, double eps = H2D_EPS_NORMAL, int item = H2D_FN_VAL_0);
+
   void show_mesh(bool show = true) { show_edges = show; refresh(); }
   void show_bounding_box(bool show = true) { show_aabb = show; refresh(); }
   void show_contours(double step, double orig = 0.0);
@@ -155,6 +160,9 @@ protected: //values
 
   bool lin_updated; ///< true, if lin now contains new values
 
+  AsyncLinearizer* async; ///< linearizes the solutions passed to show_async()
+  static void async_updated(Linearizer* lin, Solution* sln, void* data);
+
   unsigned int gl_coord_buffer; ///< Vertex coordinate buffer. (x,y,t)
   unsigned int gl_index_buffer; ///< Index data buffer.
   unsigned int gl_edge_inx_buffer; ///< A buffer for edge indices. The side of the buffer is H2DV_GL_MAX_EDGE_BUFFER pairs of indids.
@@ -256,6 +264,8 @@ public:
   void show(MeshFunction* sln, double eps = H2D_EPS_NORMAL, int item = H2D_FN_VAL_0,
             MeshFunction* xdisp = NULL, MeshFunction* ydisp = NULL, double dmult = 1.0)
      { verbose("ScalarView: Hermes2D compiled without OpenGL support, skipping visualization."); }
+  void show_async(Solution* sln, double eps = H2D_EPS_NORMAL, int item = H2D_FN_VAL_0)
+     { verbose("ScalarView: Hermes2D compiled without OpenGL support, skipping visualization."); }
   void show_mesh(bool show = true) {}
   void show_contours(double step, double orig = 0.0) {}
   void hide_contours() {}
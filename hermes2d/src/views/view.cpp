@@ -25,6 +25,7 @@
 #include "../common.h"
 #include "view_support.h"
 #include "view.h"
+#include "view_data.h"
 #include "../solution.h"
 
 ///////////////// private constants /////////////////
@@ -578,8 +579,6 @@ void View::set_title(const char* title)
 
 //// palette ///////////////////////////////////////////////////////////////////////////////////////
 
-#include "view_data.cpp"
-
 void View::get_palette_color(double x, float* gl_color)
 {
   if (pal_type == H2DV_PT_HUESCALE || pal_type == H2DV_PT_DEFAULT) { //default color
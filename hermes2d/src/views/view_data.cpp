@@ -1,5 +1,4 @@
-
-const int num_pal_entries = 256;
+#include "view_data.h"
 
 const float palette_data[num_pal_entries+1][3] =
 {
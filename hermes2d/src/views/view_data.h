@@ -0,0 +1,25 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __H2D_VIEW_DATA_H
+#define __H2D_VIEW_DATA_H
+
+/// Number of colors of the default palette.
+const int num_pal_entries = 256;
+
+/// The default palette (RGB, defined in view_data.cpp).
+extern const float palette_data[num_pal_entries+1][3];
+
+#endif
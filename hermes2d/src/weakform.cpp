@@ -18,6 +18,7 @@
 #include "weakform.h"
 #include "matrix_old.h"
 #include "forms.h"
+#include "weakform_parser.h"
 
 //// interface /////////////////////////////////////////////////////////////////////////////////////
 
@@ -28,6 +29,12 @@ WeakForm::WeakForm(int neq, bool mat_free)
   this->is_matfree = mat_free;
 }
 
+WeakForm::~WeakForm()
+{
+  for (unsigned i = 0; i < compiled_forms.size(); i++)
+    delete compiled_forms[i];
+}
+
 void WeakForm::add_matrix_form(int i, int j, matrix_form_val_t fn, 
                                matrix_form_ord_t ord, SymFlag sym, int area, Tuple<MeshFunction*>ext)
 {
@@ -177,6 +184,75 @@ void WeakForm::add_vector_form_surf(vector_form_val_t fn, vector_form_ord_t ord,
   seq++;
 }
 
+//// forms given by a text ////////////////////////////////////////////////////////////////////////
+
+void WeakForm::define_constant(const char* name, scalar value)
+{
+  constants[name] = value;
+}
+
+void WeakForm::define_function(const char* name, MeshFunction* fn)
+{
+  if (fn == NULL)
+    error("NULL function \"%s\".", name);
+  functions[name] = fn;
+}
+
+CompiledForm* WeakForm::compile_form(const char* form, bool matrix, int area)
+{
+  CompiledForm* cf = new CompiledForm(form, matrix, neq, constants, functions);
+  if (cf->is_surf() && (area == H2D_DG_BOUNDARY_EDGE || area == H2D_DG_INNER_EDGE))
+    error("Forms given by a text cannot be used on DG edges.");
+  compiled_forms.push_back(cf);
+  return cf;
+}
+
+void WeakForm::add_matrix_form(int i, int j, const char* form, SymFlag sym, int area)
+{
+  CompiledForm* cf = compile_form(form, true, area);
+  if (cf->is_surf())
+  {
+    add_matrix_form_surf(i, j, (matrix_form_val_t) NULL, (matrix_form_ord_t) NULL, area);
+    mfsurf.back().ext = cf->ext;
+    mfsurf.back().compiled = cf;
+  }
+  else
+  {
+    add_matrix_form(i, j, (matrix_form_val_t) NULL, (matrix_form_ord_t) NULL, sym, area);
+    mfvol.back().ext = cf->ext;
+    mfvol.back().compiled = cf;
+  }
+}
+
+// single equation case
+void WeakForm::add_matrix_form(const char* form, SymFlag sym, int area)
+{
+  add_matrix_form(0, 0, form, sym, area);
+}
+
+void WeakForm::add_vector_form(int i, const char* form, int area)
+{
+  CompiledForm* cf = compile_form(form, false, area);
+  if (cf->is_surf())
+  {
+    add_vector_form_surf(i, (vector_form_val_t) NULL, (vector_form_ord_t) NULL, area);
+    vfsurf.back().ext = cf->ext;
+    vfsurf.back().compiled = cf;
+  }
+  else
+  {
+    add_vector_form(i, (vector_form_val_t) NULL, (vector_form_ord_t) NULL, area);
+    vfvol.back().ext = cf->ext;
+    vfvol.back().compiled = cf;
+  }
+}
+
+// single equation case
+void WeakForm::add_vector_form(const char* form, int area)
+{
+  add_vector_form(0, form, area);
+}
+
 void WeakForm::set_ext_fns(void* fn, Tuple<MeshFunction*>ext)
 {
   error("Not implemented yet.");
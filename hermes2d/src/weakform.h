@@ -27,6 +27,7 @@ class Space;
 class MeshFunction;
 struct EdgePos;
 class Ord;
+class CompiledForm;
 
 struct Element;
 class Shapeset;
@@ -58,6 +59,7 @@ class H2D_API WeakForm
 public:
 
   WeakForm(int neq = 1, bool mat_free = false);
+  ~WeakForm();
 
   // general case
   typedef scalar (*matrix_form_val_t)(int n, double *wt, Func<scalar> *u[], Func<double> *vi, Func<double> *vj, Geom<double> *e, ExtData<scalar> *);
@@ -83,6 +85,18 @@ public:
   void add_vector_form_surf(vector_form_val_t fn, vector_form_ord_t ord, 
 			int area = H2D_ANY, Tuple<MeshFunction*>ext = Tuple<MeshFunction*>()); // single equation case
 
+  // forms given by a text, e.g. "vol u,v: u_x*v_x + u_y*v_y" (see CompiledForm
+  // in weakform_parser.h); "vol" forms are volume and "surf" forms surface forms
+  void add_matrix_form(int i, int j, const char* form, SymFlag sym = H2D_UNSYM, int area = H2D_ANY);
+  void add_matrix_form(const char* form, SymFlag sym = H2D_UNSYM, int area = H2D_ANY); // single equation case
+  void add_vector_form(int i, const char* form, int area = H2D_ANY);
+  void add_vector_form(const char* form, int area = H2D_ANY); // single equation case
+
+  /// Defines a constant or an external function that can be used in the
+  /// forms given by a text. The names have to be defined before the forms.
+  void define_constant(const char* name, scalar value);
+  void define_function(const char* name, MeshFunction* fn);
+
   void set_ext_fns(void* fn, Tuple<MeshFunction*>ext = Tuple<MeshFunction*>());
 
   /// Returns the number of equations
@@ -110,11 +124,11 @@ protected:
     scalar evaluate_fn(int point_cnt, double *weights, Func<double> *values_v, Geom<double> *geometry, ExtData<scalar> *values_ext_fnc, Element* element, Shapeset* shape_set, int shape_inx); ///< Evaluate value of the user defined function.
     Ord evaluate_ord(int point_cnt, double *weights, Func<Ord> *values_v, Geom<Ord> *geometry, ExtData<Ord> *values_ext_fnc, Element* element, Shapeset* shape_set, int shape_inx); ///< Evaluate order of the user defined function.
 
-  // general case
-  struct MatrixFormVol  {  int i, j, sym, area;  matrix_form_val_t fn;  matrix_form_ord_t ord;  std::vector<MeshFunction *> ext; };
-  struct MatrixFormSurf {  int i, j, area;       matrix_form_val_t fn;  matrix_form_ord_t ord;  std::vector<MeshFunction *> ext; };
-  struct VectorFormVol  {  int i, area;          vector_form_val_t fn;  vector_form_ord_t ord;  std::vector<MeshFunction *> ext; };
-  struct VectorFormSurf {  int i, area;          vector_form_val_t fn;  vector_form_ord_t ord;  std::vector<MeshFunction *> ext; };
+  // general case (for forms given by a text, 'fn' and 'ord' are NULL and 'compiled' is used instead)
+  struct MatrixFormVol  {  int i, j, sym, area;  matrix_form_val_t fn;  matrix_form_ord_t ord;  std::vector<MeshFunction *> ext;  CompiledForm* compiled; };
+  struct MatrixFormSurf {  int i, j, area;       matrix_form_val_t fn;  matrix_form_ord_t ord;  std::vector<MeshFunction *> ext;  CompiledForm* compiled; };
+  struct VectorFormVol  {  int i, area;          vector_form_val_t fn;  vector_form_ord_t ord;  std::vector<MeshFunction *> ext;  CompiledForm* compiled; };
+  struct VectorFormSurf {  int i, area;          vector_form_val_t fn;  vector_form_ord_t ord;  std::vector<MeshFunction *> ext;  CompiledForm* compiled; };
 
   // general case
   std::vector<MatrixFormVol>  mfvol;
@@ -157,6 +171,15 @@ protected:
 
 private:
 
+  std::map<std::string, scalar> constants;
+  std::map<std::string, MeshFunction*> functions;
+  std::vector<CompiledForm*> compiled_forms;
+  CompiledForm* compile_form(const char* form, bool matrix, int area);
+
+  // the compiled forms are owned by the weak form, so copying is not allowed
+  WeakForm(const WeakForm&);
+  WeakForm& operator=(const WeakForm&);
+
   Stage* find_stage(std::vector<WeakForm::Stage>& stages, int ii, int jj,
                     Mesh* m1, Mesh* m2, 
                     std::vector<MeshFunction*>& ext, std::vector<Solution*>& u_ext);
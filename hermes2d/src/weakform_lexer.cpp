@@ -0,0 +1,183 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+// $Id$
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <ctype.h>
+#include "weakform_lexer.h"
+
+// A hand-written scanner for the weak form language. The keywords "x",
+// "y", "xx", "yy", "xy" and "i" take precedence over identifiers of the
+// same length, longer identifiers ("xprev", "x1") are identifiers.
+
+
+static const char* input_text;
+
+
+static WFToken simple_tokens[] =
+{
+  { T_ERROR, 0, (char*) "???",  NULL }, //  0
+  { T_EOF,   0, (char*) "eof",  NULL }, //  1
+  { T_VOL,   0, (char*) "vol",  NULL }, //  2
+  { T_SURF,  0, (char*) "surf", NULL }, //  3
+  { T_COMMA, 0, (char*) ",",    NULL }, //  4
+  { T_COLON, 0, (char*) ":",    NULL }, //  5
+  { T_X,     0, (char*) "x",    NULL }, //  6
+  { T_Y,     0, (char*) "y",    NULL }, //  7
+  { T_XX,    0, (char*) "xx",   NULL }, //  8
+  { T_YY,    0, (char*) "yy",   NULL }, //  9
+  { T_XY,    0, (char*) "xy",   NULL }, // 10
+  { T_PLUS,  0, (char*) "+",    NULL }, // 11
+  { T_MINUS, 0, (char*) "-",    NULL }, // 12
+  { T_STAR,  0, (char*) "*",    NULL }, // 13
+  { T_SLASH, 0, (char*) "/",    NULL }, // 14
+  { T_BRA,   0, (char*) "(",    NULL }, // 15
+  { T_KET,   0, (char*) ")",    NULL }, // 16
+  { T_POWER, 0, (char*) "^",    NULL }, // 17
+  { T_UNDER, 0, (char*) "_",    NULL }, // 18
+  { T_IMAG,  0, (char*) "i",    NULL }  // 19
+};
+
+
+static const char* keywords[] = { "vol", "surf", "x", "y", "xx", "yy", "xy", "i" };
+static const int keyword_tokens[] = { 2, 3, 6, 7, 8, 9, 10, 19 };
+
+
+#define TABLE_SIZE 128 // must be a power of two
+static WFToken* symbol_table[TABLE_SIZE];
+
+// numbers are not shared, they are kept in a list to be freed
+static WFToken* numbers;
+
+
+static unsigned hash(const char* str)
+{
+  unsigned hash = 0;
+  while (*str)
+    hash = (*str++ & 0x1f) ^ (hash << 4);
+  return hash;
+}
+
+
+static WFToken* new_token(WFType type)
+{
+  WFToken* t = new WFToken;
+  memset(t, 0, sizeof(WFToken));
+  t->type = type;
+  return t;
+}
+
+
+static WFToken* find_symbol(const char* name, int len)
+{
+  char* str = new char[len+1];
+  strncpy(str, name, len);
+  str[len] = 0;
+
+  for (unsigned i = 0; i < sizeof(keywords) / sizeof(keywords[0]); i++)
+    if (!strcmp(str, keywords[i])) { delete [] str; return simple_tokens + keyword_tokens[i]; }
+
+  unsigned index = hash(str) & (TABLE_SIZE-1);
+  WFToken* t = symbol_table[index];
+  while (t != NULL && strcmp(t->lexeme, str))
+    t = t->next;
+  if (t != NULL) { delete [] str; return t; }
+
+  t = new_token(T_IDENT);
+  t->lexeme = str;
+  t->next = symbol_table[index];
+  return symbol_table[index] = t;
+}
+
+
+void wf_lexer_init(const char* input)
+{
+  memset(symbol_table, 0, TABLE_SIZE * sizeof(WFToken*));
+  numbers = NULL;
+  input_text = input;
+}
+
+
+WFToken* wf_get_token()
+{
+  while (isspace(*input_text)) input_text++;
+
+  const char* start = input_text;
+  char c = *input_text;
+  if (!c) return simple_tokens+1;
+
+  // identifiers and keywords
+  if (isalpha(c))
+  {
+    while (isalnum(*input_text)) input_text++;
+    return find_symbol(start, input_text - start);
+  }
+
+  // numbers: 12, 1.5, .5, 2e-3
+  if (isdigit(c) || (c == '.' && isdigit(input_text[1])))
+  {
+    char* end;
+    WFToken* t = new_token(T_NUMBER);
+    t->value = strtod(start, &end);
+    t->lexeme = (char*) "number";
+    t->next = numbers;
+    numbers = t;
+    input_text = end;
+    return t;
+  }
+
+  input_text++;
+  switch (c)
+  {
+    case ',': return simple_tokens+4;
+    case ':': return simple_tokens+5;
+    case '+': return simple_tokens+11;
+    case '-': return simple_tokens+12;
+    case '*': return simple_tokens+13;
+    case '/': return simple_tokens+14;
+    case '(': return simple_tokens+15;
+    case ')': return simple_tokens+16;
+    case '^': return simple_tokens+17;
+    case '_': return simple_tokens+18;
+  }
+  return simple_tokens+0;
+}
+
+
+void wf_lexer_free()
+{
+  WFToken *p1, *p2;
+  for (int i = 0; i < TABLE_SIZE; i++)
+  {
+    p1 = symbol_table[i];
+    while (p1 != NULL)
+    {
+      p2 = p1;
+      p1 = p1->next;
+      delete [] p2->lexeme;
+      delete p2;
+    }
+    symbol_table[i] = NULL;
+  }
+  while (numbers != NULL)
+  {
+    p1 = numbers->next;
+    delete numbers;
+    numbers = p1;
+  }
+}
@@ -35,13 +35,16 @@ struct WFToken
   WFType type;
   double value;
   char*  lexeme;
-  Token* next;
+  WFToken* next;
 };
 
 
-void   wf_lexer_init(const char* input);
-Token* wf_get_token();
-void   wf_lexer_free();
+/// Starts tokenizing the string 'input', which has to stay valid until
+/// wf_lexer_free() is called. Identifiers are stored in a symbol table,
+/// so that equal identifiers are returned as the same token.
+void     wf_lexer_init(const char* input);
+WFToken* wf_get_token();
+void     wf_lexer_free();
 
 
 #endif
@@ -16,130 +16,562 @@
 // $Id$
 
 #include "common.h"
-#include "weakform.h"
 #include "weakform_lexer.h"
-//#include "weakform_parser.h"
+#include "weakform_parser.h"
+#include "solution.h"
 
-/*
+typedef CompiledForm CF;
 
-  form    := type [ident "," ident ":"] expr
-  type    := "vol" | "surf"
-  expr    := term | term "+" expr | term "-" expr
-  term    := power | power "*" term | power "/" term
-  power   := factor | factor "^" expon
-  expon   := number | "(" expr ")"
-  factor  := number | ident | ident_partial | spvar | "(" expr ")"
-  partial := "x" | "y" | "xx" | "yy" | "xy"
-  spvar   := "x" | "y"
 
-*/
+//// parser ////////////////////////////////////////////////////////////////////////////////////////
 
+// Nodes of the expression tree. Constant subtrees are folded while the
+// tree is built, so the code generator sees constants only in leaves.
+enum { N_CONST, N_LOAD, N_NEG, N_ADD, N_SUB, N_MUL, N_DIV, N_POW };
 
-static Token * token;
+struct WFNode
+{
+  int type;
+  scalar value;          // N_CONST
+  int src, index, comp;  // N_LOAD
+  WFNode *left, *right;
+};
 
 
-static void next_token(void)
+// Recursive descent parser and code generator. The tokens are read
+// in advance, so that the optional header can be recognized.
+class WFCompiler
 {
-  token = wf_get_token();
-}
+public:
 
+  WFCompiler(CompiledForm* cf, const char* text, bool matrix, int neq,
+             std::map<std::string, scalar> &constants, std::map<std::string, MeshFunction*> &functions)
+    : cf(cf), text(text), matrix(matrix), neq(neq), constants(constants), functions(functions) {}
 
-static volatile void error(char* message)
-{
-  printf("error: '%s' -- %s\n", token->lexeme, message);
-  exit(1);
-}
+  void compile()
+  {
+    wf_lexer_init(text);
+    WFToken* t;
+    do tokens.push_back(t = wf_get_token()); while (t->type != T_EOF);
+    pos = 0;
 
+    WFNode* root = form();
+    if (token()->type != T_EOF) fail("unexpected token");
 
-static void check_for(int type, char* message)
-{
-  if (token->type != type) error(message);
-  next_token();
-}
+    cur = cf->depth = 0;
+    gen(root);
+    free_tree(root);
+    wf_lexer_free();
+  }
 
+protected:
 
-static Node* make_tree(Token* token, Node* left, Node* right, Node* cond)
-{
-  Node* n = (Node*) malloc(sizeof(Node));
-  if (n == NULL) exit(1);
-  n->token = token;
-  n->left = left;
-  n->right = right;
-  n->cond = cond;
-  return n;
-}
+  CompiledForm* cf;
+  const char* text;
+  bool matrix;
+  int neq;
+  std::map<std::string, scalar> &constants;
+  std::map<std::string, MeshFunction*> &functions;
 
+  std::vector<WFToken*> tokens;
+  unsigned pos;
+  std::string u_name, v_name;
+  int cur; // current depth of the stack
 
-NODE* factor(void)
-{
-  TOKEN* t = token;
-  if (t->type != T_IDENT && t->type != T_INTEGER && t->type != T_STRING)
-    error("expecting identifier, integer or string");
-  next_token();
-  return make_tree(t, NULL, NULL, NULL);
-}
+  WFToken* token() { return tokens[pos]; }
+  WFToken* peek() { return tokens[std::min(pos + 1, (unsigned) tokens.size() - 1)]; }
+  void next_token() { if (pos < tokens.size() - 1) pos++; }
 
+  void fail(const char* message)
+  {
+    error("Weak form \"%s\": %s (at '%s').", text, message, token()->lexeme);
+  }
 
-NODE* term(void)
-{
-  TOKEN* t;
-  NODE *l, *r;
-  l = factor();
-  if (token->type == T_STAR || token->type == T_SLASH) {
-    t = token;
+  void check_for(WFType type, const char* message)
+  {
+    if (token()->type != type) fail(message);
     next_token();
-    r = factor();
-    return make_tree(t, l, r, NULL);
   }
-  return l;
-}
 
+  WFNode* make_tree(int type, WFNode* left, WFNode* right)
+  {
+    WFNode* n = new WFNode;
+    n->type = type;
+    n->value = 0.0;
+    n->src = n->index = n->comp = 0;
+    n->left = left;
+    n->right = right;
+    return fold(n);
+  }
 
-NODE* expression(void)
-{
-  TOKEN* t;
-  NODE *l, *r;
-  l = term();
-  if (token->type == T_PLUS || token->type == T_MINUS) {
-    t = token;
+  WFNode* make_const(scalar value)
+  {
+    WFNode* n = make_tree(N_CONST, NULL, NULL);
+    n->value = value;
+    return n;
+  }
+
+  WFNode* make_load(int src, int index)
+  {
+    WFNode* n = make_tree(N_LOAD, NULL, NULL);
+    n->src = src;
+    n->index = index;
+    return n;
+  }
+
+  // evaluates operations on constants
+  WFNode* fold(WFNode* n)
+  {
+    if (n->left == NULL || n->left->type != N_CONST) return n;
+    if (n->right != NULL && n->right->type != N_CONST) return n;
+
+    scalar a = n->left->value, b = (n->right != NULL) ? n->right->value : 0.0;
+    switch (n->type)
+    {
+      case N_NEG: n->value = -a; break;
+      case N_ADD: n->value = a + b; break;
+      case N_SUB: n->value = a - b; break;
+      case N_MUL: n->value = a * b; break;
+      case N_DIV: n->value = a / b; break;
+      case N_POW: n->value = pow(a, b); break;
+    }
+    delete n->left; delete n->right;
+    n->left = n->right = NULL;
+    n->type = N_CONST;
+    return n;
+  }
+
+  void free_tree(WFNode* n)
+  {
+    if (n == NULL) return;
+    free_tree(n->left);
+    free_tree(n->right);
+    delete n;
+  }
+
+  // form := type [ident ["," ident] ":"] expr
+  WFNode* form()
+  {
+    if (token()->type != T_VOL && token()->type != T_SURF) fail("'vol' or 'surf' expected");
+    cf->surf = (token()->type == T_SURF);
     next_token();
-    r = term();
-    return make_tree(t, l, r, NULL);
+
+    u_name = matrix ? "u" : "";
+    v_name = "v";
+    if (token()->type == T_IDENT && (peek()->type == T_COMMA || peek()->type == T_COLON))
+    {
+      if (matrix)
+      {
+        u_name = token()->lexeme;
+        next_token();
+        check_for(T_COMMA, "',' expected (a matrix form has a basis and a test function)");
+      }
+      if (token()->type != T_IDENT) fail("name of the test function expected");
+      v_name = token()->lexeme;
+      next_token();
+      check_for(T_COLON, "':' expected");
+    }
+    return expr();
   }
-  return l;
-}
 
+  // expr := term { ("+" | "-") term }
+  WFNode* expr()
+  {
+    WFNode* n = term();
+    while (token()->type == T_PLUS || token()->type == T_MINUS)
+    {
+      int type = (token()->type == T_PLUS) ? N_ADD : N_SUB;
+      next_token();
+      n = make_tree(type, n, term());
+    }
+    return n;
+  }
+
+  // term := unary { ("*" | "/") unary }
+  WFNode* term()
+  {
+    WFNode* n = unary();
+    while (token()->type == T_STAR || token()->type == T_SLASH)
+    {
+      int type = (token()->type == T_STAR) ? N_MUL : N_DIV;
+      next_token();
+      n = make_tree(type, n, unary());
+    }
+    return n;
+  }
+
+  // unary := "-" unary | power
+  // (the minus binds looser than "^", so "-u^2" is "-(u^2)")
+  WFNode* unary()
+  {
+    if (token()->type == T_MINUS)
+    {
+      next_token();
+      return make_tree(N_NEG, unary(), NULL);
+    }
+    return power();
+  }
+
+  // power := factor ["^" unary]
+  WFNode* power()
+  {
+    WFNode* n = factor();
+    if (token()->type == T_POWER)
+    {
+      next_token();
+      n = make_tree(N_POW, n, unary());
+    }
+    return n;
+  }
+
+  WFNode* factor()
+  {
+    WFToken* t = token();
+    WFNode* n;
+    switch (t->type)
+    {
+      case T_NUMBER:
+        next_token();
+        return make_const(t->value);
+
+      case T_BRA:
+        next_token();
+        n = expr();
+        check_for(T_KET, "')' expected");
+        return n;
+
+      case T_X:
+        next_token();
+        return make_load(CF::SRC_X, 0);
+
+      case T_Y:
+        next_token();
+        return make_load(CF::SRC_Y, 0);
+
+      case T_IMAG:
+#ifdef H2D_COMPLEX
+        next_token();
+        return make_const(scalar(0.0, 1.0));
+#else
+        fail("the imaginary unit is available only in the complex version");
+        return NULL;
+#endif
+
+      case T_IDENT:
+        next_token();
+        n = name(t->lexeme);
+        if (token()->type == T_UNDER)
+        {
+          next_token();
+          if (n->type != N_LOAD || n->src >= CF::SRC_X) fail("only functions have partial derivatives");
+          if (token()->type == T_X) n->comp = 1;
+          else if (token()->type == T_Y) n->comp = 2;
+          else if (token()->type == T_XX || token()->type == T_YY || token()->type == T_XY)
+            fail("second derivatives are not supported");
+          else fail("partial derivative 'x' or 'y' expected");
+          next_token();
+        }
+        return n;
+
+      default:
+        fail("number, name or '(' expected");
+    }
+    return NULL;
+  }
+
+  WFNode* name(const char* str)
+  {
+    std::string s(str);
+    if (s == u_name) return make_load(CF::SRC_U, 0);
+    if (s == v_name) return make_load(CF::SRC_V, 0);
+
+    if (constants.find(s) != constants.end())
+      return make_const(constants[s]);
+
+    if (functions.find(s) != functions.end())
+    {
+      MeshFunction* fn = functions[s];
+      int index = std::find(cf->ext.begin(), cf->ext.end(), fn) - cf->ext.begin();
+      if (index == (int) cf->ext.size()) cf->ext.push_back(fn);
+      return make_load(CF::SRC_EXT, index);
+    }
+
+    if (s == "nx" || s == "ny")
+    {
+      if (!cf->surf) fail("the normal is defined only in surface forms");
+      return make_load((s == "nx") ? CF::SRC_NX : CF::SRC_NY, 0);
+    }
+
+    int k;
+    char c;
+    if (sscanf(str, "prev%d%c", &k, &c) == 1)
+    {
+      if (k < 0 || k >= neq) fail("no such equation");
+      return make_load(CF::SRC_PREV, k);
+    }
+
+    fail("unknown name");
+    return NULL;
+  }
+
+  //// code generator ////
+
+  static bool is_leaf(WFNode* n) { return n->type == N_CONST || n->type == N_LOAD; }
+
+  void emit(int op, int opnd, WFNode* leaf)
+  {
+    CF::Instr in;
+    in.op = op;
+    in.opnd = opnd;
+    in.src = in.index = in.comp = 0;
+    in.value = 0.0;
+    if (leaf != NULL)
+    {
+      in.opnd = (leaf->type == N_CONST) ? CF::OPND_CONST : CF::OPND_LOAD;
+      in.src = leaf->src;
+      in.index = leaf->index;
+      in.comp = leaf->comp;
+      in.value = leaf->value;
+    }
+    cf->code.push_back(in);
+  }
 
-NODE* ifstatement(void)
+  void push()
+  {
+    if (++cur > cf->depth) cf->depth = cur;
+  }
+
+  // A leaf operand of a binary operation is not pushed on the stack, the
+  // operation reads it directly. If the left operand is the leaf, the
+  // operands are swapped (with the reversed operation for "-" and "/").
+  void gen(WFNode* n)
+  {
+    static const int ops[] = { 0, 0, 0, CF::OP_ADD, CF::OP_SUB, CF::OP_MUL, CF::OP_DIV, CF::OP_POW };
+    switch (n->type)
+    {
+      case N_CONST: push(); emit(CF::OP_CONST, CF::OPND_CONST, n); return;
+      case N_LOAD:  push(); emit(CF::OP_LOAD, CF::OPND_LOAD, n); return;
+      case N_NEG:   gen(n->left); emit(CF::OP_NEG, CF::OPND_STACK, NULL); return;
+    }
+
+    int op = ops[n->type];
+    if (is_leaf(n->right))
+    {
+      gen(n->left);
+      emit(op, 0, n->right);
+    }
+    else if (is_leaf(n->left) && n->type != N_POW)
+    {
+      gen(n->right);
+      if (op == CF::OP_SUB) op = CF::OP_RSUB;
+      if (op == CF::OP_DIV) op = CF::OP_RDIV;
+      emit(op, 0, n->left);
+    }
+    else
+    {
+      gen(n->left);
+      gen(n->right);
+      emit(op, CF::OPND_STACK, NULL);
+      cur--;
+    }
+  }
+};
+
+
+CompiledForm::CompiledForm(const char* text, bool matrix, int neq,
+                           std::map<std::string, scalar> &constants, std::map<std::string, MeshFunction*> &functions)
 {
-  TOKEN* t = token;
-  NODE *l, *r, *c;
-  check_for(T_IF, "'if' expected");
-  check_for(T_BRA, "'(' expected");
-  c = expression();
-  check_for(T_KET, "')' expected");
-  l = goal();
-  r = (token->type == T_ELSE) ? (next_token(), goal()) : NULL;
-  return make_tree(t, l, r, c);
+  surf = false;
+  depth = 0;
+  WFCompiler compiler(this, text, matrix, neq, constants, functions);
+  compiler.compile();
 }
 
 
-NODE* goal(void)
+//// evaluation ////////////////////////////////////////////////////////////////////////////////////
+
+// a = a (op) b for all points, where b is an array or a constant
+template<typename T>
+static inline void apply(int op, scalar* a, const T* b, int n)
+{
+  switch (op)
+  {
+    case CF::OP_ADD:  for (int k = 0; k < n; k++) a[k] += b[k]; break;
+    case CF::OP_SUB:  for (int k = 0; k < n; k++) a[k] -= b[k]; break;
+    case CF::OP_RSUB: for (int k = 0; k < n; k++) a[k] = b[k] - a[k]; break;
+    case CF::OP_MUL:  for (int k = 0; k < n; k++) a[k] *= b[k]; break;
+    case CF::OP_DIV:  for (int k = 0; k < n; k++) a[k] /= b[k]; break;
+    case CF::OP_RDIV: for (int k = 0; k < n; k++) a[k] = b[k] / a[k]; break;
+    case CF::OP_POW:  for (int k = 0; k < n; k++) a[k] = pow(a[k], b[k]); break;
+  }
+}
+
+static inline void apply_const(int op, scalar* a, scalar c, int n)
 {
-  NODE* n = (token->type == T_IF) ? ifstatement() : expression();
-  check_for(T_SEMICOL, "semicolon expected");
-  return n;
+  switch (op)
+  {
+    case CF::OP_ADD:  for (int k = 0; k < n; k++) a[k] += c; break;
+    case CF::OP_SUB:  for (int k = 0; k < n; k++) a[k] -= c; break;
+    case CF::OP_RSUB: for (int k = 0; k < n; k++) a[k] = c - a[k]; break;
+    case CF::OP_MUL:  for (int k = 0; k < n; k++) a[k] *= c; break;
+    case CF::OP_DIV:  { scalar r = 1.0 / c; for (int k = 0; k < n; k++) a[k] *= r; } break;
+    case CF::OP_RDIV: for (int k = 0; k < n; k++) a[k] = c / a[k]; break;
+    case CF::OP_POW:  for (int k = 0; k < n; k++) a[k] = pow(a[k], c); break;
+  }
 }
 
+template<typename T>
+static inline T* get_values(Func<T>* f, int comp)
+{
+  return (comp == 0) ? f->val : (comp == 1) ? f->dx : f->dy;
+}
 
-void wf_parser_init(const char* input)
+scalar CompiledForm::fn(int n, double *wt, Func<scalar> *u_ext[], Func<double> *u, Func<double> *v,
+                        Geom<double> *e, ExtData<scalar> *ext)
 {
-  wf_lexer_init(input);
-  token = get_token();
+  if ((u != NULL && u->nc != 1) || v->nc != 1)
+    error("Compiled weak forms support only scalar-valued spaces.");
+
+  // the stack is local, so that one form can be evaluated by several threads
+  AUTOLA_OR(scalar, stack, depth * n);
+  scalar* top = &stack[0] - n;
+
+  for (unsigned i = 0; i < code.size(); i++)
+  {
+    const Instr &in = code[i];
+
+    // find the values of the leaf operand
+    double* rv = NULL;
+    scalar* sv = NULL;
+    if (in.opnd == OPND_LOAD)
+    {
+      switch (in.src)
+      {
+        case SRC_U:    rv = get_values(u, in.comp); break;
+        case SRC_V:    rv = get_values(v, in.comp); break;
+        case SRC_X:    rv = e->x; break;
+        case SRC_Y:    rv = e->y; break;
+        case SRC_NX:   rv = e->nx; break;
+        case SRC_NY:   rv = e->ny; break;
+        case SRC_PREV:
+          if (u_ext == NULL || u_ext[in.index] == NULL)
+            error("Compiled weak form uses prev%d, but there is no previous solution.", in.index);
+          sv = get_values(u_ext[in.index], in.comp);
+          break;
+        case SRC_EXT:  sv = get_values(ext->fn[in.index], in.comp); break;
+      }
+    }
+
+    switch (in.op)
+    {
+      case OP_LOAD:
+        top += n;
+        if (rv != NULL) for (int k = 0; k < n; k++) top[k] = rv[k];
+        else memcpy(top, sv, n * sizeof(scalar));
+        break;
+
+      case OP_CONST:
+        top += n;
+        for (int k = 0; k < n; k++) top[k] = in.value;
+        break;
+
+      case OP_NEG:
+        for (int k = 0; k < n; k++) top[k] = -top[k];
+        break;
+
+      default:
+        if (in.opnd == OPND_STACK) { top -= n; apply(in.op, top, top + n, n); }
+        else if (in.opnd == OPND_CONST) apply_const(in.op, top, in.value, n);
+        else if (rv != NULL) apply(in.op, top, rv, n);
+        else apply(in.op, top, sv, n);
+    }
+  }
+
+  scalar result = 0;
+  for (int k = 0; k < n; k++)
+    result += wt[k] * top[k];
+  return result;
 }
 
+// Integration order by the rules of the class Ord: constants have order 0,
+// sums take the maximum and products add the orders. Division by a function
+// and a power with a non-constant exponent give the maximal order.
+Ord CompiledForm::ord(int n, double *wt, Func<Ord> *u_ext[], Func<Ord> *u, Func<Ord> *v,
+                      Geom<Ord> *e, ExtData<Ord> *ext)
+{
+  const int max_order = Ord().get_max_order();
+  AUTOLA_OR(int, o, depth + 1);
+  int sp = -1;
+
+  for (unsigned i = 0; i < code.size(); i++)
+  {
+    const Instr &in = code[i];
+
+    int b = 0;
+    if (in.opnd == OPND_LOAD)
+    {
+      switch (in.src)
+      {
+        case SRC_U:    b = u->val[0].get_order(); break;
+        case SRC_V:    b = v->val[0].get_order(); break;
+        case SRC_X:    b = e->x[0].get_order(); break;
+        case SRC_Y:    b = e->y[0].get_order(); break;
+        case SRC_NX:   b = e->nx[0].get_order(); break;
+        case SRC_NY:   b = e->ny[0].get_order(); break;
+        case SRC_PREV: b = (u_ext != NULL && u_ext[in.index] != NULL) ? u_ext[in.index]->val[0].get_order() : 0; break;
+        case SRC_EXT:  b = ext->fn[in.index]->val[0].get_order(); break;
+      }
+    }
+    else if (in.opnd == OPND_STACK && in.op != OP_NEG)
+      b = o[sp--];
 
-void wf_parser_free(void)
+    switch (in.op)
+    {
+      case OP_LOAD:  o[++sp] = b; break;
+      case OP_CONST: o[++sp] = 0; break;
+      case OP_NEG:   break;
+      case OP_ADD: case OP_SUB: case OP_RSUB:
+        o[sp] = std::max(o[sp], b); break;
+      case OP_MUL:
+        o[sp] += b; break;
+      case OP_DIV:
+        if (in.opnd != OPND_CONST) o[sp] = max_order;
+        break;
+      case OP_RDIV:
+        o[sp] = max_order; break;
+      case OP_POW:
+        if (in.opnd == OPND_CONST) o[sp] = (int) ceil(std::abs(in.value)) * o[sp];
+        else o[sp] = max_order;
+        break;
+    }
+  }
+
+  return Ord(o[0]);
+}
+
+void CompiledForm::print()
 {
-  wf_lexer_free();
+  static const char* op_names[] = { "load", "const", "neg", "add", "sub", "rsub", "mul", "div", "rdiv", "pow" };
+  static const char* src_names[] = { "u", "v", "prev", "ext", "x", "y", "nx", "ny" };
+  static const char* comp_names[] = { "", "_x", "_y" };
+  printf("%s form, stack depth %d, %d function(s):\n", surf ? "surface" : "volume", depth, (int) ext.size());
+  for (unsigned i = 0; i < code.size(); i++)
+  {
+    const Instr &in = code[i];
+    printf("  %-5s ", op_names[in.op]);
+    if (in.opnd == OPND_CONST)
+    {
+#ifdef H2D_COMPLEX
+      printf("(%g, %g)", in.value.real(), in.value.imag());
+#else
+      printf("%g", in.value);
+#endif
+    }
+    else if (in.opnd == OPND_LOAD)
+    {
+      if (in.src == SRC_PREV || in.src == SRC_EXT) printf("%s%d%s", src_names[in.src], in.index, comp_names[in.comp]);
+      else printf("%s%s", src_names[in.src], comp_names[in.comp]);
+    }
+    printf("\n");
+  }
 }
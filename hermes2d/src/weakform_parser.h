@@ -0,0 +1,102 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __H2D_WEAKFORM_PARSER_H
+#define __H2D_WEAKFORM_PARSER_H
+
+#include "forms.h"
+
+class MeshFunction;
+
+/// \brief A weak form given by a text, compiled to a bytecode.
+///
+/// The grammar of the text is
+///
+///   form    := type [ident ["," ident] ":"] expr
+///   type    := "vol" | "surf"
+///   expr    := term { ("+" | "-") term }
+///   term    := unary { ("*" | "/") unary }
+///   unary   := "-" unary | power
+///   power   := factor | factor "^" unary
+///   factor  := number | name | name "_" partial | spvar | "i" | "(" expr ")"
+///   partial := "x" | "y"
+///   spvar   := "x" | "y"
+///
+/// The identifiers in the header name the basis and the test function of a
+/// matrix form ("u" and "v" by default) or the test function of a vector form
+/// ("v"). Other names are the solutions of the previous Newton iteration
+/// "prev0", "prev1", ..., the normal "nx", "ny" (surface forms only) and the
+/// constants and functions defined in the weak form, see
+/// WeakForm::define_constant() and WeakForm::define_function(). The imaginary
+/// unit "i" is available in the complex version only. Example:
+///
+///   "vol u,v: (u_x*v_x + u_y*v_y)/Re + u*v/tau + (w*u_x + z*u_y)*v"
+///
+/// Constant subexpressions are folded. Every instruction of the bytecode works
+/// on all quadrature points at once (the loops are simple enough to be
+/// vectorized by the compiler), and the integration order is derived from the
+/// bytecode by the same rules that the class Ord applies to hand-written forms.
+///
+class H2D_API CompiledForm
+{
+public:
+
+  /// Compiles 'text'; 'matrix' is true for matrix forms. Errors are fatal.
+  CompiledForm(const char* text, bool matrix, int neq,
+               std::map<std::string, scalar> &constants, std::map<std::string, MeshFunction*> &functions);
+
+  bool is_surf() const { return surf; }
+
+  /// Functions referenced by the form (in the order of ExtData::fn).
+  std::vector<MeshFunction*> ext;
+
+  // matrix forms
+  scalar fn(int n, double *wt, Func<scalar> *u_ext[], Func<double> *u, Func<double> *v, Geom<double> *e, ExtData<scalar> *ext);
+  Ord ord(int n, double *wt, Func<Ord> *u_ext[], Func<Ord> *u, Func<Ord> *v, Geom<Ord> *e, ExtData<Ord> *ext);
+
+  // vector forms
+  scalar fn(int n, double *wt, Func<scalar> *u_ext[], Func<double> *v, Geom<double> *e, ExtData<scalar> *ext)
+    { return fn(n, wt, u_ext, NULL, v, e, ext); }
+  Ord ord(int n, double *wt, Func<Ord> *u_ext[], Func<Ord> *v, Geom<Ord> *e, ExtData<Ord> *ext)
+    { return ord(n, wt, u_ext, NULL, v, e, ext); }
+
+  /// Prints the bytecode (for debugging).
+  void print();
+
+  /// The values of the function 'src' (one of the SRC_* constants).
+  enum { SRC_U, SRC_V, SRC_PREV, SRC_EXT, SRC_X, SRC_Y, SRC_NX, SRC_NY };
+
+  /// Instructions. The right operand of the binary operations is either
+  /// popped from the stack (OPND_STACK), a constant or a function value.
+  enum { OP_LOAD, OP_CONST, OP_NEG, OP_ADD, OP_SUB, OP_RSUB, OP_MUL, OP_DIV, OP_RDIV, OP_POW };
+  enum { OPND_STACK, OPND_CONST, OPND_LOAD };
+
+  struct Instr
+  {
+    int op, opnd;
+    int src, index, comp; // function value: source, index (prev, ext) and 0 = value, 1 = dx, 2 = dy
+    scalar value;         // constant
+  };
+
+protected:
+
+  bool surf;
+  std::vector<Instr> code;
+  int depth; ///< maximal depth of the stack
+
+  friend class WFCompiler;
+};
+
+#endif
@@ -0,0 +1,119 @@
+#include "hermes2d.h"
+
+// This test makes sure that the shape functions and the jacobian*weights of
+// affine elements (straight triangles and parallelograms), which are transformed
+// with the constant inverse reference map, are the same as those calculated with
+// the per-point tables of the reference map, also on sub-elements (including
+// those of anisotropic refinements of quads). Curved elements are checked as well.
+
+#undef ERROR_SUCCESS
+#undef ERROR_FAILURE
+#define ERROR_SUCCESS                               0
+#define ERROR_FAILURE                               -1
+
+bool equal(double a, double b, double scale)
+{
+  return fabs(a - b) <= 1e-12 * (scale + fabs(a));
+}
+
+// compares init_fn() and init_jwt_vol() of the active shape with the per-point tables
+bool check(PrecalcShapeset* pss, RefMap* rm, int order)
+{
+  Quad2D* quad = rm->get_quad_2d();
+  double3* pt = quad->get_points(order);
+  int np = quad->get_num_points(order);
+
+  Func<double>* u = init_fn(pss, rm, order);
+  double* jwt = init_jwt_vol(rm, order);
+  double* fn = pss->get_fn_values();
+  double* dx = pss->get_dx_values();
+  double* dy = pss->get_dy_values();
+  double2x2* m = rm->get_inv_ref_map(order);
+  double* jac = rm->get_jacobian(order);
+
+  bool ok = true;
+  for (int i = 0; i < np; i++)
+  {
+    double scale = fabs(dx[i] * m[i][0][0]) + fabs(dy[i] * m[i][0][1])
+                 + fabs(dx[i] * m[i][1][0]) + fabs(dy[i] * m[i][1][1]);
+    if (u->val[i] != fn[i] ||
+        !equal(u->dx[i], dx[i] * m[i][0][0] + dy[i] * m[i][0][1], scale) ||
+        !equal(u->dy[i], dx[i] * m[i][1][0] + dy[i] * m[i][1][1], scale) ||
+        !equal(jwt[i], pt[i][2] * jac[i], 0))
+      ok = false;
+  }
+
+  u->free_fn(); delete u;
+  delete [] jwt;
+  return ok;
+}
+
+int main(int argc, char* argv[])
+{
+  // Load the mesh with two straight quads and two curved triangles.
+  Mesh mesh;
+  H2DReader mloader;
+  mloader.load("domain.mesh", &mesh);
+  mesh.refine_all_elements();
+  mesh.refine_towards_vertex(3, 2);
+
+  H1Shapeset shapeset;
+  PrecalcShapeset pss(&shapeset);
+  RefMap rm;
+
+  bool success = true;
+  int num_affine = 0, num_curved = 0;
+  Element* e;
+  for_all_active_elements(e, &mesh)
+  {
+    rm.set_active_element(e);
+    pss.set_active_element(e);
+    if (rm.is_jacobian_const()) num_affine++; else num_curved++;
+
+    int order = 6;
+    int shapes[3] = { shapeset.get_vertex_index(0), shapeset.get_vertex_index(1),
+                      shapeset.get_edge_index(1, 0, 4) };
+    for (int s = 0; s < 3; s++)
+    {
+      pss.set_active_shape(shapes[s]);
+      if (!check(&pss, &rm, order))
+        { printf("element %d: different values\n", e->id); success = false; }
+
+      // the same on a sub-element
+      pss.push_transform(1); rm.push_transform(1);
+      pss.push_transform(2); rm.push_transform(2);
+      if (!check(&pss, &rm, order))
+        { printf("element %d: different values on a sub-element\n", e->id); success = false; }
+      pss.pop_transform(); rm.pop_transform();
+      pss.pop_transform(); rm.pop_transform();
+
+      // the same on sub-elements of an anisotropic refinement of a quad
+      if (e->is_quad())
+      {
+        pss.push_transform(4); rm.push_transform(4);
+        if (!check(&pss, &rm, order))
+          { printf("element %d: different values on an anisotropic sub-element\n", e->id); success = false; }
+        pss.push_transform(7); rm.push_transform(7);
+        pss.push_transform(1); rm.push_transform(1);
+        if (!check(&pss, &rm, order))
+          { printf("element %d: different values on an anisotropic sub-element\n", e->id); success = false; }
+        pss.pop_transform(); rm.pop_transform();
+        pss.pop_transform(); rm.pop_transform();
+        pss.pop_transform(); rm.pop_transform();
+      }
+      if (!check(&pss, &rm, order))
+        { printf("element %d: different values after the sub-elements\n", e->id); success = false; }
+    }
+  }
+  printf("%d affine and %d curved elements\n", num_affine, num_curved);
+  if (num_affine == 0 || num_curved == 0) { printf("wrong mesh\n"); success = false; }
+
+  if (success) {
+    printf("Success!\n");
+    return ERROR_SUCCESS;
+  }
+  else {
+    printf("Failure!\n");
+    return ERROR_FAILURE;
+  }
+}
@@ -0,0 +1,163 @@
+#include "hermes2d.h"
+
+// This test makes sure that the reverse Cuthill-McKee numbering of the DOFs
+// (see Space::set_dof_ordering()) is a permutation of the natural numbering
+// which reduces the bandwidth of the matrix, and that the problem solved with
+// either numbering has the same solution.
+
+int P_INIT = 3;                                   // Uniform polynomial degree of mesh elements.
+double CONST_F = 2.0;                             // Constant right-hand side.
+MatrixSolverType matrix_solver = SOLVER_UMFPACK;  // Possibilities: SOLVER_UMFPACK, SOLVER_PETSC,
+                                                  // SOLVER_MUMPS, and more are coming.
+
+// boundary condition types
+BCType bc_types(int marker)
+{
+  return (marker == 3) ? BC_ESSENTIAL : BC_NATURAL;
+}
+
+// function values for Dirichlet boundary conditions.
+scalar essential_bc_values(int ess_bdy_marker, double x, double y)
+{
+  return x;
+}
+
+template<typename Real, typename Scalar>
+Scalar bilinear_form(int n, double *wt, Func<Scalar> *u_ext[], Func<Real> *u, Func<Real> *v, Geom<Real> *e, ExtData<Scalar> *ext)
+{
+  return int_grad_u_grad_v<Real, Scalar>(n, wt, u, v);
+}
+
+template<typename Real, typename Scalar>
+Scalar linear_form(int n, double *wt, Func<Scalar> *u_ext[], Func<Real> *v, Geom<Real> *e, ExtData<Scalar> *ext)
+{
+  return CONST_F * int_v<Real, Scalar>(n, wt, v);
+}
+
+// the largest distance of two DOFs sharing an element
+int bandwidth(Space* space)
+{
+  Mesh* mesh = space->get_mesh();
+  AsmList al;
+  Element* e;
+  int bw = 0;
+  for_all_active_elements(e, mesh)
+  {
+    space->get_element_assembly_list(e, &al);
+    for (int i = 0; i < al.cnt; i++)
+      for (int j = 0; j < al.cnt; j++)
+        if (al.dof[i] >= 0 && al.dof[j] >= 0)
+          bw = std::max(bw, abs(al.dof[i] - al.dof[j]));
+  }
+  return bw;
+}
+
+// assembles and solves the problem
+void solve(WeakForm* wf, H1Space* space, Solution* sln)
+{
+  LinearProblem lp(wf, space);
+  Matrix* mat; Vector* rhs; CommonSolver* solver;
+  init_matrix_solver(matrix_solver, get_num_dofs(space), mat, rhs, solver);
+  lp.assemble(mat, rhs);
+  if (!solver->solve(mat, rhs)) error ("Matrix solver failed.\n");
+  sln->set_coeff_vector(space, rhs);
+  delete rhs;
+}
+
+int main(int argc, char* argv[])
+{
+  // Load the mesh, refine it with hanging nodes.
+  Mesh mesh;
+  H2DReader mloader;
+  mloader.load("domain.mesh", &mesh);
+  for (int i = 0; i < 3; i++)
+    mesh.refine_all_elements();
+  mesh.refine_towards_vertex(3, 3);
+
+  WeakForm wf;
+  wf.add_matrix_form(callback(bilinear_form), H2D_SYM);
+  wf.add_vector_form(callback(linear_form));
+
+  bool success = true;
+
+  // Natural numbering.
+  H1Space space1(&mesh, bc_types, essential_bc_values, P_INIT);
+  int ndof = get_num_dofs(&space1);
+  int bw1 = bandwidth(&space1);
+  if (!space1.get_dof_permutation().empty()) { printf("natural ordering: a permutation was stored\n"); success = false; }
+  Solution sln1;
+  solve(&wf, &space1, &sln1);
+
+  // The same space, renumbered.
+  H1Space space2(&mesh, bc_types, essential_bc_values, P_INIT);
+  space2.set_dof_ordering(H2D_DOF_ORDER_RCM);
+  int bw2 = bandwidth(&space2);
+  printf("ndof = %d, bandwidth natural = %d, RCM = %d\n", ndof, bw1, bw2);
+  if (get_num_dofs(&space2) != ndof) { printf("RCM ordering: wrong number of DOFs\n"); success = false; }
+  if (bw2 >= bw1) { printf("RCM ordering: the bandwidth was not reduced\n"); success = false; }
+
+  // The permutation must be a bijection mapping the DOFs of every element.
+  const std::vector<int>& perm = space2.get_dof_permutation();
+  std::vector<bool> used(ndof, false);
+  if ((int) perm.size() != ndof) { printf("wrong size of the permutation\n"); success = false; }
+  else
+    for (int i = 0; i < ndof; i++)
+    {
+      if (perm[i] < 0 || perm[i] >= ndof || used[perm[i]]) { printf("not a permutation\n"); success = false; break; }
+      used[perm[i]] = true;
+    }
+
+  if (success)
+  {
+    // (the constraints of the hanging nodes may list the DOFs in a different order)
+    AsmList al1, al2;
+    Element* e;
+    for_all_active_elements(e, &mesh)
+    {
+      space1.get_element_assembly_list(e, &al1);
+      space2.get_element_assembly_list(e, &al2);
+      std::vector<int> dofs1, dofs2;
+      for (int i = 0; i < al1.cnt; i++)
+        if (al1.dof[i] >= 0) dofs1.push_back(perm[al1.dof[i]]);
+      for (int i = 0; i < al2.cnt; i++)
+        if (al2.dof[i] >= 0) dofs2.push_back(al2.dof[i]);
+      std::sort(dofs1.begin(), dofs1.end());
+      std::sort(dofs2.begin(), dofs2.end());
+      if (dofs1 != dofs2) success = false;
+    }
+    if (!success) printf("the permutation does not map the assembly lists\n");
+  }
+
+  // Both numberings give the same solution.
+  Solution sln2;
+  solve(&wf, &space2, &sln2);
+  double max_diff = 0, max_val = 0;
+  for (int i = 0; i <= 20; i++)
+    for (int j = 0; j <= 20; j++)
+    {
+      double x = -0.95 + 0.09 * i, y = -0.95 + 0.09 * j;
+      if (x > 0 && y > 0 && x*x + y*y > 0.95) continue;
+      if (x < 0 && y < 0) continue;
+      double v1 = sln1.get_pt_value(x, y), v2 = sln2.get_pt_value(x, y);
+      max_diff = std::max(max_diff, fabs(v1 - v2));
+      max_val = std::max(max_val, fabs(v1));
+    }
+  printf("max |solution| = %g, max difference = %g\n", max_val, max_diff);
+  if (!(max_val > 0 && max_diff < 1e-10 * max_val)) { printf("the solutions differ\n"); success = false; }
+
+  // Switching back renumbers the DOFs in the natural order.
+  space2.set_dof_ordering(H2D_DOF_ORDER_NATURAL);
+  if (bandwidth(&space2) != bw1 || !space2.get_dof_permutation().empty())
+    { printf("the natural ordering was not restored\n"); success = false; }
+
+#define ERROR_SUCCESS                               0
+#define ERROR_FAILURE                               -1
+  if (success) {
+    printf("Success!\n");
+    return ERROR_SUCCESS;
+  }
+  else {
+    printf("Failure!\n");
+    return ERROR_FAILURE;
+  }
+}
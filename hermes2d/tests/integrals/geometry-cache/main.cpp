@@ -0,0 +1,181 @@
+#include "hermes2d.h"
+
+// This test makes sure that the geometry cache of reference maps (see
+// RefMap::set_geometry_cache()) does not change the results of the assembly
+// and of norms on a mesh with curved elements, that the cached tables are
+// reused by the next calculation, that the memory budget is respected, that
+// the tables are not reused after the mesh is moved, and that the edge tangents
+// are shared by the reference maps of an element.
+
+int P_INIT = 3;                                   // Uniform polynomial degree of mesh elements.
+MatrixSolverType matrix_solver = SOLVER_UMFPACK;  // Possibilities: SOLVER_UMFPACK, SOLVER_PETSC,
+                                                  // SOLVER_MUMPS, and more are coming.
+
+// boundary condition types
+BCType bc_types(int marker)
+{
+  return (marker == 3) ? BC_ESSENTIAL : BC_NATURAL;
+}
+
+// function values for Dirichlet boundary conditions.
+scalar essential_bc_values(int ess_bdy_marker, double x, double y)
+{
+  return y;
+}
+
+template<typename Real, typename Scalar>
+Scalar bilinear_form(int n, double *wt, Func<Scalar> *u_ext[], Func<Real> *u, Func<Real> *v, Geom<Real> *e, ExtData<Scalar> *ext)
+{
+  Scalar result = 0;
+  for (int i = 0; i < n; i++)
+    result += wt[i] * (u->dx[i] * v->dx[i] + u->dy[i] * v->dy[i] + e->x[i] * u->dx[i] * v->val[i]);
+  return result;
+}
+
+template<typename Real, typename Scalar>
+Scalar linear_form(int n, double *wt, Func<Scalar> *u_ext[], Func<Real> *v, Geom<Real> *e, ExtData<Scalar> *ext)
+{
+  Scalar result = 0;
+  for (int i = 0; i < n; i++)
+    result += wt[i] * (1.0 + e->y[i]) * v->val[i];
+  return result;
+}
+
+template<typename Real, typename Scalar>
+Scalar linear_form_surf(int n, double *wt, Func<Scalar> *u_ext[], Func<Real> *v, Geom<Real> *e, ExtData<Scalar> *ext)
+{
+  Scalar result = 0;
+  for (int i = 0; i < n; i++)
+    result += wt[i] * (e->nx[i] + e->x[i]) * v->val[i];
+  return result;
+}
+
+// solves the problem and returns its solution values and norms
+std::vector<double> solve(Mesh* mesh)
+{
+  H1Space space(mesh, bc_types, essential_bc_values, P_INIT);
+  WeakForm wf;
+  wf.add_matrix_form(callback(bilinear_form), H2D_UNSYM);
+  wf.add_vector_form(callback(linear_form));
+  wf.add_vector_form_surf(callback(linear_form_surf), 2);
+
+  LinearProblem lp(&wf, &space);
+  Matrix* mat; Vector* rhs; CommonSolver* solver;
+  init_matrix_solver(matrix_solver, get_num_dofs(&space), mat, rhs, solver);
+  lp.assemble(mat, rhs);
+  if (!solver->solve(mat, rhs)) error ("Matrix solver failed.\n");
+  Solution sln;
+  sln.set_coeff_vector(&space, rhs);
+  delete rhs;
+
+  Solution exact;
+  exact.set_const(mesh, 1.0);
+  std::vector<double> result;
+  result.push_back(calc_norm(&sln, H2D_L2_NORM));
+  result.push_back(calc_norm(&sln, H2D_H1_NORM));
+  result.push_back(calc_abs_error(&sln, &exact, H2D_H1_NORM));
+  for (int i = 1; i < 10; i++)
+    result.push_back(sln.get_pt_value(0.1 * i - 0.3, 0.08 * i));
+  return result;
+}
+
+bool same(const std::vector<double>& a, const std::vector<double>& b)
+{
+  for (unsigned i = 0; i < a.size(); i++)
+    if (fabs(a[i] - b[i]) > 1e-12 * (1 + fabs(a[i]))) return false;
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  // Load the mesh.
+  Mesh mesh;
+  H2DReader mloader;
+  mloader.load("domain.mesh", &mesh);
+  mesh.refine_all_elements();
+  mesh.refine_all_elements();
+  mesh.refine_towards_vertex(3, 2);
+
+  bool success = true;
+  int hits, misses, hits0, misses0;
+
+  // Without the cache.
+  std::vector<double> ref = solve(&mesh);
+  RefMap::get_geometry_cache_stats(hits, misses);
+  if (hits != 0 || misses != 0 || RefMap::get_geometry_cache_memory() != 0)
+    { printf("disabled cache: used\n"); success = false; }
+
+  // The first calculation fills the cache, the second one reuses the tables.
+  RefMap::set_geometry_cache(256 << 20);
+  std::vector<double> res1 = solve(&mesh);
+  RefMap::get_geometry_cache_stats(hits0, misses0);
+  std::vector<double> res2 = solve(&mesh);
+  RefMap::get_geometry_cache_stats(hits, misses);
+  printf("cache: %d hits, %d misses in the first run, %d hits, %d misses in the second run, %d kB\n",
+         hits0, misses0, hits - hits0, misses - misses0, (int) (RefMap::get_geometry_cache_memory() >> 10));
+  if (!same(ref, res1) || !same(ref, res2)) { printf("cache: different results\n"); success = false; }
+  // (the solution keeps a copy of the mesh, so only the elements of the norms are new)
+  if (misses - misses0 >= misses0 || hits - hits0 <= hits0) { printf("cache: the tables were not reused\n"); success = false; }
+
+  // A small budget.
+  size_t budget = RefMap::get_geometry_cache_memory() / 10;
+  RefMap::set_geometry_cache(budget);
+  if (RefMap::get_geometry_cache_memory() > budget) { printf("budget: too much memory\n"); success = false; }
+  std::vector<double> res3 = solve(&mesh);
+  if (!same(ref, res3)) { printf("budget: different results\n"); success = false; }
+  if (RefMap::get_geometry_cache_memory() > budget) { printf("budget: too much memory\n"); success = false; }
+
+  // Moving the mesh changes the geometry of the elements at the same addresses.
+  Mesh square;
+  double2 verts[6] = { { -1, 0 }, { 0, 0 }, { 1, 0 }, { -1, 1 }, { 0, 1 }, { 1, 1 } };
+  int5 quads[2] = { { 0, 1, 4, 3, 0 }, { 1, 2, 5, 4, 0 } };
+  int3 mark[6] = { { 0, 1, 3 }, { 1, 2, 3 }, { 2, 5, 2 }, { 5, 4, 2 }, { 4, 3, 2 }, { 3, 0, 2 } };
+  square.create(6, verts, 0, NULL, 2, quads, 6, mark);
+  square.refine_all_elements();
+  square.refine_all_elements();
+  RefMap::set_geometry_cache(256 << 20);
+  solve(&square);
+  Node* n;
+  for_all_vertex_nodes(n, &square)
+    { n->x *= 1.5; n->y *= 1.5; }
+  RefMap::set_geometry_cache(0);
+  std::vector<double> ref4 = solve(&square);
+  RefMap::set_geometry_cache(256 << 20);
+  RefMap::get_geometry_cache_stats(hits0, misses0);
+  std::vector<double> res4 = solve(&square);
+  RefMap::get_geometry_cache_stats(hits, misses);
+  if (!same(ref4, res4)) { printf("moved mesh: different results\n"); success = false; }
+  if (misses == misses0) { printf("moved mesh: the old tables were used\n"); success = false; }
+
+  // Reference maps of one element share its tangents, the tangents are counted.
+  Element* e = NULL;
+  for_all_active_elements(e, &square)
+    break;
+  RefMap rm1, rm2;
+  rm1.set_active_element(e);
+  size_t memory = RefMap::get_geometry_cache_memory();
+  double3* tan1 = rm1.get_tangent(1);
+  if (RefMap::get_geometry_cache_memory() <= memory) { printf("tangents: memory not counted\n"); success = false; }
+  double3 t = { tan1[0][0], tan1[0][1], tan1[0][2] };
+  rm2.set_active_element(e);
+  rm2.get_tangent(1, g_quad_2d_std.get_edge_points(1, 2));
+  if (rm2.get_tangent(1) != tan1 || rm1.get_tangent(1) != tan1 || memcmp(tan1[0], t, sizeof(double3)))
+    { printf("tangents: not shared\n"); success = false; }
+  rm1.free();
+  rm2.free();
+
+  // Disabling the cache frees the tables.
+  RefMap::set_geometry_cache(0);
+  if (RefMap::get_geometry_cache_memory() != 0) { printf("disabled cache: memory not freed\n"); success = false; }
+
+#define ERROR_SUCCESS                               0
+#define ERROR_FAILURE                               -1
+  if (success) {
+    printf("Success!\n");
+    return ERROR_SUCCESS;
+  }
+  else {
+    printf("Failure!\n");
+    return ERROR_FAILURE;
+  }
+}
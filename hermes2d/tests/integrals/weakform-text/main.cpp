@@ -0,0 +1,140 @@
+#include "hermes2d.h"
+
+// This test makes sure that weak forms given as a text (see the class
+// CompiledForm) are assembled to the same matrix and right-hand side
+// as the equivalent hand-written forms.
+
+int P_INIT = 4;                                   // Uniform polynomial degree of mesh elements.
+double CONST_F = 2.0;                             // Constant right-hand side.
+double CONST_H = 3.0;                             // Newton boundary condition coefficient.
+MatrixSolverType matrix_solver = SOLVER_UMFPACK;  // Possibilities: SOLVER_UMFPACK, SOLVER_PETSC,
+                                                  // SOLVER_MUMPS, and more are coming.
+
+// boundary condition types
+BCType bc_types(int marker)
+{
+  return (marker == 3) ? BC_ESSENTIAL : BC_NATURAL;
+}
+
+// function values for Dirichlet boundary conditions.
+scalar essential_bc_values(int ess_bdy_marker, double x, double y)
+{
+  return 0;
+}
+
+// the external function w(x,y) = x*y + 1
+scalar w_fn(double x, double y, scalar& dx, scalar& dy)
+{
+  dx = y;
+  dy = x;
+  return x*y + 1;
+}
+
+template<typename Real, typename Scalar>
+Scalar bilinear_form(int n, double *wt, Func<Scalar> *u_ext[], Func<Real> *u, Func<Real> *v, Geom<Real> *e, ExtData<Scalar> *ext)
+{
+  Func<Scalar>* w = ext->fn[0];
+  Scalar result = 0;
+  for (int i = 0; i < n; i++)
+    result += wt[i] * (u->dx[i] * v->dx[i] + u->dy[i] * v->dy[i]
+                       + (w->val[i] * u->dx[i] + e->x[i] * u->dy[i]) * v->val[i]
+                       + u->val[i] * v->val[i] / (1.0 + e->x[i] * e->x[i]));
+  return result;
+}
+
+template<typename Real, typename Scalar>
+Scalar bilinear_form_surf(int n, double *wt, Func<Scalar> *u_ext[], Func<Real> *u, Func<Real> *v, Geom<Real> *e, ExtData<Scalar> *ext)
+{
+  return CONST_H * int_u_v<Real, Scalar>(n, wt, u, v);
+}
+
+template<typename Real, typename Scalar>
+Scalar linear_form(int n, double *wt, Func<Scalar> *u_ext[], Func<Real> *v, Geom<Real> *e, ExtData<Scalar> *ext)
+{
+  Func<Scalar>* w = ext->fn[0];
+  Scalar result = 0;
+  for (int i = 0; i < n; i++)
+    result += wt[i] * (CONST_F * v->val[i] + w->dy[i] * v->dx[i]);
+  return result;
+}
+
+template<typename Real, typename Scalar>
+Scalar linear_form_surf(int n, double *wt, Func<Scalar> *u_ext[], Func<Real> *v, Geom<Real> *e, ExtData<Scalar> *ext)
+{
+  Scalar result = 0;
+  for (int i = 0; i < n; i++)
+    result += wt[i] * (e->nx[i] + 2.0 * e->ny[i]) * v->val[i];
+  return result;
+}
+
+// assembles the problem and returns the solution coefficients
+Vector* solve(WeakForm* wf, H1Space* space)
+{
+  LinearProblem lp(wf, space);
+  Matrix* mat; Vector* rhs; CommonSolver* solver;
+  init_matrix_solver(matrix_solver, get_num_dofs(space), mat, rhs, solver);
+  lp.assemble(mat, rhs);
+  if (!solver->solve(mat, rhs)) error ("Matrix solver failed.\n");
+  return rhs;
+}
+
+int main(int argc, char* argv[])
+{
+  // Load the mesh.
+  Mesh mesh;
+  H2DReader mloader;
+  mloader.load("domain.mesh", &mesh);
+  mesh.refine_all_elements();
+
+  // Create an H1 space.
+  H1Space* space = new H1Space(&mesh, bc_types, essential_bc_values, P_INIT);
+  int ndof = get_num_dofs(space);
+  printf("ndof = %d\n", ndof);
+
+  Solution w;
+  w.set_exact(&mesh, w_fn);
+
+  // Hand-written forms.
+  WeakForm wf1;
+  wf1.add_matrix_form(callback(bilinear_form), H2D_UNSYM, H2D_ANY, &w);
+  wf1.add_matrix_form_surf(callback(bilinear_form_surf), 2);
+  wf1.add_vector_form(callback(linear_form), H2D_ANY, &w);
+  wf1.add_vector_form_surf(callback(linear_form_surf), 2);
+
+  // The same forms given as a text.
+  WeakForm wf2;
+  wf2.define_constant("f", CONST_F);
+  wf2.define_constant("h", CONST_H);
+  wf2.define_function("w", &w);
+  // (the unary minus binds looser than "^", so 1 - -x^2 is 1 + x^2)
+  wf2.add_matrix_form("vol u,v: u_x*v_x + u_y*v_y + (w*u_x + x*u_y)*v + u*v/(1 - -x^2)");
+  wf2.add_matrix_form("surf u,v: h*u*v", H2D_UNSYM, 2);
+  wf2.add_vector_form("vol v: f*v + w_y*v_x");
+  wf2.add_vector_form("surf v: (nx + 2*ny)*v", 2);
+
+  Vector* sln1 = solve(&wf1, space);
+  Vector* sln2 = solve(&wf2, space);
+
+  double max_diff = 0, max_val = 0;
+  for (int i = 0; i < ndof; i++)
+  {
+    max_diff = std::max(max_diff, fabs(sln1->get(i) - sln2->get(i)));
+    max_val = std::max(max_val, fabs(sln1->get(i)));
+  }
+  printf("max |coefficient| = %g, max difference = %g\n", max_val, max_diff);
+
+  delete sln1;
+  delete sln2;
+  delete space;
+
+#define ERROR_SUCCESS                               0
+#define ERROR_FAILURE                               -1
+  if (max_val > 0 && max_diff < 1e-10 * max_val) {
+    printf("Success!\n");
+    return ERROR_SUCCESS;
+  }
+  else {
+    printf("Failure!\n");
+    return ERROR_FAILURE;
+  }
+}
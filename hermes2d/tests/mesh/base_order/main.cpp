@@ -0,0 +1,186 @@
+#include "hermes2d.h"
+
+// This test makes sure that Traverse visits the base elements along a space-filling
+// curve when it is selected by Mesh::set_base_order(): all active elements are visited
+// once, consecutive base elements of a Hilbert traversal of a regular grid are neighbors
+// regardless of the element numbering, and the assembled problem has the same solution.
+
+#undef ERROR_SUCCESS
+#undef ERROR_FAILURE
+#define ERROR_SUCCESS                               0
+#define ERROR_FAILURE                               -1
+
+const int N = 8;                                  // The base mesh is a grid of N x N squares.
+MatrixSolverType matrix_solver = SOLVER_UMFPACK;
+
+BCType bc_types(int marker)
+{
+  return BC_ESSENTIAL;
+}
+
+scalar essential_bc_values(int ess_bdy_marker, double x, double y)
+{
+  return x*y;
+}
+
+template<typename Real, typename Scalar>
+Scalar bilinear_form(int n, double *wt, Func<Scalar> *u_ext[], Func<Real> *u, Func<Real> *v, Geom<Real> *e, ExtData<Scalar> *ext)
+{
+  return int_grad_u_grad_v<Real, Scalar>(n, wt, u, v);
+}
+
+template<typename Real, typename Scalar>
+Scalar linear_form(int n, double *wt, Func<Scalar> *u_ext[], Func<Real> *v, Geom<Real> *e, ExtData<Scalar> *ext)
+{
+  Scalar result = 0;
+  for (int i = 0; i < n; i++)
+    result += wt[i] * sin(3 * e->x[i]) * v->val[i];
+  return result;
+}
+
+// the unit square divided into N x N squares numbered in a scrambled order
+void create_grid(Mesh* mesh)
+{
+  double2 verts[(N+1)*(N+1)];
+  int5 quads[N*N];
+  int3 mark[4*N];
+  for (int i = 0; i <= N; i++)
+    for (int j = 0; j <= N; j++)
+    {
+      verts[i*(N+1) + j][0] = (double) j / N;
+      verts[i*(N+1) + j][1] = (double) i / N;
+    }
+  for (int k = 0; k < N*N; k++)
+  {
+    int sq = (k * 37) % (N*N), i = sq / N, j = sq % N, v = i*(N+1) + j;
+    int5 q = { v, v + 1, v + N + 2, v + N + 1, 0 };
+    memcpy(quads[k], q, sizeof(int5));
+  }
+  int nm = 0;
+  for (int j = 0; j < N; j++)
+  {
+    int3 b[4] = { { j, j + 1, 1 }, { N*(N+1) + j, N*(N+1) + j + 1, 1 },
+                  { j*(N+1), (j+1)*(N+1), 1 }, { j*(N+1) + N, (j+1)*(N+1) + N, 1 } };
+    memcpy(mark + nm, b, sizeof(b));
+    nm += 4;
+  }
+  mesh->create((N+1)*(N+1), verts, 0, NULL, N*N, quads, nm, mark);
+}
+
+void get_centroid(Element* e, double& x, double& y)
+{
+  x = y = 0;
+  for (int i = 0; i < 4; i++)
+    { x += e->vn[i]->x / 4; y += e->vn[i]->y / 4; }
+}
+
+// traverses the mesh, checks that every active element is visited once and returns the base elements
+bool traverse(Mesh* mesh, std::vector<Element*>& bases)
+{
+  std::vector<int> visited(mesh->get_max_element_id(), 0);
+  Traverse trav;
+  trav.begin(1, &mesh);
+  Element** e;
+  bases.clear();
+  while ((e = trav.get_next_state(NULL, NULL)) != NULL)
+  {
+    visited[e[0]->id]++;
+    if (bases.empty() || bases.back() != trav.get_base()) bases.push_back(trav.get_base());
+  }
+  trav.finish();
+
+  Element* a;
+  for_all_active_elements(a, mesh)
+    if (visited[a->id] != 1) return false;
+  return (int) bases.size() == mesh->get_num_base_elements();
+}
+
+// solves the problem, returns the value at a few points
+std::vector<double> solve(Mesh* mesh)
+{
+  H1Space space(mesh, bc_types, essential_bc_values, 2);
+  WeakForm wf;
+  wf.add_matrix_form(callback(bilinear_form), H2D_SYM);
+  wf.add_vector_form(callback(linear_form));
+  LinearProblem lp(&wf, &space);
+  Matrix* mat; Vector* rhs; CommonSolver* solver;
+  init_matrix_solver(matrix_solver, get_num_dofs(&space), mat, rhs, solver);
+  lp.assemble(mat, rhs);
+  if (!solver->solve(mat, rhs)) error ("Matrix solver failed.\n");
+  Solution sln;
+  sln.set_coeff_vector(&space, rhs);
+  delete rhs;
+
+  std::vector<double> values;
+  for (int i = 1; i < 10; i++)
+    values.push_back(sln.get_pt_value(0.1 * i, 0.07 * i + 0.2));
+  return values;
+}
+
+int main(int argc, char* argv[])
+{
+  Mesh mesh;
+  create_grid(&mesh);
+  mesh.refine_element(5);
+  bool success = true;
+  std::vector<Element*> bases;
+
+  // The natural order.
+  if (mesh.get_base_order_ids() != NULL) { printf("natural order: ids returned\n"); success = false; }
+  if (!traverse(&mesh, bases)) { printf("natural order: wrong traversal\n"); success = false; }
+  for (unsigned i = 0; i < bases.size(); i++)
+    if (bases[i]->id != (int) i) { printf("natural order: base %d visited as %d.\n", bases[i]->id, i); success = false; break; }
+  std::vector<double> values1 = solve(&mesh);
+
+  // The order is kept by copies, the solution does not depend on it.
+  mesh.set_base_order(H2D_BASE_ORDER_HILBERT);
+  Mesh dup;
+  dup.copy(&mesh);
+  if (dup.get_base_order() != H2D_BASE_ORDER_HILBERT) { printf("copy: the order was not copied\n"); success = false; }
+  std::vector<double> values2 = solve(&dup);
+  for (unsigned i = 0; i < values1.size(); i++)
+    if (fabs(values1[i] - values2[i]) > 1e-12 * (1 + fabs(values1[i])))
+      { printf("Hilbert order: different solution %g, should be %g\n", values2[i], values1[i]); success = false; break; }
+
+  // Hilbert curve: consecutive base elements share an edge.
+  mesh.refine_all_elements();
+  if (!traverse(&mesh, bases)) { printf("Hilbert order: wrong traversal\n"); success = false; }
+  for (unsigned i = 1; i < bases.size(); i++)
+  {
+    double x0, y0, x1, y1;
+    get_centroid(bases[i-1], x0, y0);
+    get_centroid(bases[i], x1, y1);
+    if (fabs(fabs(x1 - x0) + fabs(y1 - y0) - 1.0 / N) > 1e-12)
+      { printf("Hilbert order: bases %d and %d are not neighbors\n", bases[i-1]->id, bases[i]->id); success = false; break; }
+  }
+
+  // The order is calculated once: refinements and copies keep it.
+  int calcs = mesh.get_num_base_order_calcs();
+  int id = mesh.get_max_element_id() - 1;          // (an active element)
+  mesh.refine_element(id);
+  mesh.unrefine_element(id);
+  if (!traverse(&mesh, bases)) { printf("Hilbert order: wrong traversal\n"); success = false; }
+  if (mesh.get_num_base_order_calcs() != calcs) { printf("Hilbert order: recalculated after a refinement\n"); success = false; }
+  Mesh dup2;
+  dup2.copy(&mesh);
+  if (dup2.get_base_order_ids() == NULL || dup2.get_num_base_order_calcs() != 0) { printf("Hilbert order: recalculated by a copy\n"); success = false; }
+
+  // Morton curve: starts in the lower left corner, ends in the upper right corner.
+  mesh.set_base_order(H2D_BASE_ORDER_MORTON);
+  if (!traverse(&mesh, bases)) { printf("Morton order: wrong traversal\n"); success = false; }
+  if (mesh.get_num_base_order_calcs() != calcs + 1) { printf("Morton order: not calculated once\n"); success = false; }
+  double x0, y0, x1, y1;
+  get_centroid(bases.front(), x0, y0);
+  get_centroid(bases.back(), x1, y1);
+  if (x0 > 1.0 / N || y0 > 1.0 / N || x1 < 1 - 1.0 / N || y1 < 1 - 1.0 / N)
+    { printf("Morton order: wrong ends\n"); success = false; }
+
+  if (success) {
+    printf("Success!\n");
+    return ERROR_SUCCESS;
+  }
+  else {
+    printf("Failure!\n");
+    return ERROR_FAILURE;
+  }
+}
@@ -0,0 +1,128 @@
+#include "hermes2d.h"
+
+// This test makes sure that AsyncLinearizer linearizes snapshots of solutions
+// in its worker thread. Called as
+//    async-linearizer <domain>
+// it queues a series of solutions (refining the mesh in the middle of the series
+// and changing the solution right after queueing it) and checks that the front
+// Linearizer finally holds the same data as a Linearizer that processed the
+// last solution directly, and that every snapshot was either processed or dropped.
+// The same series is then rendered with ImageView::show_async().
+
+#define ERROR_SUCCESS       0
+#define ERROR_FAILURE       -1
+
+const int P_INIT = 3;
+const int NUM_STEPS = 20;
+
+BCType bc_types(int marker)
+{
+  return BC_NATURAL;
+}
+
+// the solution of the given step
+void set_step(Solution* sln, H1Space* space, int step)
+{
+  int ndof = get_num_dofs(space);
+  scalar* coeffs = new scalar[ndof];
+  for (int i = 0; i < ndof; i++)
+    coeffs[i] = (step + 1) * 0.1 * ((i * 7) % 11 - 5);
+  sln->set_coeff_vector(space, coeffs);
+  delete [] coeffs;
+}
+
+int num_callbacks = 0;
+
+void on_update(Linearizer* front, Solution* sln, void* data)
+{
+  if (front == (Linearizer*) data && sln->get_mesh() != NULL) num_callbacks++;
+}
+
+bool same_data(Linearizer* a, Linearizer* b)
+{
+  if (a->get_num_vertices() != b->get_num_vertices()) return false;
+  if (a->get_num_triangles() != b->get_num_triangles()) return false;
+  if (a->get_num_edges() != b->get_num_edges()) return false;
+  if (a->get_min_value() != b->get_min_value() || a->get_max_value() != b->get_max_value()) return false;
+  double3* va = a->get_vertices();
+  double3* vb = b->get_vertices();
+  for (int i = 0; i < a->get_num_vertices(); i++)
+    for (int j = 0; j < 3; j++)
+      if (va[i][j] != vb[i][j]) return false;
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2)
+  {
+    printf("Please input as this format: async-linearizer <domain> \n");
+    return ERROR_FAILURE;
+  }
+
+  Mesh mesh;
+  H2DReader mloader;
+  mloader.load(argv[1], &mesh);
+  mesh.refine_all_elements();
+
+  bool success = true;
+
+  // the series of solutions
+  {
+    H1Space space(&mesh, bc_types, NULL, P_INIT);
+    Solution sln;
+    Linearizer front;
+    AsyncLinearizer async(&front);
+    async.set_callback(on_update, &front);
+
+    for (int step = 0; step < NUM_STEPS; step++)
+    {
+      if (step == NUM_STEPS / 2)
+      {
+        mesh.refine_all_elements();
+        space.set_uniform_order(P_INIT);
+      }
+      set_step(&sln, &space, step);
+      async.process_solution(&sln);
+      // the snapshot must not be affected by changes of the solution
+      set_step(&sln, &space, step + 100);
+    }
+    async.flush();
+
+    printf("processed %d, dropped %d snapshots\n", async.get_num_processed(), async.get_num_dropped());
+    if (async.get_num_processed() + async.get_num_dropped() != NUM_STEPS || async.get_num_processed() < 1)
+      { printf("wrong number of snapshots\n"); success = false; }
+    if (num_callbacks != async.get_num_processed())
+      { printf("%d callbacks\n", num_callbacks); success = false; }
+
+    Linearizer ref;
+    set_step(&sln, &space, NUM_STEPS - 1);
+    ref.process_solution(&sln);
+    if (!same_data(&front, &ref)) { printf("wrong linearization\n"); success = false; }
+  }
+
+  // the same with ImageView
+  {
+    H1Space space(&mesh, bc_types, NULL, P_INIT);
+    Solution sln;
+    ImageView view("async-linearizer-%d.ppm", 64, 64);
+    for (int step = 0; step < NUM_STEPS; step++)
+    {
+      set_step(&sln, &space, step);
+      view.show_async(&sln);
+    }
+    view.wait_for_frame();
+    printf("%d frames written, %d dropped\n", view.get_num_frames(), view.get_num_dropped());
+    if (view.get_num_frames() + view.get_num_dropped() != NUM_STEPS || view.get_num_frames() < 1)
+      { printf("image view: wrong number of frames\n"); success = false; }
+  }
+
+  if (success) {
+    printf("Success!\n");
+    return ERROR_SUCCESS;
+  }
+  else {
+    printf("Failure!\n");
+    return ERROR_FAILURE;
+  }
+}
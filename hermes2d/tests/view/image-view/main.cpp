@@ -0,0 +1,140 @@
+#include "hermes2d.h"
+
+// This test makes sure that ImageView renders solutions, element orders and
+// meshes to image files without a display. Called as
+//    image-view <domain>
+// it renders the function z = x + y over the mesh loaded from <domain>
+// and checks the colors of several pixels of the PPM image, the size of the
+// PNG image and the number of frames written.
+
+#define ERROR_SUCCESS       0
+#define ERROR_FAILURE       -1
+
+const int WIDTH = 200, HEIGHT = 100;
+
+BCType bc_types(int marker)
+{
+  return BC_NATURAL;
+}
+
+scalar plane(double x, double y, scalar& dx, scalar& dy)
+{
+  dx = 1.0;
+  dy = 1.0;
+  return x + y;
+}
+
+// reads a binary PPM file written by ImageView
+bool read_ppm(const char* filename, std::vector<unsigned char>& rgb)
+{
+  FILE* f = fopen(filename, "rb");
+  if (f == NULL) return false;
+  int w, h, max;
+  bool ok = (fscanf(f, "P6 %d %d %d", &w, &h, &max) == 3) && w == WIDTH && h == HEIGHT && max == 255;
+  fgetc(f);
+  rgb.resize(3 * w * h);
+  ok = ok && fread(&rgb[0], 1, rgb.size(), f) == rgb.size();
+  fclose(f);
+  return ok;
+}
+
+long file_size(const char* filename)
+{
+  FILE* f = fopen(filename, "rb");
+  if (f == NULL) return -1;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fclose(f);
+  return size;
+}
+
+bool is_white(std::vector<unsigned char>& rgb, int x, int y)
+{
+  unsigned char* p = &rgb[3 * (y * WIDTH + x)];
+  return p[0] == 255 && p[1] == 255 && p[2] == 255;
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2)
+  {
+    printf("Please input as this format: image-view <domain> \n");
+    return ERROR_FAILURE;
+  }
+
+  Mesh mesh;
+  H2DReader mloader;
+  mloader.load(argv[1], &mesh);
+  mesh.refine_all_elements();
+
+  Solution sln;
+  sln.set_exact(&mesh, plane);
+
+  bool success = true;
+
+  // scalar function: the square fills the middle of the image
+  {
+    ImageView view("image-view-%d.ppm", WIDTH, HEIGHT);
+    view.show(&sln);
+    view.wait_for_frame();
+    if (view.get_num_frames() != 1) { printf("scalar: frame not written\n"); success = false; }
+
+    std::vector<unsigned char> rgb;
+    if (!read_ppm("image-view-0.ppm", rgb)) { printf("scalar: cannot read the image\n"); return ERROR_FAILURE; }
+
+    // the margins are white, the domain is not
+    if (!is_white(rgb, 5, 50) || !is_white(rgb, 195, 50)) { printf("scalar: margin not white\n"); success = false; }
+    if (is_white(rgb, 100, 50) || is_white(rgb, 65, 85) || is_white(rgb, 135, 15)) { printf("scalar: domain not filled\n"); success = false; }
+
+    // the lower left corner has the lowest value (blue), the upper right the highest (red)
+    unsigned char* low = &rgb[3 * (85 * WIDTH + 65)];
+    unsigned char* high = &rgb[3 * (15 * WIDTH + 135)];
+    if (!(low[2] > low[0] && high[0] > high[2])) { printf("scalar: wrong colors\n"); success = false; }
+  }
+
+  // every other frame, PNG
+  {
+    ImageView view("image-view-%d.png", WIDTH, HEIGHT);
+    view.set_interval(2);
+    view.show_contours(0.5);
+    view.show_mesh();
+    for (int i = 0; i < 4; i++)
+    {
+      view.show(&sln);
+      view.wait_for_frame();
+    }
+    if (view.get_num_frames() != 2) { printf("png: %d frames written\n", view.get_num_frames()); success = false; }
+
+    int row = 3 * WIDTH + 1;
+    long expected = 8 + 25 + 12 + 2 + 5 * ((row * HEIGHT + 65534) / 65535) + row * HEIGHT + 4 + 12;
+    if (file_size("image-view-1.png") != expected) { printf("png: wrong file size\n"); success = false; }
+  }
+
+  // element orders and the mesh
+  {
+    H1Space space(&mesh, bc_types, NULL, 3);
+    ImageView view("image-view-orders-%d.ppm", WIDTH, HEIGHT);
+    view.show(&space);
+    view.wait_for_frame();
+    view.show(&mesh);
+    view.wait_for_frame();
+    if (view.get_num_frames() != 2) { printf("orders: %d frames written\n", view.get_num_frames()); success = false; }
+  }
+
+  // vector field
+  {
+    ImageView view("image-view-vectors-%d.ppm", WIDTH, HEIGHT);
+    view.show(&sln, &sln);
+    view.wait_for_frame();
+    if (view.get_num_frames() != 1) { printf("vectors: frame not written\n"); success = false; }
+  }
+
+  if (success) {
+    printf("Success!\n");
+    return ERROR_SUCCESS;
+  }
+  else {
+    printf("Failure!\n");
+    return ERROR_FAILURE;
+  }
+}
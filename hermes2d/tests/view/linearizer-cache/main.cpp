@@ -0,0 +1,125 @@
+#include "hermes2d.h"
+
+// This test makes sure that a Linearizer with caching enabled (see
+// Linearizer::set_caching()) reuses the linearized mesh when only the
+// coefficients of the solution change, recalculates the vertex values
+// correctly and does not reuse the mesh after the element orders or
+// the mesh change. Called as
+//    linearizer-cache <domain>
+
+#define ERROR_SUCCESS       0
+#define ERROR_FAILURE       -1
+
+const int P_INIT = 3;
+
+BCType bc_types(int marker)
+{
+  return BC_NATURAL;
+}
+
+// the solution of the given step
+void set_step(Solution* sln, H1Space* space, int step)
+{
+  int ndof = get_num_dofs(space);
+  scalar* coeffs = new scalar[ndof];
+  for (int i = 0; i < ndof; i++)
+    coeffs[i] = (step + 1) * 0.1 * ((i * 7) % 11 - 5) + step * step * 0.01 * (i % 3);
+  sln->set_coeff_vector(space, coeffs);
+  delete [] coeffs;
+}
+
+// compares the vertices of two linearizers; 'tris' also compares the triangles (the diagonals
+// of the quads depend on the values), 'values' also compares the vertex values
+bool same_data(Linearizer* a, Linearizer* b, bool tris, bool values)
+{
+  if (a->get_num_vertices() != b->get_num_vertices()) return false;
+  if (a->get_num_triangles() != b->get_num_triangles()) return false;
+  if (a->get_num_edges() != b->get_num_edges()) return false;
+  if (tris && memcmp(a->get_triangles(), b->get_triangles(), sizeof(int3) * a->get_num_triangles())) return false;
+
+  double3* va = a->get_vertices();
+  double3* vb = b->get_vertices();
+  double max = std::max(fabs(b->get_min_value()), fabs(b->get_max_value()));
+  for (int i = 0; i < a->get_num_vertices(); i++)
+  {
+    if (va[i][0] != vb[i][0] || va[i][1] != vb[i][1]) return false;
+    if (values && fabs(va[i][2] - vb[i][2]) > 1e-10 * max) return false;
+  }
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2)
+  {
+    printf("Please input as this format: linearizer-cache <domain> \n");
+    return ERROR_FAILURE;
+  }
+
+  Mesh mesh;
+  H2DReader mloader;
+  mloader.load(argv[1], &mesh);
+  mesh.refine_all_elements();
+  mesh.refine_element(1);
+
+  H1Space space(&mesh, bc_types, NULL, P_INIT);
+  Solution sln;
+  bool success = true;
+
+  // fixed subdivision: the cached linearization must be the same as a new one
+  {
+    Linearizer cached, plain;
+    cached.set_caching();
+    for (int step = 0; step < 5; step++)
+    {
+      set_step(&sln, &space, step);
+      cached.process_solution(&sln, H2D_FN_VAL_0, 3.0);
+      plain.process_solution(&sln, H2D_FN_VAL_0, 3.0);
+      if (!same_data(&cached, &plain, false, true)) { printf("fixed subdivision: step %d differs\n", step); success = false; }
+    }
+  }
+
+  // adaptive subdivision: the triangles of the first step are reused
+  {
+    Linearizer cached, first;
+    cached.set_caching();
+    set_step(&sln, &space, 0);
+    cached.process_solution(&sln);
+    first.process_solution(&sln);
+    set_step(&sln, &space, 4);
+    cached.process_solution(&sln);
+    if (!same_data(&cached, &first, true, false)) { printf("adaptive subdivision: the mesh was not reused\n"); success = false; }
+
+    // the values at the mesh vertices are exact
+    double3* verts = cached.get_vertices();
+    for (int i = 0; i < cached.get_num_vertices(); i += 7)
+    {
+      double v = verts[i][2], exact = sln.get_pt_value(verts[i][0], verts[i][1]);
+      if (fabs(v - exact) > 1e-8 * (1 + fabs(exact))) { printf("adaptive subdivision: wrong value %g, should be %g\n", v, exact); success = false; break; }
+    }
+
+    // a change of the element orders or of the mesh invalidates the cache
+    Linearizer plain;
+    space.set_element_order(3, H2D_MAKE_QUAD_ORDER(P_INIT + 1, P_INIT + 1));
+    set_step(&sln, &space, 5);
+    cached.process_solution(&sln);
+    plain.process_solution(&sln);
+    if (!same_data(&cached, &plain, true, true)) { printf("orders changed: the cache was used\n"); success = false; }
+
+    mesh.refine_all_elements();
+    space.set_uniform_order(P_INIT);
+    set_step(&sln, &space, 6);
+    cached.process_solution(&sln);
+    plain.process_solution(&sln);
+    if (!same_data(&cached, &plain, true, true)) { printf("mesh changed: the cache was used\n"); success = false; }
+  }
+
+  if (success) {
+    printf("Success!\n");
+    return ERROR_SUCCESS;
+  }
+  else {
+    printf("Failure!\n");
+    return ERROR_FAILURE;
+  }
+}
@@ -89,6 +89,22 @@ void out_fn(MeshFunction *fn, const char *name, int iter)
   else warning("Could not open file '%s' for writing.", fname);
 }
 
+// Visit all active elements and their vertices (measures the cost of mesh traversal).
+double traverse_mesh(Mesh *mesh)
+{
+  double sum = 0.0;
+  FOR_ALL_ACTIVE_ELEMENTS(idx, mesh) {
+    Element *e = mesh->elements[idx];
+    Word_t vtcs[Hex::NUM_VERTICES];
+    e->get_vertices(vtcs);
+    for (int i = 0; i < e->get_num_vertices(); i++) {
+      Vertex *v = mesh->vertices[vtcs[i]];
+      sum += v->x + v->y + v->z;
+    }
+  }
+  return sum;
+}
+
 /***********************************************************************************
  * main program                                                                    *
 ************************************************************************************/
@@ -107,10 +123,21 @@ int main(int argc, char **args)
 
   // Initial uniform  mesh refinements.
   printf("Performing %d initial mesh refinements.\n", INIT_REF_NUM);
+  Timer t_refine;
+  t_refine.start();
   for (int i=0; i < INIT_REF_NUM; i++) mesh.refine_all_elements(H3D_H3D_H3D_REFT_HEX_XYZ);
+  t_refine.stop();
+  printf("  - Refinement done in %s (%lf secs)\n", t_refine.get_human_time(), t_refine.get_seconds());
   Word_t (nelem) = mesh.get_num_elements();
   printf("New number of elements is %d.\n", nelem);
 
+  // Mesh traversal.
+  Timer t_traverse;
+  t_traverse.start();
+  traverse_mesh(&mesh);
+  t_traverse.stop();
+  printf("  - Traversal done in %s (%lf secs)\n", t_traverse.get_human_time(), t_traverse.get_seconds());
+
   //Initialize the shapeset and the cache.
   H1ShapesetLobattoHex shapeset;
 
@@ -24,7 +24,11 @@
 
 /// \file array.h
 
+#ifdef WITH_DENSE_CONTAINERS
+#include "dense.h"
+#else
 #include <Judy.h>
+#endif
 
 #ifndef INVALID_IDX
 #define INVALID_IDX					((Word_t) -1)
@@ -35,10 +39,19 @@
 /// C++ encapsulation of JudyL functions.
 /// Provides functionality of a dynamic array.
 /// Items are classes of TYPE
+///
+/// With WITH_DENSE_CONTAINERS the items are stored by value in a contiguous
+/// vector indexed by their id. References returned by operator[] are then
+/// invalidated when the array grows.
 template<class TYPE>
 class Array {
 protected:
+#ifdef WITH_DENSE_CONTAINERS
+	std::vector<TYPE> items;				// item with index idx is items[idx]
+	DenseBitmap present;					// indices present in the array
+#else
 	void *judy;
+#endif
 
 public:
 	Array();
@@ -123,6 +136,112 @@ protected:
 
 // implementation
 
+#ifdef WITH_DENSE_CONTAINERS
+
+template<class TYPE>
+Array<TYPE>::Array() {
+};
+
+template<class TYPE>
+Array<TYPE>::~Array() {
+	remove_all();
+}
+
+template<class TYPE>
+bool Array<TYPE>::set(Word_t idx, TYPE item) {
+	if (idx == INVALID_IDX) return false;
+	if (idx >= items.size()) items.resize(idx + 1);
+	items[idx] = item;
+	present.set(idx);
+	return true;
+}
+
+template<class TYPE>
+Word_t Array<TYPE>::add(TYPE item) {
+	Word_t idx = last();
+	idx = (idx == INVALID_IDX) ? 0 : idx + 1;
+	return set(idx, item) ? idx : INVALID_IDX;
+}
+
+template<class TYPE>
+bool Array<TYPE>::exists(Word_t idx) const {
+	return present.is_set(idx);
+}
+
+template<class TYPE>
+TYPE Array<TYPE>::get(Word_t idx) const {
+	assert(present.is_set(idx));
+	return items[idx];
+}
+
+template<class TYPE>
+TYPE Array<TYPE>::operator[](Word_t idx) const {
+	return get(idx);
+}
+
+template<class TYPE>
+TYPE &Array<TYPE>::operator[](Word_t idx) {
+	if (!present.is_set(idx)) set(idx, TYPE());
+	return items[idx];
+}
+
+template<class TYPE>
+void Array<TYPE>::free_item(Word_t idx) {
+	if (present.is_set(idx))
+		items[idx] = TYPE();
+}
+
+template<class TYPE>
+void Array<TYPE>::remove(Word_t idx) {
+	free_item(idx);
+	present.unset(idx);
+}
+
+template<class TYPE>
+Word_t Array<TYPE>::count(Word_t index1/* = 0*/, Word_t index2/* = (Word_t) -1*/) const {
+	return present.count(index1, index2);
+}
+
+template<class TYPE>
+Word_t Array<TYPE>::by_count(Word_t nth) const {
+	return present.by_count(nth);
+}
+
+template<class TYPE>
+Word_t Array<TYPE>::mem_used() const {
+	return items.capacity() * sizeof(TYPE) + present.mem_used();
+}
+
+template<class TYPE>
+void Array<TYPE>::remove_all() {
+	std::vector<TYPE>().swap(items);
+	present.clear();
+}
+
+// Iterators
+
+template<class TYPE>
+Word_t Array<TYPE>::first(Word_t idx/* = 0*/) const {
+	return present.first(idx);
+}
+
+template<class TYPE>
+Word_t Array<TYPE>::next(Word_t idx/* = 0*/) const {
+	return present.next(idx);
+}
+
+template<class TYPE>
+Word_t Array<TYPE>::last(Word_t idx/* = (Word_t) -1*/) const {
+	return present.last(idx);
+}
+
+template<class TYPE>
+Word_t Array<TYPE>::prev(Word_t idx/* = (Word_t) -1*/) const {
+	return present.prev(idx);
+}
+
+#else
+
 template<class TYPE>
 Array<TYPE>::Array() {
 	judy = NULL;
@@ -278,3 +397,5 @@ Word_t Array<TYPE>::prev(Word_t idx/* = (Word_t) -1*/) const {
 }
 
 #endif
+
+#endif
@@ -24,7 +24,11 @@
 
 /// \file arrayptr.h
 
+#ifdef WITH_DENSE_CONTAINERS
+#include "dense.h"
+#else
 #include <Judy.h>
+#endif
 
 #ifndef INVALID_IDX
 #define INVALID_IDX					((Word_t) -1)
@@ -38,7 +42,12 @@
 template<class TYPE>
 class ArrayPtr {
 protected:
+#ifdef WITH_DENSE_CONTAINERS
+	std::vector<TYPE *> items;				// item with index idx is items[idx]
+	DenseBitmap present;					// indices present in the array
+#else
 	void *judy;
+#endif
 
 public:
 	ArrayPtr();
@@ -120,6 +129,106 @@ public:
 
 // implementation
 
+#ifdef WITH_DENSE_CONTAINERS
+
+template<class TYPE>
+ArrayPtr<TYPE>::ArrayPtr() {
+};
+
+template<class TYPE>
+ArrayPtr<TYPE>::~ArrayPtr() {
+	remove_all();
+}
+
+template<class TYPE>
+bool ArrayPtr<TYPE>::set(Word_t idx, TYPE *item) {
+	if (idx == INVALID_IDX) return false;
+	if (idx >= items.size()) items.resize(idx + 1, NULL);
+	items[idx] = item;
+	present.set(idx);
+	return true;
+}
+
+template<class TYPE>
+Word_t ArrayPtr<TYPE>::add(TYPE *item) {
+	Word_t idx = last();
+	idx = (idx == INVALID_IDX) ? 0 : idx + 1;
+	return set(idx, item) ? idx : INVALID_IDX;
+}
+
+template<class TYPE>
+bool ArrayPtr<TYPE>::exists(Word_t idx) const {
+	return present.is_set(idx);
+}
+
+template<class TYPE>
+TYPE *ArrayPtr<TYPE>::get(Word_t idx) const {
+	assert(present.is_set(idx));
+	return items[idx];
+}
+
+template<class TYPE>
+TYPE *ArrayPtr<TYPE>::operator[](Word_t idx) const {
+	return get(idx);
+}
+
+template<class TYPE>
+TYPE *&ArrayPtr<TYPE>::operator[](Word_t idx) {
+	if (!present.is_set(idx)) set(idx, NULL);
+	return items[idx];
+}
+
+template<class TYPE>
+void ArrayPtr<TYPE>::remove(Word_t idx) {
+	if (present.unset(idx))
+		items[idx] = NULL;
+}
+
+template<class TYPE>
+Word_t ArrayPtr<TYPE>::count(Word_t index1/* = 0*/, Word_t index2/* = (Word_t) -1*/) const {
+	return present.count(index1, index2);
+}
+
+template<class TYPE>
+Word_t ArrayPtr<TYPE>::by_count(Word_t nth) const {
+	return present.by_count(nth);
+}
+
+template<class TYPE>
+Word_t ArrayPtr<TYPE>::mem_used() const {
+	return items.capacity() * sizeof(TYPE *) + present.mem_used();
+}
+
+template<class TYPE>
+void ArrayPtr<TYPE>::remove_all() {
+	std::vector<TYPE *>().swap(items);
+	present.clear();
+}
+
+// Iterators
+
+template<class TYPE>
+Word_t ArrayPtr<TYPE>::first(Word_t idx/* = 0*/) const {
+	return present.first(idx);
+}
+
+template<class TYPE>
+Word_t ArrayPtr<TYPE>::next(Word_t idx/* = 0*/) const {
+	return present.next(idx);
+}
+
+template<class TYPE>
+Word_t ArrayPtr<TYPE>::last(Word_t idx/* = (Word_t) -1*/) const {
+	return present.last(idx);
+}
+
+template<class TYPE>
+Word_t ArrayPtr<TYPE>::prev(Word_t idx/* = (Word_t) -1*/) const {
+	return present.prev(idx);
+}
+
+#else
+
 template<class TYPE>
 ArrayPtr<TYPE>::ArrayPtr() {
 	judy = NULL;
@@ -258,3 +367,5 @@ Word_t ArrayPtr<TYPE>::prev(Word_t idx/* = (Word_t) -1*/) const {
 }
 
 #endif
+
+#endif
@@ -22,12 +22,39 @@
 
 /// \file bitarray.h
 
+#ifdef WITH_DENSE_CONTAINERS
+#include "dense.h"
+#else
 #include <Judy.h>
+#endif
 
 #ifndef INVALID_IDX
 #define INVALID_IDX					((Word_t) -1)
 #endif
 
+#ifdef WITH_DENSE_CONTAINERS
+
+/// Bit array stored as a plain bitmap. The interface is the same as the one
+/// of the Judy1-based version below.
+class BitArray : public DenseBitmap {
+public:
+	/// Make a copy of array
+	bool copy(BitArray *original) {
+		for (Word_t ind = original->first(); ind != INVALID_IDX; ind = original->next(ind)) {
+			if (!set(ind))
+				return false;
+		}
+		return true;
+	}
+
+	/// unset all elements
+	void free() {
+		clear();
+	}
+};
+
+#else
+
 
 /// \class BitArray
 /// \brief Implementation of a hash table mapping an Index to a bit (0/1).
@@ -192,3 +219,5 @@ public:
 };
 
 #endif
+
+#endif
@@ -0,0 +1,294 @@
+// This file is part of Hermes3D
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes3D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes3D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes3D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+
+#ifndef _DENSE_H_
+#define _DENSE_H_
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+
+/// \file dense.h
+/// Building blocks for the Judy-free containers (enabled by WITH_DENSE_CONTAINERS).
+/// Items are kept in contiguous storage indexed by their id, presence of an index
+/// is tracked in a bitmap and keys are resolved by an open-addressing hash index.
+/// The items themselves are stored whole (array of structures); containers of pointers,
+/// like the Array<Vertex *> of the mesh, still point to separately allocated objects.
+
+#ifndef _JUDY_INCLUDED
+typedef unsigned long Word_t;
+#endif
+
+#ifndef INVALID_IDX
+#define INVALID_IDX					((Word_t) -1)
+#endif
+
+/// \class DenseBitmap
+/// \brief Growable bitmap with the iteration semantics of Judy1.
+class DenseBitmap {
+public:
+	DenseBitmap() : n_set(0) { }
+
+	bool is_set(Word_t idx) const {
+		Word_t w = idx / BITS;
+		return w < bits.size() && (bits[w] & bit(idx)) != 0;
+	}
+
+	/// \retval true if the bit was previously unset
+	bool set(Word_t idx) {
+		Word_t w = idx / BITS;
+		if (w >= bits.size()) bits.resize(w + 1, 0);
+		if (bits[w] & bit(idx)) return false;
+		bits[w] |= bit(idx);
+		n_set++;
+		return true;
+	}
+
+	/// \retval true if the bit was previously set
+	bool unset(Word_t idx) {
+		if (!is_set(idx)) return false;
+		bits[idx / BITS] &= ~bit(idx);
+		n_set--;
+		return true;
+	}
+
+	/// Number of set bits between index1 and index2 (inclusive)
+	Word_t count(Word_t index1 = 0, Word_t index2 = (Word_t) -1) const {
+		if (index1 == 0 && index2 >= size()) return n_set;
+		if (index1 > index2 || index1 >= size()) return 0;
+		if (index2 >= size()) index2 = size() - 1;
+
+		Word_t w1 = index1 / BITS, w2 = index2 / BITS;
+		uint64_t lo_mask = ~(uint64_t) 0 << (index1 % BITS);
+		uint64_t hi_mask = ~(uint64_t) 0 >> (BITS - 1 - index2 % BITS);
+		if (w1 == w2) return popcount(bits[w1] & lo_mask & hi_mask);
+
+		Word_t cnt = popcount(bits[w1] & lo_mask) + popcount(bits[w2] & hi_mask);
+		for (Word_t w = w1 + 1; w < w2; w++)
+			cnt += popcount(bits[w]);
+		return cnt;
+	}
+
+	/// \return nth set index (\c nth equal to 1 returns the first one) or INVALID_IDX
+	Word_t by_count(Word_t nth) const {
+		if (nth == 0 || nth > n_set) return INVALID_IDX;
+		for (Word_t w = 0; w < bits.size(); w++) {
+			Word_t c = popcount(bits[w]);
+			if (nth > c) { nth -= c; continue; }
+			uint64_t word = bits[w];
+			for (; nth > 1; nth--) word &= word - 1;		// drop the lowest set bits
+			return w * BITS + ctz(word);
+		}
+		return INVALID_IDX;
+	}
+
+	/// First set index >= idx
+	Word_t first(Word_t idx = 0) const { return scan_fwd(idx, false); }
+	/// First set index > idx
+	Word_t next(Word_t idx = 0) const { return idx == INVALID_IDX ? INVALID_IDX : scan_fwd(idx + 1, false); }
+	/// Last set index <= idx
+	Word_t last(Word_t idx = (Word_t) -1) const { return scan_bwd(idx, false); }
+	/// Last set index < idx
+	Word_t prev(Word_t idx = (Word_t) -1) const { return idx == 0 ? INVALID_IDX : scan_bwd(idx - 1, false); }
+
+	Word_t first_empty(Word_t idx = 0) const { return scan_fwd(idx, true); }
+	Word_t next_empty(Word_t idx = 0) const { return idx == INVALID_IDX ? INVALID_IDX : scan_fwd(idx + 1, true); }
+	Word_t last_empty(Word_t idx = (Word_t) -1) const { return scan_bwd(idx, true); }
+	Word_t prev_empty(Word_t idx = (Word_t) -1) const { return idx == 0 ? INVALID_IDX : scan_bwd(idx - 1, true); }
+
+	Word_t mem_used() const { return bits.capacity() * sizeof(uint64_t); }
+
+	/// Unset all bits and release the memory
+	void clear() {
+		std::vector<uint64_t>().swap(bits);
+		n_set = 0;
+	}
+
+protected:
+	static const Word_t BITS = 64;
+
+	std::vector<uint64_t> bits;
+	Word_t n_set;					// number of set bits
+
+	Word_t size() const { return bits.size() * BITS; }
+	static uint64_t bit(Word_t idx) { return (uint64_t) 1 << (idx % BITS); }
+	static Word_t popcount(uint64_t w) { return __builtin_popcountll(w); }
+	static Word_t ctz(uint64_t w) { return __builtin_ctzll(w); }
+	static Word_t clz(uint64_t w) { return __builtin_clzll(w); }
+
+	Word_t scan_fwd(Word_t idx, bool empty) const {
+		if (idx >= size()) return empty ? idx : INVALID_IDX;
+		Word_t w = idx / BITS;
+		uint64_t word = (empty ? ~bits[w] : bits[w]) & (~(uint64_t) 0 << (idx % BITS));
+		while (word == 0) {
+			if (++w >= bits.size()) return empty ? size() : INVALID_IDX;
+			word = empty ? ~bits[w] : bits[w];
+		}
+		return w * BITS + ctz(word);
+	}
+
+	Word_t scan_bwd(Word_t idx, bool empty) const {
+		if (idx >= size()) {
+			if (empty) return idx;
+			if (bits.empty()) return INVALID_IDX;
+			idx = size() - 1;
+		}
+		Word_t w = idx / BITS;
+		uint64_t word = (empty ? ~bits[w] : bits[w]) & (~(uint64_t) 0 >> (BITS - 1 - idx % BITS));
+		while (word == 0) {
+			if (w-- == 0) return INVALID_IDX;
+			word = empty ? ~bits[w] : bits[w];
+		}
+		return w * BITS + (BITS - 1 - clz(word));
+	}
+};
+
+/// \class DenseHashIndex
+/// \brief Open-addressing hash index (array-of-bytes key) => Word_t.
+/// Keys are copied into one contiguous pool, slots are probed linearly.
+class DenseHashIndex {
+public:
+	DenseHashIndex() : n_used(0), n_deleted(0) { }
+
+	Word_t count() const { return n_used; }
+
+	bool lookup(const void *key, int length, Word_t &value) const {
+		Word_t pos = find(key, length, hash(key, length));
+		if (pos == INVALID_IDX) return false;
+		value = slots[pos].value;
+		return true;
+	}
+
+	/// Insert or replace the value associated with \c key
+	/// \retval true if the key was not present before
+	bool set(const void *key, int length, Word_t value) {
+		assert(length >= 0 && length <= 0xffff);
+		Word_t h = hash(key, length);
+		Word_t pos = find(key, length, h);
+		if (pos != INVALID_IDX) {
+			slots[pos].value = value;
+			return false;
+		}
+
+		if ((n_used + n_deleted + 1) * 4 > slots.size() * 3)
+			rehash(n_used * 2 + 1 > slots.size() / 2 ? slots.size() * 2 : slots.size());
+
+		Word_t mask = slots.size() - 1;
+		for (pos = h & mask; slots[pos].state == USED; pos = (pos + 1) & mask)
+			;
+		if (slots[pos].state == DELETED) n_deleted--;
+
+		Slot &s = slots[pos];
+		s.hash = h;
+		s.value = value;
+		s.ofs = pool.size();
+		s.len = length;
+		s.state = USED;
+		pool.insert(pool.end(), (const uint8_t *) key, (const uint8_t *) key + length);
+		n_used++;
+		return true;
+	}
+
+	/// \retval true if the key was present
+	bool remove(const void *key, int length) {
+		Word_t pos = find(key, length, hash(key, length));
+		if (pos == INVALID_IDX) return false;
+		slots[pos].state = DELETED;
+		n_used--;
+		n_deleted++;
+		return true;
+	}
+
+	Word_t mem_used() const {
+		return slots.capacity() * sizeof(Slot) + pool.capacity();
+	}
+
+	void clear() {
+		std::vector<Slot>().swap(slots);
+		std::vector<uint8_t>().swap(pool);
+		n_used = n_deleted = 0;
+	}
+
+protected:
+	enum { EMPTY = 0, USED = 1, DELETED = 2 };
+
+	struct Slot {
+		Word_t hash;
+		Word_t value;
+		size_t ofs;					// offset of the key in the pool
+		uint16_t len;				// length of the key in bytes
+		uint8_t state;
+	};
+
+	std::vector<Slot> slots;		// number of slots is always a power of 2 (or zero)
+	std::vector<uint8_t> pool;		// bytes of all keys
+	Word_t n_used;
+	Word_t n_deleted;
+
+	/// FNV-1a
+	static Word_t hash(const void *key, int length) {
+		const uint8_t *p = (const uint8_t *) key;
+		uint64_t h = 14695981039346656037ULL;
+		for (int i = 0; i < length; i++) {
+			h ^= p[i];
+			h *= 1099511628211ULL;
+		}
+		return (Word_t) h;
+	}
+
+	Word_t find(const void *key, int length, Word_t h) const {
+		if (slots.empty()) return INVALID_IDX;
+		Word_t mask = slots.size() - 1;
+		for (Word_t pos = h & mask; slots[pos].state != EMPTY; pos = (pos + 1) & mask) {
+			const Slot &s = slots[pos];
+			if (s.state == USED && s.hash == h && s.len == length && memcmp(&pool[s.ofs], key, length) == 0)
+				return pos;
+		}
+		return INVALID_IDX;
+	}
+
+	/// Rebuild the table with \c size slots, drops deleted slots and compacts the key pool
+	void rehash(Word_t size) {
+		if (size < 16) size = 16;
+		std::vector<Slot> old_slots(size);
+		std::vector<uint8_t> old_pool;
+		old_slots.swap(slots);
+		old_pool.swap(pool);
+		pool.reserve(old_pool.size());
+
+		Word_t mask = size - 1;
+		for (Word_t i = 0; i < old_slots.size(); i++) {
+			Slot s = old_slots[i];
+			if (s.state != USED) continue;
+			Word_t pos = s.hash & mask;
+			while (slots[pos].state == USED) pos = (pos + 1) & mask;
+			size_t ofs = pool.size();
+			pool.insert(pool.end(), old_pool.begin() + s.ofs, old_pool.begin() + s.ofs + s.len);
+			s.ofs = ofs;
+			slots[pos] = s;
+		}
+		n_deleted = 0;
+	}
+};
+
+#endif
@@ -22,7 +22,11 @@
 
 #include <assert.h>
 
+#ifdef WITH_DENSE_CONTAINERS
+#include "dense.h"
+#else
 #include <Judy.h>
+#endif
 
 #ifndef INVALID_IDX
 #define INVALID_IDX					((Word_t) -1)
@@ -35,8 +39,15 @@
 template<class KEY, class TYPE>
 class Map {
 protected:
+#ifdef WITH_DENSE_CONTAINERS
+	DenseHashIndex keys;					// key -> position in items
+	std::vector<TYPE> items;
+	DenseBitmap present;					// positions in use
+	Word_t free_hint;						// no free position below this one
+#else
 	void *judy_hs;
 	void *judy_l;
+#endif
 
 public:
 	Map();
@@ -118,6 +129,118 @@ protected:
 
 // implementation
 
+#ifdef WITH_DENSE_CONTAINERS
+
+template<class KEY, class TYPE>
+Map<KEY, TYPE>::Map() {
+	free_hint = 0;
+};
+
+template<class KEY, class TYPE>
+Map<KEY, TYPE>::~Map() {
+	remove_all();
+};
+
+template<class KEY, class TYPE>
+Word_t Map<KEY, TYPE>::count() const {
+	return present.count();
+}
+
+template<class KEY, class TYPE>
+bool Map<KEY, TYPE>::is_empty() const {
+	return count() == 0;
+}
+
+template<class KEY, class TYPE>
+bool Map<KEY, TYPE>::lookup(const KEY &key, TYPE &item) const {
+	Word_t idx;
+	if (!keys.lookup(&key, sizeof(KEY), idx))
+		return false;
+	item = items[idx];
+	return true;
+}
+
+template<class KEY, class TYPE>
+Word_t Map<KEY, TYPE>::get_idx(const KEY &key) const {
+	Word_t idx;
+	return keys.lookup(&key, sizeof(KEY), idx) ? idx : INVALID_IDX;
+}
+
+template<class KEY, class TYPE>
+TYPE Map<KEY, TYPE>::get(Word_t iter) const {
+	assert(present.is_set(iter));
+	return items[iter];
+}
+
+template<class KEY, class TYPE>
+TYPE Map<KEY, TYPE>::operator[](Word_t idx) const {
+	return get(idx);
+}
+
+template<class KEY, class TYPE>
+bool Map<KEY, TYPE>::set(const KEY &key, TYPE item) {
+	Word_t idx;
+	if (!keys.lookup(&key, sizeof(KEY), idx)) {
+		// take the lowest free position (the same one Judy would give us)
+		idx = present.first_empty(free_hint);
+		free_hint = idx + 1;
+		if (idx >= items.size()) items.resize(idx + 1);
+		present.set(idx);
+		keys.set(&key, sizeof(KEY), idx);
+	}
+	items[idx] = item;
+	return true;
+}
+
+template<class KEY, class TYPE>
+bool Map<KEY, TYPE>::remove(const KEY &key) {
+	Word_t idx;
+	if (!keys.lookup(&key, sizeof(KEY), idx))
+		// removing non-existent item
+		return false;
+
+	free_item(idx);
+	present.unset(idx);
+	if (idx < free_hint) free_hint = idx;
+	return keys.remove(&key, sizeof(KEY));
+}
+
+template<class KEY, class TYPE>
+void Map<KEY, TYPE>::remove_all() {
+	std::vector<TYPE>().swap(items);
+	present.clear();
+	keys.clear();
+	free_hint = 0;
+}
+
+template<class KEY, class TYPE>
+void Map<KEY, TYPE>::free_item(Word_t idx) {
+	if (present.is_set(idx))
+		items[idx] = TYPE();
+}
+
+template<class KEY, class TYPE>
+Word_t Map<KEY, TYPE>::first() const {
+	return present.first();
+}
+
+template<class KEY, class TYPE>
+Word_t Map<KEY, TYPE>::next(Word_t idx) const {
+	return present.next(idx);
+}
+
+template<class KEY, class TYPE>
+Word_t Map<KEY, TYPE>::last() const {
+	return present.last();
+}
+
+template<class KEY, class TYPE>
+Word_t Map<KEY, TYPE>::prev(Word_t idx) const {
+	return present.prev(idx);
+}
+
+#else
+
 template<class KEY, class TYPE>
 Map<KEY, TYPE>::Map() {
 	judy_hs = NULL;
@@ -305,3 +428,5 @@ Word_t Map<KEY, TYPE>::prev(Word_t idx) const {
 }
 
 #endif
+
+#endif
@@ -24,7 +24,11 @@
 
 /// \file maphs.h
 
+#ifdef WITH_DENSE_CONTAINERS
+#include "dense.h"
+#else
 #include <Judy.h>
+#endif
 
 #ifndef INVALID_IDX
 #define INVALID_IDX					((Word_t) -1)
@@ -34,11 +38,17 @@
 /// C++ encapsulation of JudyHS functions.
 class MapHS {
 protected:
+#ifdef WITH_DENSE_CONTAINERS
+	DenseHashIndex hash_index;
+#else
 	void *judy;
+#endif
 
 public:
 	MapHS() {
+#ifndef WITH_DENSE_CONTAINERS
 		judy = NULL;
+#endif
 	}
 
 	virtual ~MapHS() {
@@ -53,6 +63,9 @@ public:
 	/// 	\li true if the key exists, item then contains the value,
 	/// 	\li false otherwise
 	bool lookup(uint8_t *key, int length, Word_t &item) const {
+#ifdef WITH_DENSE_CONTAINERS
+		return hash_index.lookup(key, length, item);
+#else
 		void *pval;
 		// check if the key exists
 		JHSG(pval, judy, key, length);
@@ -63,6 +76,7 @@ public:
 			item = *(Word_t *) pval;
 			return true;
 		}
+#endif
 	}
 
 	/// Add a new (key, item) pair into the map
@@ -70,6 +84,10 @@ public:
 	/// \param[in] length Size of \c key.
 	/// \param[in] item Item to insert
 	bool set(uint8_t *key, int length, Word_t item) {
+#ifdef WITH_DENSE_CONTAINERS
+		hash_index.set(key, length, item);
+		return true;
+#else
 		void *pval;
 		JHSG(pval, judy, key, item);
 		if (pval == NULL) {
@@ -79,12 +97,16 @@ public:
 		}
 		*(Word_t *) pval = item;
 		return true;
+#endif
 	}
 
 	/// Delete an item with key \c key from the map.
 	/// \param[in] key Pointer to the array-of-bytes.
 	/// \param[in] length Size of \c key.
 	bool remove(uint8_t *key, int length) {
+#ifdef WITH_DENSE_CONTAINERS
+		return hash_index.remove(key, length);
+#else
 		void *pval;
 		JHSG(pval, judy, key, length);
 		if (pval == NULL) {
@@ -95,12 +117,17 @@ public:
 			JHSD(rc, judy, key, length);
 			return (rc == 1);
 		}
+#endif
 	}
 
 	/// Remove all items from the array
 	void remove_all() {
+#ifdef WITH_DENSE_CONTAINERS
+		hash_index.clear();
+#else
 		int val;
 		JHSFA(val, judy);
+#endif
 	}
 };
 
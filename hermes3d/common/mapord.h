@@ -22,7 +22,11 @@
 
 #include <assert.h>
 
+#ifdef WITH_DENSE_CONTAINERS
+#include "dense.h"
+#else
 #include <Judy.h>
+#endif
 
 #ifndef INVALID_IDX
 #define INVALID_IDX					((Word_t) -1)
@@ -53,8 +57,15 @@ static void sort_key(Word_t *key, int length) {
 template<class TYPE>
 class MapOrd {
 protected:
+#ifdef WITH_DENSE_CONTAINERS
+	DenseHashIndex keys;					// sorted key -> position in items
+	std::vector<TYPE> items;
+	DenseBitmap present;					// positions in use (starting from 1)
+	Word_t free_hint;						// no free position below this one
+#else
 	void *judy_hs;
 	void *judy_l;
+#endif
 
 public:
 	MapOrd();
@@ -152,6 +163,122 @@ protected:
 
 // implementation
 
+#ifdef WITH_DENSE_CONTAINERS
+
+template<class TYPE>
+MapOrd<TYPE>::MapOrd() {
+	free_hint = 1;
+};
+
+template<class TYPE>
+MapOrd<TYPE>::~MapOrd() {
+	remove_all();
+};
+
+template<class TYPE>
+Word_t MapOrd<TYPE>::count() const {
+	return present.count();
+}
+
+template<class TYPE>
+bool MapOrd<TYPE>::is_empty() const {
+	return count() == 0;
+}
+
+template<class TYPE>
+bool MapOrd<TYPE>::lookup(Word_t *key, int length, TYPE &item) const {
+	Word_t idx;
+	sort_key(key, length);
+	if (!keys.lookup(key, length * sizeof(Word_t), idx))
+		return false;
+	item = items[idx];
+	return true;
+}
+
+template<class TYPE>
+Word_t MapOrd<TYPE>::get_idx(Word_t *key, int length) const {
+	Word_t idx;
+	sort_key(key, length);
+	return keys.lookup(key, length * sizeof(Word_t), idx) ? idx : INVALID_IDX;
+}
+
+template<class TYPE>
+TYPE MapOrd<TYPE>::get(Word_t iter) const {
+	assert(present.is_set(iter));
+	return items[iter];
+}
+
+template<class TYPE>
+TYPE MapOrd<TYPE>::operator[](Word_t idx) const {
+	return get(idx);
+}
+
+template<class TYPE>
+bool MapOrd<TYPE>::set(Word_t *key, int length, TYPE item) {
+	Word_t idx;
+	sort_key(key, length);
+	if (!keys.lookup(key, length * sizeof(Word_t), idx)) {
+		// take the lowest free position (the same one Judy would give us)
+		idx = present.first_empty(free_hint);
+		free_hint = idx + 1;
+		if (idx >= items.size()) items.resize(idx + 1);
+		present.set(idx);
+		keys.set(key, length * sizeof(Word_t), idx);
+	}
+	items[idx] = item;
+	return true;
+}
+
+template<class TYPE>
+bool MapOrd<TYPE>::remove(Word_t *key, int length) {
+	Word_t idx;
+	sort_key(key, length);
+	if (!keys.lookup(key, length * sizeof(Word_t), idx))
+		// removing non-existent item
+		return false;
+
+	free_item(idx);
+	present.unset(idx);
+	if (idx < free_hint) free_hint = idx;
+	return keys.remove(key, length * sizeof(Word_t));
+}
+
+template<class TYPE>
+void MapOrd<TYPE>::remove_all() {
+	std::vector<TYPE>().swap(items);
+	present.clear();
+	keys.clear();
+	free_hint = 1;
+}
+
+template<class TYPE>
+void MapOrd<TYPE>::free_item(Word_t idx) {
+	if (present.is_set(idx))
+		items[idx] = TYPE();
+}
+
+template<class TYPE>
+Word_t MapOrd<TYPE>::first() const {
+	return present.first(1);
+}
+
+template<class TYPE>
+Word_t MapOrd<TYPE>::next(Word_t idx) const {
+	return present.next(idx);
+}
+
+template<class TYPE>
+Word_t MapOrd<TYPE>::last() const {
+	return present.last();
+}
+
+template<class TYPE>
+Word_t MapOrd<TYPE>::prev(Word_t idx) const {
+	return present.prev(idx);
+}
+
+#else
+
 template<class TYPE>
 MapOrd<TYPE>::MapOrd() {
 	judy_hs = NULL;
@@ -354,6 +481,8 @@ Word_t MapOrd<TYPE>::prev(Word_t idx) const {
 	return pval ? idx : INVALID_IDX;
 }
 
+#endif
+
 //
 //
 //
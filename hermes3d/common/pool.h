@@ -0,0 +1,159 @@
+// This file is part of Hermes3D
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes3D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes3D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes3D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+
+#ifndef _POOL_H_
+#define _POOL_H_
+
+#include <assert.h>
+#include <stdlib.h>
+#include <new>
+#include <vector>
+
+/// \file pool.h
+
+/// \class Pool
+/// \brief Slab allocator for objects of class TYPE.
+///
+/// Storage is carved out of slabs holding several objects each, so objects allocated
+/// one after another end up next to each other in memory. Released storage is kept in
+/// a free list and reused. The pool only manages memory: objects are constructed with
+/// placement new and must be destructed by the owner before they are released.
+template<class TYPE>
+class Pool {
+public:
+	Pool(int slab_size = 1024);
+	virtual ~Pool();
+
+	/// Get storage for one object.
+	/// \return Pointer to uninitialized storage for one object of class TYPE.
+	void *alloc();
+
+	/// Make the next \c n calls to alloc() return consecutive storage, i.e. objects
+	/// allocated by these calls occupy one contiguous block of memory.
+	/// \param[in] n Number of objects.
+	void reserve(int n);
+
+	/// Return storage of one object back to the pool.
+	/// \param[in] obj Object (already destructed) obtained by alloc().
+	void release(TYPE *obj);
+
+	/// Release all storage at once.
+	/// Does NOT destruct the objects.
+	void free_all();
+
+	/// Get the number of bytes allocated by the pool.
+	size_t mem_used() const;
+
+protected:
+	union Item {
+		Item *next;							// link in the free list
+		double align;
+		char data[sizeof(TYPE)];
+	};
+
+	int slab_size;							// number of objects in one slab
+	std::vector<Item *> slabs;				// all slabs
+	std::vector<int> slab_sizes;			// number of objects in each slab
+	Item *cur;								// first unused item in the last slab
+	int left;								// number of unused items in the last slab
+	Item *free_list;						// released items
+	int contig;								// number of allocations served from the last slab only
+
+	void new_slab(int n);
+};
+
+// implementation
+
+template<class TYPE>
+Pool<TYPE>::Pool(int slab_size/* = 1024*/) {
+	assert(slab_size > 0);
+	this->slab_size = slab_size;
+	cur = NULL;
+	left = 0;
+	free_list = NULL;
+	contig = 0;
+}
+
+template<class TYPE>
+Pool<TYPE>::~Pool() {
+	free_all();
+}
+
+template<class TYPE>
+void Pool<TYPE>::new_slab(int n) {
+	Item *slab = (Item *) malloc(n * sizeof(Item));
+	if (slab == NULL) throw std::bad_alloc();
+	slabs.push_back(slab);
+	slab_sizes.push_back(n);
+	cur = slab;
+	left = n;
+}
+
+template<class TYPE>
+void *Pool<TYPE>::alloc() {
+	if (contig > 0) {
+		contig--;
+	}
+	else if (free_list != NULL) {
+		Item *item = free_list;
+		free_list = item->next;
+		return item;
+	}
+
+	if (left == 0) new_slab(slab_size);
+	left--;
+	return cur++;
+}
+
+template<class TYPE>
+void Pool<TYPE>::reserve(int n) {
+	if (left < n) new_slab(n > slab_size ? n : slab_size);
+	contig = n;
+}
+
+template<class TYPE>
+void Pool<TYPE>::release(TYPE *obj) {
+	if (obj == NULL) return;
+	Item *item = (Item *) obj;
+	item->next = free_list;
+	free_list = item;
+}
+
+template<class TYPE>
+void Pool<TYPE>::free_all() {
+	for (unsigned int i = 0; i < slabs.size(); i++)
+		::free(slabs[i]);
+	slabs.clear();
+	slab_sizes.clear();
+	cur = NULL;
+	left = 0;
+	free_list = NULL;
+	contig = 0;
+}
+
+template<class TYPE>
+size_t Pool<TYPE>::mem_used() const {
+	size_t n = 0;
+	for (unsigned int i = 0; i < slab_sizes.size(); i++)
+		n += slab_sizes[i];
+	return n * sizeof(Item);
+}
+
+#endif
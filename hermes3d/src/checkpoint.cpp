@@ -0,0 +1,740 @@
+// This file is part of Hermes3D
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes3D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes3D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes3D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "h3dconfig.h"
+#ifdef WITH_HDF5
+extern "C" {
+#include <hdf5.h>
+}
+#endif
+
+#include "checkpoint.h"
+#include <string.h>
+#include <stdio.h>
+#include <algorithm>
+#include <common/error.h>
+#include <common/utils.h>
+#include <common/callstack.h>
+
+#define CHECKPOINT_VERSION					1
+
+const char *Checkpoint::block_name[NUM_BLOCKS] = {
+	"info",
+	"vertices", "elements", "boundaries", "refinements",
+	"space", "vertex_nodes", "vertex_comps", "edge_nodes", "edge_comps", "edge_face_comps",
+	"face_nodes", "element_nodes", "bc_proj",
+	"vector"
+};
+
+// records //
+
+struct ChkInfo {
+	int version;
+	int scalar_size;						// to detect real/complex mismatch
+	Word_t nvertices, nbase_vertices;
+	Word_t nelements, nbase_elements;
+	Word_t nboundaries;
+};
+
+struct ChkElement {
+	int mode;
+	int marker;
+	Word_t vtx[Hex::NUM_VERTICES];
+};
+
+struct ChkBoundary {
+	int marker;
+	int nvtcs;
+	Word_t vtx[Quad::NUM_VERTICES];
+};
+
+struct ChkRefinement {
+	Word_t first_son;						// refinements are replayed in the order of son ids
+	Word_t eid;
+	int reft;
+
+	bool operator<(const ChkRefinement &o) const { return first_son < o.first_son; }
+};
+
+struct ChkSpace {
+	int type;
+	int first_dof, next_dof, first_bubble, stride;
+	Word_t ndofs;							// length of the stored vector (0 = no vector)
+};
+
+struct ChkVertexNode {
+	Word_t id;
+	int marker, bc_type, ced;
+	int dof, n;								// dof = ncomponents for CED nodes
+	scalar bc_proj;
+};
+
+struct ChkEdgeNode {
+	Word_t id;
+	int marker, bc_type, ced;
+	int order, dof, n;
+	int edge_ncomponents, face_ncomponents;
+	int nproj;								// length of bc_proj
+};
+
+struct ChkFaceNode {
+	Word_t id;
+	int marker, bc_type, ced;
+	order2_t order;
+	int dof, n;
+	Word_t facet_id;
+	int ori;
+	Part part;
+	int nproj;								// length of bc_proj
+};
+
+struct ChkElementNode {
+	Word_t id;
+	order3_t order;
+	int dof, n;
+};
+
+// appending to a block
+template<typename T>
+static void put(std::vector<char> &blk, const T *data, size_t n = 1) {
+	const char *p = (const char *) data;
+	blk.insert(blk.end(), p, p + sizeof(T) * n);
+}
+
+// reading a block
+class BlockReader {
+public:
+	BlockReader(const std::vector<char> &blk) : blk(blk), pos(0) { }
+
+	template<typename T>
+	bool get(T *data, size_t n = 1) {
+		size_t sz = sizeof(T) * n;
+		if (pos + sz > blk.size()) return false;
+		if (sz > 0) memcpy(data, &blk[pos], sz);
+		pos += sz;
+		return true;
+	}
+
+	bool at_end() const { return pos == blk.size(); }
+
+protected:
+	const std::vector<char> &blk;
+	size_t pos;
+};
+
+//
+
+Checkpoint::Checkpoint() {
+	_F_
+}
+
+Checkpoint::~Checkpoint() {
+	_F_
+}
+
+void Checkpoint::clear() {
+	_F_
+	for (int i = 0; i < NUM_BLOCKS; i++)
+		block[i].clear();
+}
+
+// Mesh ///////////////////////////////////////////////////////////////////////
+
+void Checkpoint::pack_mesh(Mesh *mesh) {
+	_F_
+	// vertices created by refinements (midpoints) have higher ids than the ones
+	// of the base mesh, the smallest one tells how many base vertices there are
+	Word_t nbase_vtcs = mesh->vertices.count();
+	std::vector<ChkRefinement> refs;
+	FOR_ALL_INACTIVE_ELEMENTS(eid, mesh) {
+		Element *e = mesh->elements[eid];
+		Word_t vtcs[Hex::NUM_VERTICES];
+		int nv = e->get_num_vertices();
+		e->get_vertices(vtcs);
+
+		ChkRefinement r = { INVALID_IDX, eid, e->reft };
+		for (int i = 0; i < e->get_num_sons(); i++) {
+			Word_t sid = e->get_son(i);
+			if (sid == INVALID_IDX) continue;
+			if (r.first_son == INVALID_IDX || sid < r.first_son) r.first_son = sid;
+
+			Element *son = mesh->elements[sid];
+			for (int k = 0; k < son->get_num_vertices(); k++) {
+				Word_t v = son->get_vertex(k);
+				if (std::find(vtcs, vtcs + nv, v) == vtcs + nv && v <= nbase_vtcs)
+					nbase_vtcs = v - 1;
+			}
+		}
+		refs.push_back(r);
+	}
+	std::sort(refs.begin(), refs.end());
+
+	ChkInfo info;
+	memset(&info, 0, sizeof(info));
+	info.version = CHECKPOINT_VERSION;
+	info.scalar_size = sizeof(scalar);
+	info.nvertices = mesh->vertices.count();
+	info.nbase_vertices = nbase_vtcs;
+	info.nelements = mesh->elements.count();
+	info.nbase_elements = mesh->get_num_base_elements();
+	info.nboundaries = mesh->boundaries.count();
+	put(block[B_INFO], &info);
+
+	for (Word_t i = 1; i <= nbase_vtcs; i++) {
+		Vertex *v = mesh->vertices[i];
+		double pt[3] = { v->x, v->y, v->z };
+		put(block[B_VERTICES], pt, 3);
+	}
+
+	FOR_ALL_BASE_ELEMENTS(eid, mesh) {
+		Element *e = mesh->elements[eid];
+		ChkElement rec;
+		memset(&rec, 0, sizeof(rec));
+		rec.mode = e->get_mode();
+		rec.marker = e->marker;
+		e->get_vertices(rec.vtx);
+		put(block[B_ELEMENTS], &rec);
+	}
+
+	// boundaries (in the order of their ids)
+	std::vector<ChkBoundary> bnds(info.nboundaries + 1);
+	FOR_ALL_FACETS(fid, mesh) {
+		Facet *facet = mesh->facets[fid];
+		if (facet->type == Facet::OUTER && facet->parent == INVALID_IDX && facet->right <= info.nboundaries) {
+			Element *e = mesh->elements[facet->left];
+			ChkBoundary &rec = bnds[facet->right];
+			memset(&rec, 0, sizeof(rec));
+			rec.marker = mesh->boundaries[facet->right]->marker;
+			rec.nvtcs = e->get_face_vertices(facet->left_face_num, rec.vtx);
+		}
+	}
+	put(block[B_BOUNDARIES], &bnds[1], info.nboundaries);
+
+	put(block[B_REFINEMENTS], refs.empty() ? NULL : &refs[0], refs.size());
+}
+
+bool Checkpoint::unpack_mesh(Mesh *mesh) {
+	_F_
+	ChkInfo info;
+	BlockReader ri(block[B_INFO]);
+	if (!ri.get(&info) || info.version != CHECKPOINT_VERSION) return false;
+	if (info.scalar_size != sizeof(scalar)) return false;
+
+	// base mesh
+	BlockReader rv(block[B_VERTICES]);
+	for (Word_t i = 0; i < info.nbase_vertices; i++) {
+		double pt[3];
+		if (!rv.get(pt, 3)) return false;
+		mesh->add_vertex(pt[0], pt[1], pt[2]);
+	}
+
+	BlockReader re(block[B_ELEMENTS]);
+	for (Word_t i = 0; i < info.nbase_elements; i++) {
+		ChkElement rec;
+		if (!re.get(&rec)) return false;
+		Element *e;
+		switch (rec.mode) {
+			case MODE_HEXAHEDRON: e = mesh->add_hex_bulk(rec.vtx); break;
+			case MODE_TETRAHEDRON: e = mesh->add_tetra_bulk(rec.vtx); break;
+			case MODE_PRISM: e = mesh->add_prism_bulk(rec.vtx); break;
+			default: return false;
+		}
+		e->marker = rec.marker;
+	}
+	mesh->build_base_maps();
+
+	BlockReader rb(block[B_BOUNDARIES]);
+	for (Word_t i = 0; i < info.nboundaries; i++) {
+		ChkBoundary rec;
+		if (!rb.get(&rec)) return false;
+		if (rec.nvtcs == Tri::NUM_VERTICES) mesh->add_tri_boundary(rec.vtx, rec.marker);
+		else mesh->add_quad_boundary(rec.vtx, rec.marker);
+	}
+	mesh->ugh();
+
+	// refinements
+	BlockReader rr(block[B_REFINEMENTS]);
+	ChkRefinement ref;
+	while (rr.get(&ref))
+		if (!mesh->refine_element(ref.eid, ref.reft)) return false;
+
+	// the replay has to end up with the same numbering
+	return mesh->vertices.count() == info.nvertices && mesh->elements.count() == info.nelements;
+}
+
+// Space //////////////////////////////////////////////////////////////////////
+
+void Checkpoint::pack_space(Space *space, scalar *vec) {
+	_F_
+	ChkSpace sp;
+	memset(&sp, 0, sizeof(sp));
+	sp.type = space->type;
+	sp.first_dof = space->first_dof;
+	sp.next_dof = space->next_dof;
+	sp.first_bubble = space->first_bubble;
+	sp.stride = space->stride;
+	sp.ndofs = vec != NULL ? space->get_max_dof() + 1 : 0;
+	put(block[B_SPACE], &sp);
+
+	std::vector<char> &proj = block[B_BC_PROJ];
+
+	for (Word_t i = space->vn_data.first(); i != INVALID_IDX; i = space->vn_data.next(i)) {
+		Space::VertexData *vd = space->vn_data[i];
+		ChkVertexNode rec;
+		memset(&rec, 0, sizeof(rec));
+		rec.id = i;
+		rec.marker = vd->marker;
+		rec.bc_type = vd->bc_type;
+		rec.ced = vd->ced;
+		if (vd->ced) {
+			rec.dof = vd->ncomponents;
+			put(block[B_VERTEX_COMPS], vd->baselist, vd->ncomponents);
+		}
+		else {
+			rec.dof = vd->dof;
+			rec.n = vd->n;
+		}
+		rec.bc_proj = vd->bc_proj;
+		put(block[B_VERTEX_NODES], &rec);
+	}
+
+	for (Word_t i = space->en_data.first(); i != INVALID_IDX; i = space->en_data.next(i)) {
+		Space::EdgeData *ed = space->en_data[i];
+		ChkEdgeNode rec;
+		memset(&rec, 0, sizeof(rec));
+		rec.id = i;
+		rec.marker = ed->marker;
+		rec.bc_type = ed->bc_type;
+		rec.ced = ed->ced;
+		if (ed->ced) {
+			rec.edge_ncomponents = ed->edge_ncomponents;
+			rec.face_ncomponents = ed->face_ncomponents;
+			put(block[B_EDGE_COMPS], ed->edge_baselist, ed->edge_ncomponents);
+			put(block[B_EDGE_FACE_COMPS], ed->face_baselist, ed->face_ncomponents);
+		}
+		else {
+			rec.order = ed->order;
+			rec.dof = ed->dof;
+			rec.n = ed->n;
+			if (ed->bc_proj != NULL) {
+				rec.nproj = ed->n;
+				put(proj, ed->bc_proj, ed->n);
+			}
+		}
+		put(block[B_EDGE_NODES], &rec);
+	}
+
+	for (Word_t i = space->fn_data.first(); i != INVALID_IDX; i = space->fn_data.next(i)) {
+		Space::FaceData *fd = space->fn_data[i];
+		ChkFaceNode rec;
+		memset(&rec, 0, sizeof(rec));
+		rec.id = i;
+		rec.marker = fd->marker;
+		rec.bc_type = fd->bc_type;
+		rec.ced = fd->ced;
+		rec.order = fd->order;
+		if (fd->ced) {
+			rec.facet_id = fd->facet_id;
+			rec.ori = fd->ori;
+			rec.part = fd->part;
+		}
+		else {
+			rec.dof = fd->dof;
+			rec.n = fd->n;
+			if (fd->bc_proj != NULL) {
+				rec.nproj = fd->n;
+				put(proj, fd->bc_proj, fd->n);
+			}
+		}
+		put(block[B_FACE_NODES], &rec);
+	}
+
+	for (Word_t i = space->elm_data.first(); i != INVALID_IDX; i = space->elm_data.next(i)) {
+		Space::ElementData *ed = space->elm_data[i];
+		ChkElementNode rec;
+		memset(&rec, 0, sizeof(rec));
+		rec.id = i;
+		rec.order = ed->order;
+		rec.dof = ed->dof;
+		rec.n = ed->n;
+		put(block[B_ELEMENT_NODES], &rec);
+	}
+
+	if (vec != NULL)
+		put(block[B_VECTOR], vec, sp.ndofs);
+}
+
+bool Checkpoint::check_mesh(Mesh *mesh) {
+	_F_
+	ChkInfo info;
+	BlockReader ri(block[B_INFO]);
+	if (!ri.get(&info) || info.version != CHECKPOINT_VERSION) return false;
+	if (info.scalar_size != sizeof(scalar)) return false;
+	if (mesh->vertices.count() != info.nvertices || mesh->elements.count() != info.nelements ||
+	    mesh->get_num_base_elements() != info.nbase_elements || mesh->boundaries.count() != info.nboundaries)
+		return false;
+
+	BlockReader rv(block[B_VERTICES]);
+	for (Word_t i = 1; i <= info.nbase_vertices; i++) {
+		double pt[3];
+		if (!rv.get(pt, 3) || !mesh->vertices.exists(i)) return false;
+		Vertex *v = mesh->vertices[i];
+		if (v->x != pt[0] || v->y != pt[1] || v->z != pt[2]) return false;
+	}
+
+	BlockReader re(block[B_ELEMENTS]);
+	FOR_ALL_BASE_ELEMENTS(eid, mesh) {
+		Element *e = mesh->elements[eid];
+		ChkElement rec;
+		Word_t vtx[Hex::NUM_VERTICES];
+		if (!re.get(&rec) || rec.mode != e->get_mode()) return false;
+		e->get_vertices(vtx);
+		if (memcmp(vtx, rec.vtx, e->get_num_vertices() * sizeof(Word_t)) != 0) return false;
+	}
+
+	return true;
+}
+
+// the number of records in a block of fixed-size records, -1 if the size does not fit
+template<typename T>
+static long num_records(const std::vector<char> &blk) {
+	return blk.size() % sizeof(T) == 0 ? (long) (blk.size() / sizeof(T)) : -1;
+}
+
+bool Checkpoint::check_space(Space *space) {
+	_F_
+	Mesh *mesh = space->get_mesh();
+	ChkSpace sp;
+	BlockReader rs(block[B_SPACE]);
+	if (!rs.get(&sp) || sp.type != space->type) return false;
+
+	// the variable-length parts have to add up to the sizes of their blocks
+	size_t nvcomps = 0, necomps = 0, nfcomps = 0, nproj = 0;
+
+	BlockReader rvn(block[B_VERTEX_NODES]);
+	ChkVertexNode vrec;
+	while (rvn.get(&vrec)) {
+		if (!mesh->vertices.exists(vrec.id)) return false;
+		if (vrec.ced) nvcomps += vrec.dof;
+	}
+
+	BlockReader ren(block[B_EDGE_NODES]);
+	ChkEdgeNode erec;
+	while (ren.get(&erec)) {
+		if (erec.ced) {
+			necomps += erec.edge_ncomponents;
+			nfcomps += erec.face_ncomponents;
+		}
+		nproj += erec.nproj;
+	}
+
+	BlockReader rfn(block[B_FACE_NODES]);
+	ChkFaceNode frec;
+	while (rfn.get(&frec))
+		nproj += frec.nproj;
+
+	BlockReader rel(block[B_ELEMENT_NODES]);
+	ChkElementNode elrec;
+	while (rel.get(&elrec))
+		if (!mesh->elements.exists(elrec.id)) return false;
+
+	return
+		num_records<ChkVertexNode>(block[B_VERTEX_NODES]) >= 0 &&
+		num_records<ChkEdgeNode>(block[B_EDGE_NODES]) >= 0 &&
+		num_records<ChkFaceNode>(block[B_FACE_NODES]) >= 0 &&
+		num_records<ChkElementNode>(block[B_ELEMENT_NODES]) >= 0 &&
+		num_records<Space::BaseVertexComponent>(block[B_VERTEX_COMPS]) == (long) nvcomps &&
+		num_records<Space::BaseEdgeComponent>(block[B_EDGE_COMPS]) == (long) necomps &&
+		num_records<Space::BaseFaceComponent>(block[B_EDGE_FACE_COMPS]) == (long) nfcomps &&
+		num_records<scalar>(block[B_BC_PROJ]) == (long) nproj &&
+		num_records<scalar>(block[B_VECTOR]) == (long) sp.ndofs;
+}
+
+bool Checkpoint::unpack_space(Space *space, scalar *&vec) {
+	_F_
+	vec = NULL;
+
+	ChkSpace sp;
+	BlockReader rs(block[B_SPACE]);
+	if (!rs.get(&sp) || sp.type != space->type) return false;
+
+	space->free_data_tables();
+
+	BlockReader rproj(block[B_BC_PROJ]);
+
+	BlockReader rvn(block[B_VERTEX_NODES]), rvc(block[B_VERTEX_COMPS]);
+	ChkVertexNode vrec;
+	while (rvn.get(&vrec)) {
+		Space::VertexData *vd = space->create_vertex_node_data(vrec.id, vrec.ced);
+		vd->marker = vrec.marker;
+		vd->bc_type = (BCType) vrec.bc_type;
+		if (vrec.ced) {
+			vd->ncomponents = vrec.dof;
+			vd->baselist = (Space::BaseVertexComponent *) malloc(vrec.dof * sizeof(Space::BaseVertexComponent));
+			if (!rvc.get(vd->baselist, vrec.dof)) return false;
+		}
+		else {
+			vd->dof = vrec.dof;
+			vd->n = vrec.n;
+		}
+		vd->bc_proj = vrec.bc_proj;
+	}
+
+	BlockReader ren(block[B_EDGE_NODES]), rec(block[B_EDGE_COMPS]), refc(block[B_EDGE_FACE_COMPS]);
+	ChkEdgeNode erec;
+	while (ren.get(&erec)) {
+		Space::EdgeData *ed = space->create_edge_node_data(erec.id, erec.ced);
+		ed->marker = erec.marker;
+		ed->bc_type = (BCType) erec.bc_type;
+		if (erec.ced) {
+			ed->edge_ncomponents = erec.edge_ncomponents;
+			ed->edge_baselist = (Space::BaseEdgeComponent *) malloc(erec.edge_ncomponents * sizeof(Space::BaseEdgeComponent));
+			ed->face_ncomponents = erec.face_ncomponents;
+			ed->face_baselist = (Space::BaseFaceComponent *) malloc(erec.face_ncomponents * sizeof(Space::BaseFaceComponent));
+			if (!rec.get(ed->edge_baselist, erec.edge_ncomponents)) return false;
+			if (!refc.get(ed->face_baselist, erec.face_ncomponents)) return false;
+		}
+		else {
+			ed->order = erec.order;
+			ed->dof = erec.dof;
+			ed->n = erec.n;
+		}
+		if (erec.nproj > 0) {
+			ed->bc_proj = new scalar[erec.nproj];
+			if (!rproj.get(ed->bc_proj, erec.nproj)) return false;
+		}
+	}
+
+	BlockReader rfn(block[B_FACE_NODES]);
+	ChkFaceNode frec;
+	while (rfn.get(&frec)) {
+		Space::FaceData *fd = space->create_face_node_data(frec.id, frec.ced);
+		fd->marker = frec.marker;
+		fd->bc_type = (BCType) frec.bc_type;
+		fd->order = frec.order;
+		if (frec.ced) {
+			fd->facet_id = frec.facet_id;
+			fd->ori = frec.ori;
+			fd->part = frec.part;
+		}
+		else {
+			fd->dof = frec.dof;
+			fd->n = frec.n;
+		}
+		if (frec.nproj > 0) {
+			fd->bc_proj = new scalar[frec.nproj];
+			if (!rproj.get(fd->bc_proj, frec.nproj)) return false;
+		}
+	}
+
+	BlockReader rel(block[B_ELEMENT_NODES]);
+	ChkElementNode elrec;
+	while (rel.get(&elrec)) {
+		Space::ElementData *ed = space->elm_data[elrec.id] = new Space::ElementData;
+		MEM_CHECK(ed);
+		ed->order = elrec.order;
+		ed->dof = elrec.dof;
+		ed->n = elrec.n;
+	}
+
+	space->first_dof = sp.first_dof;
+	space->next_dof = sp.next_dof;
+	space->first_bubble = sp.first_bubble;
+	space->stride = sp.stride;
+	space->mesh_seq = space->mesh->get_seq();
+	space->was_assigned = true;
+	space->seq++;
+
+	if (sp.ndofs > 0) {
+		vec = new scalar[sp.ndofs];
+		MEM_CHECK(vec);
+		BlockReader rvec(block[B_VECTOR]);
+		if (!rvec.get(vec, sp.ndofs)) {
+			delete [] vec;
+			vec = NULL;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// File ///////////////////////////////////////////////////////////////////////
+
+#ifdef WITH_HDF5
+
+bool Checkpoint::write(const char *file_name) {
+	_F_
+	H5open();
+	hid_t file_id = H5Fcreate(file_name, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+	if (file_id < 0) {
+		H5close();
+		return false;
+	}
+
+	bool ret = true;
+	hid_t group_id = H5Gcreate(file_id, "/checkpoint", 0);
+	for (int i = 0; i < NUM_BLOCKS && ret; i++) {
+		hsize_t dims = block[i].size();
+		hid_t dataspace_id = H5Screate_simple(1, &dims, NULL);
+		hid_t dataset_id = H5Dcreate(group_id, block_name[i], H5T_NATIVE_UCHAR, dataspace_id, H5P_DEFAULT);
+		if (dataset_id < 0) ret = false;
+		else if (dims > 0)
+			ret = H5Dwrite(dataset_id, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, &block[i][0]) >= 0;
+		H5Dclose(dataset_id);
+		H5Sclose(dataspace_id);
+	}
+	H5Gclose(group_id);
+
+	H5Fclose(file_id);
+	H5close();
+	return ret;
+}
+
+bool Checkpoint::read(const char *file_name) {
+	_F_
+	clear();
+
+	H5open();
+	if (H5Fis_hdf5(file_name) <= 0) {
+		H5close();
+		return false;
+	}
+	hid_t file_id = H5Fopen(file_name, H5F_ACC_RDONLY, H5P_DEFAULT);
+	if (file_id < 0) {
+		H5close();
+		return false;
+	}
+
+	bool ret = true;
+	hid_t group_id = H5Gopen(file_id, "/checkpoint");
+	if (group_id < 0) ret = false;
+	for (int i = 0; i < NUM_BLOCKS && ret; i++) {
+		hid_t dataset_id = H5Dopen(group_id, block_name[i]);
+		if (dataset_id < 0) {
+			ret = false;
+			break;
+		}
+		hid_t dataspace_id = H5Dget_space(dataset_id);
+		hsize_t dims = H5Sget_simple_extent_npoints(dataspace_id);
+		block[i].resize(dims);
+		if (dims > 0)
+			ret = H5Dread(dataset_id, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, &block[i][0]) >= 0;
+		H5Sclose(dataspace_id);
+		H5Dclose(dataset_id);
+	}
+	if (group_id >= 0) H5Gclose(group_id);
+
+	H5Fclose(file_id);
+	H5close();
+	return ret;
+}
+
+#else
+
+// plain binary file: signature, then (size, data) for every block
+
+static const char *CHECKPOINT_SIGNATURE = "H3DC\001\000\000\000";
+
+bool Checkpoint::write(const char *file_name) {
+	_F_
+	FILE *file = fopen(file_name, "wb");
+	if (file == NULL) return false;
+
+	hermes_fwrite(CHECKPOINT_SIGNATURE, 1, 8, file);
+	for (int i = 0; i < NUM_BLOCKS; i++) {
+		Word_t size = block[i].size();
+		hermes_fwrite(&size, sizeof(size), 1, file);
+		if (size > 0) hermes_fwrite(&block[i][0], 1, size, file);
+	}
+
+	fclose(file);
+	return true;
+}
+
+bool Checkpoint::read(const char *file_name) {
+	_F_
+	clear();
+
+	FILE *file = fopen(file_name, "rb");
+	if (file == NULL) return false;
+
+	char sig[8];
+	hermes_fread(sig, 1, 8, file);
+	if (memcmp(sig, CHECKPOINT_SIGNATURE, 8) != 0) {
+		fclose(file);
+		return false;
+	}
+	for (int i = 0; i < NUM_BLOCKS; i++) {
+		Word_t size;
+		hermes_fread(&size, sizeof(size), 1, file);
+		block[i].resize(size);
+		if (size > 0) hermes_fread(&block[i][0], 1, size, file);
+	}
+
+	fclose(file);
+	return true;
+}
+
+#endif
+
+// Public interface ///////////////////////////////////////////////////////////
+
+bool Checkpoint::save(const char *file_name, Space *space, scalar *vec) {
+	_F_
+	if (!space->is_up_to_date()) {
+		warning("Saving a checkpoint of a space without assigned DOFs.");
+		return false;
+	}
+
+	clear();
+	pack_mesh(space->get_mesh());
+	pack_space(space, vec);
+	bool ret = write(file_name);
+	clear();
+	return ret;
+}
+
+bool Checkpoint::load_mesh(const char *file_name, Mesh *mesh) {
+	_F_
+	bool ret = read(file_name) && unpack_mesh(mesh);
+	clear();
+	return ret;
+}
+
+bool Checkpoint::load_space(const char *file_name, Space *space, scalar *&vec) {
+	_F_
+	vec = NULL;
+	// the space is left untouched unless the checkpoint belongs to its mesh and is complete
+	if (!read(file_name) || !check_mesh(space->get_mesh()) || !check_space(space)) {
+		clear();
+		return false;
+	}
+
+	bool ret = unpack_space(space, vec);
+	if (!ret) {
+		// do not leave a partly loaded space behind
+		space->free_data_tables();
+		space->mesh_seq = -1;
+		space->was_assigned = false;
+		space->seq++;
+	}
+	clear();
+	return ret;
+}
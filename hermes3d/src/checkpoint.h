@@ -0,0 +1,91 @@
+// This file is part of Hermes3D
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes3D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes3D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes3D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#ifndef _CHECKPOINT_H_
+#define _CHECKPOINT_H_
+
+#include "mesh.h"
+#include "space/space.h"
+#include <vector>
+
+/// Checkpoint/restart of a computation
+///
+/// Stores the mesh (base mesh and its refinements), the space (element orders,
+/// DOF numbering, constraints and BC projections) and the coefficient vector,
+/// so that the computation can continue without repeating the adaptivity steps
+/// and without calling assign_dofs(). The file is an HDF5 file if hermes3d was
+/// built with HDF5 support, otherwise a plain binary file. Either way it is
+/// meant for restarting on the same kind of machine (records are stored as they
+/// are in memory).
+///
+/// Restart:
+///   Mesh mesh;
+///   chkpt.load_mesh(file_name, &mesh);
+///   H1Space space(&mesh, &shapeset);
+///   space.set_bc_types(...);				// callbacks are not stored
+///   scalar *vec;
+///   chkpt.load_space(file_name, &space, vec);
+///   sln.set_coeff_vector(&space, vec);
+///
+class Checkpoint {
+public:
+	Checkpoint();
+	virtual ~Checkpoint();
+
+	/// Save the mesh of 'space', the 'space' and the coefficient vector 'vec' (can be NULL,
+	/// otherwise it has space->get_max_dof() + 1 entries)
+	bool save(const char *file_name, Space *space, scalar *vec);
+
+	/// Load the mesh (has to be empty)
+	bool load_mesh(const char *file_name, Mesh *mesh);
+	/// Load the space (has to be created on the mesh from load_mesh()) and the coefficient
+	/// vector, which is allocated by new[] (NULL if it was not stored). If the checkpoint
+	/// does not belong to the mesh of the space or is damaged, false is returned and the
+	/// space is not changed.
+	bool load_space(const char *file_name, Space *space, scalar *&vec);
+
+protected:
+	/// parts of the checkpoint, each is stored as one binary block
+	enum {
+		B_INFO,
+		B_VERTICES, B_ELEMENTS, B_BOUNDARIES, B_REFINEMENTS,
+		B_SPACE, B_VERTEX_NODES, B_VERTEX_COMPS, B_EDGE_NODES, B_EDGE_COMPS, B_EDGE_FACE_COMPS,
+		B_FACE_NODES, B_ELEMENT_NODES, B_BC_PROJ,
+		B_VECTOR,
+		NUM_BLOCKS
+	};
+	static const char *block_name[NUM_BLOCKS];
+	std::vector<char> block[NUM_BLOCKS];
+
+	void clear();
+	bool write(const char *file_name);
+	bool read(const char *file_name);
+
+	void pack_mesh(Mesh *mesh);
+	bool unpack_mesh(Mesh *mesh);
+	void pack_space(Space *space, scalar *vec);
+	bool unpack_space(Space *space, scalar *&vec);
+
+	/// checks that the mesh is the one stored in the checkpoint
+	bool check_mesh(Mesh *mesh);
+	/// checks that the space blocks are complete and refer to existing mesh entities
+	bool check_space(Space *space);
+};
+
+#endif
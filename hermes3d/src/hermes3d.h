@@ -61,6 +61,7 @@
 
 // shapesets
 #include "shapeset/shapeset.h"
+#include "shapeset/shapetab.h"
 #include "shapeset/common.h"
 #include "shapeset/h1lobattotetra.h"
 #include "shapeset/h1lobattohex.h"
@@ -76,6 +77,7 @@
 
 #include "asmlist.h"
 #include "solution.h"
+#include "checkpoint.h"
 #include "filter.h"
 #include "weakform.h"
 #include "discrete_problem.h"
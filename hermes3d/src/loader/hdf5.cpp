@@ -33,6 +33,9 @@ extern "C" {
 #include "hdf5.h"
 #include "../mesh.h"
 #include <string.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
 #include <common/trace.h>
 #include <common/error.h>
 #include <common/callstack.h>
@@ -47,6 +50,8 @@ extern "C" {
 
 HDF5Reader::HDF5Reader() {
 	_F_
+	description = NULL;
+	async_read = false;
 #ifdef WITH_HDF5
 #else
 	error("hermes3d was not built with HDF5 support.");
@@ -64,24 +69,30 @@ HDF5Reader::~HDF5Reader() {
 
 #ifdef WITH_HDF5
 
-// checks the version of hdf5 file
-static bool check_version(hid_t id) {
+// version 1.0: one dataset per vertex/element/boundary
+// version 1.1: one 2D dataset "data" per group (bc groups also have "marker")
+// Vertex indices are zero-based in both versions.
+#define VERSION_1_0							0x0100
+#define VERSION_1_1							0x0101
+
+// number of rows read by one H5Dread call
+static const hsize_t CHUNK_ROWS = 16384;
+
+// returns the version of hdf5 file (0 if it is missing)
+static int get_version(hid_t id) {
 	_F_
 	herr_t status;
 
 	hid_t version_attr = H5Aopen_name(id, "version");
-	if (version_attr < 0) return false;
+	if (version_attr < 0) return 0;
 
 	char attr_data[2] = { 0 };
 	status = H5Aread(version_attr, H5T_NATIVE_CHAR, attr_data);
 
 	H5Aclose(version_attr);
 
-	// check version
-	int version = attr_data[0] * 0x100 + attr_data[1];
-	if (version != 0x0100) return false;
-
-	return true;
+	if (status < 0) return 0;
+	return attr_data[0] * 0x100 + attr_data[1];
 }
 
 /// reads the count attribute in the group 'id'
@@ -103,85 +114,342 @@ static bool read_attr(hid_t id, const char *name, unsigned int &count) {
 	return (status >= 0);
 }
 
-static bool read_vertices(hid_t id, Mesh *mesh) {
+/// Reads a 2D dataset (rows x cols) in chunks of CHUNK_ROWS rows
+///
+/// With 'async', the chunks are read by a second thread into two buffers,
+/// so the next chunk is being read while the caller works on the current one.
+/// In that case, nobody else may call HDF5 until the reader is destroyed.
+class ChunkReader {
+public:
+	ChunkReader(hid_t dataset_id, hid_t mem_type, hsize_t rows, hsize_t cols, bool async);
+	~ChunkReader();
+
+	/// Get the next chunk
+	/// @param[out] data rows of the chunk (valid until the next call)
+	/// @return number of rows in the chunk, 0 at the end, -1 on read error
+	long next(void *&data);
+
+protected:
+	static const int NUM_BUFS = 2;
+
+	hid_t dataset_id, mem_type;
+	hsize_t rows, cols;
+	size_t row_size;
+	Word_t num_chunks;
+	Word_t cur;								// index of the chunk returned by the next call of next()
+
+	char *buf[NUM_BUFS];
+	long buf_rows[NUM_BUFS];				// number of rows in a buffer, -1 on error
+	bool buf_ready[NUM_BUFS];				// buffer was read and was not consumed yet
+
+	bool async, stop;
+	pthread_t thread;
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+
+	long read_chunk(Word_t k, char *data);
+	static void *reader_thread(void *arg);
+};
+
+ChunkReader::ChunkReader(hid_t dataset_id, hid_t mem_type, hsize_t rows, hsize_t cols, bool async) {
 	_F_
-	bool ret = true;
+	this->dataset_id = dataset_id;
+	this->mem_type = mem_type;
+	this->rows = rows;
+	this->cols = cols;
+	this->row_size = H5Tget_size(mem_type) * cols;
+	this->num_chunks = (rows + CHUNK_ROWS - 1) / CHUNK_ROWS;
+	this->cur = 0;
+	// with a single chunk there is nothing to overlap
+	this->async = async && num_chunks > 1;
+	this->stop = false;
+
+	int nbufs = this->async ? NUM_BUFS : 1;
+	for (int i = 0; i < NUM_BUFS; i++) {
+		buf[i] = i < nbufs ? (char *) malloc(row_size * (rows < CHUNK_ROWS ? rows : CHUNK_ROWS)) : NULL;
+		buf_rows[i] = 0;
+		buf_ready[i] = false;
+	}
 
-	// open vertices group
-	hid_t group_id = H5Gopen(id, "vertices");
-	if (group_id < 0) return false;
+	if (this->async) {
+		pthread_mutex_init(&mutex, NULL);
+		pthread_cond_init(&cond, NULL);
+		if (pthread_create(&thread, NULL, reader_thread, this) != 0) {
+			this->async = false;
+			pthread_cond_destroy(&cond);
+			pthread_mutex_destroy(&mutex);
+		}
+	}
+}
+
+ChunkReader::~ChunkReader() {
+	_F_
+	if (async) {
+		pthread_mutex_lock(&mutex);
+		stop = true;
+		pthread_cond_broadcast(&cond);
+		pthread_mutex_unlock(&mutex);
+		pthread_join(thread, NULL);
+		pthread_cond_destroy(&cond);
+		pthread_mutex_destroy(&mutex);
+	}
+	for (int i = 0; i < NUM_BUFS; i++)
+		::free(buf[i]);
+}
+
+// NOTE: called from the reader thread, so no _F_ here
+long ChunkReader::read_chunk(Word_t k, char *data) {
+	hsize_t start[2] = { k * CHUNK_ROWS, 0 };
+	hsize_t count[2] = { rows - start[0] < CHUNK_ROWS ? rows - start[0] : CHUNK_ROWS, cols };
+
+	hid_t file_space = H5Dget_space(dataset_id);
+	hid_t mem_space = H5Screate_simple(2, count, NULL);
+	herr_t status = H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, NULL, count, NULL);
+	if (status >= 0)
+		status = H5Dread(dataset_id, mem_type, mem_space, file_space, H5P_DEFAULT, data);
+	H5Sclose(mem_space);
+	H5Sclose(file_space);
+
+	return status >= 0 ? (long) count[0] : -1;
+}
+
+void *ChunkReader::reader_thread(void *arg) {
+	ChunkReader *cr = (ChunkReader *) arg;
+	for (Word_t k = 0; k < cr->num_chunks; k++) {
+		int b = k % NUM_BUFS;
+		// wait until the consumer is done with the buffer
+		pthread_mutex_lock(&cr->mutex);
+		while (cr->buf_ready[b] && !cr->stop)
+			pthread_cond_wait(&cr->cond, &cr->mutex);
+		bool stop = cr->stop;
+		pthread_mutex_unlock(&cr->mutex);
+		if (stop) break;
+
+		long n = cr->read_chunk(k, cr->buf[b]);
+
+		pthread_mutex_lock(&cr->mutex);
+		cr->buf_rows[b] = n;
+		cr->buf_ready[b] = true;
+		pthread_cond_broadcast(&cr->cond);
+		pthread_mutex_unlock(&cr->mutex);
+		if (n < 0) break;
+	}
+	return NULL;
+}
+
+long ChunkReader::next(void *&data) {
+	_F_
+	if (cur >= num_chunks) return 0;
+
+	long n;
+	if (async) {
+		int b = cur % NUM_BUFS;
+		pthread_mutex_lock(&mutex);
+		// hand the previous buffer back to the reader
+		if (cur > 0) {
+			buf_ready[(cur - 1) % NUM_BUFS] = false;
+			pthread_cond_broadcast(&cond);
+		}
+		while (!buf_ready[b])
+			pthread_cond_wait(&cond, &mutex);
+		n = buf_rows[b];
+		pthread_mutex_unlock(&mutex);
+		data = buf[b];
+	}
+	else {
+		n = read_chunk(cur, buf[0]);
+		data = buf[0];
+	}
+
+	cur++;
+	return n;
+}
+
+/// Opens group 'name' in 'id' and its dataset 'data' with 'cols' columns.
+/// @return the number of rows, -1 on error
+static long open_data(hid_t id, const char *name, hid_t &group_id, hid_t &dataset_id, hsize_t cols) {
+	_F_
+	group_id = H5Gopen(id, name);
+	if (group_id < 0) return -1;
 
-	// read the number of vertices
 	unsigned int count;
-	if (read_attr(group_id, "count", count)) {
-		for (unsigned int i = 0; i < count; i++) {
-			// open data set
-			char name[16] = { 0 };
-			sprintf(name, "%d", i);
-			hid_t dataset_id = H5Dopen(group_id, name);
-			if (dataset_id >= 0) {
-				double pt[3];
-				if (H5Dread(dataset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, pt) >= 0) {
-					mesh->add_vertex(pt[0], pt[1], pt[2]);
-				}
-				else {
-					H5Dclose(dataset_id);
-					ret = false;
-					break;
+	if (!read_attr(group_id, "count", count)) return -1;
+	dataset_id = -1;
+	if (count == 0) return 0;
+
+	dataset_id = H5Dopen(group_id, "data");
+	if (dataset_id < 0) return -1;
+
+	// check the shape of the dataset
+	hsize_t dims[2] = { 0, 0 };
+	hid_t space = H5Dget_space(dataset_id);
+	int ndims = H5Sget_simple_extent_ndims(space);
+	if (ndims == 2) H5Sget_simple_extent_dims(space, dims, NULL);
+	H5Sclose(space);
+	if (ndims != 2 || dims[0] != count || dims[1] != cols) return -1;
+
+	return count;
+}
+
+static void close_data(hid_t group_id, hid_t dataset_id) {
+	_F_
+	if (dataset_id >= 0) H5Dclose(dataset_id);
+	if (group_id >= 0) H5Gclose(group_id);
+}
+
+// version 1.1 ////
+
+static bool read_vertices_bulk(hid_t id, Mesh *mesh, bool async) {
+	_F_
+	hid_t group_id = -1, dataset_id = -1;
+	long count = open_data(id, "vertices", group_id, dataset_id, 3);
+	bool ret = count >= 0;
+
+	if (count > 0) {
+		ChunkReader rd(dataset_id, H5T_NATIVE_DOUBLE, count, 3, async);
+		void *data;
+		long n;
+		while ((n = rd.next(data)) > 0) {
+			double *pt = (double *) data;
+			for (long i = 0; i < n; i++, pt += 3)
+				mesh->add_vertex(pt[0], pt[1], pt[2]);
+		}
+		if (n < 0) ret = false;
+	}
+
+	close_data(group_id, dataset_id);
+	return ret;
+}
+
+static bool read_elems_bulk(hid_t id, const char *name, EMode3D mode, Mesh *mesh, bool async) {
+	_F_
+	int nv;
+	switch (mode) {
+		case MODE_TETRAHEDRON: nv = Tetra::NUM_VERTICES; break;
+		case MODE_HEXAHEDRON: nv = Hex::NUM_VERTICES; break;
+		case MODE_PRISM: nv = Prism::NUM_VERTICES; break;
+		default: return false;
+	}
+
+	hid_t group_id = -1, dataset_id = -1;
+	long count = open_data(id, name, group_id, dataset_id, nv);
+	bool ret = count >= 0;
+
+	if (count > 0) {
+		ChunkReader rd(dataset_id, H5T_NATIVE_UINT32, count, nv, async);
+		void *data;
+		long n;
+		while ((n = rd.next(data)) > 0) {
+			uint32_t *row = (uint32_t *) data;
+			for (long i = 0; i < n; i++, row += nv) {
+				Word_t vtcs[Hex::NUM_VERTICES];
+				for (int k = 0; k < nv; k++)
+					vtcs[k] = row[k] + 1;
+
+				switch (mode) {
+					case MODE_TETRAHEDRON: mesh->add_tetra_bulk(vtcs); break;
+					case MODE_HEXAHEDRON: mesh->add_hex_bulk(vtcs); break;
+					case MODE_PRISM: mesh->add_prism_bulk(vtcs); break;
 				}
 			}
-			H5Dclose(dataset_id);
 		}
+		if (n < 0) ret = false;
 	}
-	else ret = false;
-
-	H5Gclose(group_id);
 
+	close_data(group_id, dataset_id);
 	return ret;
 }
 
-static bool read_hexes(hid_t id, Mesh *mesh) {
+static bool read_elements_bulk(hid_t id, Mesh *mesh, bool async) {
 	_F_
-	bool ret = true;
-
-	// open group with hexes
-	hid_t group_id = H5Gopen(id, "hex");
+	hid_t group_id = H5Gopen(id, "elements");
 	if (group_id < 0) return false;
 
-	// read the number of vertices
-	unsigned int count;
-	if (read_attr(group_id, "count", count)) {
-		for (unsigned int i = 0; i < count; i++) {
-			// open data set
-			char name[16] = { 0 };
-			sprintf(name, "%d", i);
-			hid_t dataset_id = H5Dopen(group_id, name);
-			if (dataset_id >= 0) {
-				Word_t vtcs[Hex::NUM_VERTICES] = { 0 };
-				if (H5Dread(dataset_id, H5T_NATIVE_UINT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, vtcs) >= 0) {
-					mesh->add_hex(vtcs);
-				}
-				else {
-					H5Dclose(dataset_id);
-					ret = false;
-					break;
-				}
-			}
-			H5Dclose(dataset_id);
+	bool ret =
+		read_elems_bulk(group_id, "hex", MODE_HEXAHEDRON, mesh, async) &&
+		read_elems_bulk(group_id, "tetra", MODE_TETRAHEDRON, mesh, async) &&
+		read_elems_bulk(group_id, "prism", MODE_PRISM, mesh, async);
+
+	H5Gclose(group_id); // close the group
+
+	return ret;
+}
+
+static bool read_bnds_bulk(hid_t id, const char *name, EMode2D mode, Mesh *mesh) {
+	_F_
+	int nv = (mode == MODE_TRIANGLE) ? Tri::NUM_VERTICES : Quad::NUM_VERTICES;
+
+	hid_t group_id = -1, dataset_id = -1;
+	long count = open_data(id, name, group_id, dataset_id, nv);
+	bool ret = count >= 0;
+
+	if (count > 0) {
+		// boundaries are few compared to elements, read them at once
+		uint32_t *vtcs = new uint32_t[count * nv];
+		uint32_t *markers = new uint32_t[count];
+		hid_t marker_id = H5Dopen(group_id, "marker");
+		ret =
+			marker_id >= 0 &&
+			H5Dread(dataset_id, H5T_NATIVE_UINT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, vtcs) >= 0 &&
+			H5Dread(marker_id, H5T_NATIVE_UINT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, markers) >= 0;
+		if (marker_id >= 0) H5Dclose(marker_id);
+
+		for (long i = 0; ret && i < count; i++) {
+			Word_t key[Quad::NUM_VERTICES];
+			for (int k = 0; k < nv; k++)
+				key[k] = vtcs[i * nv + k] + 1;
+			if (mode == MODE_TRIANGLE) mesh->add_tri_boundary(key, markers[i]);
+			else mesh->add_quad_boundary(key, markers[i]);
 		}
+
+		delete [] vtcs;
+		delete [] markers;
 	}
-	else ret = false;
+
+	close_data(group_id, dataset_id);
+	return ret;
+}
+
+static bool read_bcs_bulk(hid_t id, Mesh *mesh) {
+	_F_
+	hid_t group_id = H5Gopen(id, "bc");
+	if (group_id < 0) return false;
+
+	bool ret =
+		read_bnds_bulk(group_id, "tri", MODE_TRIANGLE, mesh) &&
+		read_bnds_bulk(group_id, "quad", MODE_QUAD, mesh);
 
 	H5Gclose(group_id); // close the group
 
 	return ret;
 }
 
-static bool read_tetras(hid_t id, Mesh *mesh) {
+// version 1.0 ////
+
+/// reads dataset 'i' of the group into 'vtcs' (vertex indices are stored as 32bit numbers)
+static bool read_indices(hid_t group_id, unsigned int i, Word_t *vtcs, int nv, unsigned int *marker = NULL) {
+	_F_
+	char name[16] = { 0 };
+	sprintf(name, "%d", i);
+	hid_t dataset_id = H5Dopen(group_id, name);
+	if (dataset_id < 0) return false;
+
+	uint32_t idx[Hex::NUM_VERTICES] = { 0 };
+	bool ret = H5Dread(dataset_id, H5T_NATIVE_UINT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, idx) >= 0;
+	if (ret && marker != NULL) ret = read_attr(dataset_id, "marker", *marker);
+	for (int k = 0; k < nv; k++)
+		vtcs[k] = idx[k] + 1;
+
+	H5Dclose(dataset_id);
+	return ret;
+}
+
+static bool read_vertices(hid_t id, Mesh *mesh) {
 	_F_
 	bool ret = true;
 
-	hid_t group_id = H5Gopen(id, "tetra");
+	// open vertices group
+	hid_t group_id = H5Gopen(id, "vertices");
 	if (group_id < 0) return false;
 
 	// read the number of vertices
@@ -193,9 +461,9 @@ static bool read_tetras(hid_t id, Mesh *mesh) {
 			sprintf(name, "%d", i);
 			hid_t dataset_id = H5Dopen(group_id, name);
 			if (dataset_id >= 0) {
-				Word_t vtcs[Tetra::NUM_VERTICES] = { 0 };
-				if (H5Dread(dataset_id, H5T_NATIVE_UINT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, vtcs) >= 0) {
-					mesh->add_tetra(vtcs);
+				double pt[3];
+				if (H5Dread(dataset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, pt) >= 0) {
+					mesh->add_vertex(pt[0], pt[1], pt[2]);
 				}
 				else {
 					H5Dclose(dataset_id);
@@ -208,38 +476,34 @@ static bool read_tetras(hid_t id, Mesh *mesh) {
 	}
 	else ret = false;
 
-	H5Gclose(group_id); // close the group
+	H5Gclose(group_id);
 
 	return ret;
 }
 
-static bool read_prisms(hid_t id, Mesh *mesh) {
+static bool read_elems(hid_t id, const char *name, EMode3D mode, Mesh *mesh) {
 	_F_
 	bool ret = true;
 
-	hid_t group_id = H5Gopen(id, "prism");
+	hid_t group_id = H5Gopen(id, name);
 	if (group_id < 0) return false;
 
-	// read the number of vertices
+	// read the number of elements
 	unsigned int count;
 	if (read_attr(group_id, "count", count)) {
-		for (unsigned int i = 0; i < count; i++) {
-			// open data set
-			char name[16] = { 0 };
-			sprintf(name, "%d", i);
-			hid_t dataset_id = H5Dopen(group_id, name);
-			if (dataset_id >= 0) {
-				Word_t vtcs[Prism::NUM_VERTICES] = { 0 };
-				if (H5Dread(dataset_id, H5T_NATIVE_UINT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, vtcs) >= 0) {
-					mesh->add_prism(vtcs);
-				}
-				else {
-					H5Dclose(dataset_id);
-					ret = false;
+		for (unsigned int i = 0; i < count && ret; i++) {
+			Word_t vtcs[Hex::NUM_VERTICES];
+			switch (mode) {
+				case MODE_TETRAHEDRON:
+					if ((ret = read_indices(group_id, i, vtcs, Tetra::NUM_VERTICES))) mesh->add_tetra_bulk(vtcs);
+					break;
+				case MODE_HEXAHEDRON:
+					if ((ret = read_indices(group_id, i, vtcs, Hex::NUM_VERTICES))) mesh->add_hex_bulk(vtcs);
+					break;
+				case MODE_PRISM:
+					if ((ret = read_indices(group_id, i, vtcs, Prism::NUM_VERTICES))) mesh->add_prism_bulk(vtcs);
 					break;
-				}
 			}
-			H5Dclose(dataset_id);
 		}
 	}
 	else ret = false;
@@ -255,9 +519,9 @@ static bool read_elements(hid_t id, Mesh *mesh) {
 	if (group_id < 0) return false;
 
 	bool ret =
-		read_hexes(group_id, mesh) &&
-		read_tetras(group_id, mesh) &&
-		read_prisms(group_id, mesh);
+		read_elems(group_id, "hex", MODE_HEXAHEDRON, mesh) &&
+		read_elems(group_id, "tetra", MODE_TETRAHEDRON, mesh) &&
+		read_elems(group_id, "prism", MODE_PRISM, mesh);
 
 	H5Gclose(group_id); // close the group
 
@@ -266,71 +530,25 @@ static bool read_elements(hid_t id, Mesh *mesh) {
 
 // BCs ////////////////////////////////////////////////////////////////////////
 
-static bool read_tris(hid_t id, Mesh *mesh) {
+static bool read_bnds(hid_t id, const char *name, EMode2D mode, Mesh *mesh) {
 	_F_
 	bool ret = true;
 
-	hid_t group_id = H5Gopen(id, "tri");
+	hid_t group_id = H5Gopen(id, name);
 	if (group_id < 0) return false;
 
-	// read the number of vertices
+	// read the number of boundaries
 	unsigned int count;
 	if (read_attr(group_id, "count", count)) {
-		for (unsigned int i = 0; i < count; i++) {
-			// open data set
-			char name[16] = { 0 };
-			sprintf(name, "%d", i);
-			hid_t dataset_id = H5Dopen(group_id, name);
-			if (dataset_id >= 0) {
-				Word_t vtcs[Tri::NUM_VERTICES] = { 0 };
-				unsigned int marker = 0;
-				if (H5Dread(dataset_id, H5T_NATIVE_UINT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, vtcs) >= 0 && read_attr(dataset_id, "marker", marker)) {
-					mesh->add_tri_boundary(vtcs, marker);
-				}
-				else {
-					H5Dclose(dataset_id);
-					ret = false;
-					break;
-				}
+		for (unsigned int i = 0; i < count && ret; i++) {
+			Word_t vtcs[Quad::NUM_VERTICES];
+			unsigned int marker = 0;
+			if (mode == MODE_TRIANGLE) {
+				if ((ret = read_indices(group_id, i, vtcs, Tri::NUM_VERTICES, &marker))) mesh->add_tri_boundary(vtcs, marker);
 			}
-			H5Dclose(dataset_id);
-		}
-	}
-	else ret = false;
-
-	H5Gclose(group_id); // close the group
-
-	return ret;
-}
-
-static bool read_quads(hid_t id, Mesh *mesh) {
-	_F_
-	bool ret = true;
-
-	hid_t group_id = H5Gopen(id, "quad");
-	if (group_id < 0) return false;
-
-	// read the number of vertices
-	unsigned int count;
-	if (read_attr(group_id, "count", count)) {
-		for (unsigned int i = 0; i < count; i++) {
-			// open data set
-			char name[16] = { 0 };
-			sprintf(name, "%d", i);
-			hid_t dataset_id = H5Dopen(group_id, name);
-			if (dataset_id >= 0) {
-				Word_t vtcs[Quad::NUM_VERTICES] = { 0 };
-				unsigned int marker = 0;
-				if (H5Dread(dataset_id, H5T_NATIVE_UINT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, vtcs) >= 0 && read_attr(dataset_id, "marker", marker)) {
-					mesh->add_quad_boundary(vtcs, marker);
-				}
-				else {
-					H5Dclose(dataset_id);
-					ret = false;
-					break;
-				}
+			else {
+				if ((ret = read_indices(group_id, i, vtcs, Quad::NUM_VERTICES, &marker))) mesh->add_quad_boundary(vtcs, marker);
 			}
-			H5Dclose(dataset_id);
 		}
 	}
 	else ret = false;
@@ -346,8 +564,8 @@ static bool read_bcs(hid_t id, Mesh *mesh) {
 	if (group_id < 0) return false;
 
 	bool ret =
-		read_tris(group_id, mesh) &&
-		read_quads(group_id, mesh);
+		read_bnds(group_id, "tri", MODE_TRIANGLE, mesh) &&
+		read_bnds(group_id, "quad", MODE_QUAD, mesh);
 
 	H5Gclose(group_id); // close the group
 
@@ -362,22 +580,35 @@ bool HDF5Reader::load(const char *file_name, Mesh *mesh) {
 	bool ret = true;
 
 	H5open();
+	hid_t file_id = -1, mesh_group_id = -1;
 	try {
 		// check if the file is HDF5
 		int err = H5Fis_hdf5(file_name);
 		if (err == 0) throw E_NOT_HDF5_FILE;
 		else if (err < 0) throw E_ERROR;
 
-		hid_t file_id = H5Fopen(file_name, H5F_ACC_RDONLY, H5P_DEFAULT);
+		file_id = H5Fopen(file_name, H5F_ACC_RDONLY, H5P_DEFAULT);
+		if (file_id < 0) throw E_CANT_OPEN_FILE;
 
-		hid_t mesh_group_id = H5Gopen(file_id, "/mesh3d");
+		mesh_group_id = H5Gopen(file_id, "/mesh3d");
 		if (mesh_group_id < 0) throw E_READ_ERROR;
 
 		// check version
-		if (!check_version(mesh_group_id)) throw E_INVALID_VERSION;
-		if (!read_vertices(mesh_group_id, mesh)) throw E_READ_ERROR;
-		if (!read_elements(mesh_group_id, mesh)) throw E_READ_ERROR;
-		if (!read_bcs(mesh_group_id, mesh)) throw E_READ_ERROR;
+		int version = get_version(mesh_group_id);
+		if (version == VERSION_1_1) {
+			if (!read_vertices_bulk(mesh_group_id, mesh, async_read)) throw E_READ_ERROR;
+			if (!read_elements_bulk(mesh_group_id, mesh, async_read)) throw E_READ_ERROR;
+			mesh->build_base_maps();
+			if (!read_bcs_bulk(mesh_group_id, mesh)) throw E_READ_ERROR;
+		}
+		else if (version == VERSION_1_0) {
+			if (!read_vertices(mesh_group_id, mesh)) throw E_READ_ERROR;
+			if (!read_elements(mesh_group_id, mesh)) throw E_READ_ERROR;
+			mesh->build_base_maps();
+			if (!read_bcs(mesh_group_id, mesh)) throw E_READ_ERROR;
+		}
+		else
+			throw E_INVALID_VERSION;
 
 		H5Gclose(mesh_group_id);
 
@@ -387,7 +618,8 @@ bool HDF5Reader::load(const char *file_name, Mesh *mesh) {
 	}
 	catch (int e) {
 		// TODO: save the error code
-		// TODO: close the mesh_group_id
+		if (mesh_group_id >= 0) H5Gclose(mesh_group_id);
+		if (file_id >= 0) H5Fclose(file_id);
 		ret = false;
 	}
 
@@ -409,172 +641,86 @@ static bool write_attr(hid_t loc_id, const char *name, uint value) {
 	_F_
 	hid_t dataspace_id = H5Screate(H5S_SCALAR);
 	hid_t attr = H5Acreate(loc_id, name, H5T_NATIVE_UINT32, dataspace_id, H5P_DEFAULT);
-	H5Awrite(attr, H5T_NATIVE_UINT32, &value);
+	herr_t status = H5Awrite(attr, H5T_NATIVE_UINT32, &value);
 	H5Aclose(attr);
 	H5Sclose(dataspace_id);
-	return true;
+	return status >= 0;
 }
 
-static bool save_vertices(hid_t parent_group_id, Mesh *mesh) {
+/// writes 'rows' x 'cols' array 'data' as the dataset 'name'
+static bool write_data(hid_t loc_id, const char *name, hid_t type, hsize_t rows, hsize_t cols, const void *data) {
 	_F_
-	herr_t status;
+	hsize_t dims[2] = { rows, cols };
+	hid_t dataspace_id = H5Screate_simple(cols > 1 ? 2 : 1, dims, NULL);
+	hid_t dataset_id = H5Dcreate(loc_id, name, type, dataspace_id, H5P_DEFAULT);
+	herr_t status = H5Dwrite(dataset_id, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+	H5Dclose(dataset_id);
+	H5Sclose(dataspace_id);
+	return status >= 0;
+}
 
+static bool save_vertices(hid_t parent_group_id, Mesh *mesh) {
+	_F_
 	// create main group
 	hid_t group_id = H5Gcreate(parent_group_id, "vertices", 0);
 
-	// count
+	// vertex ids are expected to be 1..count
 	uint count = mesh->vertices.count();
-	write_attr(group_id, "count", count);
-
-	hsize_t dims = 3;
-	hid_t vertex_dataspace_id = H5Screate_simple(1, &dims, NULL);
-
-	// dump vertices
-	for (uint i = 0; i < count; i++) {
-		char name[256];
-		sprintf(name, "%d", i);
-
-		// Create the dataset
-		hid_t dataset_id = H5Dcreate(group_id, name, H5T_NATIVE_DOUBLE, vertex_dataspace_id, H5P_DEFAULT);
-		double pt[] = { mesh->vertices[i]->x, mesh->vertices[i]->y, mesh->vertices[i]->z };
-		status = H5Dwrite(dataset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, pt);
-		status = H5Dclose(dataset_id);
+	bool ret = write_attr(group_id, "count", count);
+
+	if (count > 0) {
+		double *pt = new double[count * 3];
+		uint n = 0;
+		FOR_ALL_VERTICES(idx, mesh) {
+			Vertex *v = mesh->vertices[idx];
+			pt[3 * n + 0] = v->x;
+			pt[3 * n + 1] = v->y;
+			pt[3 * n + 2] = v->z;
+			n++;
+		}
+		ret = ret && write_data(group_id, "data", H5T_NATIVE_DOUBLE, count, 3, pt);
+		delete [] pt;
 	}
 
-	H5Sclose(vertex_dataspace_id);
-
-	status = H5Gclose(group_id); // close the group
+	H5Gclose(group_id); // close the group
 
-	return true;
+	return ret;
 }
 
 // Elements ////
 
-static bool save_hex(hid_t parent_group_id, Array<Element *> &elems) {
-	_F_
-	herr_t status;
-
-	// create main group
-	hid_t group_id = H5Gcreate(parent_group_id, "hex", 0);
-
-	// count
-	uint count = elems.count();
-	write_attr(group_id, "count", count);
-
-	///
-	hsize_t dims = Hex::NUM_VERTICES;
-	hid_t elem_dataspace_id = H5Screate_simple(1, &dims, NULL);
-
-	// dump vertices
-	for (uint i = 0; i < count; i++) {
-		char name[256];
-		sprintf(name, "%d", i);
-
-		// the dataset
-		hid_t dataset_id = H5Dcreate(group_id, name, H5T_NATIVE_UINT32, elem_dataspace_id, H5P_DEFAULT);
-		uint vtcs[Hex::NUM_VERTICES] = {
-			elems[i]->get_vertex(0), elems[i]->get_vertex(1), elems[i]->get_vertex(2), elems[i]->get_vertex(3),
-			elems[i]->get_vertex(4), elems[i]->get_vertex(5), elems[i]->get_vertex(6), elems[i]->get_vertex(7)
-		};
-		status = H5Dwrite(dataset_id, H5T_NATIVE_UINT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, vtcs);
-		status = H5Dclose(dataset_id);
-	}
-
-	H5Sclose(elem_dataspace_id);
-
-	status = H5Gclose(group_id); // close the group
-
-	return true;
-}
-
-static bool save_tetra(hid_t parent_group_id, Array<Element *> &elems) {
-	_F_
-	herr_t status;
-
-	// create main group
-	hid_t group_id = H5Gcreate(parent_group_id, "tetra", 0);
-
-	// count
-	uint count = elems.count();
-	write_attr(group_id, "count", count);
-
-	///
-	hsize_t dims = Tetra::NUM_VERTICES;
-	hid_t elem_dataspace_id = H5Screate_simple(1, &dims, NULL);
-
-	// dump vertices
-	for (uint i = 0; i < count; i++) {
-		char name[256];
-		sprintf(name, "%d", i);
-
-		// the dataset
-		hid_t dataset_id = H5Dcreate(group_id, name, H5T_NATIVE_UINT32, elem_dataspace_id, H5P_DEFAULT);
-		uint vtcs[Tetra::NUM_VERTICES] = {
-			elems[i]->get_vertex(0), elems[i]->get_vertex(1), elems[i]->get_vertex(2), elems[i]->get_vertex(3)
-		};
-		status = H5Dwrite(dataset_id, H5T_NATIVE_UINT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, vtcs);
-		status = H5Dclose(dataset_id);
-	}
-
-	H5Sclose(elem_dataspace_id);
-
-	status = H5Gclose(group_id); // close the group
-
-	return true;
-}
-
-static bool save_prism(hid_t parent_group_id, Array<Element *> &elems) {
+static bool save_elems(hid_t parent_group_id, const char *name, Array<Element *> &elems, int nv) {
 	_F_
-	herr_t status;
-
 	// create main group
-	hid_t group_id = H5Gcreate(parent_group_id, "prism", 0);
+	hid_t group_id = H5Gcreate(parent_group_id, name, 0);
 
 	// count
 	uint count = elems.count();
-	write_attr(group_id, "count", count);
-
-	///
-	hsize_t dims = Prism::NUM_VERTICES;
-	hid_t elem_dataspace_id = H5Screate_simple(1, &dims, NULL);
-
-	// dump vertices
-	for (uint i = 0; i < count; i++) {
-		char name[256];
-		sprintf(name, "%d", i);
-
-		// the dataset
-		hid_t dataset_id = H5Dcreate(group_id, name, H5T_NATIVE_UINT32, elem_dataspace_id, H5P_DEFAULT);
-		uint vtcs[Prism::NUM_VERTICES] = {
-			elems[i]->get_vertex(0), elems[i]->get_vertex(1), elems[i]->get_vertex(2),
-			elems[i]->get_vertex(3), elems[i]->get_vertex(4), elems[i]->get_vertex(5)
-		};
-		status = H5Dwrite(dataset_id, H5T_NATIVE_UINT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, vtcs);
-		status = H5Dclose(dataset_id);
+	bool ret = write_attr(group_id, "count", count);
+
+	if (count > 0) {
+		uint32_t *vtcs = new uint32_t[count * nv];
+		for (uint i = 0; i < count; i++)
+			for (int k = 0; k < nv; k++)
+				vtcs[i * nv + k] = elems[i]->get_vertex(k) - 1;
+		ret = ret && write_data(group_id, "data", H5T_NATIVE_UINT32, count, nv, vtcs);
+		delete [] vtcs;
 	}
 
-	H5Sclose(elem_dataspace_id);
-
-	status = H5Gclose(group_id); // close the group
+	H5Gclose(group_id); // close the group
 
-	return true;
+	return ret;
 }
 
 static bool save_elements(hid_t parent_group_id, Mesh *mesh) {
 	_F_
-	herr_t status;
-
 	// create main group
 	hid_t group_id = H5Gcreate(parent_group_id, "elements", 0);
 
-	// count
-	uint count = mesh->elements.count();
-	write_attr(group_id, "count", count);
-
-	///
+	// only the base elements are stored, refinements are not part of the format
 	Array<Element *> tet, hex, pri;
-	for (uint i = 0; i < count; i++) {
-		Element *elem = mesh->elements[i];
+	FOR_ALL_BASE_ELEMENTS(eid, mesh) {
+		Element *elem = mesh->elements[eid];
 		switch (elem->get_mode()) {
 			case MODE_TETRAHEDRON: tet.add(elem); break;
 			case MODE_HEXAHEDRON: hex.add(elem); break;
@@ -582,135 +728,92 @@ static bool save_elements(hid_t parent_group_id, Mesh *mesh) {
 		}
 	}
 
+	// count
+	uint count = tet.count() + hex.count() + pri.count();
+	write_attr(group_id, "count", count);
+
 	bool ret =
-		save_tetra(group_id, tet) &&
-		save_hex(group_id, hex) &&
-		save_prism(group_id, pri);
+		save_elems(group_id, "tetra", tet, Tetra::NUM_VERTICES) &&
+		save_elems(group_id, "hex", hex, Hex::NUM_VERTICES) &&
+		save_elems(group_id, "prism", pri, Prism::NUM_VERTICES);
 
-	status = H5Gclose(group_id); // close the group
+	H5Gclose(group_id); // close the group
 
 	return ret;
 }
 
 // BC ////
 
-static bool save_tri_bc(hid_t parent_group_id, Mesh *mesh, Array<Word_t> &bcs) {
+static bool save_bnds(hid_t parent_group_id, const char *name, Mesh *mesh, Array<Word_t> &bcs, int nv) {
 	_F_
-	herr_t status;
-
 	// create main group
-	hid_t group_id = H5Gcreate(parent_group_id, "tri", 0);
+	hid_t group_id = H5Gcreate(parent_group_id, name, 0);
 
 	// count
 	uint count = bcs.count();
-	write_attr(group_id, "count", count);
-
-	///
-	hsize_t dims = Tri::NUM_VERTICES;
-	hid_t elem_dataspace_id = H5Screate_simple(1, &dims, NULL);
-
-	// dump vertices
-	for (uint i = 0; i < count; i++) {
-		char name[256];
-		sprintf(name, "%d", i);
-
-		Word_t fid = bcs[i];
-		Facet *facet = mesh->facets.get(fid);
-		Element *elem = mesh->elements[facet->left];
-		Boundary *bnd = mesh->boundaries[facet->right];
-
-		// the dataset
-		hid_t dataset_id = H5Dcreate(group_id, name, H5T_NATIVE_UINT32, elem_dataspace_id, H5P_DEFAULT);
-		const int *vidx = elem->get_face_vertices(facet->left_face_num);
-		uint vtcs[Tri::NUM_VERTICES] = { elem->get_vertex(vidx[0]), elem->get_vertex(vidx[1]), elem->get_vertex(vidx[2]) };
-		status = H5Dwrite(dataset_id, H5T_NATIVE_UINT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, vtcs);
-
-		// marker
-		write_attr(dataset_id, "marker", bnd->marker);
-
-		status = H5Dclose(dataset_id);
-	}
-
-	H5Sclose(elem_dataspace_id);
-
-	status = H5Gclose(group_id); // close the group
-
-	return true;
-}
-
-static bool save_quad_bc(hid_t parent_group_id, Mesh *mesh, Array<Word_t> &bcs) {
-	_F_
-	herr_t status;
-
-	// create main group
-	hid_t group_id = H5Gcreate(parent_group_id, "quad", 0);
-
-	// count
-	uint count = bcs.count();
-	write_attr(group_id, "count", count);
-
-	///
-	hsize_t dims = Quad::NUM_VERTICES;
-	hid_t elem_dataspace_id = H5Screate_simple(1, &dims, NULL);
-
-	// dump vertices
-	for (uint i = 0; i < count; i++) {
-		char name[256];
-		sprintf(name, "%d", i);
-
-		Word_t fid = bcs[i];
-		Facet *facet = mesh->facets.get(fid);
-		Element *elem = mesh->elements[facet->left];
-		Boundary *bnd = mesh->boundaries[facet->right];
-
-		// the dataset
-		hid_t dataset_id = H5Dcreate(group_id, name, H5T_NATIVE_UINT32, elem_dataspace_id, H5P_DEFAULT);
-		const int *vidx = elem->get_face_vertices(facet->left_face_num);
-		uint vtcs[Quad::NUM_VERTICES] = { elem->get_vertex(vidx[0]), elem->get_vertex(vidx[1]), elem->get_vertex(vidx[2]), elem->get_vertex(vidx[3]) };
-		elem->get_face_vertices(facet->left_face_num);
-		status = H5Dwrite(dataset_id, H5T_NATIVE_UINT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, vtcs);
-
-		// marker
-		write_attr(dataset_id, "marker", bnd->marker);
-
-		status = H5Dclose(dataset_id);
+	bool ret = write_attr(group_id, "count", count);
+
+	if (count > 0) {
+		uint32_t *vtcs = new uint32_t[count * nv];
+		uint32_t *markers = new uint32_t[count];
+		for (uint i = 0; i < count; i++) {
+			Facet *facet = mesh->facets.get(bcs[i]);
+			Element *elem = mesh->elements[facet->left];
+			Boundary *bnd = mesh->boundaries[facet->right];
+
+			const int *vidx = elem->get_face_vertices(facet->left_face_num);
+			for (int k = 0; k < nv; k++)
+				vtcs[i * nv + k] = elem->get_vertex(vidx[k]) - 1;
+			markers[i] = bnd->marker;
+		}
+		ret = ret &&
+			write_data(group_id, "data", H5T_NATIVE_UINT32, count, nv, vtcs) &&
+			write_data(group_id, "marker", H5T_NATIVE_UINT32, count, 1, markers);
+		delete [] vtcs;
+		delete [] markers;
 	}
 
-	H5Sclose(elem_dataspace_id);
-
-	status = H5Gclose(group_id); // close the group
+	H5Gclose(group_id); // close the group
 
-	return true;
+	return ret;
 }
 
 static bool save_bc(hid_t parent_group_id, Mesh *mesh) {
 	_F_
-	herr_t status;
-
 	// create main group
 	hid_t group_id = H5Gcreate(parent_group_id, "bc", 0);
 
-	// count
-	uint count = mesh->boundaries.count();
-	write_attr(group_id, "count", count);
-
-	// sort out boundaries that are triangular and quadrilateral
-	Array<Word_t> tri, quad;
+	// find the facets of the boundaries (of the base mesh)
+	Word_t nbnds = mesh->boundaries.count();
+	Word_t *bnd_facet = new Word_t[nbnds + 1];
+	for (Word_t i = 0; i <= nbnds; i++)
+		bnd_facet[i] = INVALID_IDX;
 	FOR_ALL_FACETS(fid, mesh) {
 		Facet *facet = mesh->facets.get(fid);
-		if (facet->type == Facet::OUTER) {
-			switch (facet->mode) {
-				case MODE_TRIANGLE: tri.add(fid); break;
-				case MODE_QUAD: quad.add(fid); break;
-			}
+		if (facet->type == Facet::OUTER && facet->parent == INVALID_IDX && facet->right <= nbnds)
+			bnd_facet[facet->right] = fid;
+	}
+
+	// sort out boundaries that are triangular and quadrilateral (keeping their order)
+	Array<Word_t> tri, quad;
+	for (Word_t i = 1; i <= nbnds; i++) {
+		if (bnd_facet[i] == INVALID_IDX) continue;
+		switch (mesh->facets.get(bnd_facet[i])->mode) {
+			case MODE_TRIANGLE: tri.add(bnd_facet[i]); break;
+			case MODE_QUAD: quad.add(bnd_facet[i]); break;
 		}
 	}
+	delete [] bnd_facet;
+
+	// count
+	uint count = tri.count() + quad.count();
+	write_attr(group_id, "count", count);
 
 	bool ret =
-		save_tri_bc(group_id, mesh, tri) &&
-		save_quad_bc(group_id, mesh, quad);
+		save_bnds(group_id, "tri", mesh, tri, Tri::NUM_VERTICES) &&
+		save_bnds(group_id, "quad", mesh, quad, Quad::NUM_VERTICES);
 
-	status = H5Gclose(group_id); // close the group
+	H5Gclose(group_id); // close the group
 
 	return ret;
 }
@@ -727,6 +830,10 @@ bool HDF5Reader::save(const char *file_name, Mesh *mesh) {
 
 	// create a file
 	hid_t file_id = H5Fcreate(file_name, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+	if (file_id < 0) {
+		H5close();
+		return false;
+	}
 
 	// create main group
 	hid_t mesh_group_id = H5Gcreate(file_id, "/mesh3d", 0);
@@ -735,7 +842,7 @@ bool HDF5Reader::save(const char *file_name, Mesh *mesh) {
 	hsize_t dims = 2;
 	hid_t dataspace_id = H5Screate_simple(1, &dims, NULL);
 	hid_t attr_ver = H5Acreate(mesh_group_id, "version", H5T_STD_I8BE, dataspace_id, H5P_DEFAULT);
-	char attr_data[2] = { 1, 0 };
+	char attr_data[2] = { VERSION_1_1 >> 8, VERSION_1_1 & 0xff };
 	status = H5Awrite(attr_ver, H5T_NATIVE_CHAR, attr_data);
 	H5Aclose(attr_ver);
 	H5Sclose(dataspace_id);
@@ -37,6 +37,10 @@ public:
 
 	// Mesh attributes
 	char *description;					// description of the mesh
+
+	/// Read the next chunk of a dataset on a second thread while the mesh is
+	/// being built from the current one (default: false)
+	bool async_read;
 };
 
 #endif
@@ -28,6 +28,9 @@
 #include "refmap.h"
 #include "determinant.h"
 
+#include <algorithm>
+#include <vector>
+
 const int TOP_LEVEL_REF = -1;
 
 // to print out the banner
@@ -58,10 +61,6 @@ Vertex::Vertex(const Vertex &o) {
 Vertex::~Vertex() {
 }
 
-Vertex *Vertex::copy() {
-	return new Vertex(*this);
-}
-
 void Vertex::dump() {
 	printf("(x = %lf, y = %lf, z = %lf)\n", x, y, z);
 }
@@ -116,27 +115,6 @@ Facet::~Facet() {
 	_F_
 }
 
-Facet *Facet::copy() {
-	_F_
-	return new Facet(*this);
-}
-
-Facet *Facet::copy_base() {
-	_F_
-	Facet *copy = new Facet(mode);
-	MEM_CHECK(copy);
-
-	copy->lactive = true;
-	copy->ractive = true;
-	copy->type = type;
-	copy->left = left;
-	copy->right = right;
-	copy->left_face_num = left_face_num;
-	copy->right_face_num = right_face_num;
-
-	return copy;
-}
-
 bool Facet::ced(Word_t idx, int iface)
 {
 	return type == Facet::INNER &&
@@ -324,24 +302,6 @@ int Hex::get_face_orientation(int face_num) const {
 	else return -1;
 }
 
-Element *Hex::copy() {
-	_F_
-	return new Hex(*this);
-}
-
-Element *Hex::copy_base() {
-	_F_
-#ifdef WITH_HEX
-	Hex *copy = new Hex(vtcs);
-	MEM_CHECK(copy);
-	copy->id = id;
-
-	return copy;
-#else
-	return NULL;
-#endif
-}
-
 void Hex::ref_all_nodes() {
 }
 
@@ -472,24 +432,6 @@ int Tetra::get_face_orientation(int face_num) const {
 	else return -1;
 }
 
-Element *Tetra::copy() {
-	_F_
-	return new Tetra(*this);
-}
-
-Element *Tetra::copy_base() {
-	_F_
-#ifdef WITH_TETRA
-	Tetra *copy = new Tetra();
-	for (int i = 0; i < NUM_VERTICES; i++)
-		copy->vtcs[i] = vtcs[i];
-
-	return copy;
-#else
-	return NULL;
-#endif
-}
-
 void Tetra::ref_all_nodes() {
 }
 
@@ -619,24 +561,6 @@ int Prism::get_face_orientation(int face_num) const {
 	return -1;
 }
 
-Element *Prism::copy() {
-	_F_
-	return new Prism(*this);
-}
-
-Element *Prism::copy_base() {
-	_F_
-#ifdef WITH_PRISM
-	Prism *copy = new Prism();
-	for (int i = 0; i < NUM_VERTICES; i++)
-		copy->vtcs[i] = vtcs[i];
-
-	return copy;
-#else
-	return NULL;
-#endif
-}
-
 void Prism::ref_all_nodes() {
 }
 
@@ -732,8 +656,10 @@ Mesh::~Mesh() {
 
 void Mesh::free() {
 	_F_
+	// vertices, elements and facets live in the pools, so they are only destructed here
+	// and their memory is released in bulk below
 	for (Word_t i = vertices.first(); i != INVALID_IDX; i = vertices.next(i))
-		delete vertices[i];
+		vertices[i]->~Vertex();
 	vertices.remove_all();
 
 	for (Word_t i = boundaries.first(); i != INVALID_IDX; i = boundaries.next(i))
@@ -741,13 +667,19 @@ void Mesh::free() {
 	boundaries.remove_all();
 
 	for (Word_t i = elements.first(); i != INVALID_IDX; i = elements.next(i))
-		delete elements[i];
+		elements[i]->~Element();
 	elements.remove_all();
 
 	for (Word_t i = facets.first(); i != INVALID_IDX; i = facets.next(i))
-		delete facets.get(i);
+		facets.get(i)->~Facet();
 	facets.remove_all();
 
+	vertex_pool.free_all();
+	tetra_pool.free_all();
+	hex_pool.free_all();
+	prism_pool.free_all();
+	facet_pool.free_all();
+
 	midpoints.remove_all();
 	edges.remove_all();
 }
@@ -759,7 +691,7 @@ void Mesh::copy(const Mesh &mesh) {
 
 	// copy vertices
 	for (Word_t i = mesh.vertices.first(); i != INVALID_IDX; i = mesh.vertices.next(i))
-		this->vertices.set(i, mesh.vertices[i]->copy());
+		this->vertices.set(i, new (vertex_pool.alloc()) Vertex(*mesh.vertices[i]));
 
 	// copy boundaries
 	for (Word_t i = mesh.boundaries.first(); i != INVALID_IDX; i = mesh.boundaries.next(i))
@@ -768,7 +700,7 @@ void Mesh::copy(const Mesh &mesh) {
 	// copy elements, facets and edges
 	for (Word_t i = mesh.elements.first(); i != INVALID_IDX; i = mesh.elements.next(i)) {
 		Element *e = mesh.elements[i];
-		this->elements.set(i, e->copy());
+		this->elements.set(i, copy_element(e, false));
 
 		// copy mid points on edges and edges
 		Word_t emp[e->get_num_edges()];
@@ -823,12 +755,12 @@ void Mesh::copy(const Mesh &mesh) {
 		if (facet->left != INVALID_IDX) {
 			Element *left_e = mesh.elements[facet->left];
 			int nvtcs = left_e->get_face_vertices(facet->left_face_num, face_idxs);
-			this->facets.set(face_idxs + 0, nvtcs, facet->copy());
+			this->facets.set(face_idxs + 0, nvtcs, copy_facet(facet, false));
 		}
 		else if (facet->right != INVALID_IDX && facet->type == Facet::INNER) {
 			Element *right_e = mesh.elements[facet->right];
 			int nvtcs = right_e->get_face_vertices(facet->right_face_num, face_idxs);
-			this->facets.set(face_idxs + 0, nvtcs, facet->copy());
+			this->facets.set(face_idxs + 0, nvtcs, copy_facet(facet, false));
 		}
 		else
 			EXIT("WTF?");		// FIXME
@@ -852,7 +784,7 @@ void Mesh::copy_base(const Mesh &mesh) {
 		for (int iv = 0; iv < e->get_num_vertices(); iv++) {
 			Word_t vtx = e->get_vertex(iv);
 			if (!this->vertices.exists(vtx))
-				this->vertices.set(vtx, mesh.vertices[vtx]->copy());
+				this->vertices.set(vtx, new (vertex_pool.alloc()) Vertex(*mesh.vertices[vtx]));
 		}
 
 		// edges
@@ -874,7 +806,7 @@ void Mesh::copy_base(const Mesh &mesh) {
 			if (mesh.facets.lookup(face_idxs + 0, nvts, facet)) {
 				if (!this->facets.lookup(face_idxs + 0, nvts, facet)) {
 					// insert the facet
-					Facet *fcopy = facet->copy_base();
+					Facet *fcopy = copy_facet(facet, true);
 					fcopy->left = eid;
 					this->facets.set(face_idxs + 0, nvts, fcopy);
 
@@ -891,13 +823,60 @@ void Mesh::copy_base(const Mesh &mesh) {
 			}
 		}
 
-		this->elements.set(eid, e->copy_base());
+		this->elements.set(eid, copy_element(e, true));
 	}
 
 	this->nbase = this->nactive = mesh.nbase;
 	this->seq = g_mesh_seq++;
 }
 
+Element *Mesh::copy_element(Element *e, bool base) {
+	_F_
+	Word_t vtcs[Hex::NUM_VERTICES]; // hex is the element with the largest number of vertices
+	Element *copy = NULL;
+	switch (e->get_mode()) {
+		case MODE_TETRAHEDRON:
+			if (!base) return new (tetra_pool.alloc()) Tetra(*(Tetra *) e);
+			e->get_vertices(vtcs);
+			copy = new (tetra_pool.alloc()) Tetra(vtcs);
+			break;
+
+		case MODE_HEXAHEDRON:
+			if (!base) return new (hex_pool.alloc()) Hex(*(Hex *) e);
+			e->get_vertices(vtcs);
+			copy = new (hex_pool.alloc()) Hex(vtcs);
+			break;
+
+		case MODE_PRISM:
+			if (!base) return new (prism_pool.alloc()) Prism(*(Prism *) e);
+			e->get_vertices(vtcs);
+			copy = new (prism_pool.alloc()) Prism(vtcs);
+			break;
+
+		default:
+			EXIT(H3D_ERR_UNKNOWN_MODE);
+	}
+	copy->id = e->id;
+
+	return copy;
+}
+
+Facet *Mesh::copy_facet(Facet *facet, bool base) {
+	_F_
+	if (!base) return new (facet_pool.alloc()) Facet(*facet);
+
+	Facet *copy = new (facet_pool.alloc()) Facet(facet->mode);
+	copy->lactive = true;
+	copy->ractive = true;
+	copy->type = facet->type;
+	copy->left = facet->left;
+	copy->right = facet->right;
+	copy->left_face_num = facet->left_face_num;
+	copy->right_face_num = facet->right_face_num;
+
+	return copy;
+}
+
 Word_t Mesh::get_facet_id(Element *e, int face_num) const {
 	_F_
 	assert(e != NULL);
@@ -948,13 +927,13 @@ void Mesh::dump() {
 Word_t Mesh::add_vertex(double x, double y, double z) {
 	_F_
 	Word_t idx = vertices.count() + 1;
-	vertices.set(idx, new Vertex(x, y, z));
+	vertices.set(idx, new (vertex_pool.alloc()) Vertex(x, y, z));
 	return idx;
 }
 
 Tetra *Mesh::create_tetra(Word_t vtcs[]) {
 	_F_
-	Tetra *tetra = new Tetra(vtcs);
+	Tetra *tetra = new (tetra_pool.alloc()) Tetra(vtcs);
 	MEM_CHECK(tetra);
 	Word_t id = elements.count() + 1;
 	elements.set(id, tetra);
@@ -982,7 +961,7 @@ Tetra *Mesh::add_tetra(Word_t vtcs[]) {
 			facet->set_right_info(tetra->id, i);
 		}
 		else {
-			facet = new Facet(RefTetra::get_face_mode(i));
+			facet = new (facet_pool.alloc()) Facet(RefTetra::get_face_mode(i));
 			facet->set_left_info(tetra->id, i);
 			facets.set(facet_idxs + 0, nvtcs, facet);
 		}
@@ -994,7 +973,7 @@ Tetra *Mesh::add_tetra(Word_t vtcs[]) {
 Hex *Mesh::create_hex(Word_t vtcs[]) {
 	_F_
 	// build up the element
-	Hex *hex = new Hex(vtcs);
+	Hex *hex = new (hex_pool.alloc()) Hex(vtcs);
 	MEM_CHECK(hex);
 	Word_t id = elements.count() + 1;
 	elements.set(id, hex);
@@ -1022,7 +1001,7 @@ Hex *Mesh::add_hex(Word_t vtcs[]) {
 			facet->set_right_info(hex->id, i);
 		}
 		else {
-			Facet *fct = new Facet(MODE_QUAD);
+			Facet *fct = new (facet_pool.alloc()) Facet(MODE_QUAD);
 			MEM_CHECK(fct);
 			fct->set_left_info(hex->id, i);
 			facets.set(facet_idxs + 0, nvtcs, fct);
@@ -1034,7 +1013,7 @@ Hex *Mesh::add_hex(Word_t vtcs[]) {
 
 Prism *Mesh::create_prism(Word_t vtcs[]) {
 	_F_
-	Prism *prism = new Prism(vtcs);
+	Prism *prism = new (prism_pool.alloc()) Prism(vtcs);
 	MEM_CHECK(prism);
 	Word_t id = elements.count() + 1;
 	elements.set(id, prism);
@@ -1062,7 +1041,7 @@ Prism *Mesh::add_prism(Word_t vtcs[]) {
 			facet->set_right_info(prism->id, i);
 		}
 		else {
-			facet = new Facet(RefPrism::get_face_mode(i));
+			facet = new (facet_pool.alloc()) Facet(RefPrism::get_face_mode(i));
 			MEM_CHECK(facet);
 			facet->set_left_info(prism->id, i);
 			facets.set(facet_idxs + 0, nvtcs, facet);
@@ -1137,6 +1116,125 @@ void Mesh::ugh()
 	check_elem_oris();
 }
 
+// Bulk construction //
+
+// an edge of an element (sorted vertices) together with the order in which it was met
+struct EdgeRec {
+	Word_t vtx[Edge::NUM_VERTICES];
+	Word_t occ;
+	unsigned ref;
+
+	bool operator<(const EdgeRec &o) const {
+		if (vtx[0] != o.vtx[0]) return vtx[0] < o.vtx[0];
+		if (vtx[1] != o.vtx[1]) return vtx[1] < o.vtx[1];
+		return occ < o.occ;
+	}
+	bool same_key(const EdgeRec &o) const { return vtx[0] == o.vtx[0] && vtx[1] == o.vtx[1]; }
+};
+
+// a face of an element (sorted vertices, unused ones are zero)
+struct FaceRec {
+	Word_t vtx[Quad::NUM_VERTICES];
+	Word_t occ;
+	Word_t elem_id;
+	int face_num;
+	int nvtcs;
+	Facet *facet;
+
+	bool operator<(const FaceRec &o) const {
+		for (int i = 0; i < Quad::NUM_VERTICES; i++)
+			if (vtx[i] != o.vtx[i]) return vtx[i] < o.vtx[i];
+		return occ < o.occ;
+	}
+	bool same_key(const FaceRec &o) const {
+		return vtx[0] == o.vtx[0] && vtx[1] == o.vtx[1] && vtx[2] == o.vtx[2] && vtx[3] == o.vtx[3];
+	}
+};
+
+template<typename REC>
+static bool by_occurrence(const REC &a, const REC &b) {
+	return a.occ < b.occ;
+}
+
+static EMode2D get_face_mode(Element *e, int iface) {
+	switch (e->get_mode()) {
+		case MODE_TETRAHEDRON: return RefTetra::get_face_mode(iface);
+		case MODE_PRISM: return RefPrism::get_face_mode(iface);
+		default: return MODE_QUAD;
+	}
+}
+
+void Mesh::build_base_maps() {
+	_F_
+	// collect edges and faces of all elements
+	std::vector<EdgeRec> erec;
+	std::vector<FaceRec> frec;
+	erec.reserve(elements.count() * Hex::NUM_EDGES);
+	frec.reserve(elements.count() * Hex::NUM_FACES);
+	FOR_ALL_ELEMENTS(eid, this) {
+		Element *e = elements[eid];
+		for (int iedge = 0; iedge < e->get_num_edges(); iedge++) {
+			EdgeRec r;
+			e->get_edge_vertices(iedge, r.vtx);
+			sort_key(r.vtx, Edge::NUM_VERTICES);
+			r.occ = erec.size();
+			erec.push_back(r);
+		}
+		for (int iface = 0; iface < e->get_num_faces(); iface++) {
+			FaceRec r;
+			memset(r.vtx, 0, sizeof(r.vtx));
+			r.nvtcs = e->get_face_vertices(iface, r.vtx);
+			sort_key(r.vtx, r.nvtcs);
+			r.occ = frec.size();
+			r.elem_id = eid;
+			r.face_num = iface;
+			frec.push_back(r);
+		}
+	}
+
+	// edges: after sorting, all occurrences of an edge form one run
+	std::sort(erec.begin(), erec.end());
+	Word_t n = 0;
+	for (Word_t i = 0, j; i < erec.size(); i = j) {
+		for (j = i + 1; j < erec.size() && erec[j].same_key(erec[i]); j++)
+			;
+		erec[n] = erec[i];
+		erec[n].ref = j - i;
+		n++;
+	}
+	erec.resize(n);
+
+	// faces: the first occurrence is on the left, the next one on the right
+	std::sort(frec.begin(), frec.end());
+	n = 0;
+	for (Word_t i = 0, j; i < frec.size(); i = j) {
+		Facet *facet = new (facet_pool.alloc()) Facet(get_face_mode(elements[frec[i].elem_id], frec[i].face_num));
+		MEM_CHECK(facet);
+		facet->set_left_info(frec[i].elem_id, frec[i].face_num);
+		for (j = i + 1; j < frec.size() && frec[j].same_key(frec[i]); j++) {
+			facet->type = Facet::INNER;
+			facet->set_right_info(frec[j].elem_id, frec[j].face_num);
+		}
+		frec[n] = frec[i];
+		frec[n].facet = facet;
+		n++;
+	}
+	frec.resize(n);
+
+	// insert in the order of the first occurrence, so that the ids are the same as
+	// if the elements were added one by one
+	std::sort(erec.begin(), erec.end(), by_occurrence<EdgeRec>);
+	for (Word_t i = 0; i < erec.size(); i++) {
+		Edge edge;
+		edge.ref = erec[i].ref;
+		edges.set(erec[i].vtx, Edge::NUM_VERTICES, edge);
+	}
+
+	std::sort(frec.begin(), frec.end(), by_occurrence<FaceRec>);
+	for (Word_t i = 0; i < frec.size(); i++)
+		facets.set(frec[i].vtx, frec[i].nvtcs, frec[i].facet);
+}
+
 bool Mesh::is_compatible_quad_refinement(Facet *facet, int reft) const {
 	_F_
 	if (facet->type == Facet::INNER) {
@@ -1405,6 +1503,7 @@ bool Mesh::refine_hex_2(Hex *parent, int refinement) {
 	parent->active = false; // make parent element inactive
 	parent->unref_all_nodes();
 	unref_edges(parent);
+	hex_pool.reserve(2); // keep the sons next to each other in memory
 	for (int i = 0; i < 2; i++) { // add child elements
 		Hex *hex = create_hex(son[i]);
 		parent->sons[i] = hex->id;
@@ -1539,6 +1638,7 @@ bool Mesh::refine_hex_4(Hex *parent, int refinement) {
 	parent->active = false; // make parent element inactive
 	parent->unref_all_nodes();
 	unref_edges(parent);
+	hex_pool.reserve(4); // keep the sons next to each other in memory
 	for (int i = 0; i < 4; i++) { // add child elements
 		Hex *hex = create_hex(son[i]);
 		parent->sons[i] = hex->id;
@@ -1642,6 +1742,7 @@ bool Mesh::refine_hex_8(Hex *parent, int refinement) {
 	parent->active = false; // make parent element inactive
 	parent->unref_all_nodes();
 	unref_edges(parent);
+	hex_pool.reserve(8); // keep the sons next to each other in memory
 	for (int i = 0; i < 8; i++) { // add child elements
 		Hex *hex = create_hex(son[i]);
 		parent->sons[i] = hex->id;
@@ -2054,7 +2155,7 @@ Facet *Mesh::add_quad_facet(Facet::Type type, Word_t left_elem, int left_iface,
 	}
 	else {
 		// create new facet
-		facet = new Facet(MODE_QUAD);
+		facet = new (facet_pool.alloc()) Facet(MODE_QUAD);
 		MEM_CHECK(facet);
 		facet->type = type;
 		facet->set_left_info(left_elem, left_iface);
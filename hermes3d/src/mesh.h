@@ -29,6 +29,7 @@ class MeshLoader;
 #include <common/array.h>
 #include <common/arrayptr.h>
 #include <common/mapord.h>
+#include <common/pool.h>
 
 /// Iterates over all mesh vertex indices.
 ///
@@ -123,8 +124,6 @@ public:
 	Vertex(const Vertex &o);			// copy-constructor
 	virtual ~Vertex();
 
-	virtual Vertex *copy();
-
 	// for debugging
 	void dump();
 
@@ -189,9 +188,6 @@ public:
 	Facet(const Facet &o);
 	virtual ~Facet();
 
-	virtual Facet *copy();
-	virtual Facet *copy_base();
-
 	void set_left_info(Word_t elem_id, int face_num = -1) {
 		this->left = elem_id;
 		this->left_face_num = face_num;
@@ -263,9 +259,6 @@ public:
 	virtual const int *get_face_edges(int face_num) const = 0;
 	virtual int get_face_orientation(int face_num) const = 0;
 
-	virtual Element *copy() = 0;
-	virtual Element *copy_base() = 0;
-
 	// for debugging
 	virtual void dump();
 
@@ -337,9 +330,6 @@ public:
 	virtual const int *get_face_edges(int face_num) const;
 	virtual int get_face_orientation(int face_num) const;
 
-	virtual Element *copy();
-	virtual Element *copy_base();
-
 	virtual void ref_all_nodes();
 	virtual void unref_all_nodes();
 
@@ -398,9 +388,6 @@ public:
 	virtual const int *get_face_edges(int face_num) const;
 	virtual int get_face_orientation(int face_num) const;
 
-	virtual Element *copy();
-	virtual Element *copy_base();
-
 	virtual void ref_all_nodes();
 	virtual void unref_all_nodes();
 
@@ -454,9 +441,6 @@ public:
 	virtual const int *get_face_edges(int face_num) const;
 	virtual int get_face_orientation(int face_num) const;
 
-	virtual Element *copy();
-	virtual Element *copy_base();
-
 	virtual void ref_all_nodes();
 	virtual void unref_all_nodes();
 
@@ -628,6 +612,17 @@ public:
 	Boundary *add_tri_boundary(Word_t vtcs[], int marker);
 	Boundary *add_quad_boundary(Word_t vtcs[], int marker);
 
+	/// Bulk construction of the base mesh (for loaders of large meshes).
+	/// Elements are only created here, the edge and facet maps are built
+	/// afterwards by build_base_maps() in one sorted pass over all elements.
+	Tetra *add_tetra_bulk(Word_t vtcs[]) { return create_tetra(vtcs); }
+	Hex *add_hex_bulk(Word_t vtcs[]) { return create_hex(vtcs); }
+	Prism *add_prism_bulk(Word_t vtcs[]) { return create_prism(vtcs); }
+	/// Builds edges and facets of elements added by add_XXX_bulk(). Ids of
+	/// edges and facets are the same as if add_tetra(), add_hex() and
+	/// add_prism() were used.
+	void build_base_maps();
+
 	void ugh();
 
 	// data
@@ -641,10 +636,22 @@ protected:
 	Word_t nbase;							/// number of base elements
 	Word_t nactive;						/// number of active elements
 
+	// storage of mesh entities (released all at once in free())
+	Pool<Vertex> vertex_pool;
+	Pool<Tetra> tetra_pool;
+	Pool<Hex> hex_pool;
+	Pool<Prism> prism_pool;
+	Pool<Facet> facet_pool;
+
 	Tetra *create_tetra(Word_t vtcs[]);
 	Hex *create_hex(Word_t vtcs[]);
 	Prism *create_prism(Word_t vtcs[]);
 
+	/// Copy an element (or only its base part) into the storage of this mesh
+	Element *copy_element(Element *e, bool base);
+	/// Copy a facet (or only its base part) into the storage of this mesh
+	Facet *copy_facet(Facet *facet, bool base);
+
 	bool can_refine_hex(Hex *elem, int refinement) const;
 
 	/// Apply a refinement to a hex
@@ -714,6 +721,7 @@ protected:
 
 	friend class Space;
 	friend class WeakForm;
+	friend class Checkpoint;
 };
 
 
@@ -20,6 +20,7 @@
 #include "h3dconfig.h"
 #include "common.h"
 #include "shapefn.h"
+#include "shapeset/shapetab.h"
 #include "function.cpp" // non-inline template members
 #include <common/error.h>
 #include <common/callstack.h>
@@ -93,10 +94,23 @@ void ShapeFunction::precalculate(const int np, const QuadPt3D *pt, int mask) {
 	int newmask = mask | oldmask;
 	Node *node = new_node(newmask, np);
 
+	// values of regular shape functions on the whole reference element are shared by everybody
+	int pset = -1;
+	if (index >= 0 &&
+		ctm->m[0] == 1.0 && ctm->m[1] == 1.0 && ctm->m[2] == 1.0 &&
+		ctm->t[0] == 0.0 && ctm->t[1] == 0.0 && ctm->t[2] == 0.0)
+		pset = ShapeTable::get_point_set(np, pt);
+
 	// precalculate all required tables
 	for (int ic = 0; ic < num_components; ic++) {
 		for (int j = 0; j < VALUE_TYPES; j++) {
 			if (newmask & idx2mask[j][ic]) {
+				if (pset >= 0) {
+					const double *vals = ShapeTable::get_values(shapeset, j, index, pset, ic);
+					memcpy(node->values[ic][j], vals, np * sizeof(double));
+					continue;
+				}
+
 				// transform quadrature points
 				QuadPt3D trans_pt[np];
 				for (int k = 0; k < np; k++) {
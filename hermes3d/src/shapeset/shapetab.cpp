@@ -0,0 +1,221 @@
+// This file is part of Hermes3D
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes3D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes3D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes3D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "h3dconfig.h"
+#include "shapetab.h"
+#include <common/trace.h>
+#include <common/error.h>
+#include <common/callstack.h>
+
+Map<ShapeTable::PointSetKey, ShapeTable::PointSet *> ShapeTable::psets;
+Array<ShapeTable::PointSet *> ShapeTable::pset_list;
+Map<ShapeTable::ValueKey, double *> ShapeTable::values;
+int ShapeTable::num_psets = 0;
+Word_t ShapeTable::mem_size = 0;
+ShapeTable::PointSlot ShapeTable::point_slots[POINT_SLOTS];
+ShapeTable::ValueSlot ShapeTable::value_slots[VALUE_SLOTS];
+int ShapeTable::num_point_slots = 0;
+int ShapeTable::num_value_slots = 0;
+
+static unsigned hash_points(int np, const QuadPt3D *pt) {
+	// FNV-1a over the 64-bit words of the points
+	const uint64 *p = (const uint64 *) pt;
+	uint64 h = 14695981039346656037ull;
+	for (size_t i = 0; i < np * sizeof(QuadPt3D) / sizeof(uint64); i++) {
+		h ^= p[i];
+		h *= 1099511628211ull;
+	}
+	return (unsigned) (h ^ (h >> 32));
+}
+
+static unsigned hash_pointer(const void *p) {
+	uint64 h = (uint64) p;
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdull;
+	h ^= h >> 33;
+	return (unsigned) h;
+}
+
+static unsigned hash_value_key(int ss_id, int pset, int index, int n, int component) {
+	uint64 h = ((uint64) (unsigned) index << 32) ^ ((uint64) (unsigned) pset << 12) ^
+		((uint64) ss_id << 8) ^ (n << 4) ^ component;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ull;
+	h ^= h >> 33;
+	return (unsigned) h;
+}
+
+// Lookups in the published arrays are done without the lock: the slots are filled under the
+// lock, the pointer that marks a slot as used is written last (flush, atomic write) and read
+// first (atomic read, flush), so a reader that sees it also sees the rest of the slot and the
+// table (the atomics alone do not order the other memory accesses).
+
+ShapeTable::PointSet *ShapeTable::find_published(int np, const QuadPt3D *pt) {
+	for (unsigned i = hash_pointer(pt) & (POINT_SLOTS - 1);; i = (i + 1) & (POINT_SLOTS - 1)) {
+		PointSet *ps;
+#pragma omp atomic read
+		ps = point_slots[i].ps;
+		if (ps == NULL) return NULL;
+#pragma omp flush
+		// the same address may be reused for other points (e.g. a freed temporary array)
+		if (point_slots[i].pt == pt && ps->np == np && memcmp(ps->pt, pt, np * sizeof(QuadPt3D)) == 0)
+			return ps;
+	}
+}
+
+double *ShapeTable::find_published(const ValueKey &key) {
+	unsigned h = hash_value_key(key.ss_id, key.pset, key.index, key.n, key.component);
+	for (unsigned i = h & (VALUE_SLOTS - 1);; i = (i + 1) & (VALUE_SLOTS - 1)) {
+		double *vals;
+#pragma omp atomic read
+		vals = value_slots[i].vals;
+		if (vals == NULL) return NULL;
+#pragma omp flush
+		if (memcmp(&value_slots[i].key, &key, sizeof(key)) == 0) return vals;
+	}
+}
+
+void ShapeTable::publish(const QuadPt3D *pt, PointSet *ps) {
+	// called under the lock; a full array is not an error, lookups just take the slow path
+	if ((num_point_slots + 1) * 4 > POINT_SLOTS * 3) return;
+	unsigned i = hash_pointer(pt) & (POINT_SLOTS - 1);
+	while (point_slots[i].ps != NULL) {
+		if (point_slots[i].pt == pt) return;		// another point set at the same address
+		i = (i + 1) & (POINT_SLOTS - 1);
+	}
+	point_slots[i].pt = pt;
+#pragma omp flush
+#pragma omp atomic write
+	point_slots[i].ps = ps;
+	num_point_slots++;
+}
+
+void ShapeTable::publish(const ValueKey &key, double *vals) {
+	if ((num_value_slots + 1) * 4 > VALUE_SLOTS * 3) return;
+	unsigned h = hash_value_key(key.ss_id, key.pset, key.index, key.n, key.component);
+	unsigned i = h & (VALUE_SLOTS - 1);
+	while (value_slots[i].vals != NULL)
+		i = (i + 1) & (VALUE_SLOTS - 1);
+	value_slots[i].key = key;
+#pragma omp flush
+#pragma omp atomic write
+	value_slots[i].vals = vals;
+	num_value_slots++;
+}
+
+int ShapeTable::get_point_set(int np, const QuadPt3D *pt) {
+	_F_
+	PointSet *pub = find_published(np, pt);
+	if (pub != NULL) return pub->id;
+
+	PointSetKey key;
+	memset(&key, 0, sizeof(key));
+	key.np = np;
+	key.hash = hash_points(np, pt);
+
+	int id = -1;
+#pragma omp critical (shape_table)
+	{
+		PointSet *first = NULL;
+		psets.lookup(key, first);
+		for (PointSet *ps = first; ps != NULL; ps = ps->next)
+			if (memcmp(ps->pt, pt, np * sizeof(QuadPt3D)) == 0) {
+				id = ps->id;
+				break;
+			}
+
+		if (id == -1) {
+			PointSet *ps = new PointSet;
+			MEM_CHECK(ps);
+			ps->id = id = num_psets++;
+			ps->np = np;
+			ps->pt = new QuadPt3D[np];
+			MEM_CHECK(ps->pt);
+			memcpy(ps->pt, pt, np * sizeof(QuadPt3D));
+			ps->next = first;
+			psets.set(key, ps);
+			pset_list.set(id, ps);
+			mem_size += sizeof(PointSet) + np * sizeof(QuadPt3D);
+		}
+		publish(pt, pset_list[id]);
+	}
+
+	return id;
+}
+
+const double *ShapeTable::get_values(Shapeset *ss, int n, int index, int pset, int component) {
+	_F_
+	assert(index >= 0);
+	double *vals = NULL;
+
+	ValueKey key;
+	memset(&key, 0, sizeof(key));
+	key.ss_id = ss->id;
+	key.pset = pset;
+	key.index = index;
+	key.n = n;
+	key.component = component;
+
+	vals = find_published(key);
+	if (vals != NULL) return vals;
+
+#pragma omp critical (shape_table)
+	{
+		if (!values.lookup(key, vals)) {
+			PointSet *ps = pset_list[pset];
+			vals = new double[ps->np];
+			MEM_CHECK(vals);
+			ss->get_values(n, index, ps->np, ps->pt, component, vals);
+			values.set(key, vals);
+			mem_size += ps->np * sizeof(double);
+			publish(key, vals);
+		}
+	}
+
+	return vals;
+}
+
+void ShapeTable::free() {
+	_F_
+#pragma omp critical (shape_table)
+	{
+		for (Word_t i = values.first(); i != INVALID_IDX; i = values.next(i))
+			delete [] values.get(i);
+		values.remove_all();
+
+		for (Word_t i = pset_list.first(); i != INVALID_IDX; i = pset_list.next(i)) {
+			PointSet *ps = pset_list.get(i);
+			delete [] ps->pt;
+			delete ps;
+		}
+		pset_list.remove_all();
+		psets.remove_all();
+
+		memset(point_slots, 0, sizeof(point_slots));
+		memset(value_slots, 0, sizeof(value_slots));
+		num_point_slots = num_value_slots = 0;
+
+		num_psets = 0;
+		mem_size = 0;
+	}
+}
+
+Word_t ShapeTable::get_mem_size() {
+	return mem_size;
+}
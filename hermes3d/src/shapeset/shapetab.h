@@ -0,0 +1,119 @@
+// This file is part of Hermes3D
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes3D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes3D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes3D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#ifndef _SHAPESET_SHAPETAB_H_
+#define _SHAPESET_SHAPETAB_H_
+
+#include "shapeset.h"
+
+/// Process-wide table of shape function values on the reference element
+///
+/// Values (and derivatives) of a shape function at a set of reference points do not depend on
+/// the element, the space or the problem, so they are evaluated only once and then shared by
+/// all ShapeFunction instances (and threads). Tables are built lazily, i.e. the first request
+/// for a (shapeset, point set) pair evaluates the shapeset, all subsequent ones just return
+/// the stored values. Point sets are identified by their contents, so any set of points
+/// (typically a quadrature of some order) can be used. Stored tables are never modified or
+/// freed until free() is called, so the returned pointers can be held by the callers.
+///
+/// Point sets and tables are created under a lock. Once finished they are published in
+/// fixed-size lookup arrays that are read without the lock, so concurrent lookups of
+/// existing tables do not serialize. A point set is resolved by the address of its points
+/// (checked against the stored copy) and is hashed only when that address is seen first.
+///
+/// Only regular shape functions (index >= 0) can be stored, since the indices of constrained
+/// functions are specific to a shapeset instance.
+///
+/// @ingroup shapesets
+class ShapeTable {
+public:
+	/// Register a set of reference points
+	/// @return id of the point set (the same points always get the same id)
+	/// @param[in] np - the number of points
+	/// @param[in] pt - the points on the reference domain
+	static int get_point_set(int np, const QuadPt3D *pt);
+
+	/// Get values of a shape function at a point set
+	/// @return array of values (owned by the table), one per point of the set
+	/// @param[in] ss - the shapeset
+	/// @param[in] n - the type of values (FN, DX, ...)
+	/// @param[in] index - index of the shape function (>= 0)
+	/// @param[in] pset - the point set (obtained from get_point_set())
+	/// @param[in] component - the component of the shape function
+	static const double *get_values(Shapeset *ss, int n, int index, int pset, int component);
+
+	/// Free all tables (no pointer returned by get_values() can be used after that)
+	static void free();
+
+	/// @return The number of bytes occupied by the tables
+	static Word_t get_mem_size();
+
+protected:
+	/// a set of reference points
+	struct PointSet {
+		int id;
+		int np;
+		QuadPt3D *pt;
+		PointSet *next;							/// next point set with the same hash
+	};
+
+	struct PointSetKey {
+		int np;
+		unsigned hash;
+	};
+
+	struct ValueKey {
+		int ss_id;								/// shapeset id
+		int pset;								/// point set id
+		int index;
+		short n;
+		short component;
+	};
+
+	static Map<PointSetKey, PointSet *> psets;
+	static Array<PointSet *> pset_list;			/// point sets indexed by their id
+	static Map<ValueKey, double *> values;
+	static int num_psets;
+	static Word_t mem_size;
+
+	/// published point sets, indexed by the address of the points passed by the callers
+	struct PointSlot {
+		const QuadPt3D *pt;
+		PointSet *ps;							/// written last, NULL = empty slot
+	};
+
+	/// published tables
+	struct ValueSlot {
+		ValueKey key;
+		double *vals;							/// written last, NULL = empty slot
+	};
+
+	static const int POINT_SLOTS = 1 << 12;
+	static const int VALUE_SLOTS = 1 << 16;
+	static PointSlot point_slots[POINT_SLOTS];
+	static ValueSlot value_slots[VALUE_SLOTS];
+	static int num_point_slots, num_value_slots;
+
+	static PointSet *find_published(int np, const QuadPt3D *pt);
+	static double *find_published(const ValueKey &key);
+	static void publish(const QuadPt3D *pt, PointSet *ps);
+	static void publish(const ValueKey &key, double *vals);
+};
+
+#endif
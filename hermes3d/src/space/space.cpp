@@ -24,6 +24,8 @@
 #include <common/error.h>
 #include <common/timer.h>
 #include <common/callstack.h>
+#include "../../../hermes_common/dof_ordering.h"
+#include <map>
 
 #define PRINTF(...)
 //#define PRINTF printf
@@ -122,6 +124,7 @@ Space::Space(Mesh *mesh, Shapeset *shapeset) :
 	mesh_seq = -1;
 	seq = 0;
 	was_assigned = false;
+	dof_ordering = H3D_DOF_ORDER_NATURAL;
 
 	init_data_tables();
 }
@@ -2191,6 +2194,8 @@ int Space::assign_dofs(int first_dof, int stride) {
 	set_bc_information();
 
 	assign_dofs_internal();
+	dof_perm.clear();
+	if (dof_ordering == H3D_DOF_ORDER_RCM) reorder_dofs();
 	update_constraints();
 
 	mesh_seq = mesh->get_seq();
@@ -2200,6 +2205,59 @@ int Space::assign_dofs(int first_dof, int stride) {
 	return get_dof_count();
 }
 
+void Space::set_dof_ordering(DofOrdering ordering) {
+	_F_
+	if (ordering == dof_ordering) return;
+	dof_ordering = ordering;
+	seq++;
+	if (was_assigned) assign_dofs(first_dof, stride);
+}
+
+// DOF reordering ////
+
+// adds the block of a node to the element being collected
+static void add_dof_block(DofBlockGraph &g, std::map<Word_t, int> &blocks, Word_t id, int *dof, int n) {
+	std::map<Word_t, int>::iterator it = blocks.find(id);
+	if (it == blocks.end()) blocks.insert(std::make_pair(id, g.add_block(dof, n)));
+	else g.add_block(it->second);
+}
+
+void Space::reorder_dofs() {
+	_F_
+	// collect the DOF blocks and the blocks of every element
+	DofBlockGraph g;
+	std::map<Word_t, int> vtx_blocks, edge_blocks, face_blocks;
+
+	FOR_ALL_ACTIVE_ELEMENTS(idx, mesh) {
+		Element *e = mesh->elements[idx];
+		for (int ivtx = 0; ivtx < e->get_num_vertices(); ivtx++) {
+			Word_t vid = e->get_vertex(ivtx);
+			VertexData *vd = vn_data[vid];
+			if (vd != NULL && !vd->ced && vd->dof >= 0 && vd->n > 0)
+				add_dof_block(g, vtx_blocks, vid, &vd->dof, vd->n);
+		}
+		for (int iedge = 0; iedge < e->get_num_edges(); iedge++) {
+			Word_t eid = mesh->get_edge_id(e, iedge);
+			EdgeData *ed = en_data[eid];
+			if (ed != NULL && !ed->ced && ed->dof >= 0 && ed->n > 0)
+				add_dof_block(g, edge_blocks, eid, &ed->dof, ed->n);
+		}
+		for (int iface = 0; iface < e->get_num_faces(); iface++) {
+			Word_t fid = mesh->get_facet_id(e, iface);
+			FaceData *fd = fn_data[fid];
+			if (fd != NULL && !fd->ced && fd->dof >= 0 && fd->n > 0)
+				add_dof_block(g, face_blocks, fid, &fd->dof, fd->n);
+		}
+		ElementData *enode = elm_data[idx];
+		if (enode != NULL && enode->dof >= 0 && enode->n > 0)
+			g.add_block(&enode->dof, enode->n);
+		g.end_element();
+	}
+
+	if (!rcm_renumber_dof_blocks(g, first_dof, stride, get_dof_count(), dof_perm))
+		warning("Unexpected DOF structure of the space, the DOFs were not reordered.");
+}
+
 
 void Space::uc_dep(Word_t eid)
 {
@@ -2344,6 +2402,7 @@ void Space::copy_callbacks(const Space *space) {
 	bc_type_callback = space->bc_type_callback;
 	bc_value_callback_by_coord = space->bc_value_callback_by_coord;
 	bc_vec_value_callback_by_coord = space->bc_vec_value_callback_by_coord;
+	dof_ordering = space->dof_ordering;
 }
 
 void Space::calc_boundary_projections() {
@@ -65,6 +65,14 @@ enum BCType
 };
 
 
+/// Numberings of the DOFs (see Space::set_dof_ordering()):
+enum DofOrdering
+{
+  H3D_DOF_ORDER_NATURAL, /// In the order of the elements (the default).
+  H3D_DOF_ORDER_RCM      /// Reverse Cuthill-McKee, reduces the bandwidth of the matrix.
+};
+
+
 #define H3D_MARKER_UNDEFINED				-1
 
 #define H3D_DOF_UNASSIGNED					-2
@@ -100,6 +108,17 @@ public:
 	int get_dof_count() const { return (next_dof - first_dof) / stride; }
 	int get_max_dof() const { return next_dof - stride; }
 
+	/// Selects the numbering of the DOFs by assign_dofs(). With H3D_DOF_ORDER_RCM, the blocks
+	/// of DOFs of one vertex, edge, face or element interior are renumbered by the reverse
+	/// Cuthill-McKee algorithm on the graph of blocks sharing an element, which reduces the
+	/// bandwidth of the matrix and the fill-in of direct solvers.
+	/// Calls assign_dofs() if the DOFs have already been assigned.
+	void set_dof_ordering(DofOrdering ordering);
+	DofOrdering get_dof_ordering() const { return dof_ordering; }
+	/// The basis function numbered first_dof + i * stride in the natural ordering got the
+	/// number first_dof + perm[i] * stride. Empty if the DOFs were not reordered.
+	const std::vector<int> &get_dof_permutation() const { return dof_perm; }
+
 	Shapeset *get_shapeset() const { return shapeset; }
 	Mesh *get_mesh() const { return mesh; }
 
@@ -122,6 +141,10 @@ protected:
 	int seq, mesh_seq;
 	bool was_assigned;
 
+	DofOrdering dof_ordering;
+	std::vector<int> dof_perm;
+	void reorder_dofs();
+
 	// CED
 	struct BaseVertexComponent {
 		int dof;
@@ -391,6 +414,7 @@ protected:
 
 	friend class DiscreteProblem;
 	friend class LinearProblem;
+	friend class Checkpoint;
 };
 
 
@@ -0,0 +1,190 @@
+// This file is part of Hermes3D
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes3D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes3D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes3D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+/*
+ * checkpoint/main.cpp
+ *
+ * usage: $0 <mesh file> <checkpoint file> <element id> <refinement id> [<element id> <refinement id>...]
+ *
+ * Refines the mesh, builds a space on it and saves a checkpoint. Then restores
+ * the mesh and the space from it and checks that they are the same as the
+ * original ones.
+ */
+
+#include "config.h"
+#include <hermes3d.h>
+#include <common/trace.h>
+#include <common/error.h>
+
+#define ERROR_SUCCESS								0
+#define ERROR_FAILURE								-1
+
+BCType bc_types(int marker) {
+	return marker == 1 ? BC_ESSENTIAL : BC_NATURAL;
+}
+
+scalar essential_bc_values(int ess_bdy_marker, double x, double y, double z) {
+	return x * x + y * y + z * z;
+}
+
+bool same_meshes(Mesh *a, Mesh *b) {
+	_F_
+	if (a->vertices.count() != b->vertices.count()) return false;
+	FOR_ALL_VERTICES(idx, a) {
+		Vertex *va = a->vertices[idx], *vb = b->vertices[idx];
+		if (va->x != vb->x || va->y != vb->y || va->z != vb->z) return false;
+	}
+
+	if (a->elements.count() != b->elements.count()) return false;
+	FOR_ALL_ELEMENTS(idx, a) {
+		Element *ea = a->elements[idx], *eb = b->elements[idx];
+		if (ea->active != eb->active || ea->marker != eb->marker || ea->get_mode() != eb->get_mode()) return false;
+		for (int i = 0; i < ea->get_num_vertices(); i++)
+			if (ea->get_vertex(i) != eb->get_vertex(i)) return false;
+	}
+
+	if (a->facets.count() != b->facets.count() || a->edges.count() != b->edges.count()) return false;
+	FOR_ALL_FACETS(idx, a) {
+		Facet *fa = a->facets[idx], *fb = b->facets[idx];
+		if (fa->type != fb->type || fa->left != fb->left || fa->right != fb->right) return false;
+	}
+
+	return true;
+}
+
+bool same_asm_lists(AsmList *a, AsmList *b) {
+	if (a->cnt != b->cnt) return false;
+	for (int i = 0; i < a->cnt; i++) {
+		// indices of constrained functions are assigned by the shapeset on the fly, so we only
+		// check that both lists refer to a constrained function there
+		if (a->idx[i] >= 0 ? a->idx[i] != b->idx[i] : b->idx[i] >= 0) return false;
+		if (a->dof[i] != b->dof[i] || a->coef[i] != b->coef[i]) return false;
+	}
+	return true;
+}
+
+bool same_spaces(Space *a, Space *b) {
+	_F_
+	if (a->get_dof_count() != b->get_dof_count()) return false;
+
+	FOR_ALL_ACTIVE_ELEMENTS(idx, a->get_mesh()) {
+		Element *ea = a->get_mesh()->elements[idx];
+		Element *eb = b->get_mesh()->elements[idx];
+		if (a->get_element_order(idx) != b->get_element_order(idx)) return false;
+
+		AsmList ala, alb;
+		a->get_element_assembly_list(ea, &ala);
+		b->get_element_assembly_list(eb, &alb);
+		if (!same_asm_lists(&ala, &alb)) return false;
+
+		for (int iface = 0; iface < ea->get_num_faces(); iface++) {
+			AsmList fala, falb;
+			a->get_boundary_assembly_list(ea, iface, &fala);
+			b->get_boundary_assembly_list(eb, iface, &falb);
+			if (!same_asm_lists(&fala, &falb)) return false;
+		}
+	}
+
+	return true;
+}
+
+int main(int argc, char **args)
+{
+	_F_
+	int res = ERROR_SUCCESS;
+	set_verbose(false);
+
+	if (argc < 3) error("Not enough parameters");
+
+	Mesh mesh;
+	Mesh3DReader mloader;
+	if (!mloader.load(args[1], &mesh)) error("Loading mesh file '%s'\n", args[1]);
+
+	for (int i = 3; i + 1 < argc; i += 2) {
+		int elem_id, reft_id;
+		sscanf(args[i], "%d", &elem_id);
+		sscanf(args[i + 1], "%d", &reft_id);
+		if (!mesh.refine_element(elem_id, reft_id)) error("Unable to refine element #%d\n", elem_id);
+	}
+
+	H1ShapesetLobattoHex shapeset;
+	H1Space space(&mesh, &shapeset);
+	space.set_bc_types(bc_types);
+	space.set_essential_bc_values(essential_bc_values);
+	space.set_uniform_order(order3_t(2, 3, 4));
+	int ndofs = space.assign_dofs();
+
+	scalar *vec = new scalar[ndofs];
+	for (int i = 0; i < ndofs; i++)
+		vec[i] = 0.5 * i;
+
+	Checkpoint chkpt;
+	if (!chkpt.save(args[2], &space, vec)) error("Unable to save checkpoint '%s'\n", args[2]);
+
+	// restart
+	Mesh mesh2;
+	if (!chkpt.load_mesh(args[2], &mesh2)) error("Unable to load mesh from checkpoint '%s'\n", args[2]);
+
+	H1Space space2(&mesh2, &shapeset);
+	space2.set_bc_types(bc_types);
+	space2.set_essential_bc_values(essential_bc_values);
+	scalar *vec2;
+	if (!chkpt.load_space(args[2], &space2, vec2)) error("Unable to load space from checkpoint '%s'\n", args[2]);
+
+	if (!same_meshes(&mesh, &mesh2)) {
+		printf("meshes differ\n");
+		res = ERROR_FAILURE;
+	}
+	if (!space2.is_up_to_date() || !same_spaces(&space, &space2)) {
+		printf("spaces differ\n");
+		res = ERROR_FAILURE;
+	}
+	if (vec2 == NULL || memcmp(vec, vec2, ndofs * sizeof(scalar)) != 0) {
+		printf("vectors differ\n");
+		res = ERROR_FAILURE;
+	}
+
+	// a checkpoint of another mesh is refused and the space is left as it was
+	if (argc > 3) {
+		Mesh mesh3;
+		if (!mloader.load(args[1], &mesh3)) error("Loading mesh file '%s'\n", args[1]);
+		H1Space space3(&mesh3, &shapeset);
+		space3.set_bc_types(bc_types);
+		space3.set_essential_bc_values(essential_bc_values);
+		space3.set_uniform_order(order3_t(2, 3, 4));
+		int ndofs3 = space3.assign_dofs();
+		scalar *vec3;
+		if (chkpt.load_space(args[2], &space3, vec3) || vec3 != NULL) {
+			printf("checkpoint of another mesh was loaded\n");
+			res = ERROR_FAILURE;
+		}
+		if (!space3.is_up_to_date() || space3.get_dof_count() != ndofs3) {
+			printf("space changed by a refused checkpoint\n");
+			res = ERROR_FAILURE;
+		}
+	}
+
+	delete [] vec;
+	delete [] vec2;
+
+	if (res == ERROR_SUCCESS) printf("Success!\n");
+	else printf("Failed\n");
+
+	return res;
+}
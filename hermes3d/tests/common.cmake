@@ -58,6 +58,7 @@ endif(WITH_TRILINOS)
 if(WITH_HDF5)
 	set(TESTS_INCLUDE_DIRS ${TESTS_INCLUDE_DIRS} ${HDF5_INCLUDE_DIR})
 	set(TESTS_LIBRARIES ${TESTS_LIBRARIES} ${HDF5_LIBRARY})
+	set(TESTS_LIBRARIES ${TESTS_LIBRARIES} ${CMAKE_THREAD_LIBS_INIT})
 
 #	# ZLIB
 #	set(TESTS_LIBRARIES ${TESTS_LIBRARIES} ${ZLIB_LIBRARY})
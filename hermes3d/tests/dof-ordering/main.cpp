@@ -0,0 +1,226 @@
+// This file is part of Hermes3D
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes3D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes3D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes3D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+/*
+ * dof-ordering/main.cpp
+ *
+ * usage: $0 <mesh file> [<element id> <refinement id>...]
+ *
+ * Refines the mesh and builds a space on it with the natural and the reverse
+ * Cuthill-McKee numbering of the DOFs (see Space::set_dof_ordering()). Checks
+ * that the latter is a permutation of the former which reduces the bandwidth,
+ * and that both give the same matrix and right-hand side up to the permutation.
+ */
+
+#include "config.h"
+#include <hermes3d.h>
+#include <common/trace.h>
+#include <common/error.h>
+#include <map>
+
+#define ERROR_SUCCESS								0
+#define ERROR_FAILURE								-1
+
+// stores the assembled entries, so that the two numberings can be compared
+class MapMatrix : public SparseMatrix {
+public:
+	std::map<std::pair<int, int>, scalar> m;
+
+	virtual void alloc() { }
+	virtual void free() { }
+	virtual scalar get(int r, int c) { return m[std::make_pair(r, c)]; }
+	virtual int get_size() { return size; }
+	virtual void zero() { m.clear(); }
+	virtual void add(int r, int c, scalar v) { if (r >= 0 && c >= 0) m[std::make_pair(r, c)] += v; }
+	virtual void add(int n, int k, scalar **mat, int *rows, int *cols) {
+		for (int i = 0; i < n; i++)
+			for (int j = 0; j < k; j++)
+				add(rows[i], cols[j], mat[i][j]);
+	}
+	virtual bool dump(FILE *, const char *, EMatrixDumpFormat) { return true; }
+	virtual int get_matrix_size() const { return 0; }
+	virtual double get_fill_in() const { return 0; }
+};
+
+class MapVector : public Vector {
+public:
+	std::map<int, scalar> v;
+
+	virtual void alloc(int n) { }
+	virtual void free() { }
+	virtual scalar get(int i) { return v[i]; }
+	virtual void extract(scalar *) const { }
+	virtual void zero() { v.clear(); }
+	virtual void set(int i, scalar y) { v[i] = y; }
+	virtual void add(int i, scalar y) { if (i >= 0) v[i] += y; }
+	virtual void add(int n, int *idx, scalar *y) { for (int i = 0; i < n; i++) add(idx[i], y[i]); }
+	virtual bool dump(FILE *, const char *, EMatrixDumpFormat) { return true; }
+};
+
+BCType bc_types(int marker) {
+	return marker == 1 ? BC_ESSENTIAL : BC_NATURAL;
+}
+
+scalar essential_bc_values(int ess_bdy_marker, double x, double y, double z) {
+	return x * x + y * y + z * z;
+}
+
+template<typename T>
+T f(T x, T y, T z) {
+	return x * y + z;
+}
+
+template<typename f_t, typename res_t>
+res_t bilinear_form(int n, double *wt, fn_t<res_t> *u_ext[], fn_t<f_t> *u, fn_t<f_t> *v, geom_t<f_t> *e,
+                    user_data_t<res_t> *data)
+{
+	return int_grad_u_grad_v<f_t, res_t>(n, wt, u, v, e) + int_u_v<f_t, res_t>(n, wt, u, v, e);
+}
+
+template<typename f_t, typename res_t>
+res_t linear_form(int n, double *wt, fn_t<res_t> *u_ext[], fn_t<f_t> *v, geom_t<f_t> *e, user_data_t<res_t> *data)
+{
+	return int_F_v<f_t, res_t>(n, wt, f, v, e);
+}
+
+// the largest distance of two DOFs sharing an element
+int bandwidth(Space *space) {
+	_F_
+	int bw = 0;
+	FOR_ALL_ACTIVE_ELEMENTS(idx, space->get_mesh()) {
+		AsmList al;
+		space->get_element_assembly_list(space->get_mesh()->elements[idx], &al);
+		for (int i = 0; i < al.cnt; i++)
+			for (int j = 0; j < al.cnt; j++)
+				if (al.dof[i] >= 0 && al.dof[j] >= 0)
+					bw = std::max(bw, abs(al.dof[i] - al.dof[j]));
+	}
+	return bw;
+}
+
+void assemble(Space *space, MapMatrix *mat, MapVector *rhs) {
+	_F_
+	WeakForm wf;
+	wf.add_matrix_form(bilinear_form<double, scalar>, bilinear_form<ord_t, ord_t>, SYM);
+	wf.add_vector_form(linear_form<double, scalar>, linear_form<ord_t, ord_t>);
+
+	LinearProblem lp(&wf, space);
+	lp.assemble(mat, rhs);
+}
+
+int main(int argc, char **args)
+{
+	_F_
+	int res = ERROR_SUCCESS;
+	set_verbose(false);
+
+	if (argc < 2) error("Not enough parameters");
+
+	Mesh mesh;
+	Mesh3DReader mloader;
+	if (!mloader.load(args[1], &mesh)) error("Loading mesh file '%s'\n", args[1]);
+
+	for (int i = 2; i + 1 < argc; i += 2) {
+		int elem_id, reft_id;
+		sscanf(args[i], "%d", &elem_id);
+		sscanf(args[i + 1], "%d", &reft_id);
+		if (!mesh.refine_element(elem_id, reft_id)) error("Unable to refine element #%d\n", elem_id);
+	}
+
+	H1ShapesetLobattoHex shapeset;
+
+	// natural numbering
+	H1Space space1(&mesh, &shapeset);
+	space1.set_bc_types(bc_types);
+	space1.set_essential_bc_values(essential_bc_values);
+	space1.set_uniform_order(order3_t(2, 3, 4));
+	int ndofs = space1.assign_dofs();
+	int bw1 = bandwidth(&space1);
+	if (!space1.get_dof_permutation().empty()) {
+		printf("natural ordering: a permutation was stored\n");
+		res = ERROR_FAILURE;
+	}
+
+	// the same space, renumbered
+	H1Space space2(&mesh, &shapeset);
+	space2.set_bc_types(bc_types);
+	space2.set_essential_bc_values(essential_bc_values);
+	space2.set_uniform_order(order3_t(2, 3, 4));
+	space2.set_dof_ordering(H3D_DOF_ORDER_RCM);
+	space2.assign_dofs();
+	int bw2 = bandwidth(&space2);
+	printf("ndofs = %d, bandwidth natural = %d, RCM = %d\n", ndofs, bw1, bw2);
+	if (space2.get_dof_count() != ndofs) {
+		printf("RCM ordering: wrong number of DOFs\n");
+		res = ERROR_FAILURE;
+	}
+	if (bw2 >= bw1) {
+		printf("RCM ordering: the bandwidth was not reduced\n");
+		res = ERROR_FAILURE;
+	}
+
+	// the permutation must be a bijection
+	const std::vector<int> &perm = space2.get_dof_permutation();
+	if ((int) perm.size() != ndofs) {
+		printf("wrong size of the permutation\n");
+		return ERROR_FAILURE;
+	}
+	std::vector<bool> used(ndofs, false);
+	for (int i = 0; i < ndofs; i++) {
+		if (perm[i] < 0 || perm[i] >= ndofs || used[perm[i]]) {
+			printf("not a permutation\n");
+			return ERROR_FAILURE;
+		}
+		used[perm[i]] = true;
+	}
+
+	// both numberings assemble the same problem
+	MapMatrix mat1, mat2;
+	MapVector rhs1, rhs2;
+	assemble(&space1, &mat1, &rhs1);
+	assemble(&space2, &mat2, &rhs2);
+
+	double max_val = 0, max_diff = 0;
+	for (std::map<std::pair<int, int>, scalar>::iterator it = mat1.m.begin(); it != mat1.m.end(); ++it) {
+		scalar v2 = mat2.get(perm[it->first.first], perm[it->first.second]);
+		max_val = std::max(max_val, fabs(it->second));
+		max_diff = std::max(max_diff, fabs(it->second - v2));
+	}
+	for (std::map<int, scalar>::iterator it = rhs1.v.begin(); it != rhs1.v.end(); ++it) {
+		max_val = std::max(max_val, fabs(it->second));
+		max_diff = std::max(max_diff, fabs(it->second - rhs2.get(perm[it->first])));
+	}
+	if (mat1.m.size() != mat2.m.size() || rhs1.v.size() != rhs2.v.size() || !(max_val > 0) ||
+	    max_diff > 1e-12 * max_val) {
+		printf("the assembled problems differ (max difference %g)\n", max_diff);
+		res = ERROR_FAILURE;
+	}
+
+	// switching back renumbers the DOFs in the natural order
+	space2.set_dof_ordering(H3D_DOF_ORDER_NATURAL);
+	if (bandwidth(&space2) != bw1 || !space2.get_dof_permutation().empty()) {
+		printf("the natural ordering was not restored\n");
+		res = ERROR_FAILURE;
+	}
+
+	if (res == ERROR_SUCCESS) printf("Success!\n");
+	else printf("Failed\n");
+
+	return res;
+}
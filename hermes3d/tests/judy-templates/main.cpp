@@ -420,6 +420,68 @@ int testMap() {
 	return ERROR_SUCCESS;
 }
 
+// test MapOrd
+int testMapOrd() {
+	printf("- Testing MapOrd<int>-----\n");
+
+	bool r;
+	int item;
+
+	MapOrd<int> map;
+
+	// fill the map (enough items to make the map grow several times)
+	printf("  * Filling the map with items\n");
+	for (Word_t i = 1; i <= 1000; i++) {
+		Word_t key[] = { i + 1, i };
+		map.set(key, 2, (int) i);
+	}
+	if (!testPrint(map.count() == 1000, "  * Number of items == 1000", true))
+		return ERROR_FAILURE;
+
+	// test the values, keys are given in the opposite order
+	r = true;
+	for (Word_t i = 1; i <= 1000; i++) {
+		Word_t key[] = { i, i + 1 };
+		r &= map.lookup(key, 2, item) && item == (int) i;
+	}
+	if (!testPrint(r, "  * Checking if all values were inserted correctly", true))
+		return ERROR_FAILURE;
+
+	// non-existent item
+	Word_t nk[] = { 1, 3 };
+	r = map.lookup(nk, 2, item);
+	if (!testPrint(r, "  * Checking non-existent item", false))
+		return ERROR_FAILURE;
+
+	// iteration
+	r = true;
+	Word_t n = 0;
+	for (Word_t idx = map.first(); idx != INVALID_IDX; idx = map.next(idx), n++)
+		r &= map.get(idx) == (int) idx;
+	if (!testPrint(r && n == 1000, "  * Forward iteration", true))
+		return ERROR_FAILURE;
+
+	// deleting item, its position is reused by the next insertion
+	Word_t k5[] = { 5, 6 };
+	Word_t idx5 = map.get_idx(k5, 2);
+	map.remove(k5, 2);
+	r = map.lookup(k5, 2, item);
+	if (!testPrint(r, "  * Deleting item", false))
+		return ERROR_FAILURE;
+
+	Word_t knew[] = { 2000, 1 };
+	map.set(knew, 2, 2000);
+	if (!testPrint(map.get_idx(knew, 2) == idx5 && map.count() == 1000, "  * Reusing position of deleted item", true))
+		return ERROR_FAILURE;
+
+	// free
+	map.remove_all();
+	if (!testPrint(map.is_empty(), "  * Empty map after removing all items", true))
+		return ERROR_FAILURE;
+
+	return ERROR_SUCCESS;
+}
+
 // test MapHSOrd
 int testMapHSOrd() {
 	printf("- Testing MapHSOrd<struct>-----\n");
@@ -637,6 +699,10 @@ int main() {
 	if ((ret = testMap()) != ERROR_SUCCESS)
 		return ret;
 
+	// test MapOrd
+	if ((ret = testMapOrd()) != ERROR_SUCCESS)
+		return ret;
+
 	// test MapHS
 	if ((ret = testMapHS()) != ERROR_SUCCESS)
 		return ret;
@@ -76,6 +76,30 @@ int test_hdf5_loader(char *file_name)
 	}
 }
 
+// load the mesh, save it in the bulk format and load it back (on two threads)
+int test_hdf5_resave(char *file_name, char *out_name)
+{
+	_F_
+	Mesh mesh;
+	HDF5Reader mloader;
+	if (!mloader.load(file_name, &mesh) || !mloader.save(out_name, &mesh)) {
+		printf("failed\n");
+		return ERROR_FAILURE;
+	}
+
+	Mesh mesh2;
+	HDF5Reader mloader2;
+	mloader2.async_read = true;
+	if (mloader2.load(out_name, &mesh2)) {
+		mesh2.dump();
+		return ERROR_SUCCESS;
+	}
+	else {
+		printf("failed\n");
+		return ERROR_FAILURE;
+	}
+}
+
 int test_exodusii_loader(char *file_name)
 {
 	_F_
@@ -106,6 +130,10 @@ int main(int argc, char *argv[])
 	else if (strcmp(argv[1], "hdf5") == 0) {
 		ret = test_hdf5_loader(argv[2]);
 	}
+	else if (strcmp(argv[1], "hdf5-resave") == 0) {
+		if (argc < 4) return ERROR_NOT_ENOUGH_PARAMS;
+		ret = test_hdf5_resave(argv[2], argv[3]);
+	}
 	else if (strcmp(argv[1], "exoii") == 0) {
 		ret = test_exodusii_loader(argv[2]);
 	}
@@ -73,6 +73,7 @@ cdef extern from "arrayobject.h":
         cdef npy_intp *dimensions
         cdef npy_intp *strides
         cdef int flags
+        cdef PyObject *base
 
     object PyArray_SimpleNewFromData(int nd, npy_intp* dims, int typenum,
             void* data)
@@ -102,7 +103,8 @@ cdef extern from "matrix.h":
         pass
     c_AVector *new_AVector "new AVector" (int size, int is_complex)
 
-    cdef struct c_DenseMatrix "DenseMatrix"
+    cdef struct c_DenseMatrix "DenseMatrix":
+        double **get_A()
 
     cdef struct c_CooMatrix "CooMatrix":
         int get_nnz()
@@ -140,11 +142,15 @@ cdef api object c2numpy_int(int *A, int len)
 cdef api object c2numpy_double(double *A, int len)
 cdef api void numpy2c_double_inplace(object A_n, double **A_c, int *n)
 cdef api void numpy2c_int_inplace(object A_n, int **A_c, int *n)
+cdef api object c2numpy_int_view(int *A, int len, object owner)
+cdef api object c2numpy_double_view(double *A, int len, object owner)
 
 cdef inline PY_NEW(T)
 
 cdef class Matrix:
     cdef c_Matrix *thisptr
+    cdef int owner
 
 cdef class Vector:
     cdef c_Vector *thisptr
+    cdef int owner
@@ -19,9 +19,30 @@ cdef inline PY_NEW(T):
 
 #-----------------------------------------------------------------------
 # Matrix classes:
+#
+# Ownership rules:
+#
+# * Matrices and vectors created from Python (e.g. CooMatrix(5),
+#   CSRMatrix(c), AVector(10)) own the C++ object and delete it when they
+#   are deallocated.
+# * Objects returned by c2py_*() only borrow the C++ object, the C++ code
+#   keeps the ownership and has to keep the object alive as long as Python
+#   uses it (see python_solvers.cpp).
+# * The NumPy arrays returned by CSRMatrix.IA, .JA, .A (the same for
+#   CSCMatrix), AVector.to_numpy() and DenseMatrix.to_numpy() share the
+#   memory with the C++ object, no data is copied. The arrays (and the SciPy
+#   matrices built from them by to_scipy_csr() and to_scipy_csc()) keep a
+#   reference to the Python object, so an owned C++ object stays alive as
+#   long as they do. Changing the arrays changes the matrix; after the C++
+#   object reallocates its data (e.g. by free_data()), the arrays must not be
+#   used anymore.
 
 cdef class Matrix:
 
+    def __dealloc__(self):
+        if self.owner:
+            delete(self.thisptr)
+
     def get_size(self):
         """
         Returns the dimension of the square matrix.
@@ -66,6 +87,10 @@ cdef class Matrix:
 
 cdef class Vector:
 
+    def __dealloc__(self):
+        if self.owner:
+            delete(self.thisptr)
+
     def get_size(self):
         return self.thisptr.get_size()
 
@@ -79,34 +104,45 @@ cdef class AVector(Vector):
 
     def __init__(self, size=0, is_complex=False):
         self.thisptr = <c_Vector *>new_AVector(size, is_complex)
+        self.owner = 1
 
-    def to_numpy(self):
-        from numpy import empty
+    def to_numpy(self, copy=False):
+        """
+        Returns the vector as a NumPy array.
+
+        Unless ``copy`` is True, the array shares the memory with the vector.
+        """
         if self.thisptr.is_complex():
             raise NotImplementedError("This is not yet implemented")
-        cdef int n, i, len=self.get_size()
-        cdef double *cdata
-        cdef double *v = self.thisptr.get_c_array()
-        row = empty([len], dtype="double")
-        numpy2c_double_inplace(row, &cdata, &n)
-        for i in range(len):
-            cdata[i] = v[i]
-        return row
+        v = c2numpy_double_view(self.thisptr.get_c_array(), self.get_size(),
+                self)
+        if copy:
+            return v.copy()
+        return v
 
 cdef class DenseMatrix(Matrix):
 
-    def to_numpy(self):
+    def to_numpy(self, copy=False):
+        """
+        Returns the matrix as a 2D NumPy array.
+
+        Unless ``copy`` is True, the array shares the memory with the matrix.
+        """
         from numpy import empty
         if self.thisptr.is_complex():
             raise NotImplementedError("This is not yet implemented")
-        cdef int n, i, j, len=self.get_size()
-        cdef double *cdata
-        row = empty([len*len], dtype="double")
-        numpy2c_double_inplace(row, &cdata, &n)
-        for i in range(len):
-            for j in range(len):
-                cdata[i*len+j] = self.thisptr.get(i, j);
-        return row.reshape((len, len))
+        cdef int len=self.get_size()
+        if len == 0:
+            return empty((0, 0), dtype="double")
+        cdef npy_intp dims[2]
+        dims[0] = len
+        dims[1] = len
+        cdef double **A = (<c_DenseMatrix *>(self.thisptr)).get_A()
+        # the rows are stored contiguously after each other (_new_matrix())
+        m = c2numpy_view(2, dims, NPY_DOUBLE, A[0], self)
+        if copy:
+            return m.copy()
+        return m
 
 cdef class SparseMatrix(Matrix):
     pass
@@ -126,6 +162,7 @@ cdef class CooMatrix(SparseMatrix):
 
     def __init__(self, size=0, is_complex=False):
         self.thisptr = <c_Matrix *>new_CooMatrix(size, is_complex)
+        self.owner = 1
 
     def add(self, int m, int n, v):
         """
@@ -239,6 +276,7 @@ cdef class CSRMatrix(SparseMatrix):
                     <c_CSCMatrix*>(py2c_Matrix(M).thisptr))
         else:
             raise Exception("Not implemented.")
+        self.owner = 1
 
     @property
     def IA(self):
@@ -246,7 +284,7 @@ cdef class CSRMatrix(SparseMatrix):
         Returns (row, col, data) arrays.
         """
         cdef c_CSRMatrix *_thisptr = <c_CSRMatrix*>(self.thisptr)
-        return c2numpy_int_inplace(_thisptr.get_Ap(), self.get_size()+1)
+        return c2numpy_int_view(_thisptr.get_Ap(), self.get_size()+1, self)
 
     @property
     def JA(self):
@@ -254,7 +292,7 @@ cdef class CSRMatrix(SparseMatrix):
         Returns (row, col, data) arrays.
         """
         cdef c_CSRMatrix *_thisptr = <c_CSRMatrix*>(self.thisptr)
-        return c2numpy_int_inplace(_thisptr.get_Ai(), _thisptr.get_nnz())
+        return c2numpy_int_view(_thisptr.get_Ai(), _thisptr.get_nnz(), self)
 
     @property
     def A(self):
@@ -263,18 +301,21 @@ cdef class CSRMatrix(SparseMatrix):
         """
         cdef c_CSRMatrix *_thisptr = <c_CSRMatrix*>(self.thisptr)
         if self.thisptr.is_complex():
-            return c2numpy_double_complex_inplace(_thisptr.get_Ax_cplx(),
-                    _thisptr.get_nnz())
+            return c2numpy_double_complex_view(_thisptr.get_Ax_cplx(),
+                    _thisptr.get_nnz(), self)
         else:
-            return c2numpy_double_inplace(_thisptr.get_Ax(), _thisptr.get_nnz())
+            return c2numpy_double_view(_thisptr.get_Ax(), _thisptr.get_nnz(),
+                    self)
 
     def to_scipy_csr(self):
         """
         Converts itself to the scipy sparse CSR format.
+
+        The SciPy matrix shares the memory with this matrix.
         """
         from scipy.sparse import csr_matrix
         n = self.get_size()
-        return csr_matrix((self.A, self.JA, self.IA), shape=(n, n))
+        return csr_matrix((self.A, self.JA, self.IA), shape=(n, n), copy=False)
 
     def __str__(self):
         return str(self.to_scipy_csr())
@@ -308,6 +349,7 @@ cdef class CSCMatrix(SparseMatrix):
                     <c_CSRMatrix*>(py2c_Matrix(M).thisptr))
         else:
             raise Exception("Not implemented.")
+        self.owner = 1
 
     @property
     def IA(self):
@@ -315,7 +357,7 @@ cdef class CSCMatrix(SparseMatrix):
         Returns (row, col, data) arrays.
         """
         cdef c_CSCMatrix *_thisptr = <c_CSCMatrix*>(self.thisptr)
-        return c2numpy_int_inplace(_thisptr.get_Ai(), _thisptr.get_nnz())
+        return c2numpy_int_view(_thisptr.get_Ai(), _thisptr.get_nnz(), self)
 
     @property
     def JA(self):
@@ -323,7 +365,7 @@ cdef class CSCMatrix(SparseMatrix):
         Returns (row, col, data) arrays.
         """
         cdef c_CSCMatrix *_thisptr = <c_CSCMatrix*>(self.thisptr)
-        return c2numpy_int_inplace(_thisptr.get_Ap(), self.get_size()+1)
+        return c2numpy_int_view(_thisptr.get_Ap(), self.get_size()+1, self)
 
     @property
     def A(self):
@@ -332,18 +374,21 @@ cdef class CSCMatrix(SparseMatrix):
         """
         cdef c_CSCMatrix *_thisptr = <c_CSCMatrix*>(self.thisptr)
         if self.thisptr.is_complex():
-            return c2numpy_double_complex_inplace(_thisptr.get_Ax_cplx(),
-                    _thisptr.get_nnz())
+            return c2numpy_double_complex_view(_thisptr.get_Ax_cplx(),
+                    _thisptr.get_nnz(), self)
         else:
-            return c2numpy_double_inplace(_thisptr.get_Ax(), _thisptr.get_nnz())
+            return c2numpy_double_view(_thisptr.get_Ax(), _thisptr.get_nnz(),
+                    self)
 
     def to_scipy_csc(self):
         """
         Converts itself to the scipy sparse CSC format.
+
+        The SciPy matrix shares the memory with this matrix.
         """
         from scipy.sparse import csc_matrix
         n = self.get_size()
-        return csc_matrix((self.A, self.IA, self.JA), shape=(n, n))
+        return csc_matrix((self.A, self.IA, self.JA), shape=(n, n), copy=False)
 
     def __str__(self):
         return str(self.to_scipy_csc())
@@ -513,6 +558,41 @@ cdef api object c2numpy_double_complex_inplace(cplx *A, int len):
     cdef npy_intp dim = len
     return PyArray_SimpleNewFromData(1, &dim, NPY_COMPLEX128, A)
 
+cdef object c2numpy_view(int nd, npy_intp *dims, int typenum, void *A,
+        object owner):
+    """
+    Construct the NumPy array inplace (don't copy any data).
+
+    The array keeps a reference to "owner" (unless it is None), so that the
+    Python object owning the memory A is not deallocated before the array.
+    """
+    cdef ndarray vec = PyArray_SimpleNewFromData(nd, dims, typenum, A)
+    if owner is not None:
+        Py_INCREF(owner)
+        vec.base = <PyObject *>owner
+    return vec
+
+cdef api object c2numpy_int_view(int *A, int len, object owner):
+    """
+    Construct the integer NumPy array inplace, owned by "owner".
+    """
+    cdef npy_intp dim = len
+    return c2numpy_view(1, &dim, NPY_INT, A, owner)
+
+cdef api object c2numpy_double_view(double *A, int len, object owner):
+    """
+    Construct the double NumPy array inplace, owned by "owner".
+    """
+    cdef npy_intp dim = len
+    return c2numpy_view(1, &dim, NPY_DOUBLE, A, owner)
+
+cdef api object c2numpy_double_complex_view(cplx *A, int len, object owner):
+    """
+    Construct the complex NumPy array inplace, owned by "owner".
+    """
+    cdef npy_intp dim = len
+    return c2numpy_view(1, &dim, NPY_COMPLEX128, A, owner)
+
 _AA = None
 
 cdef api void numpy2c_int_inplace(object A_n, int **A_c, int *n):
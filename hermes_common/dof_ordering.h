@@ -0,0 +1,141 @@
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Distributed under the terms of the BSD license (see the LICENSE
+// file for the exact terms).
+// Email: hermes1d@googlegroups.com, home page: http://hpfem.org/
+
+#ifndef __HERMES_COMMON_DOF_ORDERING_H
+#define __HERMES_COMMON_DOF_ORDERING_H
+
+#include <vector>
+#include <algorithm>
+
+/// Graph for the reordering of the DOFs of a space.
+/** The vertices are blocks of DOFs (all DOFs of a node or of an element interior), connected
+ *  if they belong to a common element. The space fills the blocks of every element (eptr,
+ *  eblocks) and where the first DOF of every block is stored (block_dof, block_size), the
+ *  rest is built by rcm_renumber_dof_blocks(). All arrays are in the CSR format. */
+struct DofBlockGraph
+{
+    std::vector<int> eptr, eblocks; ///< blocks of element k: eblocks[eptr[k]..eptr[k+1]-1]
+    std::vector<int> bptr, belems;  ///< elements of block b: belems[bptr[b]..bptr[b+1]-1]
+    std::vector<int> degree;        ///< (approximate) number of neighbors of every block
+    std::vector<int*> block_dof;    ///< where the first DOF of the block is stored
+    std::vector<int> block_size;    ///< number of DOFs in the block
+
+    DofBlockGraph() { eptr.push_back(0); }
+
+    /// Adds a new block to the element being collected, returns its index.
+    int add_block(int* dof, int n)
+    {
+        int b = block_dof.size();
+        block_dof.push_back(dof);
+        block_size.push_back(n);
+        eblocks.push_back(b);
+        return b;
+    }
+    /// Adds an existing block to the element being collected.
+    void add_block(int b) { eblocks.push_back(b); }
+    /// Finishes the element being collected.
+    void end_element() { eptr.push_back(eblocks.size()); }
+};
+
+/// Appends the blocks reachable from 'start' to 'order' in the Cuthill-McKee order (breadth-first,
+/// neighbors by increasing degree), marking them with 'stamp'. Returns the block of the last level
+/// with the smallest degree, which is a candidate for a pseudo-peripheral block.
+inline int cuthill_mckee(const DofBlockGraph& g, int start, std::vector<int>& mark, int stamp,
+                         std::vector<int>& order)
+{
+    int first = order.size();
+    order.push_back(start);
+    mark[start] = stamp;
+    int level_start = first, level_end = first + 1;
+    std::vector<std::pair<int, int> > nbrs;
+    for (int i = first; i < (int) order.size(); i++) {
+        if (i == level_end) { level_start = level_end; level_end = order.size(); }
+        int b = order[i];
+        nbrs.clear();
+        for (int j = g.bptr[b]; j < g.bptr[b+1]; j++) {
+            int k = g.belems[j];
+            for (int l = g.eptr[k]; l < g.eptr[k+1]; l++) {
+                int c = g.eblocks[l];
+                if (mark[c] == stamp || mark[c] < 0) continue;
+                mark[c] = stamp;
+                nbrs.push_back(std::make_pair(g.degree[c], c));
+            }
+        }
+        std::sort(nbrs.begin(), nbrs.end());
+        for (unsigned j = 0; j < nbrs.size(); j++)
+            order.push_back(nbrs[j].second);
+    }
+
+    // the last level is order[level_start..] (it may have started after the last check)
+    if (level_end < (int) order.size()) level_start = level_end;
+    int best = order[level_start];
+    for (int i = level_start + 1; i < (int) order.size(); i++)
+        if (g.degree[order[i]] < g.degree[best]) best = order[i];
+    return best;
+}
+
+/// Renumbers the DOF blocks of 'g' by the reverse Cuthill-McKee algorithm.
+/** The DOFs are first_dof, first_dof + stride, ... first_dof + (ndof-1)*stride; the blocks
+ *  are numbered consecutively, so the DOFs of a block stay together. On return, the DOF
+ *  first_dof + i*stride of the old numbering has the number first_dof + perm[i]*stride.
+ *  \return false (and nothing is changed) if the blocks do not cover exactly ndof DOFs. */
+inline bool rcm_renumber_dof_blocks(DofBlockGraph& g, int first_dof, int stride, int ndof,
+                                    std::vector<int>& perm)
+{
+    int nb = g.block_dof.size(), ne = g.eptr.size() - 1;
+    int total = 0;
+    for (int b = 0; b < nb; b++)
+        total += g.block_size[b];
+    if (total != ndof) return false;
+
+    // elements of every block, degrees
+    g.bptr.assign(nb + 1, 0);
+    g.degree.assign(nb, 0);
+    for (int k = 0; k < ne; k++)
+        for (int l = g.eptr[k]; l < g.eptr[k+1]; l++) {
+            g.bptr[g.eblocks[l] + 1]++;
+            g.degree[g.eblocks[l]] += g.eptr[k+1] - g.eptr[k] - 1;
+        }
+    for (int b = 0; b < nb; b++)
+        g.bptr[b+1] += g.bptr[b];
+    g.belems.resize(g.bptr[nb]);
+    std::vector<int> pos(g.bptr.begin(), g.bptr.end() - 1);
+    for (int k = 0; k < ne; k++)
+        for (int l = g.eptr[k]; l < g.eptr[k+1]; l++)
+            g.belems[pos[g.eblocks[l]]++] = k;
+
+    // Cuthill-McKee order of every connected component, starting from a pseudo-peripheral
+    // block: the block with the smallest degree in the last level of a search started from
+    // the block with the smallest degree in the component
+    std::vector<int> mark(nb, 0), order, tmp;
+    order.reserve(nb);
+    int stamp = 0;
+    for (int b = 0; b < nb; b++) {
+        if (mark[b] < 0) continue;
+        int start = b;
+        tmp.clear();
+        cuthill_mckee(g, b, mark, ++stamp, tmp);
+        for (unsigned i = 0; i < tmp.size(); i++)
+            if (g.degree[tmp[i]] < g.degree[start]) start = tmp[i];
+        tmp.clear();
+        start = cuthill_mckee(g, start, mark, ++stamp, tmp);
+        cuthill_mckee(g, start, mark, -1, order);
+    }
+
+    // renumber the blocks in the reverse order
+    perm.resize(total);
+    int dof = first_dof;
+    for (int i = nb-1; i >= 0; i--) {
+        int b = order[i];
+        int old = (*g.block_dof[b] - first_dof) / stride;
+        for (int j = 0; j < g.block_size[b]; j++)
+            perm[old + j] = (dof - first_dof) / stride + j;
+        *g.block_dof[b] = dof;
+        dof += g.block_size[b] * stride;
+    }
+    return true;
+}
+
+#endif
@@ -140,33 +140,35 @@ void DenseMatrix::add_from_coo(CooMatrix *m)
     int nnz = m->get_nnz();
 
     // get data
-    int *row = new int[nnz];
-    int *col = new int[nnz];
+    int *Ap = new int[m->get_size() + 1];
+    int *Ai = new int[nnz];
 
     if (complex)
     {
-        cplx *data = new cplx[nnz];
-        m->get_row_col_data(row, col, data);
+        cplx *Ax = new cplx[nnz];
+        m->get_csr(Ap, Ai, Ax);
 
-        for (int i = 0; i < nnz; i++)
-            A_cplx[row[i]][col[i]] = data[i];
+        for (int i = 0; i < m->get_size(); i++)
+            for (int k = Ap[i]; k < Ap[i+1]; k++)
+                A_cplx[i][Ai[k]] = Ax[k];
 
-        if (data != NULL) delete[] data;
+        delete[] Ax;
     }
     else
     {
-        double *data = new double[nnz];
-        m->get_row_col_data(row, col, data);
+        double *Ax = new double[nnz];
+        m->get_csr(Ap, Ai, Ax);
 
-        for (int i = 0; i < nnz; i++)
-            A[row[i]][col[i]] = data[i];
+        for (int i = 0; i < m->get_size(); i++)
+            for (int k = Ap[i]; k < Ap[i+1]; k++)
+                A[i][Ai[k]] = Ax[k];
 
-        if (data != NULL) delete[] data;
+        delete[] Ax;
     }
 
     // free data
-    if (row != NULL) delete[] row;
-    if (col != NULL) delete[] col;
+    delete[] Ap;
+    delete[] Ai;
 }
 
 int DenseMatrix::get_nnz()
@@ -177,11 +179,15 @@ int DenseMatrix::get_nnz()
         for (int j = 0; j < this->size; j++)
         {
             if (complex)
-                if (fabs(A[i][j]) > 1e-12)
+            {
+                if (std::abs(A_cplx[i][j]) > 1e-12)
                     nnz++;
+            }
             else
-                if (std::abs(A_cplx[i][j]) > 1e-12)
+            {
+                if (fabs(A[i][j]) > 1e-12)
                     nnz++;
+            }
         }
     }
     return nnz;
@@ -434,6 +440,77 @@ void CooMatrix::get_row_col_data(int *row, int *col, double *data_real, double *
     }
 }
 
+// The rows of the map (and the columns in every row) are sorted, so the
+// CSR arrays are filled in a single pass, without any sorting.
+template<typename T>
+static void coo_map_to_csr(int size, const std::map<size_t, std::map<size_t, T> > &A,
+                           int *Ap, int *Ai, T *Ax)
+{
+    int count = 0;
+    int i = 0;
+    for(typename std::map<size_t, std::map<size_t, T> >::const_iterator it_row = A.begin(); it_row != A.end(); ++it_row)
+    {
+        while (i <= (int) it_row->first)
+            Ap[i++] = count;
+        for(typename std::map<size_t, T>::const_iterator it_col = it_row->second.begin(); it_col != it_row->second.end(); ++it_col)
+        {
+            Ai[count] = it_col->first;
+            Ax[count] = it_col->second;
+            count++;
+        }
+    }
+    while (i <= size)
+        Ap[i++] = count;
+}
+
+// Counting sort of the entries by columns. Since the rows are visited
+// in increasing order, the row indices in every column come out sorted.
+template<typename T>
+static void coo_map_to_csc(int size, const std::map<size_t, std::map<size_t, T> > &A,
+                           int *Ap, int *Ai, T *Ax)
+{
+    std::fill(Ap, Ap + size + 1, 0);
+    for(typename std::map<size_t, std::map<size_t, T> >::const_iterator it_row = A.begin(); it_row != A.end(); ++it_row)
+        for(typename std::map<size_t, T>::const_iterator it_col = it_row->second.begin(); it_col != it_row->second.end(); ++it_col)
+            Ap[it_col->first + 1]++;
+    for (int j = 0; j < size; j++)
+        Ap[j+1] += Ap[j];
+
+    // position of the next entry in every column
+    int *next = new int[size];
+    std::copy(Ap, Ap + size, next);
+    for(typename std::map<size_t, std::map<size_t, T> >::const_iterator it_row = A.begin(); it_row != A.end(); ++it_row)
+    {
+        for(typename std::map<size_t, T>::const_iterator it_col = it_row->second.begin(); it_col != it_row->second.end(); ++it_col)
+        {
+            int dest = next[it_col->first]++;
+            Ai[dest] = it_row->first;
+            Ax[dest] = it_col->second;
+        }
+    }
+    delete[] next;
+}
+
+void CooMatrix::get_csr(int *Ap, int *Ai, double *Ax)
+{
+    coo_map_to_csr(this->size, A, Ap, Ai, Ax);
+}
+
+void CooMatrix::get_csr(int *Ap, int *Ai, cplx *Ax)
+{
+    coo_map_to_csr(this->size, A_cplx, Ap, Ai, Ax);
+}
+
+void CooMatrix::get_csc(int *Ap, int *Ai, double *Ax)
+{
+    coo_map_to_csc(this->size, A, Ap, Ai, Ax);
+}
+
+void CooMatrix::get_csc(int *Ap, int *Ai, cplx *Ax)
+{
+    coo_map_to_csc(this->size, A_cplx, Ap, Ai, Ax);
+}
+
 int CooMatrix::get_nnz()
 {
     int nnz = 0;
@@ -562,40 +639,26 @@ void CSRMatrix::free_data()
 
 void CSRMatrix::add_from_dense(DenseMatrix *m)
 {
+    free_data();
+
     this->size = m->get_size();
+    this->complex = m->is_complex();
 
-    // count nnz
-    this->nnz = 0;
-    for(int i = 0; i < this->size; i++)
+    // count the nonzeros in every row, then fill the rows
+    this->Ap = new int[this->size + 1];
+    if (is_complex())
     {
-        for(int j = 0; j < this->size; j++)
-        {
-            double v = m->get(i, j);
-            if (fabs(v) > 1e-12)
-                this->nnz++;
-        }
+        this->nnz = dense_count_nnz(this->size, m->get_A_cplx(), this->Ap);
+        this->Ai = new int[this->nnz];
+        this->Ax_cplx = new cplx[this->nnz];
+        dense_to_csr(this->size, m->get_A_cplx(), Ap, Ai, Ax_cplx);
     }
-
-    // allocate arrays
-    this->Ax = new double[this->nnz];
-    this->Ap = new int[this->size+1];
-    this->Ai = new int[this->nnz];
-
-    int count = 0;
-    this->Ap[0] = 0;
-    for(int i = 0; i < this->size; i++)
+    else
     {
-        for(int j = 0; j < this->size; j++)
-        {
-            double v = m->get(i, j);
-            if (fabs(v) > 1e-12)
-            {
-                this->Ax[count] = v;
-                this->Ai[count] = j;
-                count++;
-            }
-        }
-        this->Ap[i+1] = count;
+        this->nnz = dense_count_nnz(this->size, m->get_A(), this->Ap);
+        this->Ai = new int[this->nnz];
+        this->Ax = new double[this->nnz];
+        dense_to_csr(this->size, m->get_A(), Ap, Ai, Ax);
     }
 }
 
@@ -610,32 +673,16 @@ void CSRMatrix::add_from_coo(CooMatrix *m)
     // allocate data
     this->Ap = new int[this->size + 1];
     this->Ai = new int[this->nnz];
-    if (is_complex())
-        this->Ax_cplx = new cplx[this->nnz];
-    else
-        this->Ax = new double[this->nnz];
-
-    // get data
-    int *row = new int[this->nnz];
-    int *col = new int[this->nnz];
     if (is_complex())
     {
-        cplx *data = new cplx[this->nnz];
-        m->get_row_col_data(row, col, data);
-        coo_to_csr(this->size, this->nnz, row, col, data, Ap, Ai, Ax_cplx);
-        if (data != NULL) delete[] data;
+        this->Ax_cplx = new cplx[this->nnz];
+        m->get_csr(Ap, Ai, Ax_cplx);
     }
     else
     {
-        double *data = new double[this->nnz];
-        m->get_row_col_data(row, col, data);
-        coo_to_csr(this->size, this->nnz, row, col, data, Ap, Ai, Ax);
-        if (data != NULL) delete[] data;
+        this->Ax = new double[this->nnz];
+        m->get_csr(Ap, Ai, Ax);
     }
-
-    // free data
-    if (row != NULL) delete[] row;
-    if (col != NULL) delete[] col;
 }
 
 void CSRMatrix::add_from_csc(CSCMatrix *m)
@@ -664,6 +711,22 @@ void CSRMatrix::add_from_csc(CSCMatrix *m)
     }
 }
 
+void CSRMatrix::take_transpose(CSCMatrix *m)
+{
+    free_data();
+
+    this->size = m->size;
+    this->nnz = m->nnz;
+    this->complex = m->complex;
+
+    this->Ap = m->Ap;
+    this->Ai = m->Ai;
+    this->Ax = m->Ax;
+    this->Ax_cplx = m->Ax_cplx;
+
+    m->init();
+}
+
 void CSRMatrix::print()
 {
     printf("\nCSR Matrix:\n");
@@ -774,41 +837,24 @@ void CSCMatrix::add_from_dense(DenseMatrix *m)
     free_data();
 
     this->size = m->get_size();
-    this->nnz = m->get_nnz();
     this->complex = m->is_complex();
 
-    // allocate data
+    // count the nonzeros in every column, then fill the columns
     this->Ap = new int[this->size + 1];
-    this->Ai = new int[this->nnz];
-    if (is_complex())
-        this->Ax_cplx = new cplx[this->nnz];
-    else
-        this->Ax = new double[this->nnz];
-
-    // get data
-    int *row = new int[this->nnz];
-    int *col = new int[this->nnz];
     if (is_complex())
     {
-        cplx *data = new cplx[this->nnz];
-        dense_to_coo(size, nnz, m->get_A_cplx(), row, col, data);
-        coo_to_csc(this->size, this->nnz, row, col, data, Ap, Ai, Ax_cplx);
-        if (data != NULL) delete[] data;
+        this->nnz = dense_count_nnz(this->size, m->get_A_cplx(), this->Ap, true);
+        this->Ai = new int[this->nnz];
+        this->Ax_cplx = new cplx[this->nnz];
+        dense_to_csc(this->size, m->get_A_cplx(), Ap, Ai, Ax_cplx);
     }
     else
     {
-        double *data = new double[this->nnz];
-        dense_to_coo(size, nnz, m->get_A(), row, col, data);
-        print_vector("row", row, this->nnz);
-        print_vector("col", col, this->nnz);
-        print_vector("Ax", data, this->nnz);
-        coo_to_csc(this->size, this->nnz, row, col, data, Ap, Ai, Ax);
-        if (data != NULL) delete[] data;
+        this->nnz = dense_count_nnz(this->size, m->get_A(), this->Ap, true);
+        this->Ai = new int[this->nnz];
+        this->Ax = new double[this->nnz];
+        dense_to_csc(this->size, m->get_A(), Ap, Ai, Ax);
     }
-
-    // free data
-    if (row != NULL) delete[] row;
-    if (col != NULL) delete[] col;
 }
 
 void CSCMatrix::add_from_coo(CooMatrix *m)
@@ -822,32 +868,16 @@ void CSCMatrix::add_from_coo(CooMatrix *m)
     // allocate data
     this->Ap = new int[this->size + 1];
     this->Ai = new int[this->nnz];
-    if (is_complex())
-        this->Ax_cplx = new cplx[this->nnz];
-    else
-        this->Ax = new double[this->nnz];
-
-    // get data
-    int *row = new int[this->nnz];
-    int *col = new int[this->nnz];
     if (is_complex())
     {
-        cplx *data = new cplx[this->nnz];
-        m->get_row_col_data(row, col, data);
-        coo_to_csc(this->size, this->nnz, row, col, data, Ap, Ai, Ax_cplx);
-        if (data != NULL) delete[] data;
+        this->Ax_cplx = new cplx[this->nnz];
+        m->get_csc(Ap, Ai, Ax_cplx);
     }
     else
     {
-        double *data = new double[this->nnz];
-        m->get_row_col_data(row, col, data);
-        coo_to_csc(this->size, this->nnz, row, col, data, Ap, Ai, Ax);
-        if (data != NULL) delete[] data;
+        this->Ax = new double[this->nnz];
+        m->get_csc(Ap, Ai, Ax);
     }
-
-    // free data
-    if (row != NULL) delete[] row;
-    if (col != NULL) delete[] col;
 }
 
 void CSCMatrix::add_from_csr(CSRMatrix *m)
@@ -876,6 +906,22 @@ void CSCMatrix::add_from_csr(CSRMatrix *m)
     }
 }
 
+void CSCMatrix::take_transpose(CSRMatrix *m)
+{
+    free_data();
+
+    this->size = m->size;
+    this->nnz = m->nnz;
+    this->complex = m->complex;
+
+    this->Ap = m->Ap;
+    this->Ai = m->Ai;
+    this->Ax = m->Ax;
+    this->Ax_cplx = m->Ax_cplx;
+
+    m->init();
+}
+
 void CSCMatrix::print()
 {
     printf("\nCSC Matrix:\n");
@@ -892,69 +938,276 @@ void CSCMatrix::print()
 
 // ******************************************************************************************************************************
 
-template<typename T>
-void dense_to_coo(int size, int nnz, T **Ad, int *row, int *col, T *A)
+BandMatrix::BandMatrix(int size, int kl, int ku, int *perm)
 {
-    int count = 0;
-    for (int i = 0; i < size; i++)
+    if (size < 0 || kl < 0 || ku < 0)
+        _error("BandMatrix: invalid size or bandwidth.");
+    this->complex = false;
+    this->size = size;
+    this->kl = kl;
+    this->ku = ku;
+    this->width = 2*kl + ku + 1;
+    this->band = new double[size*this->width];
+    this->piv = new int[size];
+    this->work = new double[size];
+    this->work_size = size;
+    this->perm = NULL;
+    if (perm != NULL)
     {
-        for (int j = 0; j < size; j++)
-        {
-            if (std::abs(Ad[i][j]) > 1e-12)
-            {
-                row[count] = i;
-                col[count] = j;
-                A[count] = Ad[i][j];
+        this->perm = new int[size];
+        for (int i = 0; i < size; i++) this->perm[i] = perm[i];
+    }
+    this->set_zero();
+}
 
-                count++;
-            }
-        }
+BandMatrix::~BandMatrix()
+{
+    free_data();
+}
+
+void BandMatrix::free_data()
+{
+    if (this->band != NULL) { delete[] this->band; this->band = NULL; }
+    if (this->piv != NULL) { delete[] this->piv; this->piv = NULL; }
+    if (this->work != NULL) { delete[] this->work; this->work = NULL; }
+    if (this->perm != NULL) { delete[] this->perm; this->perm = NULL; }
+    this->size = 0;
+}
+
+void BandMatrix::set_zero()
+{
+    for (int i = 0; i < this->size*this->width; i++) this->band[i] = 0;
+    this->factorized = false;
+}
+
+void BandMatrix::add(int m, int n, double v)
+{
+    if (this->factorized)
+        _error("BandMatrix::add() called after factorize().");
+    if (this->perm != NULL) { m = this->perm[m]; n = this->perm[n]; }
+    if (n < m - this->kl || n > m + this->ku)
+        _error("BandMatrix: entry outside of the band.");
+    entry(m, n) += v;
+}
+
+double BandMatrix::get(int m, int n)
+{
+    if (this->perm != NULL) { m = this->perm[m]; n = this->perm[n]; }
+    if (n < m - this->kl || n > m + this->ku) return 0;
+    return entry(m, n);
+}
+
+int BandMatrix::get_nnz()
+{
+    int nnz = 0;
+    for (int i = 0; i < this->size; i++)
+        for (int j = std::max(0, i - kl); j <= std::min(this->size - 1, i + ku); j++)
+            if (entry(i, j) != 0) nnz++;
+    return nnz;
+}
+
+int *BandMatrix::inverse_perm()
+{
+    if (this->perm == NULL) return NULL;
+    int *inv = new int[this->size];
+    for (int i = 0; i < this->size; i++) inv[this->perm[i]] = i;
+    return inv;
+}
+
+void BandMatrix::copy_into(Matrix *m)
+{
+    m->free_data();
+    // walk the band only and map the band rows/columns back to the indices
+    int *inv = inverse_perm();
+    for (int i = 0; i < this->size; i++)
+        for (int j = std::max(0, i - kl); j <= std::min(this->size - 1, i + ku); j++)
+            if (entry(i, j) != 0)
+                m->add(inv != NULL ? inv[i] : i, inv != NULL ? inv[j] : j, entry(i, j));
+    delete[] inv;
+}
+
+void BandMatrix::times_vector(double* vec, double* result, int rank)
+{
+    if (this->factorized)
+        _error("BandMatrix::times_vector() called after factorize().");
+    int n = this->size;
+    double *y = new double[n];
+    for (int i = 0; i < n; i++)
+        this->work[this->perm != NULL ? this->perm[i] : i] = vec[i];
+    for (int i = 0; i < n; i++)
+    {
+        double sum = 0;
+        for (int j = std::max(0, i - kl); j <= std::min(n - 1, i + ku); j++)
+            sum += entry(i, j) * this->work[j];
+        y[i] = sum;
     }
+    for (int i = 0; i < rank; i++)
+        result[i] = (i < n) ? y[this->perm != NULL ? this->perm[i] : i] : 0;
+    delete[] y;
 }
 
-template<typename T>
-void coo_to_csr(int size, int nnz, int *row, int *col, T *A, int *Ap, int *Ai, T *Ax)
+void BandMatrix::print()
 {
-    std::fill(Ap, Ap + size, 0);
+    printf("\nBand Matrix:\n");
+    printf("size: %i, kl: %i, ku: %i\n", this->size, this->kl, this->ku);
+    int *inv = inverse_perm();
+    for (int i = 0; i < this->size; i++)
+        for (int j = std::max(0, i - kl); j <= std::min(this->size - 1, i + ku); j++)
+            if (entry(i, j) != 0)
+                printf("(%i, %i): %f\n", inv != NULL ? inv[i] : i, inv != NULL ? inv[j] : j, entry(i, j));
+    delete[] inv;
+}
 
-    for (int n = 0; n < nnz; n++)
+void BandMatrix::factorize()
+{
+    int n = this->size;
+    for (int k = 0; k < n; k++)
     {
-        Ap[row[n]]++;
+        int last_row = std::min(n - 1, k + kl);
+        int last_col = std::min(n - 1, k + kl + ku);
+
+        // pivot
+        int p = k;
+        for (int i = k + 1; i <= last_row; i++)
+            if (fabs(entry(i, k)) > fabs(entry(p, k))) p = i;
+        if (entry(p, k) == 0) _error("Singular matrix!");
+        piv[k] = p;
+        if (p != k)
+            for (int j = k; j <= last_col; j++)
+                std::swap(entry(k, j), entry(p, j));
+
+        // elimination
+        double *row_k = &entry(k, 0);
+        for (int i = k + 1; i <= last_row; i++)
+        {
+            double *row_i = &entry(i, 0);
+            double l = (row_i[k] /= row_k[k]);
+            if (l == 0) continue;
+            for (int j = k + 1; j <= last_col; j++) row_i[j] -= l * row_k[j];
+        }
     }
+    this->factorized = true;
+}
 
-    // cumsum the nnz per row to get this->row_ptr[]
-    for(int i = 0, cumsum = 0; i < size; i++)
+void BandMatrix::solve(double *b, int n_rhs)
+{
+    if (!this->factorized) factorize();
+    int n = this->size;
+    if (this->work_size < n*n_rhs)
     {
-        int temp = Ap[i];
-        Ap[i] = cumsum;
-        cumsum += temp;
+        delete[] this->work;
+        this->work = new double[n*n_rhs];
+        this->work_size = n*n_rhs;
+    }
+    double *x = this->work;
+    for (int i = 0; i < n; i++)
+    {
+        double *xi = x + (this->perm != NULL ? this->perm[i] : i)*n_rhs;
+        for (int k = 0; k < n_rhs; k++) xi[k] = b[i*n_rhs + k];
     }
-    Ap[size] = nnz;
 
-    // write Aj, Ax into Bj, Bx
-    for(int n = 0; n < nnz; n++)
+    // L y = P b
+    for (int j = 0; j < n; j++)
     {
-        int index  = row[n];
-        int dest = Ap[index];
+        double *xj = x + j*n_rhs;
+        if (piv[j] != j)
+        {
+            double *xp = x + piv[j]*n_rhs;
+            for (int k = 0; k < n_rhs; k++) std::swap(xj[k], xp[k]);
+        }
+        for (int i = j + 1; i <= std::min(n - 1, j + kl); i++)
+        {
+            double l = entry(i, j);
+            if (l == 0) continue;
+            double *xi = x + i*n_rhs;
+            for (int k = 0; k < n_rhs; k++) xi[k] -= l * xj[k];
+        }
+    }
+    // U x = y
+    for (int i = n - 1; i >= 0; i--)
+    {
+        double *row_i = &entry(i, 0);
+        double *xi = x + i*n_rhs;
+        for (int j = i + 1; j <= std::min(n - 1, i + kl + ku); j++)
+        {
+            double a = row_i[j];
+            if (a == 0) continue;
+            double *xj = x + j*n_rhs;
+            for (int k = 0; k < n_rhs; k++) xi[k] -= a * xj[k];
+        }
+        double d = 1.0 / row_i[i];
+        for (int k = 0; k < n_rhs; k++) xi[k] *= d;
+    }
 
-        Ai[dest] = col[n];
-        Ax[dest] = A[n];
+    for (int i = 0; i < n; i++)
+    {
+        double *xi = x + (this->perm != NULL ? this->perm[i] : i)*n_rhs;
+        for (int k = 0; k < n_rhs; k++) b[i*n_rhs + k] = xi[k];
+    }
+}
 
-        Ap[index]++;
+// ******************************************************************************************************************************
+
+// Stores the number of nonzeros of the first i rows (columns if
+// by_columns is set) of Ad in Ap[i], i = 0, ..., size, and returns the
+// total. The rows are counted in parallel when compiled with OpenMP.
+template<typename T>
+int dense_count_nnz(int size, T **Ad, int *Ap, bool by_columns)
+{
+    Ap[0] = 0;
+#pragma omp parallel for if (size >= 256)
+    for (int i = 0; i < size; i++)
+    {
+        int count = 0;
+        for (int j = 0; j < size; j++)
+            if (std::abs(by_columns ? Ad[j][i] : Ad[i][j]) > 1e-12)
+                count++;
+        Ap[i+1] = count;
     }
+    for (int i = 0; i < size; i++)
+        Ap[i+1] += Ap[i];
+    return Ap[size];
+}
 
-    for(int i = 0, last = 0; i <= size; i++)
+// Ap has to be filled by dense_count_nnz(). Every row is written
+// independently, so the rows are filled in parallel with OpenMP.
+template<typename T>
+void dense_to_csr(int size, T **Ad, int *Ap, int *Ai, T *Ax)
+{
+#pragma omp parallel for if (size >= 256)
+    for (int i = 0; i < size; i++)
     {
-        int temp = Ap[i];
-        Ap[i]  = last;
-        last   = temp;
+        int count = Ap[i];
+        for (int j = 0; j < size; j++)
+        {
+            if (std::abs(Ad[i][j]) > 1e-12)
+            {
+                Ai[count] = j;
+                Ax[count] = Ad[i][j];
+                count++;
+            }
+        }
     }
 }
 
+// Ap has to be filled by dense_count_nnz(..., true).
 template<typename T>
-void coo_to_csc(int size, int nnz, int *row, int *col, T *A, int *Ap, int *Ai, T *Ax)
+void dense_to_csc(int size, T **Ad, int *Ap, int *Ai, T *Ax)
 {
-    coo_to_csr(size, nnz, col, row, A, Ap, Ai, Ax);
+#pragma omp parallel for if (size >= 256)
+    for (int j = 0; j < size; j++)
+    {
+        int count = Ap[j];
+        for (int i = 0; i < size; i++)
+        {
+            if (std::abs(Ad[i][j]) > 1e-12)
+            {
+                Ai[count] = i;
+                Ax[count] = Ad[i][j];
+                count++;
+            }
+        }
+    }
 }
 
 template<typename T>
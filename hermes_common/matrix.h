@@ -16,6 +16,7 @@
 #include <string.h>
 #include <complex>
 #include <map>
+#include <algorithm>
 
 typedef std::complex<double> cplx;
 class Matrix;
@@ -322,6 +323,13 @@ public:
     void get_row_col_data(int *row, int *col, cplx *data);
     void get_row_col_data(int *row, int *col, double *data_real, double *data_imag);
 
+    // Fill the CSR/CSC arrays (Ap of length size+1, Ai and Ax of length
+    // nnz) directly from the sorted rows, in O(nnz) operations.
+    void get_csr(int *Ap, int *Ai, double *Ax);
+    void get_csr(int *Ap, int *Ai, cplx *Ax);
+    void get_csc(int *Ap, int *Ai, double *Ax);
+    void get_csc(int *Ap, int *Ai, cplx *Ax);
+
     virtual void copy_into(Matrix *m);
 
     inline virtual double get(int m, int n) { return A[m][n]; }
@@ -363,14 +371,15 @@ public:
         {
             for (int j = 0; j < this->size; j++)
             {
-                for (int j = 0; j < this->size; j++)
+                if (complex)
+                {
+                    if (std::abs(A_cplx[i][j]) > 1e-12)
+                        m->add(i, j, A_cplx[i][j]);
+                }
+                else
                 {
-                    if (complex)
-                        if (std::abs(A_cplx[i][j]) > 1e-12)
-                             m->add(i, j, A_cplx[i][j]);
-                    else
-                        if (fabs(A[i][j]) > 1e-12)
-                            m->add(i, j, A[i][j]);
+                    if (fabs(A[i][j]) > 1e-12)
+                        m->add(i, j, A[i][j]);
                 }
             }
         }
@@ -413,6 +422,11 @@ public:
     void add_from_coo(CooMatrix *m);
     void add_from_csc(CSCMatrix *m);
 
+    // Take over the arrays of 'm' (which is left empty) without copying
+    // them: the CSC arrays of A are the CSR arrays of A^T, so this
+    // matrix becomes the transpose of 'm'.
+    void take_transpose(CSCMatrix *m);
+
     virtual void add(int m, int n, double v)
     {
         _error("CSR matrix add() not implemented.");
@@ -440,6 +454,8 @@ public:
     inline cplx *get_Ax_cplx() { return this->Ax_cplx; }
 
 private:
+    friend class CSCMatrix;
+
     // number of non-zeros
     int nnz;
 
@@ -475,6 +491,10 @@ public:
     void add_from_coo(CooMatrix *m);
     void add_from_csr(CSRMatrix *m);
 
+    // Take over the arrays of 'm' (which is left empty) without copying
+    // them: this matrix becomes the transpose of 'm'.
+    void take_transpose(CSRMatrix *m);
+
     virtual void add(int m, int n, double v)
     {
         _error("CSC matrix add() not implemented.");
@@ -503,6 +523,8 @@ public:
     inline cplx *get_Ax_cplx() { return this->Ax_cplx; }
 
 private:
+    friend class CSRMatrix;
+
     // number of non-zeros
     int nnz;
 
@@ -513,12 +535,66 @@ private:
     int *Ai;
 };
 
+// **********************************************************************************************************
+
+// Banded matrix with 'kl' subdiagonals and 'ku' superdiagonals. Rows 
+// are stored with room for 'kl' extra superdiagonals, so that the LU
+// factorization with partial pivoting can be done in place in 
+// O(size*kl*(kl+ku)) operations. The optional permutation 'perm' 
+// maps the row/column indices passed to add(), get() and solve() to 
+// the rows/columns of the band (it is needed when the natural 
+// ordering of the unknowns is not banded).
+class BandMatrix : public Matrix
+{
+public:
+    BandMatrix(int size, int kl, int ku, int *perm = NULL);
+    ~BandMatrix();
+
+    virtual void free_data();
+    virtual void set_zero();
+
+    virtual void add(int m, int n, double v);
+    virtual double get(int m, int n);
+
+    virtual int get_nnz();
+    virtual void copy_into(Matrix *m);
+    virtual void times_vector(double* vec, double* result, int rank);
+
+    virtual void print();
+
+    // LU factorization with partial pivoting (overwrites the matrix)
+    void factorize();
+    // Solves A x = b using the factorization, b is overwritten by x.
+    // With n_rhs > 1, b holds n_rhs right-hand sides interleaved 
+    // (b[i*n_rhs + k] is the i-th entry of the k-th one), so that 
+    // all of them are eliminated together.
+    void solve(double *b, int n_rhs = 1);
+
+    inline bool is_factorized() { return this->factorized; }
+    inline int get_kl() { return this->kl; }
+    inline int get_ku() { return this->ku; }
+
+private:
+    int kl, ku;
+    int width;          // stored entries per row (2*kl + ku + 1)
+    double *band;       // band[i*width + j - i + kl] holds A(i, j)
+    int *piv;           // row interchanges of the factorization
+    int *perm;          // NULL or index -> band row/column
+    double *work;
+    int work_size;
+    bool factorized;
+
+    inline double &entry(int i, int j) { return band[i*width + j - i + kl]; }
+    // band row/column -> index (NULL without a permutation), delete[] by the caller
+    int *inverse_perm();
+};
+
 template<typename T>
-void dense_to_coo(int size, int nnz, T **Ad, int *row, int *col, T *A);
+int dense_count_nnz(int size, T **Ad, int *Ap, bool by_columns = false);
 template<typename T>
-void coo_to_csr(int size, int nnz, int *row, int *col, T *A, int *Ap, int *Ai, T *Ax);
+void dense_to_csr(int size, T **Ad, int *Ap, int *Ai, T *Ax);
 template<typename T>
-void coo_to_csc(int size, int nnz, int *row, int *col, T *A, int *Ap, int *Ai, T *Ax);
+void dense_to_csc(int size, T **Ad, int *Ap, int *Ai, T *Ax);
 template<typename T>
 void csr_to_csc(int size, int nnz, int *Arp, int *Ari, T *Arx, int *Acp, int *Aci, T *Acx);
 template<typename T>
@@ -17,7 +17,7 @@ bool CommonSolverNumPy::_solve(Matrix *mat, double *res)
     Python *p = new Python();
     p->push("m", c2py_CSRMatrix(&M));
     p->push("rhs", c2numpy_double_inplace(res, mat->get_size()));
-    p->exec("A = m.to_scipy_csr().todense()");
+    p->exec("A = m.to_scipy_csr().toarray()");
     p->exec("from numpy.linalg import solve");
     p->exec("x = solve(A, rhs)");
     double *x;
@@ -36,7 +36,7 @@ bool CommonSolverNumPy::_solve(Matrix *mat, cplx *res)
     Python *p = new Python();
     p->push("m", c2py_CSRMatrix(&M));
     p->push("rhs", c2numpy_double_complex_inplace(res, mat->get_size()));
-    p->exec("A = m.to_scipy_csr().todense()");
+    p->exec("A = m.to_scipy_csr().toarray()");
     p->exec("from numpy.linalg import solve");
     p->exec("x = solve(A, rhs)");
     cplx *x;
@@ -6,6 +6,8 @@
 #ifndef __HERMES_COMMON_SOLVERS_H
 #define __HERMES_COMMON_SOLVERS_H
 
+#include <vector>
+
 class Matrix;
 class Vector;
 
@@ -13,6 +15,8 @@ class Vector;
 class CommonSolver
 {
 public:
+    // solvers are deleted through this class (see create_direct_solver())
+    virtual ~CommonSolver() {}
     virtual bool _solve(Matrix *mat, double *res) = 0;
     virtual bool _solve(Matrix *mat, cplx *res) = 0;
     virtual bool solve(Matrix *mat, Vector *res);
@@ -66,6 +70,49 @@ inline void solve_linear_system_dense_lu(Matrix *mat, cplx *res)
     solver._solve(mat, res);
 }
 
+// c++ sparse lu - always available
+//
+// Left-looking sparse LU with threshold partial pivoting (preferring the
+// diagonal) and a reverse Cuthill-McKee fill-reducing ordering. Works
+// directly on CSC arrays (CooMatrix and CSRMatrix are converted once per
+// solve). The ordering is kept and reused as long as the sparsity pattern
+// does not change, e.g. during Newton iterations.
+class CommonSolverSparseLU : public CommonSolver
+{
+public:
+    CommonSolverSparseLU()
+    {
+        pivot_tolerance = 0.1;
+    }
+
+    bool _solve(Matrix *mat, double *res);
+    bool _solve(Matrix *mat, cplx *res);
+    inline void set_pivot_tolerance(double tol) { this->pivot_tolerance = tol; }
+
+private:
+    double pivot_tolerance;
+
+    // column ordering and the pattern it was computed for
+    std::vector<int> q;
+    std::vector<int> pattern_Ap, pattern_Ai;
+
+    void update_ordering(int size, int *Ap, int *Ai);
+};
+inline bool solve_linear_system_sparselu(Matrix *mat, double *res)
+{
+    CommonSolverSparseLU solver;
+    return solver._solve(mat, res);
+}
+inline bool solve_linear_system_sparselu(Matrix *mat, cplx *res)
+{
+    CommonSolverSparseLU solver;
+    return solver._solve(mat, res);
+}
+
+// the best direct solver the library was built with (UMFPACK if available,
+// the native sparse LU otherwise)
+CommonSolver *create_direct_solver();
+
 // c++ umfpack - optional
 class CommonSolverUmfpack : public CommonSolver
 {
@@ -85,13 +132,23 @@ inline void solve_linear_system_umfpack(Matrix *mat, cplx *res)
 }
 
 // c++ sparselib - optional
+//
+// The matrix structure (CSC) and the preconditioner are kept between calls.
+// The preconditioner is rebuilt only when the sparsity pattern changes or
+// when the number of iterations grows more than 'rebuild_ratio' times
+// compared to the solve right after the last rebuild (or the method does
+// not converge). With ilu_fill = 0 the preconditioner is ILU(0) from
+// SparseLib++, otherwise ILU(k) with the given level of fill.
+struct SparseLibCache;
 class CommonSolverSparseLib : public CommonSolver
 {
 public:
     enum CommonSolverSparseLibSolver
     {
         HERMES_CommonSolverSparseLibSolver_ConjugateGradientSquared,
-        CommonSolverSparseLibSolver_RichardsonIterativeRefinement
+        CommonSolverSparseLibSolver_RichardsonIterativeRefinement,
+        CommonSolverSparseLibSolver_GMRES,
+        CommonSolverSparseLibSolver_BiCGStab
     };
 
     CommonSolverSparseLib()
@@ -99,18 +156,46 @@ public:
         tolerance = 1e-8;
         maxiter = 1000;
         method = HERMES_CommonSolverSparseLibSolver_ConjugateGradientSquared;
+        restart = 30;
+        ilu_fill = 0;
+        rebuild_ratio = 2.0;
+        num_iters = 0;
+        num_factorizations = 0;
+        cache = NULL;
     }
+    ~CommonSolverSparseLib();
 
     bool _solve(Matrix *mat, double *res);
     bool _solve(Matrix *mat, cplx *res);
     inline void set_tolerance(double tolerance) { this->tolerance = tolerance; }
     inline void set_maxiter(int maxiter) { this->maxiter = maxiter; }
     inline void set_method(CommonSolverSparseLibSolver method) { this->method = method; }
+    // restart length of GMRES
+    inline void set_restart(int restart) { this->restart = restart; }
+    // level of fill of the ILU preconditioner (0 = ILU(0))
+    void set_ilu_fill(int level);
+    inline void set_rebuild_ratio(double ratio) { this->rebuild_ratio = ratio; }
+    // throw away the preconditioner, the next solve builds a new one
+    void reset_preconditioner();
+
+    // number of iterations of the last solve
+    inline int get_num_iters() { return num_iters; }
+    // number of times the preconditioner was built so far
+    inline int get_num_factorizations() { return num_factorizations; }
 
 private:
     double tolerance;
     int maxiter;
     CommonSolverSparseLibSolver method;
+    int restart;
+    int ilu_fill;
+    double rebuild_ratio;
+    int num_iters;
+    int num_factorizations;
+
+    SparseLibCache *cache;
+
+    int run_method(const double *rhs, double *x, int &iters);
 };
 inline void solve_linear_system_sparselib_cgs(Matrix *mat, double *res, double tolerance = 1e-8, int maxiter = 1000)
 {
@@ -9,6 +9,8 @@
 #include <coord_double.h>
 #include <compcol_double.h>
 #include <mvvd.h>
+#include <mvmd.h>
+#include <mvblasd.h>
 #include <ilupre_double.h>
 #include <bicg.h>
 #include <cg.h>
@@ -19,6 +21,248 @@
 #include <ir.h>
 #include <qmr.h>
 
+// Preconditioner interface for the IML++ templates.
+class SparseLibPreconditioner
+{
+public:
+    virtual ~SparseLibPreconditioner() {}
+    virtual VECTOR_double solve(const VECTOR_double &x) const = 0;
+    virtual VECTOR_double trans_solve(const VECTOR_double &x) const = 0;
+};
+
+// ILU(0) from SparseLib++
+class SparseLibILU0 : public SparseLibPreconditioner
+{
+public:
+    SparseLibILU0(const CompCol_Mat_double &A) : ilu(A) {}
+
+    VECTOR_double solve(const VECTOR_double &x) const { return ilu.solve(x); }
+    VECTOR_double trans_solve(const VECTOR_double &x) const { return ilu.trans_solve(x); }
+
+private:
+    CompCol_ILUPreconditioner_double ilu;
+};
+
+// ILU(k): incomplete LU with the fill-in limited by its level
+class SparseLibILUK : public SparseLibPreconditioner
+{
+public:
+    SparseLibILUK(int n, int *Ap, int *Ai, double *Ax, int level);
+
+    VECTOR_double solve(const VECTOR_double &x) const;
+    VECTOR_double trans_solve(const VECTOR_double &x) const;
+
+private:
+    int n;
+    // strictly lower part of L (unit diagonal), by rows
+    std::vector<int> Lp, Li;
+    std::vector<double> Lx;
+    // U by rows, the diagonal is the first entry of each row
+    std::vector<int> Up, Ui;
+    std::vector<double> Ux;
+};
+
+SparseLibILUK::SparseLibILUK(int n, int *Ap, int *Ai, double *Ax, int level) : n(n)
+{
+    // A by rows (column indices come out sorted)
+    int nnz = Ap[n];
+    std::vector<int> Rp(n + 1, 0), Ri(nnz);
+    std::vector<double> Rx(nnz);
+    for (int p = 0; p < nnz; p++) Rp[Ai[p] + 1]++;
+    for (int i = 0; i < n; i++) Rp[i + 1] += Rp[i];
+    std::vector<int> pos(Rp.begin(), Rp.end() - 1);
+    for (int j = 0; j < n; j++)
+        for (int p = Ap[j]; p < Ap[j + 1]; p++) {
+            int q = pos[Ai[p]]++;
+            Ri[q] = j;
+            Rx[q] = Ax[p];
+        }
+
+    const int NONE = -1;
+    std::vector<int> lev(n), next(n), where(n, NONE);
+    std::vector<double> w(n, 0.0);
+    std::vector<int> Ulev;                  // levels of the entries of U
+    Lp.assign(1, 0);
+    Up.assign(1, 0);
+
+    for (int i = 0; i < n; i++) {
+        // sorted linked list of the row pattern, starting with the pattern of A
+        // (diagonal always included)
+        int head = NONE, tail = NONE;
+        bool diag = false;
+        for (int p = Rp[i]; p < Rp[i + 1] || !diag; ) {
+            int j;
+            if (p < Rp[i + 1] && (diag || Ri[p] <= i)) j = Ri[p++];
+            else j = i;
+            if (j == i) {
+                if (diag) continue;
+                diag = true;
+            }
+
+            lev[j] = 0;
+            next[j] = NONE;
+            if (tail == NONE) head = j;
+            else next[tail] = j;
+            tail = j;
+            where[j] = i;
+        }
+
+        // symbolic elimination with levels
+        for (int k = head; k != NONE && k < i; k = next[k]) {
+            int last = k;
+            for (int p = Up[k] + 1; p < Up[k + 1]; p++) {
+                int j = Ui[p];
+                int l = lev[k] + Ulev[p] + 1;
+                if (where[j] == i) {
+                    if (l < lev[j]) lev[j] = l;
+                    last = j;
+                    continue;
+                }
+                if (l > level) continue;
+
+                // insert j into the list after 'last' (j > last)
+                while (next[last] != NONE && next[last] < j) last = next[last];
+                next[j] = next[last];
+                next[last] = j;
+                lev[j] = l;
+                where[j] = i;
+                last = j;
+            }
+        }
+
+        // numeric elimination on the pattern
+        for (int p = Rp[i]; p < Rp[i + 1]; p++) w[Ri[p]] = Rx[p];
+        for (int k = head; k != NONE && k < i; k = next[k]) {
+            double lik = w[k] / Ux[Up[k]];
+            w[k] = lik;
+            for (int p = Up[k] + 1; p < Up[k + 1]; p++)
+                if (where[Ui[p]] == i) w[Ui[p]] -= lik * Ux[p];
+        }
+
+        for (int j = head; j != NONE; j = next[j]) {
+            if (j < i) {
+                Li.push_back(j);
+                Lx.push_back(w[j]);
+            }
+            else {
+                double v = w[j];
+                if (j == i && v == 0.0) v = 1e-12;      // zero pivot
+                Ui.push_back(j);
+                Ux.push_back(v);
+                Ulev.push_back(lev[j]);
+            }
+            w[j] = 0.0;
+        }
+        Lp.push_back(Li.size());
+        Up.push_back(Ui.size());
+    }
+}
+
+VECTOR_double SparseLibILUK::solve(const VECTOR_double &x) const
+{
+    VECTOR_double y(x);
+    for (int i = 0; i < n; i++)
+        for (int p = Lp[i]; p < Lp[i + 1]; p++)
+            y(i) -= Lx[p] * y(Li[p]);
+    for (int i = n - 1; i >= 0; i--) {
+        for (int p = Up[i] + 1; p < Up[i + 1]; p++)
+            y(i) -= Ux[p] * y(Ui[p]);
+        y(i) /= Ux[Up[i]];
+    }
+    return y;
+}
+
+VECTOR_double SparseLibILUK::trans_solve(const VECTOR_double &x) const
+{
+    VECTOR_double y(x);
+    for (int i = 0; i < n; i++) {
+        y(i) /= Ux[Up[i]];
+        for (int p = Up[i] + 1; p < Up[i + 1]; p++)
+            y(Ui[p]) -= Ux[p] * y(i);
+    }
+    for (int i = n - 1; i >= 0; i--)
+        for (int p = Lp[i]; p < Lp[i + 1]; p++)
+            y(Li[p]) -= Lx[p] * y(i);
+    return y;
+}
+
+// What is kept between the calls
+struct SparseLibCache
+{
+    SparseLibCache() : A(NULL), M(NULL), build_iters(0) {}
+    ~SparseLibCache()
+    {
+        delete M;
+        delete A;
+    }
+
+    std::vector<int> Ap, Ai;        // pattern of A
+    CompCol_Mat_double *A;
+    SparseLibPreconditioner *M;
+    int build_iters;                // iterations of the solve right after the preconditioner was built
+};
+
+CommonSolverSparseLib::~CommonSolverSparseLib()
+{
+    delete cache;
+}
+
+void CommonSolverSparseLib::set_ilu_fill(int level)
+{
+    if (level != this->ilu_fill) reset_preconditioner();
+    this->ilu_fill = level;
+}
+
+void CommonSolverSparseLib::reset_preconditioner()
+{
+    if (cache != NULL) {
+        delete cache->M;
+        cache->M = NULL;
+    }
+}
+
+int CommonSolverSparseLib::run_method(const double *rhs, double *x, int &iters)
+{
+    int size = cache->A->dim(0);
+    VECTOR_double b(rhs, size);
+    const SparseLibPreconditioner &M = *cache->M;
+    VECTOR_double xv = M.solve(b);
+
+    // IML++ returns the number of iterations and the residual in these
+    iters = maxiter;
+    double tol = tolerance;
+
+    int result = -1;
+    switch (method)
+    {
+    case HERMES_CommonSolverSparseLibSolver_ConjugateGradientSquared:
+        result = CGS(*cache->A, xv, b, M, iters, tol);
+        break;
+    case CommonSolverSparseLibSolver_RichardsonIterativeRefinement:
+        result = IR(*cache->A, xv, b, M, iters, tol);
+        break;
+    case CommonSolverSparseLibSolver_GMRES:
+        {
+            int m = restart;
+            MATRIX_double H(m + 1, m, 0.0);
+            result = GMRES(*cache->A, xv, b, M, H, m, iters, tol);
+        }
+        break;
+    case CommonSolverSparseLibSolver_BiCGStab:
+        result = BiCGSTAB(*cache->A, xv, b, M, iters, tol);
+        break;
+    default:
+        _error("SparseLib++ error. Method is not defined.");
+    }
+
+    for (int i = 0; i < size; i++)
+        x[i] = xv(i);
+
+    if (result == 0)
+        printf("SparseLib++ solver: iters: %i, tol: %e\n", iters, tol);
+    return result;
+}
+
 bool CommonSolverSparseLib::_solve(Matrix *mat, double *res)
 {
     printf("SparseLib++ solver\n");
@@ -38,47 +282,67 @@ bool CommonSolverSparseLib::_solve(Matrix *mat, double *res)
 
     int nnz = Acsc->get_nnz();
     int size = Acsc->get_size();
+    int *Ap = Acsc->get_Ap();
+    int *Ai = Acsc->get_Ai();
+    double *Ax = Acsc->get_Ax();
 
-    CompCol_Mat_double Acc = CompCol_Mat_double(size, size, nnz,
-                                                Acsc->get_Ax(), Acsc->get_Ai(), Acsc->get_Ap());
-
-    // rhs
-    VECTOR_double rhs(res, size);
-
-    // preconditioner
-    CompCol_ILUPreconditioner_double ILU(Acc);
-    VECTOR_double xv = ILU.solve(rhs);
-
-    // method
-    int result = -1;
-    switch (method)
+    // keep the structure if the pattern did not change, just update the values
+    if (cache == NULL) cache = new SparseLibCache();
+    if (cache->A != NULL && (int) cache->Ai.size() == nnz && (int) cache->Ap.size() == size + 1 &&
+        std::equal(Ap, Ap + size + 1, cache->Ap.begin()) &&
+        std::equal(Ai, Ai + nnz, cache->Ai.begin()))
     {
-    case HERMES_CommonSolverSparseLibSolver_ConjugateGradientSquared:
-        result = CGS(Acc, xv, rhs, ILU, maxiter, tolerance);
-        break;
-    case CommonSolverSparseLibSolver_RichardsonIterativeRefinement:
-        result = IR(Acc, xv, rhs, ILU, maxiter, tolerance);
-        break;
-    default:
-        _error("SparseLib++ error. Method is not defined.");
+        for (int i = 0; i < nnz; i++)
+            cache->A->val(i) = Ax[i];
     }
-
-    if (result == 0)
-        printf("SparseLib++ solver: maxiter: %i, tol: %e\n", maxiter, tolerance);
     else
-        _error("SparseLib++ error.");
+    {
+        delete cache->M;
+        cache->M = NULL;
+        delete cache->A;
+        cache->A = new CompCol_Mat_double(size, size, nnz, Ax, Ai, Ap);
+        cache->Ap.assign(Ap, Ap + size + 1);
+        cache->Ai.assign(Ai, Ai + nnz);
+    }
+
+    std::vector<double> rhs(res, res + size);
+    bool fresh = false;
+    for (;;)
+    {
+        if (cache->M == NULL)
+        {
+            if (ilu_fill > 0)
+                cache->M = new SparseLibILUK(size, Ap, Ai, Ax, ilu_fill);
+            else
+                cache->M = new SparseLibILU0(*cache->A);
+            num_factorizations++;
+            fresh = true;
+        }
 
-    double *x;
-    x = (double*) malloc(size * sizeof(double));
+        int result = run_method(&rhs[0], res, num_iters);
+        if (fresh) cache->build_iters = num_iters;
 
-    for (int i = 0 ; i < xv.size() ; i++)
-        x[i] = xv(i);
+        // an old preconditioner that does not converge any more is replaced and
+        // the solve repeated
+        if (result != 0 && !fresh)
+        {
+            reset_preconditioner();
+            continue;
+        }
+        if (result != 0)
+            _error("SparseLib++ error.");
 
-    memcpy(res, x, size*sizeof(double));
-    delete[] x;
+        // the solution is kept even if it took too many iterations, only the next
+        // call builds a new preconditioner
+        if (!fresh && num_iters > rebuild_ratio * std::max(cache->build_iters, 1))
+            reset_preconditioner();
+        break;
+    }
 
     if (!dynamic_cast<CSCMatrix*>(mat))
         delete Acsc;
+
+    return true;
 }
 
 bool CommonSolverSparseLib::_solve(Matrix *mat, cplx *res)
@@ -0,0 +1,257 @@
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Distributed under the terms of the BSD license (see the LICENSE
+// file for the exact terms).
+// Email: hermes1d@googlegroups.com, home page: http://hpfem.org/
+
+#include "matrix.h"
+#include "solvers.h"
+
+#include <algorithm>
+
+// Reverse Cuthill-McKee ordering of the graph of A + A^T.
+static void rcm_ordering(int n, int *Ap, int *Ai, std::vector<int> &perm)
+{
+    // adjacency of A + A^T without the diagonal
+    std::vector<int> deg(n, 0);
+    for (int j = 0; j < n; j++)
+        for (int p = Ap[j]; p < Ap[j + 1]; p++)
+            if (Ai[p] != j) {
+                deg[Ai[p]]++;
+                deg[j]++;
+            }
+    std::vector<int> adj_p(n + 1, 0);
+    for (int i = 0; i < n; i++) adj_p[i + 1] = adj_p[i] + deg[i];
+    std::vector<int> adj(adj_p[n]);
+    std::vector<int> pos(adj_p.begin(), adj_p.end() - 1);
+    for (int j = 0; j < n; j++)
+        for (int p = Ap[j]; p < Ap[j + 1]; p++)
+            if (Ai[p] != j) {
+                adj[pos[Ai[p]]++] = j;
+                adj[pos[j]++] = Ai[p];
+            }
+
+    // duplicate edges (from symmetric entries) do not change the result, only the degrees
+    // are a bit off, which does not matter for a heuristic
+    std::vector<int> order;
+    order.reserve(n);
+    std::vector<char> visited(n, 0);
+    std::vector<int> nbrs;
+    for (;;) {
+        // start a new component from its vertex of minimal degree
+        int start = -1;
+        for (int i = 0; i < n; i++)
+            if (!visited[i] && (start == -1 || deg[i] < deg[start])) start = i;
+        if (start == -1) break;
+
+        size_t head = order.size();
+        order.push_back(start);
+        visited[start] = 1;
+        while (head < order.size()) {
+            int v = order[head++];
+            nbrs.clear();
+            for (int p = adj_p[v]; p < adj_p[v + 1]; p++)
+                if (!visited[adj[p]]) {
+                    visited[adj[p]] = 1;
+                    nbrs.push_back(adj[p]);
+                }
+            for (size_t a = 1; a < nbrs.size(); a++) {
+                // insertion sort by degree, neighbor lists are short
+                int w = nbrs[a];
+                size_t b = a;
+                for (; b > 0 && deg[nbrs[b - 1]] > deg[w]; b--) nbrs[b] = nbrs[b - 1];
+                nbrs[b] = w;
+            }
+            order.insert(order.end(), nbrs.begin(), nbrs.end());
+        }
+    }
+
+    perm.resize(n);
+    for (int i = 0; i < n; i++) perm[i] = order[n - 1 - i];
+}
+
+void CommonSolverSparseLU::update_ordering(int size, int *Ap, int *Ai)
+{
+    int nnz = Ap[size];
+    if ((int) q.size() == size && (int) pattern_Ai.size() == nnz &&
+        std::equal(Ap, Ap + size + 1, pattern_Ap.begin()) &&
+        std::equal(Ai, Ai + nnz, pattern_Ai.begin()))
+        return;
+
+    rcm_ordering(size, Ap, Ai, q);
+    pattern_Ap.assign(Ap, Ap + size + 1);
+    pattern_Ai.assign(Ai, Ai + nnz);
+}
+
+// Gilbert-Peierls left-looking LU factorization P A Q = L U followed by the solve.
+// The right-hand side comes in 'x' and the solution leaves in it.
+template<typename T>
+static bool sparse_lu_solve(int n, int *Ap, int *Ai, T *Ax, const std::vector<int> &q,
+                            double tol, T *x)
+{
+    std::vector<int> Lp(n + 1), Up(n + 1);
+    std::vector<int> Li, Ui;
+    std::vector<T> Lx, Ux;
+    Li.reserve(4 * Ap[n] + n);
+    Lx.reserve(4 * Ap[n] + n);
+    Ui.reserve(4 * Ap[n] + n);
+    Ux.reserve(4 * Ap[n] + n);
+
+    std::vector<int> pinv(n, -1);          // row -> pivot step
+    std::vector<int> xi(n), stack(n), pstack(n);
+    std::vector<char> mark(n, 0);
+    std::vector<T> w(n, T(0));
+
+    for (int k = 0; k < n; k++) {
+        Lp[k] = Li.size();
+        Up[k] = Ui.size();
+        int col = q[k];
+
+        // nonzero pattern of L \ A(:, col) by depth first search in the graph of L
+        int top = n;
+        for (int p = Ap[col]; p < Ap[col + 1]; p++) {
+            if (mark[Ai[p]]) continue;
+            int head = 0;
+            stack[0] = Ai[p];
+            while (head >= 0) {
+                int j = stack[head];
+                int jj = pinv[j];
+                if (!mark[j]) {
+                    mark[j] = 1;
+                    pstack[head] = (jj < 0) ? 0 : Lp[jj];
+                }
+                bool done = true;
+                int p2 = (jj < 0) ? 0 : Lp[jj + 1];
+                for (int r = pstack[head]; r < p2; r++) {
+                    int i = Li[r];
+                    if (mark[i]) continue;
+                    pstack[head] = r;
+                    stack[++head] = i;
+                    done = false;
+                    break;
+                }
+                if (done) {
+                    head--;
+                    xi[--top] = j;
+                }
+            }
+        }
+        for (int p = top; p < n; p++) mark[xi[p]] = 0;
+
+        // numerical values by the sparse triangular solve
+        for (int p = Ap[col]; p < Ap[col + 1]; p++) w[Ai[p]] += Ax[p];
+        for (int px = top; px < n; px++) {
+            int j = xi[px];
+            int jj = pinv[j];
+            if (jj < 0) continue;
+            T wj = w[j];
+            for (int p = Lp[jj] + 1; p < Lp[jj + 1]; p++) w[Li[p]] -= Lx[p] * wj;
+        }
+
+        // choose the pivot, prefer the diagonal
+        int ipiv = -1;
+        double a = -1;
+        for (int px = top; px < n; px++) {
+            int i = xi[px];
+            if (pinv[i] < 0) {
+                double t = std::abs(w[i]);
+                if (t > a) {
+                    a = t;
+                    ipiv = i;
+                }
+            }
+            else {
+                Ui.push_back(pinv[i]);
+                Ux.push_back(w[i]);
+            }
+        }
+        if (ipiv == -1 || a <= 0) return false;       // singular
+        if (pinv[col] < 0 && std::abs(w[col]) >= a * tol) ipiv = col;
+
+        T pivot = w[ipiv];
+        Ui.push_back(k);
+        Ux.push_back(pivot);
+        pinv[ipiv] = k;
+        Li.push_back(ipiv);
+        Lx.push_back(T(1));
+        for (int px = top; px < n; px++) {
+            int i = xi[px];
+            if (pinv[i] < 0) {
+                Li.push_back(i);
+                Lx.push_back(w[i] / pivot);
+            }
+            w[i] = T(0);
+        }
+    }
+    Lp[n] = Li.size();
+    Up[n] = Ui.size();
+    for (size_t p = 0; p < Li.size(); p++) Li[p] = pinv[Li[p]];
+
+    // solve L U y = P b, x = Q y
+    for (int i = 0; i < n; i++) w[pinv[i]] = x[i];
+    for (int j = 0; j < n; j++)
+        for (int p = Lp[j] + 1; p < Lp[j + 1]; p++)
+            w[Li[p]] -= Lx[p] * w[j];
+    for (int j = n - 1; j >= 0; j--) {
+        w[j] /= Ux[Up[j + 1] - 1];
+        for (int p = Up[j]; p < Up[j + 1] - 1; p++)
+            w[Ui[p]] -= Ux[p] * w[j];
+    }
+    for (int k = 0; k < n; k++) x[q[k]] = w[k];
+
+    return true;
+}
+
+static CSCMatrix *to_csc(Matrix *mat)
+{
+    if (CSCMatrix *mcsc = dynamic_cast<CSCMatrix*>(mat))
+        return mcsc;
+    return new CSCMatrix(mat);
+}
+
+bool CommonSolverSparseLU::_solve(Matrix *mat, double *res)
+{
+    CSCMatrix *Acsc = to_csc(mat);
+    int size = Acsc->get_size();
+
+    update_ordering(size, Acsc->get_Ap(), Acsc->get_Ai());
+    bool ok = sparse_lu_solve<double>(size, Acsc->get_Ap(), Acsc->get_Ai(), Acsc->get_Ax(),
+                                      q, pivot_tolerance, res);
+
+    if (Acsc != mat)
+        delete Acsc;
+    return ok;
+}
+
+bool CommonSolverSparseLU::_solve(Matrix *mat, cplx *res)
+{
+    CSCMatrix *Acsc = to_csc(mat);
+    int size = Acsc->get_size();
+
+    update_ordering(size, Acsc->get_Ap(), Acsc->get_Ai());
+    bool ok;
+    if (Acsc->is_complex())
+        ok = sparse_lu_solve<cplx>(size, Acsc->get_Ap(), Acsc->get_Ai(), Acsc->get_Ax_cplx(),
+                                   q, pivot_tolerance, res);
+    else {
+        // real matrix, complex right-hand side
+        int nnz = Acsc->get_nnz();
+        cplx *Ax = new cplx[nnz];
+        for (int i = 0; i < nnz; i++) Ax[i] = Acsc->get_Ax()[i];
+        ok = sparse_lu_solve<cplx>(size, Acsc->get_Ap(), Acsc->get_Ai(), Ax,
+                                   q, pivot_tolerance, res);
+        delete [] Ax;
+    }
+
+    if (Acsc != mat)
+        delete Acsc;
+    return ok;
+}
+
+CommonSolver *create_direct_solver()
+{
+#ifdef COMMON_WITH_UMFPACK
+    return new CommonSolverUmfpack();
+#else
+    return new CommonSolverSparseLU();
+#endif
+}
@@ -103,11 +103,89 @@ void test_matrix4()
     // convert to CSR and CSC
     CSRMatrix n1(&m);
     n1.print();
-    /*
-    FIXME: DenseMatrix -> CSCMatrix segfaults...:
     CSCMatrix n2(&m);
     n2.print();
-    */
+}
+
+// checks that all the conversion paths give the same CSR/CSC arrays
+void test_matrix6()
+{
+    // (i, j) -> value, with an empty row 2 and an empty column 3
+    int n = 6;
+    int row[] = {0, 0, 1, 3, 3, 4, 5, 5, 1};
+    int col[] = {0, 4, 1, 2, 0, 5, 1, 4, 0};
+    double val[] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int nnz = 9;
+
+    CooMatrix coo(n);
+    DenseMatrix dense(n);
+    for (int k = 0; k < nnz; k++)
+    {
+        coo.add(row[k], col[k], val[k]);
+        dense.add(row[k], col[k], val[k]);
+    }
+
+    CSRMatrix csr_coo(&coo), csr_dense(&dense);
+    CSCMatrix csc_coo(&coo), csc_dense(&dense), csc_csr(&csr_coo);
+    _assert(csr_coo.get_nnz() == nnz && csr_dense.get_nnz() == nnz);
+    _assert(csc_coo.get_nnz() == nnz && csc_dense.get_nnz() == nnz);
+    _assert(dense.get_nnz() == nnz);
+    for (int i = 0; i <= n; i++)
+    {
+        _assert(csr_coo.get_Ap()[i] == csr_dense.get_Ap()[i]);
+        _assert(csc_coo.get_Ap()[i] == csc_dense.get_Ap()[i]);
+        _assert(csc_coo.get_Ap()[i] == csc_csr.get_Ap()[i]);
+    }
+    for (int k = 0; k < nnz; k++)
+    {
+        _assert(csr_coo.get_Ai()[k] == csr_dense.get_Ai()[k]);
+        _assert(csr_coo.get_Ax()[k] == csr_dense.get_Ax()[k]);
+        _assert(csc_coo.get_Ai()[k] == csc_dense.get_Ai()[k]);
+        _assert(csc_coo.get_Ax()[k] == csc_dense.get_Ax()[k]);
+        _assert(csc_coo.get_Ai()[k] == csc_csr.get_Ai()[k]);
+        _assert(csc_coo.get_Ax()[k] == csc_csr.get_Ax()[k]);
+    }
+    for (int i = 0; i < n; i++)
+        for (int k = csr_coo.get_Ap()[i]; k < csr_coo.get_Ap()[i+1]; k++)
+            _assert(dense.get(i, csr_coo.get_Ai()[k]) == csr_coo.get_Ax()[k]);
+
+    // COO -> dense and dense -> COO
+    DenseMatrix dense2(&coo);
+    CooMatrix coo2(n);
+    dense.copy_into(&coo2);
+    _assert(coo2.get_nnz() == nnz);
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            _assert(dense2.get(i, j) == dense.get(i, j));
+
+    // the CSR arrays of A are the CSC arrays of A^T
+    CSCMatrix t(n);
+    t.take_transpose(&csr_coo);
+    _assert(csr_coo.get_nnz() == 0 && csr_coo.get_Ap() == NULL);
+    for (int k = 0; k < nnz; k++)
+        _assert(t.get_Ai()[k] == csr_dense.get_Ai()[k]);
+    CSRMatrix tt(n);
+    tt.take_transpose(&t);
+    _assert(tt.get_nnz() == nnz && t.get_Ap() == NULL);
+    for (int k = 0; k < nnz; k++)
+        _assert(tt.get_Ax()[k] == csr_dense.get_Ax()[k]);
+
+    // complex
+    CooMatrix coo_c(n, true);
+    DenseMatrix dense_c(n, true);
+    for (int k = 0; k < nnz; k++)
+    {
+        coo_c.add(row[k], col[k], cplx(val[k], -val[k]));
+        dense_c.add(row[k], col[k], cplx(val[k], -val[k]));
+    }
+    CSRMatrix csr_c(&dense_c);
+    CSCMatrix csc_c(&coo_c), csc_dense_c(&dense_c);
+    _assert(csr_c.is_complex() && csr_c.get_nnz() == nnz);
+    for (int k = 0; k < nnz; k++)
+    {
+        _assert(csc_c.get_Ai()[k] == csc_dense_c.get_Ai()[k]);
+        _assert(csc_c.get_Ax_cplx()[k] == csc_dense_c.get_Ax_cplx()[k]);
+    }
 }
 
 #include "python_api.h"
@@ -143,6 +221,7 @@ int main(int argc, char* argv[])
         test_matrix3();
         test_matrix4();
         test_matrix5();
+        test_matrix6();
 
         return ERROR_SUCCESS;
     } catch(std::exception const &ex) {
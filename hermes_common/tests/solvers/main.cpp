@@ -342,6 +342,151 @@ void test_solver_umfpack_imag()
     _assert(fabs(res[1].imag() - (-0.25)) < EPS);
 }
 
+void test_solver_sparselu_real()
+{
+    CooMatrix A(5);
+    A.add(0, 0, 2);
+    A.add(0, 1, 3);
+    A.add(1, 0, 3);
+    A.add(1, 2, 4);
+    A.add(1, 4, 6);
+    A.add(2, 1, -1);
+    A.add(2, 2, -3);
+    A.add(2, 3, 2);
+    A.add(3, 2, 1);
+    A.add(4, 1, 4);
+    A.add(4, 2, 2);
+    A.add(4, 4, 1);
+
+    double res[5] = {8., 45., -3., 3., 19.};
+    _assert(solve_linear_system_sparselu(&A, res));
+    _assert(fabs(res[0] - 1.) < EPS);
+    _assert(fabs(res[1] - 2.) < EPS);
+    _assert(fabs(res[2] - 3.) < EPS);
+    _assert(fabs(res[3] - 4.) < EPS);
+    _assert(fabs(res[4] - 5.) < EPS);
+
+    // the same solver again (reuses the ordering)
+    CommonSolverSparseLU solver;
+    CSCMatrix B(&A);
+    for (int i = 0; i < 2; i++) {
+        double res2[5] = {8., 45., -3., 3., 19.};
+        _assert(solver._solve(&B, res2));
+        for (int j = 0; j < 5; j++)
+            _assert(fabs(res2[j] - (j + 1)) < EPS);
+    }
+}
+
+void test_solver_sparselu_imag()
+{
+    CooMatrix A(2, true);
+    A.add(0, 0, cplx(1, 1));
+    A.add(0, 1, cplx(2, 2));
+    A.add(1, 0, cplx(3, 3));
+    A.add(1, 1, cplx(4, 4));
+
+    cplx res[2];
+    res[0] = cplx(2, 1);
+    res[1] = cplx(2, 2);
+    _assert(solve_linear_system_sparselu(&A, res));
+    _assert(fabs(res[0].real() - (-1)) < EPS);
+    _assert(fabs(res[1].real() - 1.25) < EPS);
+    _assert(fabs(res[0].imag() - 1.) < EPS);
+    _assert(fabs(res[1].imag() - (-0.75)) < EPS);
+}
+
+void test_solver_sparselu_laplace()
+{
+    // 5-point Laplacian on a 20x20 grid with a nonsymmetric convection term,
+    // compared to the dense LU
+    int m = 20, n = m * m;
+    CooMatrix A(n);
+    for (int i = 0; i < m; i++)
+        for (int j = 0; j < m; j++) {
+            int k = i * m + j;
+            A.add(k, k, 4);
+            if (i > 0) A.add(k, k - m, -1.2);
+            if (i < m - 1) A.add(k, k + m, -0.8);
+            if (j > 0) A.add(k, k - 1, -1);
+            if (j < m - 1) A.add(k, k + 1, -1);
+        }
+
+    double *res1 = new double[n];
+    double *res2 = new double[n];
+    for (int i = 0; i < n; i++) res1[i] = res2[i] = sin(i);
+
+    _assert(solve_linear_system_sparselu(&A, res1));
+    solve_linear_system_dense_lu(&A, res2);
+    for (int i = 0; i < n; i++)
+        _assert(fabs(res1[i] - res2[i]) < 1e-10);
+
+    delete [] res1;
+    delete [] res2;
+}
+
+void test_band_matrix()
+{
+    // tridiagonal nonsymmetric matrix whose unknowns are numbered in
+    // reverse order, with a zero diagonal entry that requires pivoting
+    int n = 50;
+    int *perm = new int[n];
+    for (int i = 0; i < n; i++) perm[i] = n - 1 - i;
+    BandMatrix B(n, 1, 1, perm);
+    CooMatrix A(n);
+    for (int k = 0; k < n; k++) {
+        int i = perm[k];
+        double d = (k == 10) ? 0 : 3;
+        A.add(i, i, d); B.add(i, i, d);
+        if (k > 0) { A.add(i, perm[k - 1], -1.5); B.add(i, perm[k - 1], -1.5); }
+        if (k < n - 1) { A.add(i, perm[k + 1], -0.5); B.add(i, perm[k + 1], -0.5); }
+    }
+    _assert(B.get_nnz() == 3*n - 3);
+    _assert(B.get(perm[10], perm[11]) == -0.5);
+    _assert(B.get(0, 5) == 0);
+
+    CooMatrix C(n);
+    B.copy_into(&C);
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            _assert(C.get(i, j) == A.get(i, j));
+
+    double *res1 = new double[n];
+    double *res2 = new double[n];
+    double *prod = new double[n];
+    for (int i = 0; i < n; i++) res1[i] = sin(i);
+    B.times_vector(res1, prod, n);
+    A.times_vector(res1, res2, n);
+    for (int i = 0; i < n; i++)
+        _assert(fabs(prod[i] - res2[i]) < EPS);
+
+    for (int i = 0; i < n; i++) res1[i] = res2[i] = cos(i);
+    B.solve(res1);
+    solve_linear_system_dense_lu(&A, res2);
+    for (int i = 0; i < n; i++)
+        _assert(fabs(res1[i] - res2[i]) < 1e-10);
+
+    // three interleaved right-hand sides, the second one is cos(i)
+    double *res3 = new double[3*n];
+    for (int i = 0; i < n; i++) {
+        res3[3*i] = 1;
+        res3[3*i + 1] = cos(i);
+        res3[3*i + 2] = i;
+    }
+    B.solve(res3, 3);
+    for (int i = 0; i < n; i++)
+        _assert(fabs(res3[3*i + 1] - res2[i]) < 1e-10);
+    for (int i = 0; i < n; i++) res1[i] = i;
+    B.solve(res1);
+    for (int i = 0; i < n; i++)
+        _assert(fabs(res3[3*i + 2] - res1[i]) < 1e-10);
+    delete [] res3;
+
+    delete [] perm;
+    delete [] res1;
+    delete [] res2;
+    delete [] prod;
+}
+
 void test_solver_sparselib_cgs()
 {
     CooMatrix A(5);
@@ -392,6 +537,114 @@ void test_solver_sparselib_ir()
     _assert(fabs(res[4] - 5.65306122448980) < EPS);
 }
 
+void test_solver_sparselib_gmres_bicgstab()
+{
+    CommonSolverSparseLib::CommonSolverSparseLibSolver methods[2] = {
+        CommonSolverSparseLib::CommonSolverSparseLibSolver_GMRES,
+        CommonSolverSparseLib::CommonSolverSparseLibSolver_BiCGStab
+    };
+    for (int m = 0; m < 2; m++) {
+        CooMatrix A(5);
+        A.add(0, 0, 2);
+        A.add(0, 1, 3);
+        A.add(1, 0, 3);
+        A.add(1, 2, 4);
+        A.add(1, 4, 6);
+        A.add(2, 1, -1);
+        A.add(2, 2, -3);
+        A.add(2, 3, 2);
+        A.add(3, 2, 1);
+        A.add(4, 1, 4);
+        A.add(4, 2, 2);
+        A.add(4, 4, 1);
+
+        double res[5] = {8., 45., -3., 3., 19.};
+        CommonSolverSparseLib solver;
+        solver.set_method(methods[m]);
+        solver.set_tolerance(1e-14);
+        solver._solve(&A, res);
+        _assert(fabs(res[0] - 1.) < EPS);
+        _assert(fabs(res[1] - 2.) < EPS);
+        _assert(fabs(res[2] - 3.) < EPS);
+        _assert(fabs(res[3] - 4.) < EPS);
+        _assert(fabs(res[4] - 5.) < EPS);
+    }
+}
+
+static void convection_diffusion_grid(CooMatrix *A, int m, double c)
+{
+    for (int i = 0; i < m; i++)
+        for (int j = 0; j < m; j++) {
+            int k = i * m + j;
+            A->add(k, k, 4 + c);
+            if (i > 0) A->add(k, k - m, -1.2);
+            if (i < m - 1) A->add(k, k + m, -0.8);
+            if (j > 0) A->add(k, k - 1, -1 - c);
+            if (j < m - 1) A->add(k, k + 1, -1);
+        }
+}
+
+void test_solver_sparselib_reuse()
+{
+    // ILU(1) on a convection-diffusion grid; the second solve with slightly
+    // changed values reuses the structure and the preconditioner
+    int m = 20, n = m * m;
+    CommonSolverSparseLib solver;
+    solver.set_method(CommonSolverSparseLib::CommonSolverSparseLibSolver_GMRES);
+    solver.set_tolerance(1e-12);
+    solver.set_ilu_fill(1);
+
+    double *res1 = new double[n];
+    double *res2 = new double[n];
+    for (int step = 0; step < 3; step++) {
+        CooMatrix A(n);
+        convection_diffusion_grid(&A, m, 0.1 * step);
+
+        for (int i = 0; i < n; i++) res1[i] = res2[i] = sin(i);
+        solver._solve(&A, res1);
+        solve_linear_system_dense_lu(&A, res2);
+        for (int i = 0; i < n; i++)
+            _assert(fabs(res1[i] - res2[i]) < 1e-8);
+        _assert(solver.get_num_iters() > 0);
+        // the preconditioner is built by the first solve only
+        _assert(solver.get_num_factorizations() == 1);
+    }
+
+    // a new pattern needs a new preconditioner
+    CooMatrix B(n);
+    for (int k = 0; k < n; k++) {
+        B.add(k, k, 4);
+        if (k > 0) B.add(k, k - 1, -1);
+        if (k < n - 1) B.add(k, k + 1, -1);
+    }
+    for (int i = 0; i < n; i++) res1[i] = res2[i] = sin(i);
+    solver._solve(&B, res1);
+    solve_linear_system_dense_lu(&B, res2);
+    for (int i = 0; i < n; i++)
+        _assert(fabs(res1[i] - res2[i]) < 1e-8);
+    _assert(solver.get_num_factorizations() == 2);
+
+    // a solve that converges too slowly is kept, only the next one rebuilds
+    // the preconditioner
+    CooMatrix C(n);
+    convection_diffusion_grid(&C, m, 0.3);
+    solver.set_rebuild_ratio(0.0);
+    for (int step = 0; step < 2; step++) {
+        for (int i = 0; i < n; i++) res1[i] = res2[i] = sin(i);
+        solver._solve(&C, res1);
+        solve_linear_system_dense_lu(&C, res2);
+        for (int i = 0; i < n; i++)
+            _assert(fabs(res1[i] - res2[i]) < 1e-8);
+    }
+    _assert(solver.get_num_factorizations() == 3);
+    for (int i = 0; i < n; i++) res1[i] = sin(i);
+    solver._solve(&C, res1);
+    _assert(solver.get_num_factorizations() == 4);
+
+    delete [] res1;
+    delete [] res2;
+}
+
 void test_solver_superlu()
 {
     CooMatrix A(5);
@@ -423,11 +676,17 @@ int main(int argc, char* argv[])
         // SparseLib++
         test_solver_sparselib_cgs();
         test_solver_sparselib_ir();
+        test_solver_sparselib_gmres_bicgstab();
+        test_solver_sparselib_reuse();
 
         // Hermes Common
         test_solver_dense_lu1();
         test_solver_dense_lu2();
         test_solver_cg();
+        test_solver_sparselu_real();
+        test_solver_sparselu_imag();
+        test_solver_sparselu_laplace();
+        test_band_matrix();
 
         // NumPy + SciPy
 #ifdef COMMON_WITH_SCIPY